@@ -55,37 +55,151 @@ typedef struct atr_s {
 } atr_t;
 
 const char *getAtrInfo(const char *atr_str);
+int atr_selftest(void);
 
 // atr_t array is expected to be NULL terminated
 const static atr_t AtrTable[] = {
-    { "3BDF18FFC080B1FE751F033078464646462026204963656D616E1D", "Cardhelper by 0xFFFF and Iceman" },
-    { "3B90969181B1FE551FC7D4", "IClass SE Processor (Other) https://www.hidglobal.com/products/embedded-modules/iclass-se/sio-processor"},
 """
 
+# ours, ahead of the pcsc-tools list
+EXTRA_ATRS = [
+    ("3BDF18FFC080B1FE751F033078464646462026204963656D616E1D", "Cardhelper by 0xFFFF and Iceman"),
+    ("3B90969181B1FE551FC7D4", "IClass SE Processor (Other) https://www.hidglobal.com/products/embedded-modules/iclass-se/sio-processor"),
+]
+
 C_FOOTER="""    {NULL, "n/a"}
 };
 
 #endif
 """
 
+C_INDEX_HEADER="""//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// *DO NOT EDIT MANUALLY*
+// Autogenerated with atr_scrap_pcsctools.py
+//-----------------------------------------------------------------------------
+// Lookup index over AtrTable, only included by atrs.c
+//
+// AtrExact    entries without wildcards, ordered by length then bytes
+// AtrPattern  entries with wildcards, ordered by length, later table entries
+//             first. Each position has a set of allowed characters in
+//             AtrPatternSets, bit n for hex digit n, bit 16 for any other
+//             character. '.' allows all of them.
+//             Patterns with [..] or '*' are left out, the table scan always
+//             compared those characters literally so they never matched.
+//
+// ATR_INDEX_TABLE_LEN is the length of the AtrTable the index was built from
+//-----------------------------------------------------------------------------
+#ifndef ATRS_INDEX_H__
+
+#define ATRS_INDEX_H__
+#include <stdint.h>
+
+typedef struct atr_pattern_s {
+    uint16_t index;
+    uint16_t len;
+    uint32_t sets;
+} atr_pattern_t;
+
+"""
+
+C_INDEX_FOOTER="""
+#endif
+"""
+
+HEX = '0123456789ABCDEF'
+ANY = 0x1FFFF
+
+
+def atr_sets(atr):
+    """allowed characters per position, None for patterns we do not index"""
+    sets = []
+    for c in atr:
+        if c in HEX:
+            sets.append(1 << HEX.index(c))
+        elif c == '.':
+            sets.append(ANY)
+        else:
+            return None
+    return sets
+
+
+def write_index(f, atrs):
+    exact = [i for i, (atr, _) in enumerate(atrs) if all(c in HEX for c in atr)]
+    exact.sort(key=lambda i: (len(atrs[i][0]), atrs[i][0], i))
+
+    patterns = []
+    for i, (atr, _) in enumerate(atrs):
+        if all(c in HEX for c in atr):
+            continue
+        sets = atr_sets(atr)
+        if sets is not None:
+            patterns.append((i, sets))
+    patterns.sort(key=lambda p: (len(p[1]), -p[0]))
+
+    f.write(C_INDEX_HEADER)
+    # AtrTable has a terminating entry on top of the atrs
+    f.write(f'#define ATR_INDEX_TABLE_LEN {len(atrs) + 1}\n\n')
+    f.write('static const uint16_t AtrExact[] = {\n')
+    for k in range(0, len(exact), 12):
+        f.write('    ' + ' '.join(f'{i},' for i in exact[k:k + 12]) + '\n')
+    f.write('};\n\n')
+
+    f.write('static const atr_pattern_t AtrPattern[] = {\n')
+    offset = 0
+    for i, sets in patterns:
+        f.write(f'    {{ {i}, {len(sets)}, {offset} }},\n')
+        offset += len(sets)
+    f.write('};\n\n')
+
+    f.write('static const uint32_t AtrPatternSets[] = {\n')
+    for i, sets in patterns:
+        f.write('    ' + ' '.join(f'0x{s:05X},' for s in sets) + '\n')
+    f.write('};\n')
+    f.write(C_INDEX_FOOTER)
+
+
+def write_table(f, atrs):
+    f.write(C_HEADER)
+    for atr, desc in atrs:
+        f.write(f'    {{ "{atr}", "{desc}" }},\n')
+    f.write(C_FOOTER)
+
+
 def main():
+    s = urllib.request.urlopen(ATR_URL).read().decode()
+    atrs = list(EXTRA_ATRS)
+    atr = None
+    desc = ''
+    for line in s.split('\n'):
+        if len(line) == 0 or line[0] == '#':
+            continue
+        if line[0] == '\t':
+            desc += ['\\n',''][len(desc)==0] + unidecode.unidecode(line[1:]).replace('"',"'").replace('\\','\\\\')
+        else:
+            if atr is not None:
+                atrs.append((atr, desc))
+            atr = line.replace(' ','')
+            desc = ''
+    atrs.append((atr, desc))
+
     with open('src/atrs.h','w') as fatr:
-        s = urllib.request.urlopen(ATR_URL).read().decode()
-        atr = None
-        desc = ''
-        fatr.write(C_HEADER)
-        for line in s.split('\n'):
-            if len(line) == 0 or line[0] == '#':
-                continue
-            if line[0] == '\t':
-                desc += ['\\n',''][len(desc)==0] + unidecode.unidecode(line[1:]).replace('"',"'").replace('\\','\\\\')
-            else:
-                if atr is not None:
-                    fatr.write(f'    {{ "{atr}", "{desc}" }},\n')
-                atr = line.replace(' ','')
-                desc = ''
-        fatr.write(f'    {{ "{atr}", "{desc}" }},\n')
-        fatr.write(C_FOOTER)
+        write_table(fatr, atrs)
+    with open('src/atrs_index.h','w') as fidx:
+        write_index(fidx, atrs)
 
 if __name__ == "__main__":
     main()
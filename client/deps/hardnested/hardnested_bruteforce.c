@@ -96,6 +96,143 @@ static uint32_t keys_found = 0;
 static uint64_t num_keys_tested;
 static uint64_t found_bs_key = 0;
 
+// Persistent worker threads. Only running between hardnested_pool_start() and
+// hardnested_pool_stop(), i.e. during batch runs. Otherwise every call to
+// hardnested_run_threads() creates and joins its own threads as before.
+static struct {
+    bool running;
+    bool stop;
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t done;
+    pthread_t *threads;
+    uint32_t num_threads;
+    hardnested_job_t *job;
+    uint8_t *args;
+    size_t arg_size;
+    uint32_t num_jobs;
+    uint32_t next_job;
+    uint32_t jobs_left;
+} pool;
+
+static void *
+#ifdef __has_attribute
+#if __has_attribute(force_align_arg_pointer)
+__attribute__((force_align_arg_pointer))
+#endif
+#endif
+pool_worker_thread(void *x) {
+    (void)x;
+    pthread_mutex_lock(&pool.lock);
+    while (true) {
+        while (pool.stop == false && pool.next_job >= pool.num_jobs) {
+            pthread_cond_wait(&pool.work, &pool.lock);
+        }
+        if (pool.stop) {
+            break;
+        }
+        uint32_t job = pool.next_job++;
+        pthread_mutex_unlock(&pool.lock);
+
+        pool.job(pool.args + (job * pool.arg_size));
+
+        pthread_mutex_lock(&pool.lock);
+        pool.jobs_left--;
+        if (pool.jobs_left == 0) {
+            pthread_cond_signal(&pool.done);
+        }
+    }
+    pthread_mutex_unlock(&pool.lock);
+    return NULL;
+}
+
+void hardnested_pool_start(void) {
+    if (pool.running) {
+        return;
+    }
+
+    const uint32_t num_threads = NUM_BRUTE_FORCE_THREADS;
+    pool.threads = calloc(num_threads, sizeof(pthread_t));
+    if (pool.threads == NULL) {
+        return;
+    }
+
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.work, NULL);
+    pthread_cond_init(&pool.done, NULL);
+    pool.stop = false;
+    pool.num_jobs = 0;
+    pool.next_job = 0;
+    pool.jobs_left = 0;
+
+    pool.num_threads = 0;
+    while (pool.num_threads < num_threads) {
+        if (pthread_create(&pool.threads[pool.num_threads], NULL, pool_worker_thread, NULL) != 0) {
+            break;
+        }
+        pool.num_threads++;
+    }
+
+    pool.running = true;
+    if (pool.num_threads == 0) {
+        // fall back to a thread per job
+        hardnested_pool_stop();
+    }
+}
+
+void hardnested_pool_stop(void) {
+    if (pool.running == false) {
+        return;
+    }
+
+    pthread_mutex_lock(&pool.lock);
+    pool.stop = true;
+    pthread_cond_broadcast(&pool.work);
+    pthread_mutex_unlock(&pool.lock);
+
+    for (uint32_t i = 0; i < pool.num_threads; i++) {
+        pthread_join(pool.threads[i], NULL);
+    }
+
+    pthread_cond_destroy(&pool.done);
+    pthread_cond_destroy(&pool.work);
+    pthread_mutex_destroy(&pool.lock);
+    free(pool.threads);
+    pool.threads = NULL;
+    pool.num_threads = 0;
+    pool.running = false;
+}
+
+void hardnested_run_threads(hardnested_job_t *job, void *args, size_t arg_size, uint32_t num_jobs) {
+
+    if (pool.running) {
+        // jobs are handed out in order, more jobs than workers just queue up
+        pthread_mutex_lock(&pool.lock);
+        pool.job = job;
+        pool.args = args;
+        pool.arg_size = arg_size;
+        pool.next_job = 0;
+        pool.jobs_left = num_jobs;
+        pool.num_jobs = num_jobs;
+        pthread_cond_broadcast(&pool.work);
+        while (pool.jobs_left) {
+            pthread_cond_wait(&pool.done, &pool.lock);
+        }
+        pool.num_jobs = 0;
+        pool.next_job = 0;
+        pthread_mutex_unlock(&pool.lock);
+        return;
+    }
+
+    pthread_t threads[num_jobs];
+    for (uint32_t i = 0; i < num_jobs; i++) {
+        pthread_create(&threads[i], NULL, job, (uint8_t *)args + (i * arg_size));
+    }
+    for (uint32_t i = 0; i < num_jobs; i++) {
+        pthread_join(threads[i], NULL);
+    }
+}
+
 uint8_t trailing_zeros(uint8_t byte) {
     static const uint8_t trailing_zeros_LUT[256] = {
         8, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0,
@@ -354,7 +491,6 @@ bool brute_force_bs(float *bf_rate, statelist_t *candidates, uint32_t cuid, uint
         return false;
 #endif
 
-    pthread_t threads[num_brute_force_threads];
     struct args {
         bool silent;
         int thread_ID;
@@ -373,11 +509,8 @@ bool brute_force_bs(float *bf_rate, statelist_t *candidates, uint32_t cuid, uint
         thread_args[i].maximum_states = maximum_states;
         thread_args[i].nonces = nonces;
         thread_args[i].best_first_bytes = best_first_bytes;
-        pthread_create(&threads[i], NULL, crack_states_thread, (void *)&thread_args[i]);
-    }
-    for (uint32_t i = 0; i < num_brute_force_threads; i++) {
-        pthread_join(threads[i], 0);
     }
+    hardnested_run_threads(crack_states_thread, thread_args, sizeof(thread_args[0]), num_brute_force_threads);
 
     free(buckets);
     buckets = NULL;
@@ -478,6 +611,10 @@ static bool read_bench_data(statelist_t *test_candidates) {
 }
 
 
+uint64_t brute_force_keys_tested(void) {
+    return num_keys_tested;
+}
+
 float brute_force_benchmark(void) {
     const int num_brute_force_threads = NUM_BRUTE_FORCE_THREADS;
     statelist_t test_candidates[num_brute_force_threads];
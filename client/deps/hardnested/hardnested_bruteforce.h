@@ -19,6 +19,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #define NUM_SUMS 19 // number of possible sum property values
 
@@ -53,9 +54,19 @@ typedef struct {
     void *next;
 } statelist_t;
 
+typedef void *hardnested_job_t(void *);
+
+// keep worker threads alive between calls, see hf mf hardnested --batch
+void hardnested_pool_start(void);
+void hardnested_pool_stop(void);
+// run num_jobs jobs in parallel, job i gets args + i * arg_size. Returns when all are done.
+void hardnested_run_threads(hardnested_job_t *job, void *args, size_t arg_size, uint32_t num_jobs);
+
 void prepare_bf_test_nonces(noncelist_t *nonces, uint8_t best_first_byte);
 bool brute_force_bs(float *bf_rate, statelist_t *candidates, uint32_t cuid, uint32_t num_acquired_nonces, uint64_t maximum_states, noncelist_t *nonces, uint8_t *best_first_bytes, uint64_t *found_key);
 float brute_force_benchmark(void);
+// keys tested by the last brute_force_bs() call
+uint64_t brute_force_keys_tested(void);
 uint8_t trailing_zeros(uint8_t byte);
 bool verify_key(uint32_t cuid, noncelist_t *nonces, const uint8_t *best_first_bytes, uint32_t odd, uint32_t even);
 
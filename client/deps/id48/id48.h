@@ -27,6 +27,7 @@
 
 // This file defines only the structs and API surface.
 // There are no dependencies on any external code.
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 #include <stdbool.h>
@@ -200,6 +201,46 @@ bool id48lib_key_recovery_next(
     ID48LIB_KEY *potential_key_output
 );
 
+/// <summary>
+/// Number of independent partitions of the key space
+/// searched by id48lib_key_recovery_partition().
+/// </summary>
+#define ID48LIB_KEY_RECOVERY_PARTITIONS 256
+
+/// <summary>
+/// Finds all potential keys whose bits K₄₇..K₄₀ equal
+/// the given partition index.  Searching every partition
+/// from 0 to 255 finds the same keys, in the same order,
+/// as the init() / next() functions above.
+/// Unlike those, this function does not use any global
+/// state, so different partitions may be searched by
+/// different threads at the same time.
+/// </summary>
+/// <param name="input_partial_key">
+/// Top 48 bits of the key, as for id48lib_key_recovery_init().
+/// </param>
+/// <param name="input_nonce">The nonce value.</param>
+/// <param name="input_frn">The challenge sent from the reader.</param>
+/// <param name="input_grn">The response sent from the tag.</param>
+/// <param name="k47_to_k40">The partition to search.</param>
+/// <param name="potential_keys_output">
+/// Caller-provided array receiving up to max_keys potential keys.
+/// </param>
+/// <param name="max_keys">Number of entries in potential_keys_output.</param>
+/// <returns>
+/// The number of potential keys found in this partition,
+/// which may be larger than max_keys.
+/// </returns>
+size_t id48lib_key_recovery_partition(
+    const ID48LIB_KEY *input_partial_key,
+    const ID48LIB_NONCE *input_nonce,
+    const ID48LIB_FRN *input_frn,
+    const ID48LIB_GRN *input_grn,
+    uint8_t k47_to_k40,
+    ID48LIB_KEY *potential_keys_output,
+    size_t max_keys
+);
+
 #if defined(__cplusplus)
 }
 #endif
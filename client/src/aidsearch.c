@@ -20,6 +20,19 @@
 #include <string.h>
 #include "fileutils.h"
 #include "pm3_cmd.h"
+#include "commonutil.h"
+#include "util_posix.h"
+
+#define AID_BENCH_ROUNDS 200
+
+typedef struct aid_trie_node_s {
+    int32_t child[16];
+    // index of the entry ending here, -1 if none
+    int32_t elm;
+} aid_trie_node_t;
+
+// the session copy of aidlist.json
+static aid_index_t aidlist_index = {0};
 
 static int openAIDFile(json_t **root, bool verbose) {
     json_error_t error;
@@ -58,13 +71,144 @@ static int closeAIDFile(json_t *root) {
     return PM3_SUCCESS;
 }
 
-json_t *AIDSearchInit(bool verbose) {
+static int aid_nibble(char c) {
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    c = tolower(c);
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+static int32_t aid_trie_new_node(aid_index_t *idx) {
+    if (idx->count == idx->size) {
+        size_t size = (idx->size) ? idx->size * 2 : 1024;
+        aid_trie_node_t *nodes = realloc(idx->nodes, size * sizeof(aid_trie_node_t));
+        if (nodes == NULL) {
+            return -1;
+        }
+        idx->nodes = nodes;
+        idx->size = size;
+    }
+    aid_trie_node_t *node = &idx->nodes[idx->count];
+    memset(node->child, 0xFF, sizeof(node->child));
+    node->elm = -1;
+    return idx->count++;
+}
+
+int AIDIndexBuild(aid_index_t *idx, json_t *root) {
+    memset(idx, 0, sizeof(aid_index_t));
+    if (!json_is_array(root)) {
+        return PM3_EINVARG;
+    }
+
+    if (aid_trie_new_node(idx) < 0) {
+        return PM3_EMALLOC;
+    }
+
+    for (size_t elmindx = 0; elmindx < json_array_size(root); elmindx++) {
+        json_t *data = json_array_get(root, elmindx);
+        const char *hexaid = json_string_value(json_object_get(data, "AID"));
+        if (hexaid == NULL || strlen(hexaid) == 0) {
+            continue;
+        }
+
+        int32_t n = 0;
+        for (const char *p = hexaid; *p && n >= 0; p++) {
+            int nib = aid_nibble(*p);
+            if (nib < 0) {
+                PrintAndLogEx(DEBUG, "AID `%s` is not hex, skipped", hexaid);
+                n = -1;
+                break;
+            }
+            if (idx->nodes[n].child[nib] < 0) {
+                int32_t c = aid_trie_new_node(idx);
+                if (c < 0) {
+                    AIDIndexFree(idx);
+                    return PM3_EMALLOC;
+                }
+                idx->nodes[n].child[nib] = c;
+            }
+            n = idx->nodes[n].child[nib];
+        }
+
+        if (n > 0 && idx->nodes[n].elm < 0) {
+            idx->nodes[n].elm = elmindx;
+        }
+    }
+
+    idx->root = json_incref(root);
+    return PM3_SUCCESS;
+}
+
+void AIDIndexFree(aid_index_t *idx) {
+    free(idx->nodes);
+    json_decref(idx->root);
+    memset(idx, 0, sizeof(aid_index_t));
+}
+
+json_t *AIDIndexFind(const aid_index_t *idx, const char *aid, size_t *matchlen) {
+    if (matchlen) {
+        *matchlen = 0;
+    }
+    if (idx->nodes == NULL || aid == NULL) {
+        return NULL;
+    }
+
+    int32_t n = 0;
+    int32_t elm = -1;
+    size_t len = 0;
+    for (size_t i = 0; aid[i]; i++) {
+        int nib = aid_nibble(aid[i]);
+        if (nib < 0) {
+            break;
+        }
+        n = idx->nodes[n].child[nib];
+        if (n < 0) {
+            break;
+        }
+        if (idx->nodes[n].elm >= 0) {
+            elm = idx->nodes[n].elm;
+            len = i + 1;
+        }
+    }
+
+    if (elm < 0) {
+        return NULL;
+    }
+    if (matchlen) {
+        *matchlen = len;
+    }
+    return json_array_get(idx->root, elm);
+}
+
+static int aidlist_load(bool verbose) {
+    if (aidlist_index.root) {
+        return PM3_SUCCESS;
+    }
+
     json_t *root = NULL;
     int res = openAIDFile(&root, verbose);
-    if (res != PM3_SUCCESS)
+    if (res == PM3_SUCCESS) {
+        res = AIDIndexBuild(&aidlist_index, root);
+    }
+    json_decref(root);
+    return res;
+}
+
+json_t *AIDSearchInit(bool verbose) {
+    if (aidlist_load(verbose) != PM3_SUCCESS)
         return NULL;
 
-    return root;
+    // callers release it with AIDSearchFree
+    return json_incref(aidlist_index.root);
+}
+
+json_t *AIDSearchFind(const char *aid) {
+    if (aidlist_load(false) != PM3_SUCCESS)
+        return NULL;
+
+    return AIDIndexFind(&aidlist_index, aid, NULL);
 }
 
 json_t *AIDSearchGetElm(json_t *root, size_t elmindx) {
@@ -100,17 +244,6 @@ static const char *jsonStrGet(json_t *data, const char *name) {
     return cstr;
 }
 
-static bool aidCompare(const char *aidlarge, const char *aidsmall) {
-    if (strcmp(aidlarge, aidsmall) == 0)
-        return true;
-
-    if (strlen(aidlarge) > strlen(aidsmall))
-        if (strncmp(aidlarge, aidsmall, strlen(aidsmall)) == 0)
-            return true;
-
-    return false;
-}
-
 bool AIDGetFromElm(json_t *data, uint8_t *aid, size_t aidmaxlen, int *aidlen) {
     *aidlen = 0;
     const char *hexaid = jsonStrGet(data, "AID");
@@ -124,32 +257,47 @@ bool AIDGetFromElm(json_t *data, uint8_t *aid, size_t aidmaxlen, int *aidlen) {
     return true;
 }
 
-int PrintAIDDescription(json_t *xroot, char *aid, bool verbose) {
-    int retval = PM3_SUCCESS;
-
-    json_t *root = xroot;
-    if (root == NULL) {
-        root = AIDSearchInit(verbose);
-    }
-    if (root == NULL) {
-        goto out;
+static bool aid_prefix(const char *aid, const char *dictaid) {
+    for (; *dictaid; aid++, dictaid++) {
+        if (tolower(*aid) != tolower(*dictaid))
+            return false;
     }
+    return true;
+}
 
+// reference for the index, longest dictionary AID which is a prefix of aid
+static json_t *aid_search_linear(json_t *root, const char *aid) {
     json_t *elm = NULL;
     size_t maxaidlen = 0;
     for (size_t elmindx = 0; elmindx < json_array_size(root); elmindx++) {
-        json_t *data = AIDSearchGetElm(root, elmindx);
-        if (data == NULL) {
+        json_t *data = json_array_get(root, elmindx);
+        const char *dictaid = json_string_value(json_object_get(data, "AID"));
+        if (dictaid == NULL || strlen(dictaid) == 0) {
             continue;
         }
-        const char *dictaid = jsonStrGet(data, "AID");
-        if (aidCompare(aid, dictaid)) {  // dictaid may be less length than requested aid
-            if (maxaidlen < strlen(dictaid) && strlen(dictaid) <= strlen(aid)) {
+        if (aid_prefix(aid, dictaid)) {
+            if (maxaidlen < strlen(dictaid)) {
                 maxaidlen = strlen(dictaid);
                 elm = data;
             }
         }
     }
+    return elm;
+}
+
+int PrintAIDDescription(json_t *xroot, char *aid, bool verbose) {
+    int retval = PM3_SUCCESS;
+
+    json_t *elm = NULL;
+    if (xroot == NULL || xroot == aidlist_index.root) {
+        elm = AIDSearchFind(aid);
+    } else {
+        aid_index_t idx;
+        if (AIDIndexBuild(&idx, xroot) == PM3_SUCCESS) {
+            elm = AIDIndexFind(&idx, aid, NULL);
+            AIDIndexFree(&idx);
+        }
+    }
 
     if (elm == NULL) {
         goto out;
@@ -182,9 +330,6 @@ int PrintAIDDescription(json_t *xroot, char *aid, bool verbose) {
     }
 
 out:
-    if (xroot == NULL) {
-        AIDSearchFree(root);
-    }
     return retval;
 }
 
@@ -192,3 +337,75 @@ int PrintAIDDescriptionBuf(json_t *root, uint8_t *aid, size_t aidlen, bool verbo
     return PrintAIDDescription(root, sprint_hex_inrow(aid, aidlen), verbose);
 }
 
+
+int AIDSearchSelftest(void) {
+    if (aidlist_load(true) != PM3_SUCCESS) {
+        PrintAndLogEx(FAILED, "Can't load the aid list");
+        return PM3_EFILE;
+    }
+
+    json_t *root = aidlist_index.root;
+    size_t n = json_array_size(root);
+    char (*aids)[40] = calloc(n * 2 + 2, sizeof(*aids));
+    if (aids == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return PM3_EMALLOC;
+    }
+
+    // every AID as is and with some bytes appended, in both cases
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        const char *hexaid = json_string_value(json_object_get(json_array_get(root, i), "AID"));
+        if (hexaid == NULL || strlen(hexaid) + 4 >= sizeof(aids[0])) {
+            continue;
+        }
+        strcpy(aids[count], hexaid);
+        str_upper(aids[count++]);
+        snprintf(aids[count], sizeof(aids[0]), "%s%04zX", hexaid, i);
+        str_lower(aids[count++]);
+    }
+
+    // and two which are not in there
+    strcpy(aids[count++], "FF");
+    strcpy(aids[count++], "F0DEADBEEF");
+
+    bool ok = true;
+    size_t bad = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (AIDSearchFind(aids[i]) != aid_search_linear(root, aids[i])) {
+            if (bad++ < 5) {
+                PrintAndLogEx(FAILED, "AID %s, index and scan disagree", aids[i]);
+            }
+            ok = false;
+        }
+    }
+    PrintAndLogEx(INFO, "Lookups........ %zu ( %s )", count, (ok) ? _GREEN_("ok") : _RED_("fail"));
+    PrintAndLogEx(INFO, "Index nodes.... %zu ( %zu kB )", aidlist_index.count, aidlist_index.count * sizeof(aid_trie_node_t) / 1024);
+
+    uint64_t t1 = usclock();
+    size_t hits = 0;
+    for (int r = 0; r < AID_BENCH_ROUNDS; r++) {
+        for (size_t i = 0; i < count; i++) {
+            hits += (aid_search_linear(root, aids[i]) != NULL);
+        }
+    }
+    uint64_t t_scan = usclock() - t1;
+
+    t1 = usclock();
+    for (int r = 0; r < AID_BENCH_ROUNDS; r++) {
+        for (size_t i = 0; i < count; i++) {
+            hits += (AIDSearchFind(aids[i]) != NULL);
+        }
+    }
+    uint64_t t_index = usclock() - t1;
+
+    double scan_us = (double)MAX(t_scan, 1) / (double)(count * AID_BENCH_ROUNDS);
+    double index_us = (double)MAX(t_index, 1) / (double)(count * AID_BENCH_ROUNDS);
+    PrintAndLogEx(INFO, "List scan...... %.3f us / lookup", scan_us);
+    PrintAndLogEx(INFO, "Index.......... %.3f us / lookup ( %.0fx )", index_us, scan_us / index_us);
+    PrintAndLogEx(DEBUG, "%zu lookups", hits);
+
+    free(aids);
+    PrintAndLogEx((ok) ? SUCCESS : FAILED, "Tests ( %s )", (ok) ? _GREEN_("ok") : _RED_("fail"));
+    return (ok) ? PM3_SUCCESS : PM3_ESOFT;
+}
@@ -25,11 +25,28 @@
 #include <stdbool.h>
 #include "jansson.h"
 
+// Longest prefix index over the "AID" strings of a json array. It is keyed on
+// nibbles, so odd length AIDs are found as well, and is case insensitive.
+// Of equal AIDs the first one in the array wins.
+typedef struct {
+    json_t *root;
+    struct aid_trie_node_s *nodes;
+    size_t count;
+    size_t size;
+} aid_index_t;
+
+int AIDIndexBuild(aid_index_t *idx, json_t *root);
+void AIDIndexFree(aid_index_t *idx);
+json_t *AIDIndexFind(const aid_index_t *idx, const char *aid, size_t *matchlen);
+
 int PrintAIDDescription(json_t *xroot, char *aid, bool verbose);
 int PrintAIDDescriptionBuf(json_t *root, uint8_t *aid, size_t aidlen, bool verbose);
 json_t *AIDSearchInit(bool verbose);
 json_t *AIDSearchGetElm(json_t *root, size_t elmindx);
 bool AIDGetFromElm(json_t *data, uint8_t *aid, size_t aidmaxlen, int *aidlen);
 int AIDSearchFree(json_t *root);
+// aidlist.json is loaded and indexed once per session
+json_t *AIDSearchFind(const char *aid);
+int AIDSearchSelftest(void);
 
 #endif
@@ -20,11 +20,95 @@
 #include <stdlib.h>
 #include "commonutil.h" // ARRAYLEN
 #include "ui.h"         // PrintAndLogEx
+#include "util_posix.h" // usclock
+#include "atrs_index.h"
+
+_Static_assert(ARRAYLEN(AtrTable) == ATR_INDEX_TABLE_LEN, "atrs_index.h is out of date, regenerate it with atr_scrap_pcsctools.py");
+
+#define ATR_ANY_CHAR    (1U << 16)
+
+static uint32_t atr_char_bit(char c) {
+    if (c >= '0' && c <= '9') {
+        return 1U << (c - '0');
+    }
+    if (c >= 'A' && c <= 'F') {
+        return 1U << (c - 'A' + 10);
+    }
+    return ATR_ANY_CHAR;
+}
+
+// first exact entry of the same length and bytes, -1 if there is none
+static int atr_find_exact(const char *atr_str, size_t slen) {
+    size_t lo = 0;
+    size_t hi = ARRAYLEN(AtrExact);
+
+    while (lo < hi) {
+        size_t mid = lo + ((hi - lo) / 2);
+        const char *bytes = AtrTable[AtrExact[mid]].bytes;
+        size_t blen = strlen(bytes);
+        int cmp = (blen != slen) ? ((blen < slen) ? -1 : 1) : strcmp(bytes, atr_str);
+        if (cmp < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo < ARRAYLEN(AtrExact) && strcmp(AtrTable[AtrExact[lo]].bytes, atr_str) == 0) {
+        return AtrExact[lo];
+    }
+    return -1;
+}
+
+// last wildcard entry of the table matching, -1 if there is none
+static int atr_find_pattern(const char *atr_str, size_t slen) {
+    size_t lo = 0;
+    size_t hi = ARRAYLEN(AtrPattern);
+
+    while (lo < hi) {
+        size_t mid = lo + ((hi - lo) / 2);
+        if (AtrPattern[mid].len < slen) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    for (; lo < ARRAYLEN(AtrPattern) && AtrPattern[lo].len == slen; lo++) {
+        const uint32_t *sets = AtrPatternSets + AtrPattern[lo].sets;
+        size_t i = 0;
+        while (i < slen && (sets[i] & atr_char_bit(atr_str[i]))) {
+            i++;
+        }
+        if (i == slen) {
+            return AtrPattern[lo].index;
+        }
+    }
+    return -1;
+}
 
 // get a ATR description based on the atr bytes
-// returns description of the best match
+// returns description of the best match, an exact one before any wildcard one
 const char *getAtrInfo(const char *atr_str) {
 
+    size_t slen = strlen(atr_str);
+
+    int match = atr_find_exact(atr_str, slen);
+    if (match < 0) {
+        match = atr_find_pattern(atr_str, slen);
+    }
+
+    if (match >= 0) {
+        return AtrTable[match].desc;
+    } else {
+        //No match, return default = last element of AtrTable
+        return AtrTable[ARRAYLEN(AtrTable) - 1].desc;
+    }
+}
+
+// the table scan the index replaces, kept as it was to check the index against
+static const char *atr_lookup_linear(const char *atr_str) {
+
     size_t slen = strlen(atr_str);
     int match = -1;
 
@@ -67,3 +151,80 @@ const char *getAtrInfo(const char *atr_str) {
         return AtrTable[ARRAYLEN(AtrTable) - 1].desc;
     }
 }
+
+#define ATR_BENCH_ROUNDS 20
+
+// Looks up an ATR made from every table entry, wildcards filled in, with the
+// index and with the plain scan and compares what they find
+int atr_selftest(void) {
+
+    size_t n = ARRAYLEN(AtrTable) - 1;
+    char (*atrs)[80] = calloc(n + 2, sizeof(*atrs));
+    if (atrs == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return PM3_EMALLOC;
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        const char *p = AtrTable[i].bytes;
+        if (strchr(p, '*') != NULL || strlen(p) >= sizeof(atrs[0])) {
+            continue;
+        }
+
+        size_t j = 0;
+        for (; *p; j++) {
+            if (*p == '[') {
+                atrs[count][j] = p[1];
+                p = strchr(p, ']') + 1;
+            } else {
+                atrs[count][j] = (*p == '.') ? "0123456789ABCDEF"[(i + j) % 16] : *p;
+                p++;
+            }
+        }
+        count++;
+    }
+
+    // and two which are not in there
+    strcpy(atrs[count++], "3B00");
+    strcpy(atrs[count++], "3B8F8001804F0CA000000306030001000000006A");
+
+    bool ok = true;
+    size_t bad = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (getAtrInfo(atrs[i]) != atr_lookup_linear(atrs[i])) {
+            if (bad++ < 5) {
+                PrintAndLogEx(FAILED, "ATR %s, index and scan disagree", atrs[i]);
+            }
+            ok = false;
+        }
+    }
+    PrintAndLogEx(INFO, "Lookups........ %zu ( %s )", count, (ok) ? _GREEN_("ok") : _RED_("fail"));
+
+    uint64_t t1 = usclock();
+    size_t hits = 0;
+    for (int r = 0; r < ATR_BENCH_ROUNDS; r++) {
+        for (size_t i = 0; i < count; i++) {
+            hits += (atr_lookup_linear(atrs[i]) != NULL);
+        }
+    }
+    uint64_t t_scan = usclock() - t1;
+
+    t1 = usclock();
+    for (int r = 0; r < ATR_BENCH_ROUNDS; r++) {
+        for (size_t i = 0; i < count; i++) {
+            hits += (getAtrInfo(atrs[i]) != NULL);
+        }
+    }
+    uint64_t t_index = usclock() - t1;
+
+    double scan_us = (double)MAX(t_scan, 1) / (double)(count * ATR_BENCH_ROUNDS);
+    double index_us = (double)MAX(t_index, 1) / (double)(count * ATR_BENCH_ROUNDS);
+    PrintAndLogEx(INFO, "Table scan..... %.3f us / lookup", scan_us);
+    PrintAndLogEx(INFO, "Index.......... %.3f us / lookup ( %.0fx )", index_us, scan_us / index_us);
+    PrintAndLogEx(DEBUG, "%zu lookups", hits);
+
+    free(atrs);
+    PrintAndLogEx((ok) ? SUCCESS : FAILED, "Tests ( %s )", (ok) ? _GREEN_("ok") : _RED_("fail"));
+    return (ok) ? PM3_SUCCESS : PM3_ESOFT;
+}
@@ -0,0 +1,850 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// *DO NOT EDIT MANUALLY*
+// Autogenerated with atr_scrap_pcsctools.py
+//-----------------------------------------------------------------------------
+// Lookup index over AtrTable, only included by atrs.c
+//
+// AtrExact    entries without wildcards, ordered by length then bytes
+// AtrPattern  entries with wildcards, ordered by length, later table entries
+//             first. Each position has a set of allowed characters in
+//             AtrPatternSets, bit n for hex digit n, bit 16 for any other
+//             character. '.' allows all of them.
+//             Patterns with [..] or '*' are left out, the table scan always
+//             compared those characters literally so they never matched.
+//
+// ATR_INDEX_TABLE_LEN is the length of the AtrTable the index was built from
+//-----------------------------------------------------------------------------
+#ifndef ATRS_INDEX_H__
+
+#define ATRS_INDEX_H__
+#include <stdint.h>
+
+typedef struct atr_pattern_s {
+    uint16_t index;
+    uint16_t len;
+    uint32_t sets;
+} atr_pattern_t;
+
+#define ATR_INDEX_TABLE_LEN 4569
+
+static const uint16_t AtrExact[] = {
+    9, 10, 11, 12, 14, 15, 17, 18, 19, 20, 47, 110,
+    111, 399, 425, 802, 1681, 1685, 13, 112, 113, 114, 426, 1683,
+    1686, 1690, 1691, 1692, 2440, 2441, 21, 22, 23, 24, 25, 26,
+    27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+    39, 40, 41, 42, 43, 44, 45, 46, 48, 49, 50, 51,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    115, 227, 228, 229, 230, 231, 282, 283, 1684, 1687, 1688, 1689,
+    1693, 1706, 1707, 3304, 3808, 64, 65, 66, 116, 226, 233, 234,
+    235, 236, 237, 238, 240, 427, 1695, 1696, 1697, 1698, 1699, 1700,
+    1701, 1702, 1703, 1713, 2442, 2443, 2444, 2447, 3812, 4370, 67, 68,
+    69, 70, 72, 73, 74, 75, 76, 77, 83, 84, 85, 86,
+    87, 88, 89, 117, 118, 119, 120, 121, 122, 123, 284, 285,
+    286, 430, 488, 1708, 1709, 1710, 1711, 1712, 1725, 1726, 1727, 2446,
+    3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3627, 3628, 3629,
+    90, 93, 94, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+    133, 134, 135, 136, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 239,
+    241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 287, 431,
+    432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443,
+    445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456,
+    457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
+    469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480,
+    481, 482, 483, 484, 485, 486, 487, 489, 490, 491, 492, 493,
+    494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505,
+    506, 507, 508, 509, 510, 512, 513, 514, 516, 1337, 1704, 1705,
+    1714, 1715, 1716, 1717, 1718, 1720, 1721, 1722, 1723, 1724, 1729, 1730,
+    1731, 1732, 1733, 2465, 3266, 3268, 3623, 3624, 3625, 4391, 4392, 4393,
+    4394, 4395, 4397, 4398, 4400, 4401, 4402, 4403, 4404, 4405, 4407, 4408,
+    4409, 4410, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166,
+    167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 251,
+    252, 254, 255, 256, 257, 258, 259, 260, 261, 444, 517, 518,
+    519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530,
+    531, 532, 533, 534, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345,
+    1346, 1347, 1348, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742,
+    1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754,
+    1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1765, 1766, 2449,
+    2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2466, 2467,
+    2470, 3267, 3420, 3813, 4385, 16, 95, 178, 179, 180, 181, 182,
+    183, 262, 288, 289, 290, 291, 400, 535, 536, 537, 538, 539,
+    540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551,
+    553, 554, 555, 556, 557, 558, 559, 560, 561, 562, 563, 564,
+    565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576,
+    577, 578, 579, 580, 581, 582, 583, 585, 1350, 1351, 1352, 1353,
+    1354, 1355, 1356, 1377, 1719, 1767, 1768, 1769, 1770, 1771, 1772, 1773,
+    1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785,
+    1786, 1787, 1788, 1789, 1790, 1, 2445, 2451, 2476, 2490, 3398, 3399,
+    3400, 3401, 3402, 3404, 3405, 3406, 3407, 3408, 3409, 3410, 4371, 4411,
+    4412, 4413, 4414, 4415, 4416, 4418, 4419, 4420, 4421, 4435, 96, 97,
+    184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 263, 265,
+    266, 584, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597,
+    598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608, 609,
+    610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621,
+    622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632, 633,
+    1357, 1764, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1801, 1802,
+    1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814,
+    1815, 1816, 1817, 1818, 1820, 1821, 1822, 1921, 1922, 1923, 2464, 2469,
+    2492, 2498, 2499, 2503, 2505, 2506, 2507, 2508, 2509, 2510, 3252, 3253,
+    3254, 3255, 3256, 3396, 3403, 3411, 3630, 3821, 3831, 4436, 4437, 4438,
+    4439, 4440, 4441, 4442, 4443, 4444, 4445, 4446, 4447, 4448, 4449, 4450,
+    4473, 8, 194, 267, 270, 271, 272, 273, 274, 292, 293, 294,
+    295, 634, 635, 636, 637, 640, 641, 642, 643, 644, 645, 646,
+    647, 649, 650, 651, 652, 653, 654, 655, 656, 658, 659, 660,
+    661, 662, 663, 784, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365,
+    1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1378,
+    1380, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1791, 1823,
+    1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835,
+    1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1846, 1847, 1848,
+    1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860,
+    1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872,
+    1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884,
+    1885, 1886, 1887, 1888, 1889, 1890, 1891, 1893, 1894, 1895, 1896, 1897,
+    1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909,
+    1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1924, 1961, 1962,
+    1963, 1965, 1966, 1967, 1968, 1969, 1970, 2472, 2474, 2475, 2481, 2493,
+    2494, 2497, 2500, 2504, 2511, 2512, 2513, 2514, 2515, 3395, 3412, 3437,
+    3632, 3809, 3810, 3811, 3814, 3815, 3816, 3817, 3818, 3819, 3820, 3822,
+    3823, 3843, 4422, 4423, 4451, 4452, 195, 196, 197, 198, 275, 276,
+    665, 666, 667, 668, 669, 670, 672, 673, 674, 675, 676, 677,
+    678, 679, 680, 681, 682, 683, 684, 685, 741, 1391, 1392, 1393,
+    1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405,
+    1406, 1408, 1409, 1410, 1819, 1925, 1926, 1927, 1928, 1929, 1930, 1931,
+    1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943,
+    1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955,
+    1956, 1957, 1958, 1959, 1960, 1971, 1972, 2448, 2471, 2477, 2478, 2483,
+    2485, 2486, 2487, 2488, 2516, 2518, 2519, 2520, 2521, 2523, 2524, 2525,
+    2526, 2527, 2528, 2529, 3413, 3414, 3415, 3422, 3451, 3452, 3453, 3454,
+    3631, 3633, 3634, 3637, 3655, 3824, 3825, 3827, 3855, 3857, 3858, 3859,
+    3860, 3862, 3864, 3865, 3866, 3867, 3868, 4424, 199, 298, 299, 300,
+    301, 302, 303, 305, 306, 307, 309, 310, 311, 312, 313, 314,
+    315, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327,
+    328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339,
+    340, 341, 401, 402, 403, 688, 689, 690, 691, 692, 693, 694,
+    695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706,
+    707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718,
+    719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730,
+    731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 742, 743,
+    744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755,
+    756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767,
+    768, 769, 770, 771, 772, 773, 775, 776, 777, 778, 779, 780,
+    781, 782, 783, 1379, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419,
+    1420, 1421, 1422, 1423, 1424, 1426, 1428, 1919, 1973, 1974, 1975, 1976,
+    1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988,
+    1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000,
+    2001, 2416, 2468, 2482, 2484, 2501, 2502, 2530, 2531, 3259, 3260, 3261,
+    3295, 3296, 3416, 3417, 3418, 3421, 3424, 3426, 3439, 3468, 3635, 3638,
+    3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3826, 3828, 3829, 3830,
+    3880, 3882, 3883, 3884, 3918, 4386, 4425, 98, 200, 201, 202, 203,
+    204, 205, 278, 342, 343, 344, 345, 346, 347, 348, 349, 350,
+    687, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795,
+    796, 797, 798, 799, 800, 801, 943, 993, 1002, 1088, 1431, 1432,
+    1433, 1434, 1435, 1436, 1437, 1439, 1441, 1442, 2002, 2003, 2004, 2005,
+    2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017,
+    2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029,
+    2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041,
+    2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053,
+    2055, 2056, 2057, 2092, 2183, 2489, 2491, 2495, 2496, 2538, 2543, 2544,
+    2545, 2558, 2559, 3279, 3281, 3282, 3283, 3284, 3286, 3287, 3288, 3292,
+    3297, 3305, 3306, 3307, 3308, 3309, 3419, 3423, 3428, 3440, 3469, 3647,
+    3649, 3650, 3651, 3652, 3653, 3832, 3845, 3846, 3847, 3848, 3856, 3861,
+    3863, 3895, 3916, 3958, 3961, 4372, 4426, 4427, 4428, 4429, 4430, 4431,
+    4432, 4475, 4476, 4477, 4478, 99, 100, 101, 102, 103, 104, 105,
+    106, 107, 109, 206, 207, 208, 351, 352, 353, 354, 355, 356,
+    357, 358, 359, 396, 803, 804, 805, 806, 807, 808, 809, 810,
+    811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822,
+    823, 824, 825, 826, 827, 828, 829, 830, 831, 833, 834, 835,
+    836, 837, 838, 839, 841, 842, 843, 844, 845, 846, 847, 848,
+    850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861,
+    862, 863, 865, 866, 1425, 1443, 1444, 1445, 1446, 1447, 1448, 1449,
+    2059, 2060, 2061, 2062, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071,
+    2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083,
+    2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2093, 2094, 2095, 2096,
+    2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108,
+    2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120,
+    2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132,
+    2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144,
+    2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156,
+    2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168,
+    2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180,
+    2181, 2182, 2184, 2473, 2517, 2578, 3257, 3258, 3263, 3264, 3285, 3289,
+    3290, 3291, 3425, 3427, 3429, 3430, 3431, 3432, 3433, 3434, 3435, 3436,
+    3442, 3444, 3446, 3448, 3449, 3488, 3521, 3648, 3656, 3657, 3658, 3659,
+    3661, 3662, 3663, 3664, 3665, 3666, 3703, 3833, 3834, 3835, 3836, 3837,
+    3838, 3839, 3840, 3841, 3844, 3849, 3869, 3870, 3872, 3873, 3874, 3875,
+    3889, 3950, 3982, 4387, 4433, 4434, 209, 210, 211, 212, 213, 214,
+    215, 216, 218, 219, 220, 221, 222, 223, 224, 225, 277, 279,
+    280, 281, 360, 361, 362, 363, 394, 395, 397, 398, 404, 832,
+    867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878,
+    879, 880, 881, 882, 884, 885, 886, 887, 888, 889, 890, 891,
+    892, 893, 894, 895, 896, 897, 898, 899, 900, 901, 902, 903,
+    904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915,
+    916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927,
+    928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939,
+    940, 941, 942, 944, 945, 946, 947, 948, 949, 950, 951, 952,
+    953, 955, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966,
+    967, 968, 969, 970, 971, 972, 973, 974, 975, 976, 977, 978,
+    979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990,
+    991, 992, 994, 995, 996, 1451, 1452, 1453, 1454, 1455, 1456, 1457,
+    1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469,
+    1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481,
+    1482, 1483, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494,
+    1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1659,
+    1920, 2054, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194,
+    2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206,
+    2207, 2208, 2209, 2210, 2211, 2242, 2243, 2479, 2480, 2533, 2534, 2535,
+    2539, 2540, 2561, 2566, 2646, 2647, 3265, 3293, 3294, 3301, 3303, 3322,
+    3323, 3324, 3325, 3326, 3327, 3328, 3329, 3330, 3331, 3438, 3447, 3455,
+    3456, 3475, 3636, 3654, 3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674,
+    3675, 3676, 3677, 3678, 3679, 3680, 3700, 3701, 3850, 3851, 3852, 3853,
+    3854, 3876, 3877, 3885, 3886, 3888, 3890, 3891, 3892, 3893, 3894, 3899,
+    3900, 3901, 3902, 3903, 3904, 3905, 3906, 3907, 3908, 3939, 3993, 3994,
+    3999, 4000, 4001, 4002, 4003, 4004, 4005, 4013, 4014, 4015, 4373, 4374,
+    4375, 4376, 4377, 4378, 4379, 4380, 4381, 4382, 4383, 4384, 4388, 4453,
+    364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375,
+    376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387,
+    388, 389, 391, 392, 393, 405, 406, 407, 408, 409, 410, 411,
+    412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423,
+    424, 511, 997, 998, 999, 1000, 1001, 1003, 1004, 1005, 1006, 1007,
+    1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019,
+    1020, 1021, 1022, 1023, 1025, 1026, 1027, 1028, 1030, 1031, 1032, 1033,
+    1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045,
+    1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057,
+    1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
+    1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081,
+    1082, 1083, 1084, 1085, 1086, 1087, 1089, 1090, 1091, 1092, 1093, 1094,
+    1095, 1096, 1098, 1099, 1100, 1101, 1102, 1103, 1106, 1107, 1108, 1109,
+    1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121,
+    1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133,
+    1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1144, 1145, 1146,
+    1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158,
+    1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170,
+    1171, 1172, 1173, 1174, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
+    1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196,
+    1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208,
+    1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220,
+    1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232,
+    1233, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1246,
+    1247, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259,
+    1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271,
+    1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283,
+    1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+    1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307,
+    1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319,
+    1320, 1321, 1322, 1323, 1325, 1326, 1328, 1329, 1330, 1331, 1332, 1333,
+    1334, 1335, 1336, 1507, 1508, 1510, 1511, 1512, 1513, 1514, 1515, 1516,
+    1517, 1518, 1519, 1520, 1521, 1522, 1523, 1524, 1677, 1800, 2212, 2213,
+    2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225,
+    2226, 2227, 2228, 2229, 2230, 2231, 2232, 2234, 2236, 2237, 2238, 2239,
+    2240, 2241, 2244, 2245, 2246, 2247, 2290, 2532, 2541, 2542, 2546, 2547,
+    2548, 2549, 2550, 2551, 2552, 2553, 2560, 3262, 3298, 3299, 3300, 3302,
+    3311, 3313, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343, 3344, 3345,
+    3346, 3347, 3348, 3349, 3350, 3351, 3352, 3354, 3355, 3361, 3362, 3363,
+    3364, 3365, 3366, 3441, 3443, 3445, 3450, 3457, 3460, 3470, 3471, 3472,
+    3476, 3489, 3490, 3491, 3492, 3563, 3564, 3681, 3682, 3684, 3685, 3686,
+    3687, 3688, 3689, 3690, 3878, 3879, 3881, 3896, 3897, 3898, 3909, 3910,
+    3911, 3913, 3914, 3915, 3919, 3920, 3921, 3922, 3923, 3924, 3925, 3926,
+    3927, 3932, 3933, 3934, 3935, 3936, 3937, 3938, 3940, 3941, 3942, 3948,
+    3955, 4389, 4454, 4455, 4456, 4457, 390, 1175, 1529, 1530, 1531, 1532,
+    1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544,
+    1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556,
+    1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568,
+    1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580,
+    1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592,
+    1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604,
+    1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616,
+    1617, 1618, 1619, 1620, 1621, 1623, 1624, 1625, 1626, 1627, 1628, 1629,
+    1630, 1631, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643,
+    1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655,
+    1656, 1657, 1658, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668,
+    1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1678, 1679, 1680, 1682,
+    2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259,
+    2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271,
+    2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2284,
+    2285, 2286, 2287, 2288, 2289, 2291, 2292, 2293, 2295, 2296, 2297, 2298,
+    2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2310, 2311,
+    2312, 2313, 2314, 2377, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388,
+    2389, 2390, 2393, 2395, 2396, 2397, 2400, 2401, 2403, 2404, 2405, 2406,
+    2407, 2413, 2415, 2417, 2418, 2419, 2420, 2421, 2423, 2424, 2425, 2426,
+    2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438,
+    2536, 2537, 2554, 2555, 2556, 2557, 2567, 2568, 2569, 2570, 2571, 2572,
+    2573, 2574, 2575, 2576, 2579, 2643, 2648, 2649, 2650, 2679, 2753, 2754,
+    2755, 2756, 2757, 2759, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788,
+    2789, 2790, 2791, 2794, 2795, 2958, 2959, 2960, 2961, 2962, 3314, 3356,
+    3357, 3358, 3359, 3461, 3462, 3463, 3473, 3477, 3493, 3518, 3522, 3525,
+    3526, 3537, 3538, 3549, 3691, 3692, 3693, 3694, 3695, 3696, 3697, 3698,
+    3917, 3943, 3944, 3945, 3946, 3949, 3951, 3952, 3953, 3956, 3957, 3959,
+    3962, 3964, 3965, 3966, 3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974,
+    3975, 3976, 3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 4012, 4038,
+    4047, 4048, 4458, 4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466, 4467,
+    4468, 4470, 4471, 4472, 2439, 2562, 2563, 2564, 2565, 2577, 2580, 2581,
+    2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593,
+    2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605,
+    2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613, 2614, 2615, 2616, 2617,
+    2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2626, 2627, 2628, 2629,
+    2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641,
+    2642, 2644, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660,
+    2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672,
+    2673, 2674, 2675, 2676, 2677, 2678, 2680, 2681, 2682, 2683, 2684, 2685,
+    2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693, 2694, 2695, 2696, 2697,
+    2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 2707, 2708, 2709,
+    2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721,
+    2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733,
+    2734, 2735, 2736, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748,
+    2749, 2750, 2751, 2758, 2874, 2888, 3056, 3310, 3315, 3316, 3317, 3318,
+    3319, 3320, 3321, 3397, 3458, 3459, 3464, 3465, 3466, 3467, 3474, 3479,
+    3480, 3519, 3553, 3572, 3699, 3702, 3709, 3928, 3929, 3930, 3931, 3963,
+    3977, 3978, 3979, 3980, 3981, 3991, 3992, 3995, 3996, 3998, 4006, 4007,
+    4008, 4016, 4017, 4019, 4020, 4021, 4022, 4023, 4024, 4078, 4277, 4479,
+    4480, 4481, 4482, 4483, 4484, 4486, 4487, 4488, 4489, 4490, 4491, 4492,
+    4493, 4494, 4495, 4496, 4497, 4498, 4499, 4500, 4501, 2235, 2645, 2737,
+    2738, 2739, 2760, 2761, 2763, 2764, 2765, 2766, 2767, 2768, 2769, 2770,
+    2771, 2792, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805,
+    2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816, 2817,
+    2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829,
+    2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 2838, 2839, 2840, 2841,
+    2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853,
+    2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862, 2863, 2864, 2865,
+    2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2875, 2876, 2877, 2878,
+    2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886, 2887, 2889, 2890, 2891,
+    2892, 2893, 2894, 2895, 2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903,
+    2904, 2905, 2906, 2907, 2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915,
+    2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 2927,
+    2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973, 2974,
+    2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986,
+    2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998,
+    2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010,
+    3011, 3012, 3013, 3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022,
+    3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034,
+    3035, 3036, 3037, 3039, 3040, 3041, 3042, 3043, 3044, 3045, 3046, 3047,
+    3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3057, 3058, 3059, 3060,
+    3061, 3062, 3063, 3064, 3065, 3066, 3067, 3068, 3069, 3070, 3071, 3072,
+    3073, 3074, 3075, 3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084,
+    3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096,
+    3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108,
+    3109, 3110, 3111, 3112, 3113, 3114, 3115, 3117, 3118, 3119, 3120, 3121,
+    3122, 3123, 3124, 3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133,
+    3134, 3135, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145,
+    3146, 3147, 3148, 3149, 3150, 3151, 3152, 3153, 3154, 3155, 3156, 3157,
+    3158, 3159, 3160, 3161, 3162, 3227, 3228, 3229, 3230, 3231, 3235, 3332,
+    3333, 3334, 3478, 3481, 3482, 3483, 3494, 3495, 3496, 3497, 3498, 3499,
+    3500, 3501, 3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511,
+    3512, 3513, 3514, 3515, 3516, 3517, 3520, 3523, 3524, 3527, 3528, 3529,
+    3530, 3531, 3532, 3533, 3534, 3535, 3539, 3541, 3542, 3543, 3550, 3552,
+    3554, 3705, 3706, 3707, 3708, 3710, 3712, 3713, 4009, 4010, 4011, 4025,
+    4026, 4027, 4028, 4029, 4031, 4032, 4033, 4034, 4035, 4068, 4069, 4113,
+    4115, 4116, 4117, 4118, 4127, 4128, 4129, 4130, 4131, 4132, 4133, 4134,
+    4135, 4136, 4137, 4138, 4139, 4140, 4141, 4142, 4143, 4144, 4145, 4146,
+    4147, 4148, 4149, 4150, 4151, 4152, 4153, 4274, 4278, 4279, 4280, 4281,
+    4287, 4292, 4302, 4303, 4502, 4503, 4505, 4506, 4509, 4510, 4511, 4512,
+    4513, 4514, 4515, 4516, 4517, 4518, 4519, 4520, 4521, 2762, 2772, 2773,
+    2774, 2775, 2776, 2777, 2778, 2780, 2928, 2929, 2930, 2932, 2934, 2935,
+    2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2947, 2948,
+    2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956, 2957, 3163, 3164, 3165,
+    3166, 3167, 3168, 3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177,
+    3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3187, 3188, 3189,
+    3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3203,
+    3204, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 3232, 3233, 3234, 3236,
+    3237, 3238, 3239, 3240, 3241, 3242, 3248, 3360, 3386, 3389, 3392, 3393,
+    3394, 3484, 3485, 3486, 3487, 3540, 3544, 3545, 3546, 3599, 3600, 3601,
+    3711, 3714, 3715, 3716, 3717, 3756, 4018, 4036, 4039, 4040, 4041, 4042,
+    4043, 4044, 4045, 4046, 4049, 4050, 4051, 4052, 4053, 4054, 4055, 4056,
+    4060, 4062, 4063, 4064, 4065, 4066, 4067, 4070, 4071, 4072, 4073, 4074,
+    4075, 4076, 4077, 4100, 4298, 4301, 4304, 4305, 4306, 4307, 4308, 4309,
+    4310, 4311, 4504, 4507, 4508, 4544, 3212, 3213, 3214, 3215, 3216, 3217,
+    3218, 3219, 3220, 3221, 3222, 3223, 3224, 3225, 3226, 3243, 3244, 3245,
+    3246, 3377, 3378, 3379, 3380, 3381, 3383, 3384, 3387, 3388, 3390, 3536,
+    3551, 3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562, 3565, 3570, 3571,
+    3573, 3574, 3575, 3576, 3577, 3578, 3579, 3580, 3581, 3582, 3585, 3586,
+    3604, 3605, 3609, 3610, 3611, 3615, 3616, 3617, 3618, 3621, 3720, 3721,
+    3722, 3723, 3724, 3725, 3726, 3727, 3728, 3729, 3730, 3731, 3732, 3733,
+    3734, 3735, 3736, 3737, 3738, 3740, 3741, 3742, 3743, 3744, 3746, 3747,
+    3749, 3750, 3751, 3752, 3753, 3754, 3755, 3757, 3758, 3759, 3760, 3761,
+    3762, 3763, 3764, 3765, 3766, 3767, 3768, 3769, 3770, 3771, 3772, 3773,
+    3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782, 3783, 3784, 3785,
+    3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793, 3794, 3795, 3796, 3797,
+    3798, 3799, 3800, 3801, 3802, 3803, 3804, 3805, 3806, 3807, 4079, 4081,
+    4082, 4083, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 4102, 4103,
+    4105, 4282, 4299, 4522, 4528, 2779, 3201, 3202, 3249, 3250, 3312, 3382,
+    3385, 3547, 3548, 3583, 3584, 3587, 3588, 3589, 3590, 3596, 3602, 3603,
+    3613, 3614, 3620, 4057, 4058, 4059, 4061, 4080, 4106, 4109, 4111, 4114,
+    4119, 4120, 4121, 4122, 4123, 4125, 4126, 4154, 4155, 4156, 4157, 4158,
+    4159, 4166, 4167, 4168, 4169, 4170, 4171, 4172, 4173, 4174, 4175, 4176,
+    4177, 4178, 4179, 4180, 4181, 4182, 4183, 4184, 4185, 4186, 4187, 4188,
+    4189, 4190, 4192, 4193, 4194, 4195, 4196, 4197, 4198, 4199, 4200, 4202,
+    4203, 4204, 4205, 4206, 4207, 4208, 4209, 4210, 4211, 4212, 4213, 4214,
+    4215, 4216, 4217, 4218, 4220, 4221, 4222, 4223, 4225, 4226, 4227, 4228,
+    4229, 4231, 4232, 4233, 4234, 4235, 4236, 4238, 4239, 4240, 4241, 4242,
+    4245, 4246, 4248, 4249, 4251, 4252, 4253, 4254, 4255, 4256, 4257, 4258,
+    4259, 4260, 4261, 4262, 4263, 4264, 4265, 4266, 4267, 4268, 4269, 4275,
+    4283, 4284, 4285, 4290, 4291, 4293, 4294, 4295, 4296, 4297, 4300, 4312,
+    4313, 4314, 4315, 4316, 4317, 4318, 4319, 4320, 4321, 4322, 4323, 4324,
+    4325, 4326, 4327, 4328, 4329, 4330, 4331, 4332, 4333, 4334, 4335, 4336,
+    4337, 4339, 4340, 4341, 4342, 4343, 4344, 4345, 4346, 4347, 4348, 4349,
+    4350, 4351, 4352, 4353, 4354, 4355, 4356, 4357, 4358, 4359, 4360, 4361,
+    4362, 4364, 4367, 4368, 3566, 3568, 3591, 3606, 3607, 3608, 3612, 3619,
+    3622, 4092, 4093, 4094, 4095, 4096, 4097, 4098, 4099, 4101, 4104, 4160,
+    4161, 4162, 4163, 4164, 4165, 4270, 4271, 4272, 4273, 4338, 4363, 4365,
+    4366, 4369, 3247, 3567, 3569, 3592, 0, 3597, 3598, 4276, 4288, 4289,
+    4525, 4526, 4527, 4529, 4530, 4531, 4532, 4533, 4534, 4535, 4536, 4537,
+    4538, 4539, 4540, 4541, 4542, 4543, 4545, 4546, 4547, 4548, 4549, 4550,
+    4551, 4552, 4553, 4554, 4555, 4556, 4557, 4558, 4559, 4560, 4561, 4562,
+    4563, 4564, 4565, 4566, 4567, 3593, 3594, 3595, 4286, 3116,
+};
+
+static const atr_pattern_t AtrPattern[] = {
+    { 1694, 14, 0 },
+    { 232, 14, 14 },
+    { 81, 14, 28 },
+    { 71, 14, 42 },
+    { 3626, 16, 56 },
+    { 429, 16, 72 },
+    { 428, 16, 88 },
+    { 82, 16, 104 },
+    { 80, 16, 120 },
+    { 79, 16, 136 },
+    { 78, 16, 152 },
+    { 4390, 18, 168 },
+    { 1728, 18, 186 },
+    { 587, 18, 204 },
+    { 137, 18, 222 },
+    { 92, 18, 240 },
+    { 91, 18, 258 },
+    { 7, 18, 276 },
+    { 4474, 20, 294 },
+    { 3739, 20, 314 },
+    { 2463, 20, 334 },
+    { 2452, 20, 354 },
+    { 2450, 20, 374 },
+    { 253, 20, 394 },
+    { 552, 22, 414 },
+    { 108, 22, 436 },
+    { 3251, 24, 458 },
+    { 264, 24, 482 },
+    { 1892, 26, 506 },
+    { 1845, 26, 532 },
+    { 1381, 26, 558 },
+    { 657, 26, 584 },
+    { 648, 26, 610 },
+    { 639, 26, 636 },
+    { 638, 26, 662 },
+    { 269, 26, 688 },
+    { 268, 26, 714 },
+    { 2522, 28, 740 },
+    { 1407, 28, 768 },
+    { 671, 28, 796 },
+    { 664, 28, 824 },
+    { 3842, 30, 852 },
+    { 1427, 30, 882 },
+    { 1411, 30, 912 },
+    { 774, 30, 942 },
+    { 686, 30, 972 },
+    { 316, 30, 1002 },
+    { 3280, 32, 1032 },
+    { 3278, 32, 1064 },
+    { 1430, 32, 1096 },
+    { 1429, 32, 1128 },
+    { 3871, 34, 1160 },
+    { 3660, 34, 1194 },
+    { 2063, 34, 1228 },
+    { 2058, 34, 1262 },
+    { 849, 34, 1296 },
+    { 840, 34, 1330 },
+    { 3887, 36, 1364 },
+    { 1484, 36, 1400 },
+    { 1450, 36, 1436 },
+    { 956, 36, 1472 },
+    { 954, 36, 1508 },
+    { 883, 36, 1544 },
+    { 217, 36, 1580 },
+    { 3912, 38, 1616 },
+    { 3683, 38, 1654 },
+    { 3353, 38, 1692 },
+    { 3335, 38, 1730 },
+    { 2233, 38, 1768 },
+    { 1509, 38, 1806 },
+    { 1506, 38, 1844 },
+    { 1327, 38, 1882 },
+    { 1324, 38, 1920 },
+    { 1248, 38, 1958 },
+    { 1245, 38, 1996 },
+    { 1184, 38, 2034 },
+    { 1143, 38, 2072 },
+    { 1105, 38, 2110 },
+    { 1104, 38, 2148 },
+    { 1029, 38, 2186 },
+    { 1024, 38, 2224 },
+    { 4469, 40, 2262 },
+    { 3960, 40, 2302 },
+    { 3954, 40, 2342 },
+    { 3947, 40, 2382 },
+    { 2793, 40, 2422 },
+    { 2422, 40, 2462 },
+    { 2414, 40, 2502 },
+    { 2412, 40, 2542 },
+    { 2411, 40, 2582 },
+    { 2410, 40, 2622 },
+    { 2409, 40, 2662 },
+    { 2408, 40, 2702 },
+    { 2402, 40, 2742 },
+    { 2399, 40, 2782 },
+    { 2398, 40, 2822 },
+    { 2394, 40, 2862 },
+    { 2392, 40, 2902 },
+    { 2391, 40, 2942 },
+    { 2380, 40, 2982 },
+    { 2379, 40, 3022 },
+    { 2378, 40, 3062 },
+    { 2376, 40, 3102 },
+    { 2375, 40, 3142 },
+    { 2374, 40, 3182 },
+    { 2373, 40, 3222 },
+    { 2372, 40, 3262 },
+    { 2371, 40, 3302 },
+    { 2370, 40, 3342 },
+    { 2369, 40, 3382 },
+    { 2368, 40, 3422 },
+    { 2367, 40, 3462 },
+    { 2366, 40, 3502 },
+    { 2365, 40, 3542 },
+    { 2364, 40, 3582 },
+    { 2363, 40, 3622 },
+    { 2362, 40, 3662 },
+    { 2361, 40, 3702 },
+    { 2360, 40, 3742 },
+    { 2359, 40, 3782 },
+    { 2358, 40, 3822 },
+    { 2357, 40, 3862 },
+    { 2356, 40, 3902 },
+    { 2355, 40, 3942 },
+    { 2354, 40, 3982 },
+    { 2353, 40, 4022 },
+    { 2352, 40, 4062 },
+    { 2351, 40, 4102 },
+    { 2350, 40, 4142 },
+    { 2349, 40, 4182 },
+    { 2348, 40, 4222 },
+    { 2347, 40, 4262 },
+    { 2346, 40, 4302 },
+    { 2345, 40, 4342 },
+    { 2344, 40, 4382 },
+    { 2343, 40, 4422 },
+    { 2342, 40, 4462 },
+    { 2341, 40, 4502 },
+    { 2340, 40, 4542 },
+    { 2339, 40, 4582 },
+    { 2338, 40, 4622 },
+    { 2337, 40, 4662 },
+    { 2336, 40, 4702 },
+    { 2335, 40, 4742 },
+    { 2334, 40, 4782 },
+    { 2333, 40, 4822 },
+    { 2332, 40, 4862 },
+    { 2331, 40, 4902 },
+    { 2330, 40, 4942 },
+    { 2329, 40, 4982 },
+    { 2328, 40, 5022 },
+    { 2327, 40, 5062 },
+    { 2326, 40, 5102 },
+    { 2325, 40, 5142 },
+    { 2324, 40, 5182 },
+    { 2323, 40, 5222 },
+    { 2322, 40, 5262 },
+    { 2321, 40, 5302 },
+    { 2320, 40, 5342 },
+    { 2319, 40, 5382 },
+    { 2318, 40, 5422 },
+    { 2317, 40, 5462 },
+    { 2316, 40, 5502 },
+    { 2315, 40, 5542 },
+    { 2309, 40, 5582 },
+    { 2294, 40, 5622 },
+    { 2283, 40, 5662 },
+    { 1633, 40, 5702 },
+    { 1632, 40, 5742 },
+    { 1528, 40, 5782 },
+    { 1527, 40, 5822 },
+    { 1526, 40, 5862 },
+    { 1525, 40, 5902 },
+    { 6, 40, 5942 },
+    { 4, 40, 5982 },
+    { 4485, 42, 6022 },
+    { 3997, 42, 6064 },
+    { 3719, 42, 6106 },
+    { 3718, 42, 6148 },
+    { 4030, 44, 6190 },
+    { 3704, 44, 6234 },
+    { 3367, 44, 6278 },
+    { 3038, 44, 6322 },
+    { 2752, 44, 6366 },
+    { 4037, 46, 6410 },
+    { 2946, 46, 6456 },
+    { 2933, 46, 6502 },
+    { 2931, 46, 6548 },
+    { 2, 46, 6594 },
+    { 4110, 48, 6640 },
+    { 3748, 48, 6688 },
+    { 3391, 48, 6736 },
+    { 3376, 48, 6784 },
+    { 3375, 48, 6832 },
+    { 3374, 48, 6880 },
+    { 3373, 48, 6928 },
+    { 3372, 48, 6976 },
+    { 3371, 48, 7024 },
+    { 3370, 48, 7072 },
+    { 3369, 48, 7120 },
+    { 3368, 48, 7168 },
+    { 5, 48, 7216 },
+    { 3, 48, 7264 },
+    { 4250, 50, 7312 },
+    { 4247, 50, 7362 },
+    { 4244, 50, 7412 },
+    { 4243, 50, 7462 },
+    { 4237, 50, 7512 },
+    { 4230, 50, 7562 },
+    { 4224, 50, 7612 },
+    { 4219, 50, 7662 },
+    { 4201, 50, 7712 },
+    { 4191, 50, 7762 },
+    { 4124, 50, 7812 },
+    { 4108, 50, 7862 },
+    { 4107, 50, 7912 },
+    { 4524, 54, 7962 },
+    { 4523, 54, 8016 },
+};
+
+static const uint32_t AtrPatternSets[] = {
+    0x00008, 0x00800, 0x00100, 0x00004, 0x00100, 0x00001, 0x00001, 0x00002, 0x00001, 0x00004, 0x00010, 0x00010, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00004, 0x00010, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00010, 0x00020,
+    0x00008, 0x00800, 0x00001, 0x00040, 0x00002, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00001, 0x00040, 0x00001, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x04000, 0x00004, 0x00001, 0x00001, 0x00001, 0x00001, 0x00010, 0x00001, 0x00004, 0x00001, 0x00010, 0x00200, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00040, 0x00010, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00040, 0x00004, 0x00001, 0x1FFFF, 0x00020, 0x00002,
+    0x00008, 0x00800, 0x00040, 0x00010, 0x1FFFF, 0x1FFFF, 0x08000, 0x08000, 0x00100, 0x00001, 0x00040, 0x00004, 0x1FFFF, 0x1FFFF, 0x00400, 0x00004,
+    0x00008, 0x00800, 0x00001, 0x00040, 0x00002, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00001, 0x00040, 0x00001, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00001, 0x00040, 0x00001, 0x00004, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00001, 0x00040, 0x00001, 0x00002, 0x00001, 0x00004, 0x00002, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x08000, 0x00040, 0x00020, 0x00004, 0x00020, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00010, 0x00040, 0x01000, 0x00200, 0x00001, 0x1FFFF, 0x00001,
+    0x00008, 0x00800, 0x00100, 0x00020, 0x00010, 0x00001, 0x00004, 0x00001, 0x00040, 0x00100, 0x00001, 0x00002, 0x00001, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00040, 0x00080, 0x00004, 0x00020, 0x00001, 0x00001, 0x00040, 0x00004, 0x00004, 0x00010, 0x00008, 0x00008, 0x00001, 0x00008, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00002, 0x00040, 0x00200, 0x00010, 0x00100, 0x00002, 0x00002, 0x00001, 0x00001, 0x00040, 0x00001, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00001, 0x00080, 0x00040, 0x00010, 0x00001, 0x00100, 0x00002, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00001, 0x00080, 0x00040, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00010, 0x00002, 0x00080, 0x00008, 0x00080, 0x00010, 0x00080, 0x00004, 0x00040, 0x00200, 0x00040, 0x00010,
+    0x00008, 0x08000, 0x04000, 0x08000, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x1FFFF, 0x1FFFF, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008,
+    0x00008, 0x00800, 0x04000, 0x08000, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x1FFFF, 0x1FFFF, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008,
+    0x00008, 0x00800, 0x00200, 0x00020, 0x00200, 0x00020, 0x00010, 0x00001, 0x08000, 0x08000, 0x02000, 0x00001, 0x00001, 0x00001, 0x00020, 0x00010, 0x00001, 0x00002, 0x00008, 0x1FFFF,
+    0x00008, 0x00800, 0x00200, 0x00020, 0x00002, 0x00020, 0x00010, 0x00001, 0x1FFFF, 0x1FFFF, 0x00040, 0x00100, 0x00001, 0x00002, 0x00001, 0x00004, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00200, 0x00020, 0x1FFFF, 0x1FFFF, 0x00010, 0x00001, 0x08000, 0x08000, 0x00040, 0x00004, 0x00001, 0x00002, 0x00001, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00004, 0x00080, 0x00001, 0x00001, 0x00100, 0x00001, 0x00040, 0x00020, 0x00400, 0x00004, 0x1FFFF, 0x1FFFF, 0x00001, 0x00002, 0x00001, 0x00002, 0x00008, 0x00080,
+    0x00008, 0x00800, 0x00040, 0x00080, 0x00001, 0x00001, 0x00001, 0x00001, 0x00080, 0x00008, 0x00004, 0x00001, 0x00001, 0x00001, 0x00040, 0x01000, 0x1FFFF, 0x1FFFF, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00001, 0x08000, 0x08000, 0x08000, 0x01000, 0x00002, 0x00800, 0x00020, 0x01000, 0x01000, 0x00080, 0x00004, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00400, 0x00080, 0x00001, 0x00001, 0x00010, 0x00001, 0x1FFFF, 0x1FFFF, 0x00100, 0x00001, 0x00040, 0x00020, 0x00400, 0x00004, 0x00001, 0x00100, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00004, 0x00200, 0x00001, 0x00001, 0x00100, 0x00001, 0x00080, 0x00004, 0x00400, 0x00010, 0x00010, 0x00020, 0x00040, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x00100, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00040, 0x00040, 0x00800, 0x00001, 0x00001, 0x00080, 0x00001, 0x00002, 0x00001, 0x00002, 0x00001, 0x00080, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x00100, 0x00100, 0x00001, 0x00001, 0x00002, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00800, 0x00008, 0x00080, 0x00002, 0x00080, 0x00002, 0x1FFFF, 0x00001, 0x1FFFF, 0x00400,
+    0x00008, 0x00800, 0x00080, 0x00100, 0x00002, 0x00100, 0x00001, 0x00001, 0x00001, 0x00001, 0x00020, 0x00010, 0x00010, 0x00100, 0x00004, 0x00001, 0x00010, 0x04000, 0x00010, 0x00200, 0x00010, 0x00010, 0x00004, 0x00001, 0x00008, 0x1FFFF,
+    0x00008, 0x00800, 0x00040, 0x00200, 0x00001, 0x00001, 0x00001, 0x00004, 0x00010, 0x00002, 0x00010, 0x00008, 0x00010, 0x08000, 0x00020, 0x00008, 0x00010, 0x00400, 0x00080, 0x00040, 0x00008, 0x00004, 0x00008, 0x00001, 0x00008, 0x1FFFF,
+    0x00008, 0x00800, 0x00040, 0x00200, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00040, 0x00020, 0x00400, 0x00004, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00080, 0x00004, 0x02000, 0x00040,
+    0x00008, 0x00800, 0x00040, 0x00200, 0x00001, 0x00001, 0x00001, 0x00001, 0x00010, 0x00200, 0x00010, 0x00010, 0x00008, 0x00040, 0x00008, 0x00001, 0x00020, 0x00040, 0x00008, 0x00002, 0x00004, 0x04000, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00040, 0x00200, 0x00001, 0x00001, 0x00001, 0x00001, 0x00010, 0x00200, 0x00010, 0x00010, 0x00008, 0x00020, 0x00008, 0x00001, 0x00020, 0x00040, 0x00008, 0x00002, 0x00004, 0x04000, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00004, 0x00400, 0x00001, 0x00001, 0x00100, 0x00001, 0x00040, 0x00020, 0x00400, 0x00004, 0x00001, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00080, 0x00004, 0x02000, 0x00040, 0x00010, 0x00008,
+    0x00008, 0x00800, 0x00004, 0x00400, 0x00001, 0x00001, 0x00100, 0x00001, 0x00040, 0x00020, 0x00400, 0x00004, 0x00001, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00080, 0x00004, 0x02000, 0x00040, 0x00010, 0x00002,
+    0x00008, 0x00800, 0x00200, 0x00400, 0x00200, 0x00010, 0x00001, 0x00001, 0x00200, 0x00004, 0x00001, 0x00004, 0x00080, 0x00020, 0x00200, 0x00008, 0x00002, 0x00002, 0x00001, 0x00001, 0x00001, 0x00002, 0x00001, 0x00004, 0x00001, 0x00004, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00080, 0x00200, 0x00200, 0x00040, 0x00001, 0x00001, 0x00001, 0x00001, 0x00020, 0x00010, 0x00010, 0x00100, 0x00004, 0x00001, 0x00010, 0x04000, 0x00010, 0x00200, 0x00010, 0x00010, 0x00004, 0x00001, 0x00008, 0x00002, 0x00008, 0x1FFFF,
+    0x00008, 0x00800, 0x00040, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00040, 0x00020, 0x00400, 0x00004, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00080, 0x00004, 0x02000, 0x00040, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00040, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x00010, 0x00010, 0x00008, 0x00002, 0x00008, 0x00002, 0x00010, 0x00008, 0x00020, 0x00004, 0x00001, 0x00004, 0x00001, 0x00001, 0x00004, 0x00020, 0x01000, 0x00008,
+    0x00008, 0x00800, 0x08000, 0x00020, 0x00200, 0x00040, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x1FFFF, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00010, 0x02000, 0x00080, 0x00200, 0x00010, 0x00020, 0x00010, 0x00200, 0x00010, 0x00010, 0x00002, 0x1FFFF,
+    0x00008, 0x00800, 0x00080, 0x00400, 0x00200, 0x00080, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00040, 0x00020, 0x00800, 0x00001, 0x00100, 0x00020, 0x00004, 0x00001, 0x00001, 0x00010, 0x00001, 0x00004, 0x00080, 0x00004, 0x02000, 0x00040, 0x00010, 0x1FFFF,
+    0x00008, 0x00800, 0x00080, 0x00400, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00040, 0x00020, 0x00400, 0x00004, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00080, 0x00004, 0x02000, 0x00040, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00040, 0x00800, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00040, 0x00020, 0x00800, 0x00001, 0x00100, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00008, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00040, 0x00800, 0x1FFFF, 0x1FFFF, 0x08000, 0x08000, 0x00100, 0x00001, 0x00040, 0x00004, 0x1FFFF, 0x1FFFF, 0x00400, 0x00004, 0x00020, 0x00040, 0x00010, 0x00040, 0x00040, 0x00200, 0x00040, 0x04000, 0x00010, 0x00020, 0x00010, 0x00200, 0x00010, 0x00010,
+    0x00008, 0x00800, 0x00008, 0x00800, 0x00200, 0x00010, 0x00001, 0x00001, 0x00010, 0x08000, 0x00008, 0x00010, 0x00002, 0x00001, 0x00004, 0x00001, 0x00001, 0x00002, 0x00001, 0x1FFFF, 0x1FFFF, 0x00001, 0x00008, 0x00008, 0x00008, 0x00008, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00800, 0x00080, 0x00002, 0x00002, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x00200, 0x00001, 0x00020, 0x00008, 0x00800, 0x00020, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00800, 0x00080, 0x00002, 0x00002, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x00200, 0x00001, 0x00010, 0x00008, 0x00400, 0x00020, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00080, 0x00800, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00040, 0x00020, 0x00800, 0x00001, 0x00100, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00008, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00080, 0x00800, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00040, 0x00004, 0x00001, 0x1FFFF, 0x00020, 0x00002, 0x00020, 0x00040, 0x00010, 0x00040, 0x00040, 0x00200, 0x00040, 0x04000, 0x00010, 0x00020, 0x00010, 0x00200, 0x00010, 0x00010,
+    0x00008, 0x00800, 0x08000, 0x00080, 0x00002, 0x00008, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00010, 0x00400, 0x00010, 0x00008, 0x00010, 0x08000, 0x00020, 0x00001, 0x00008, 0x00004, 0x00008, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x04000, 0x00100, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00010, 0x00400, 0x00010, 0x00008, 0x00010, 0x08000, 0x00020, 0x00001, 0x00080, 0x00040, 0x00008, 0x00004, 0x00008, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x01000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00020, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x04000, 0x00002, 0x08000, 0x00008, 0x00020, 0x04000, 0x00002, 0x00002, 0x00080, 0x00080, 0x00100, 0x00002, 0x04000, 0x00002, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x01000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00001, 0x00010, 0x00010, 0x00008, 0x08000, 0x02000, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00040, 0x02000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00008, 0x00002, 0x00100, 0x00001, 0x00040, 0x00020, 0x00800, 0x00001, 0x00100, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00008, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00040, 0x02000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00020, 0x00080, 0x00010, 0x00010, 0x00008, 0x00040, 0x00010, 0x00002, 0x00001, 0x00002, 0x00100, 0x00040, 0x00200, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x00100, 0x00002, 0x00008, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00010, 0x00400, 0x00010, 0x00008, 0x00010, 0x08000, 0x00020, 0x00001, 0x00080, 0x00040, 0x00008, 0x00004, 0x00008, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00080, 0x02000, 0x00200, 0x00020, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00008, 0x00002, 0x00100, 0x00001, 0x00040, 0x00020, 0x00800, 0x00001, 0x00100, 0x00008, 0x00002, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00008, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00080, 0x02000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00008, 0x00002, 0x00100, 0x00001, 0x00040, 0x00020, 0x00800, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00008, 0x1FFFF, 0x1FFFF, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00040, 0x04000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00040, 0x00004, 0x00002, 0x00040, 0x00010, 0x00008, 0x1FFFF, 0x1FFFF, 0x00010, 0x00002, 0x00020, 0x00040, 0x00010, 0x00002, 0x00010, 0x04000, 0x00020, 0x00010, 0x00002, 0x00001, 0x00100, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00040, 0x04000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00040, 0x00004, 0x1FFFF, 0x1FFFF, 0x00010, 0x00008, 0x00020, 0x00080, 0x00010, 0x00002, 0x00020, 0x00040, 0x00010, 0x00002, 0x00010, 0x04000, 0x00020, 0x00010, 0x00002, 0x00001, 0x00100, 0x00002, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00040, 0x04000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00002, 0x01000, 0x00001, 0x00040, 0x00020, 0x00080, 0x00080, 0x00800, 0x00008, 0x00001, 0x00002, 0x00001, 0x00001, 0x00080, 0x00001, 0x00080, 0x00002, 0x02000, 0x00040, 0x00100, 0x01000, 0x00040, 0x00002, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00002, 0x08000, 0x00002, 0x00002, 0x00100, 0x00001, 0x00040, 0x00400, 0x00100, 0x00001, 0x00008, 0x00010, 0x00010, 0x00040, 0x00010, 0x00200, 0x00020, 0x00008, 0x00010, 0x00020, 0x00020, 0x00008, 0x00200, 0x00010, 0x00001, 0x00001, 0x08000, 0x08000, 0x00001, 0x00080, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x00200, 0x00002, 0x00008, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00010, 0x00400, 0x00010, 0x00008, 0x00010, 0x08000, 0x00020, 0x00001, 0x00008, 0x00004, 0x00008, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x04000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x00004, 0x00001, 0x00010, 0x00008, 0x00100, 0x00001, 0x00040, 0x00020, 0x00400, 0x00004, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00080, 0x00004, 0x02000, 0x00040, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00800, 0x04000, 0x00002, 0x00100, 0x00001, 0x00001, 0x00001, 0x00001, 0x00010, 0x00002, 0x00001, 0x00020, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00800, 0x04000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00010, 0x00002, 0x00001, 0x00020, 0x00004, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00100, 0x04000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00008, 0x00002, 0x00100, 0x00001, 0x00040, 0x00040, 0x00800, 0x00002, 0x00100, 0x00010, 0x00001, 0x01000, 0x00001, 0x00002, 0x00040, 0x04000, 0x00001, 0x00002, 0x00100, 0x00008, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00080, 0x04000, 0x00002, 0x00008, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00040, 0x00400, 0x00002, 0x00002, 0x00040, 0x00008, 0x00020, 0x00010, 0x00001, 0x00020, 0x00010, 0x00100, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00002, 0x00004, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00080, 0x04000, 0x00002, 0x00002, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00040, 0x00400, 0x00002, 0x00002, 0x00040, 0x00008, 0x00020, 0x00010, 0x00001, 0x00100, 0x00008, 0x00001, 0x00004, 0x00010, 0x00001, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00004, 0x00002, 0x00200, 0x00001, 0x00001, 0x00002,
+    0x00008, 0x00800, 0x00040, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00040, 0x00040, 0x00800, 0x00001, 0x00001, 0x00080, 0x00001, 0x00002, 0x00001, 0x00002, 0x00080, 0x00080, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00040, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00040, 0x00040, 0x00800, 0x00001, 0x00001, 0x00080, 0x00001, 0x00002, 0x00001, 0x00002, 0x00001, 0x00080, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00040, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00020, 0x00400, 0x00004, 0x01000, 0x00004, 0x00008, 0x01000, 0x00008, 0x00002, 0x00001, 0x00002, 0x00001, 0x00001, 0x00020, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00040, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00020, 0x00400, 0x00004, 0x01000, 0x00004, 0x00008, 0x01000, 0x00004, 0x00002, 0x00001, 0x00002, 0x00001, 0x00001, 0x00020, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00040, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00020, 0x00400, 0x00004, 0x00100, 0x00002, 0x00002, 0x00010, 0x00004, 0x00002, 0x00001, 0x00002, 0x00004, 0x00004, 0x00800, 0x00004, 0x00040, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00040, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00020, 0x00400, 0x00001, 0x00400, 0x00001, 0x00002, 0x00001, 0x00004, 0x00004, 0x00001, 0x00001, 0x00008, 0x00002, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00040, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00020, 0x00400, 0x00001, 0x00100, 0x00001, 0x00040, 0x00001, 0x00100, 0x00004, 0x00001, 0x00001, 0x00004, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00040, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00020, 0x00400, 0x00001, 0x00100, 0x00001, 0x00008, 0x00002, 0x00010, 0x00001, 0x00001, 0x00001, 0x00004, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00040, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00040, 0x00080, 0x00004, 0x1FFFF, 0x00010, 0x00008, 0x00010, 0x00040, 0x00010, 0x00200, 0x00020, 0x00008, 0x00010, 0x00020, 0x00002, 0x00004, 0x00020, 0x00004, 0x00040, 0x00040, 0x08000, 0x08000, 0x00100, 0x00002, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00040, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00040, 0x00040, 0x00010, 0x02000, 0x00010, 0x00020, 0x00040, 0x00040, 0x00100, 0x00001, 0x00001, 0x00008, 0x1FFFF, 0x1FFFF, 0x00020, 0x00008, 0x00001, 0x00040, 0x00040, 0x00002, 0x00001, 0x00008, 0x08000, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x08000, 0x00080, 0x08000, 0x00002, 0x00008, 0x00004, 0x00020, 0x00001, 0x00008, 0x00008, 0x00100, 0x00800, 0x00001, 0x00001, 0x00010, 0x08000, 0x08000, 0x08000, 0x08000, 0x00010, 0x00400, 0x00020, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00004, 0x00200, 0x00010, 0x00100, 0x00020, 0x00020, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x00400, 0x00002, 0x00008, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00010, 0x00400, 0x00010, 0x00008, 0x00010, 0x08000, 0x00020, 0x00001, 0x00080, 0x00040, 0x00008, 0x00004, 0x00008, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x00400, 0x00002, 0x00008, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00010, 0x00400, 0x00010, 0x00008, 0x00010, 0x08000, 0x00020, 0x00001, 0x00008, 0x1FFFF, 0x00008, 0x1FFFF, 0x00020, 0x00040, 0x00008, 0x00004, 0x00008, 0x00008, 0x00008, 0x00004, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x00400, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x1FFFF, 0x1FFFF, 0x00010, 0x00008, 0x00100, 0x00001, 0x00040, 0x00020, 0x00400, 0x00004, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00080, 0x00004, 0x02000, 0x00040, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00200, 0x08000, 0x00200, 0x00010, 0x00010, 0x00001, 0x00002, 0x04000, 0x00001, 0x00001, 0x00040, 0x00080, 0x1FFFF, 0x1FFFF, 0x00010, 0x00008, 0x00010, 0x00040, 0x00010, 0x00200, 0x00020, 0x00008, 0x00010, 0x00020, 0x00002, 0x00001, 0x00020, 0x00004, 0x00040, 0x00040, 0x08000, 0x08000, 0x00100, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00040, 0x00040, 0x00800, 0x00001, 0x00001, 0x00080, 0x00001, 0x00002, 0x00001, 0x00002, 0x00001, 0x00080, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00010, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00002, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00001, 0x08000, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00001, 0x04000, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00001, 0x02000, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00001, 0x01000, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00001, 0x00800, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00001, 0x00400, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00001, 0x00200, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00001, 0x00080, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00001, 0x00020, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00001, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00001, 0x00004, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00001, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x02000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x01000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00800, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00200, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00100, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00080, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00040, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00020, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00010, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00008, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00004, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00002, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x04000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x02000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x01000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x00800, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x00100, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x00080, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x00040, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x00020, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x00010, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x00008, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x00004, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x00002, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00004, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x04000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x02000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x01000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x00800, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x00200, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x00080, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x00040, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x00020, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x00010, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x00008, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x00004, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x00002, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00002, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x04000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x02000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x01000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00800, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00080, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00040, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00010, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00004, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00002, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00010, 0x08000, 0x00001, 0x01000, 0x00400, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00008, 0x00001, 0x00040, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00008, 0x00002, 0x04000, 0x00001, 0x00040, 0x00800, 0x00001, 0x00010, 0x00008, 0x00002, 0x00001, 0x00020, 0x00001, 0x00004, 0x02000, 0x00002, 0x00020, 0x00020, 0x00020, 0x00020, 0x00020, 0x00020, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00100, 0x00001, 0x00008, 0x00002, 0x00100, 0x00001, 0x00040, 0x00020, 0x00800, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00002, 0x00004, 0x00001, 0x08000, 0x08000, 0x04000, 0x00100, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00100, 0x08000, 0x00100, 0x00001, 0x00001, 0x00002, 0x00010, 0x00020, 0x00020, 0x00001, 0x00010, 0x00002, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00080, 0x08000, 0x00200, 0x00040, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00040, 0x00400, 0x00010, 0x00010, 0x00010, 0x04000, 0x00010, 0x00200, 0x00040, 0x00020, 0x00002, 0x00001, 0x00001, 0x00002, 0x00080, 0x00080, 0x00200, 0x00100, 0x00001, 0x1FFFF, 0x00002, 0x00002, 0x00001, 0x00008, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00080, 0x08000, 0x00200, 0x00040, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00040, 0x00400, 0x00010, 0x00010, 0x00010, 0x04000, 0x00010, 0x00200, 0x00040, 0x00020, 0x00002, 0x00001, 0x00001, 0x00002, 0x00001, 0x00002, 0x00020, 0x00020, 0x00001, 0x00010, 0x1FFFF, 0x1FFFF, 0x00001, 0x00008, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00080, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00008, 0x00002, 0x00100, 0x00001, 0x00040, 0x00020, 0x00800, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00002, 0x00004, 0x00001, 0x08000, 0x08000, 0x04000, 0x00100, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00080, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00001, 0x00008, 0x00002, 0x1FFFF, 0x1FFFF, 0x00040, 0x00020, 0x00800, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00004, 0x00200, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00080, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00040, 0x00400, 0x00010, 0x00008, 0x00010, 0x00020, 0x00020, 0x00004, 0x00010, 0x00020, 0x00020, 0x00008, 0x00001, 0x00004, 0x00004, 0x01000, 0x00008, 0x00010, 0x00001, 0x00008, 0x1FFFF, 0x1FFFF, 0x00001, 0x00008, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x00080, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00040, 0x00400, 0x00010, 0x00008, 0x00010, 0x00020, 0x00020, 0x00004, 0x00010, 0x00020, 0x00020, 0x00008, 0x00001, 0x00004, 0x00004, 0x01000, 0x00008, 0x00010, 0x00001, 0x00004, 0x1FFFF, 0x1FFFF, 0x00001, 0x00008, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00002, 0x00800, 0x00100, 0x00040, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00080, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001, 0x00400, 0x00008,
+    0x00008, 0x00800, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00002, 0x00800, 0x00100, 0x00040, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00080, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x08000, 0x08000, 0x02000, 0x00002, 0x00008, 0x00004, 0x00020, 0x00001, 0x00004, 0x00020, 0x00001, 0x00100, 0x00001, 0x00001, 0x08000, 0x1FFFF, 0x1FFFF, 0x00800, 0x00001, 0x1FFFF, 0x1FFFF, 0x00040, 0x00200, 0x08000, 0x08000, 0x00010, 0x00400, 0x00020, 0x00001, 0x02000, 0x00001, 0x00100, 0x00001, 0x00001, 0x00001, 0x00010, 0x00200, 0x00020, 0x00010, 0x00001, 0x00008,
+    0x00008, 0x00800, 0x08000, 0x00800, 0x00002, 0x00008, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00010, 0x00400, 0x00010, 0x00008, 0x00010, 0x08000, 0x00020, 0x00001, 0x00020, 0x00008, 0x00008, 0x1FFFF, 0x00008, 0x1FFFF, 0x00020, 0x00040, 0x00008, 0x00004, 0x00008, 0x00008, 0x00008, 0x00004, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x04000, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00010, 0x00001, 0x00002, 0x00010, 0x00100, 0x00001, 0x00004, 0x00020, 0x00010, 0x00008, 0x00010, 0x00020, 0x00020, 0x00004, 0x00010, 0x00020, 0x00020, 0x00008, 0x00020, 0x00080, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00002, 0x00001, 0x00004, 0x00001, 0x00008, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x04000, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00010, 0x00001, 0x00002, 0x00010, 0x00100, 0x00001, 0x00004, 0x00020, 0x00010, 0x00008, 0x00010, 0x00020, 0x00020, 0x00004, 0x00010, 0x00020, 0x00020, 0x00008, 0x00020, 0x00080, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00002, 0x00001, 0x00002, 0x00001, 0x00008, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x08000, 0x01000, 0x00002, 0x00100, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x00100, 0x00001, 0x00010, 0x00020, 0x00200, 0x00001, 0x00040, 0x00080, 0x00010, 0x00040, 0x00010, 0x00400, 0x00001, 0x00001, 0x00040, 0x00100, 0x00001, 0x00100, 0x00001, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF,
+    0x00008, 0x00800, 0x04000, 0x02000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x00004, 0x00001, 0x00010, 0x00008, 0x00100, 0x00001, 0x00008, 0x00002, 0x00100, 0x00001, 0x00040, 0x00020, 0x00800, 0x00001, 0x00100, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00008, 0x00001, 0x00001, 0x00200, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00800, 0x04000, 0x00200, 0x00040, 0x00001, 0x00001, 0x00100, 0x00001, 0x00002, 0x08000, 0x01000, 0x00080, 0x00100, 0x00001, 0x00008, 0x00002, 0x04000, 0x00001, 0x00080, 0x00008, 0x08000, 0x04000, 0x00004, 0x00002, 0x00002, 0x00008, 0x00040, 0x00004, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF, 0x00100, 0x00008, 0x00100, 0x00002, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00200, 0x08000, 0x00200, 0x00040, 0x00100, 0x00001, 0x00002, 0x08000, 0x01000, 0x00080, 0x00100, 0x00001, 0x00008, 0x00002, 0x04000, 0x00001, 0x00080, 0x00008, 0x08000, 0x04000, 0x00004, 0x00002, 0x1FFFF, 0x1FFFF, 0x00040, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00008, 0x1FFFF, 0x1FFFF, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00200, 0x08000, 0x1FFFF, 0x1FFFF, 0x00100, 0x00001, 0x00002, 0x08000, 0x01000, 0x00008, 0x00001, 0x00001, 0x00040, 0x00100, 0x00002, 0x1FFFF, 0x00010, 0x00010, 0x00001, 0x00020, 0x00001, 0x00002, 0x00010, 0x00040, 0x00010, 0x00200, 0x00020, 0x00008, 0x00010, 0x00020, 0x00008, 0x00002, 0x01000, 0x00100, 0x1FFFF, 0x1FFFF, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x02000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x1FFFF, 0x1FFFF, 0x00010, 0x00008, 0x00100, 0x00001, 0x00008, 0x00002, 0x00100, 0x00001, 0x00040, 0x00020, 0x00800, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00008, 0x1FFFF, 0x1FFFF, 0x00200, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00200, 0x08000, 0x00200, 0x00020, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00200, 0x08000, 0x00001, 0x00001, 0x00040, 0x00040, 0x00010, 0x00040, 0x00020, 0x00008, 0x00001, 0x00020, 0x00004, 0x00008, 0x00001, 0x00001, 0x00004, 0x00020, 0x00080, 0x00002, 0x02000, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF,
+    0x00008, 0x00800, 0x00200, 0x08000, 0x00200, 0x00020, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00200, 0x08000, 0x00001, 0x00001, 0x00040, 0x00040, 0x00010, 0x00040, 0x00020, 0x00008, 0x00001, 0x00020, 0x00001, 0x00002, 0x00001, 0x00001, 0x00002, 0x00002, 0x00080, 0x00002, 0x02000, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00200, 0x08000, 0x00200, 0x00020, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00200, 0x08000, 0x00001, 0x00001, 0x00040, 0x00020, 0x00010, 0x00040, 0x00020, 0x00008, 0x00001, 0x00020, 0x1FFFF, 0x1FFFF, 0x00001, 0x00040, 0x00080, 0x00002, 0x02000, 0x08000, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00002, 0x00800, 0x00100, 0x00040, 0x00010, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00080, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x08000, 0x08000, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x1FFFF, 0x1FFFF, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x04000, 0x08000, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x00020, 0x00001, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00800, 0x08000, 0x00200, 0x00040, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00020, 0x02000, 0x00001, 0x00001, 0x00040, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00008, 0x00002, 0x01000, 0x00001, 0x00080, 0x00008, 0x08000, 0x00080, 0x00001, 0x00002, 0x02000, 0x00001, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00800, 0x08000, 0x00002, 0x00002, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x1FFFF, 0x1FFFF, 0x00010, 0x00020, 0x00010, 0x00020, 0x00020, 0x00001, 0x00010, 0x00002, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00800, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00020, 0x02000, 0x00001, 0x00001, 0x00040, 0x00010, 0x00001, 0x00020, 0x00200, 0x00002, 0x00001, 0x00008, 0x1FFFF, 0x1FFFF, 0x00008, 0x00002, 0x01000, 0x00001, 0x00080, 0x00008, 0x08000, 0x00080, 0x00001, 0x00002, 0x02000, 0x00001, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00800, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00020, 0x02000, 0x00001, 0x00001, 0x00040, 0x00010, 0x00001, 0x00020, 0x00100, 0x00400, 0x00001, 0x00008, 0x1FFFF, 0x1FFFF, 0x00008, 0x00002, 0x01000, 0x00001, 0x00080, 0x00008, 0x08000, 0x00080, 0x00001, 0x00002, 0x02000, 0x00001, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00800, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00020, 0x02000, 0x00001, 0x00001, 0x00040, 0x00010, 0x00001, 0x00020, 0x00100, 0x00200, 0x00001, 0x00008, 0x1FFFF, 0x1FFFF, 0x00008, 0x00002, 0x01000, 0x00001, 0x00080, 0x00008, 0x08000, 0x00080, 0x00001, 0x00002, 0x02000, 0x00001, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00800, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00020, 0x02000, 0x00001, 0x00001, 0x00040, 0x00010, 0x00001, 0x00020, 0x00040, 0x02000, 0x00001, 0x00008, 0x1FFFF, 0x1FFFF, 0x00008, 0x00002, 0x01000, 0x00001, 0x00080, 0x00008, 0x08000, 0x00080, 0x00001, 0x00002, 0x02000, 0x00001, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00800, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00020, 0x02000, 0x00001, 0x00001, 0x00040, 0x00010, 0x00001, 0x00010, 0x00004, 0x00100, 0x00001, 0x00008, 0x00001, 0x00004, 0x00008, 0x00002, 0x01000, 0x00001, 0x00080, 0x00008, 0x08000, 0x00080, 0x00001, 0x00002, 0x02000, 0x00001, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00800, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00020, 0x02000, 0x00001, 0x00001, 0x00040, 0x00010, 0x00001, 0x00010, 0x00002, 0x00020, 0x00001, 0x00008, 0x1FFFF, 0x1FFFF, 0x00008, 0x00002, 0x01000, 0x00001, 0x00080, 0x00008, 0x08000, 0x00080, 0x00001, 0x00002, 0x02000, 0x00001, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00800, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00020, 0x02000, 0x00001, 0x00001, 0x00040, 0x00010, 0x00001, 0x00010, 0x00002, 0x00002, 0x00001, 0x00008, 0x1FFFF, 0x1FFFF, 0x00008, 0x00002, 0x01000, 0x00001, 0x00080, 0x00008, 0x08000, 0x00080, 0x00001, 0x00002, 0x02000, 0x00001, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x00800, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00020, 0x02000, 0x00001, 0x00001, 0x00040, 0x00010, 0x00001, 0x00010, 0x00001, 0x08000, 0x00001, 0x00008, 0x1FFFF, 0x1FFFF, 0x00008, 0x00002, 0x01000, 0x00001, 0x00080, 0x00008, 0x08000, 0x00080, 0x00001, 0x00002, 0x02000, 0x00001, 0x00001, 0x00001, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00002, 0x00008, 0x00002, 0x00100, 0x00001, 0x00010, 0x00008, 0x00001, 0x00001, 0x00008, 0x00002, 0x00800, 0x00100, 0x00040, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00080, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001,
+    0x00008, 0x00800, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00008, 0x00002, 0x00800, 0x00100, 0x00040, 0x00010, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00001, 0x00080, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00100, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x08000, 0x00002, 0x00100, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008, 0x00002, 0x00200, 0x00001, 0x00002, 0x00020, 0x00001, 0x00001, 0x00004, 0x00100, 0x00001, 0x00001, 0x00001, 0x00001, 0x08000, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00020, 0x00002, 0x00004, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x08000, 0x00002, 0x00100, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008, 0x00002, 0x00002, 0x00001, 0x00100, 0x00040, 0x00040, 0x00001, 0x00004, 0x00100, 0x00001, 0x00001, 0x00001, 0x00002, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00040, 0x00004, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x08000, 0x00002, 0x00100, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008, 0x00002, 0x00002, 0x00001, 0x00100, 0x00010, 0x00008, 0x00001, 0x00004, 0x00020, 0x00001, 0x00001, 0x00001, 0x00002, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00020, 0x00008, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x08000, 0x00002, 0x00100, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008, 0x00002, 0x00002, 0x00001, 0x00080, 0x00040, 0x00010, 0x00001, 0x00004, 0x00100, 0x00001, 0x00001, 0x00001, 0x00002, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00040, 0x00002, 0x00200, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x08000, 0x00002, 0x00100, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008, 0x00002, 0x00002, 0x00001, 0x00040, 0x00040, 0x00004, 0x00001, 0x00004, 0x00100, 0x00001, 0x00001, 0x00001, 0x00002, 0x00002, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00040, 0x00002, 0x00008, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x08000, 0x00002, 0x00100, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008, 0x00002, 0x00002, 0x00001, 0x00040, 0x00010, 0x00001, 0x00001, 0x00004, 0x00020, 0x00001, 0x00001, 0x00001, 0x00002, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00020, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x08000, 0x00002, 0x00100, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008, 0x00001, 0x02000, 0x00001, 0x00100, 0x00040, 0x00020, 0x00001, 0x00080, 0x00040, 0x00010, 0x00001, 0x00001, 0x00001, 0x02000, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00040, 0x00002, 0x00040, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x08000, 0x00002, 0x00100, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008, 0x00001, 0x02000, 0x00001, 0x00080, 0x00040, 0x00008, 0x00001, 0x00080, 0x00040, 0x00010, 0x00001, 0x00001, 0x00001, 0x02000, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00001, 0x00040, 0x00002, 0x00020, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x08000, 0x00002, 0x00100, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x00020, 0x00001, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x08000, 0x00002, 0x00100, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x1FFFF, 0x1FFFF, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x08000, 0x00002, 0x00008, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x08000, 0x04000, 0x00010, 0x00020, 0x00010, 0x08000, 0x00020, 0x00080, 0x00010, 0x08000, 0x00010, 0x00800, 0x00008, 0x00002, 0x00008, 0x00001, 0x00004, 0x02000, 0x00010, 0x00400, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x08000, 0x08000, 0x00100, 0x00002, 0x00008, 0x00002, 0x1FFFF, 0x1FFFF, 0x00010, 0x00020, 0x00040, 0x00020, 0x00040, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x00800, 0x08000, 0x08000, 0x1FFFF, 0x1FFFF, 0x00001, 0x00001, 0x00001, 0x00001, 0x00100, 0x00002, 0x00008, 0x00002, 0x1FFFF, 0x1FFFF, 0x00010, 0x00008, 0x00100, 0x00001, 0x00008, 0x00002, 0x00100, 0x00001, 0x00040, 0x00020, 0x00800, 0x00001, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00002, 0x00004, 0x00001, 0x08000, 0x08000, 0x04000, 0x00100, 0x00004, 0x00200, 0x00001, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x08000, 0x08000, 0x08000, 0x00200, 0x00020, 0x00001, 0x00001, 0x08000, 0x08000, 0x00200, 0x00002, 0x00100, 0x00002, 0x00080, 0x00002, 0x1FFFF, 0x1FFFF, 0x00010, 0x00080, 0x00001, 0x00001, 0x00010, 0x04000, 0x00010, 0x00008, 0x00010, 0x02000, 0x00010, 0x00020, 0x00010, 0x00010, 0x00008, 0x1FFFF, 0x00008, 0x00001, 0x00008, 0x1FFFF, 0x00004, 0x00001, 0x00020, 0x00004, 0x00040, 0x00020, 0x00080, 0x00040, 0x1FFFF, 0x1FFFF, 0x00008, 0x1FFFF, 0x00008, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+    0x00008, 0x08000, 0x08000, 0x08000, 0x00200, 0x00020, 0x00001, 0x00001, 0x08000, 0x08000, 0x00200, 0x00002, 0x00100, 0x00002, 0x00080, 0x00002, 0x1FFFF, 0x1FFFF, 0x00010, 0x00080, 0x00001, 0x00001, 0x1FFFF, 0x1FFFF, 0x00010, 0x1FFFF, 0x00010, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x00008, 0x1FFFF, 0x00008, 0x1FFFF, 0x00008, 0x1FFFF, 0x00004, 0x00001, 0x1FFFF, 0x1FFFF, 0x00040, 0x00020, 0x00080, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF, 0x1FFFF,
+};
+
+#endif
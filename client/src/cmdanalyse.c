@@ -21,6 +21,8 @@
 #include <string.h>
 #include <ctype.h>        // tolower
 #include <math.h>
+#include <pthread.h>
+#include <sched.h>        // sched_yield
 #include <inttypes.h>     // PRIx64 macro
 #include "commonutil.h"   // reflect...
 #include "comms.h"        // clearCommandBuffer
@@ -36,6 +38,11 @@
 #include "cliparser.h"
 #include "generator.h"    // generate nuid
 #include "iso14b.h"       // defines for ETU conversions
+#include "util_posix.h"   // msclock
+#include "uart/spscring.h"
+#include "crapto1/crapto1.h"
+#include "mifare/mfkey.h"     // lfsr_recovery32_mt
+#include "mifare/crypto1_bitslice.h"
 
 static int CmdHelp(const char *Cmd);
 
@@ -1035,6 +1042,9 @@ static int CmdAnalyseFoo(const char *Cmd) {
     PrintAndLogEx(INFO, "Got:  %s", data3);
 
     ClearGraph(false);
+    if (graph_reserve(15000) == false) {
+        return PM3_EMALLOC;
+    }
     g_GraphTraceLen = 15000;
 
     for (int i = 0; i < 4095; i++) {
@@ -1072,6 +1082,7 @@ static int CmdAnalyseFoo(const char *Cmd) {
         int o = i >> 5;
         g_GraphBuffer[i + 10000] = o;
     }
+    graph_changed();
 
     RepaintGraphWindow();
     ShowGraphWindow();
@@ -1168,6 +1179,247 @@ static int CmdAnalyseUnits(const char *Cmd) {
     return PM3_SUCCESS;
 }
 
+typedef struct {
+    SpscRing *ring;
+    uint64_t total;
+    size_t chunk;
+} ring_bench_t;
+
+// synthetic producer, mimics the comm thread receiving USB-CDC frames straight into the ring
+static void *ring_bench_producer(void *arg) {
+    ring_bench_t *b = (ring_bench_t *)arg;
+    uint64_t produced = 0;
+    while (produced < b->total) {
+        uint8_t *p;
+        size_t n = SpscRing_writePeek(b->ring, &p);
+        if (n == 0) {
+            // consumer lagging behind
+            sched_yield();
+            continue;
+        }
+        n = MIN(n, b->chunk);
+        n = MIN(n, b->total - produced);
+        for (size_t i = 0; i < n; i++) {
+            p[i] = (uint8_t)(produced + i);
+        }
+        SpscRing_writeCommit(b->ring, n);
+        produced += n;
+    }
+    return NULL;
+}
+
+static int CmdAnalyseRing(const char *Cmd) {
+    CLIParserContext *ctx;
+    CLIParserInit(&ctx, "analyse ring",
+                  "Benchmark the lock-free ring used for raw receive mode (lf read --realtime).\n"
+                  "A synthetic producer thread fills the ring in chunks while the consumer\n"
+                  "drains it and verifies every byte.",
+                  "analyse ring\n"
+                  "analyse ring --mb 256 --chunk 64   --> 256 MB in USB-CDC sized chunks\n"
+                 );
+
+    void *argtable[] = {
+        arg_param_begin,
+        arg_int0("m", "mb", "<dec>", "megabytes to transfer (def 64)"),
+        arg_int0("c", "chunk", "<dec>", "producer chunk size in bytes (def 1024)"),
+        arg_int0("s", "size", "<dec>", "ring size in KB, rounded up to a power of two (def 256)"),
+        arg_param_end
+    };
+    CLIExecWithReturn(ctx, Cmd, argtable, true);
+    int mb = arg_get_int_def(ctx, 1, 64);
+    int chunk = arg_get_int_def(ctx, 2, COMM_RAW_RECEIVE_LEN);
+    int size = arg_get_int_def(ctx, 3, COMM_RAW_RING_SIZE / 1024);
+    CLIParserFree(ctx);
+
+    if (mb <= 0 || chunk <= 0 || size <= 0) {
+        PrintAndLogEx(WARNING, "parameters must be positive");
+        return PM3_EINVARG;
+    }
+
+    ring_bench_t b = {
+        .ring = SpscRing_create((size_t)size * 1024),
+        .total = (uint64_t)mb * 1024 * 1024,
+        .chunk = chunk,
+    };
+
+    if (b.ring == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return PM3_EMALLOC;
+    }
+
+    PrintAndLogEx(INFO, "ring " _YELLOW_("%zu") " bytes, chunk " _YELLOW_("%d") ", transfer " _YELLOW_("%d") " MB", b.ring->capacity, chunk, mb);
+
+    uint64_t t1 = msclock();
+
+    pthread_t producer;
+    if (pthread_create(&producer, NULL, ring_bench_producer, &b) != 0) {
+        SpscRing_destroy(b.ring);
+        return PM3_ESOFT;
+    }
+
+    uint64_t consumed = 0, errors = 0, empty = 0;
+    while (consumed < b.total) {
+        const uint8_t *p;
+        size_t n = SpscRing_readPeek(b.ring, &p);
+        if (n == 0) {
+            empty++;
+            sched_yield();
+            continue;
+        }
+        for (size_t i = 0; i < n; i++) {
+            errors += (p[i] != (uint8_t)(consumed + i));
+        }
+        SpscRing_readCommit(b.ring, n);
+        consumed += n;
+    }
+
+    pthread_join(producer, NULL);
+    uint64_t delta = msclock() - t1;
+    SpscRing_destroy(b.ring);
+
+    PrintAndLogEx(SUCCESS, "transferred... " _YELLOW_("%" PRIu64) " bytes in " _YELLOW_("%" PRIu64) " ms", consumed, delta);
+    if (delta) {
+        PrintAndLogEx(SUCCESS, "throughput.... " _GREEN_("%.1f") " MB/s", (double)mb * 1000 / delta);
+    }
+    PrintAndLogEx(INFO, "empty polls... %" PRIu64, empty);
+    PrintAndLogEx((errors) ? FAILED : SUCCESS, "integrity..... %s", (errors) ? _RED_("fail") : _GREEN_("ok"));
+    return (errors) ? PM3_ESOFT : PM3_SUCCESS;
+}
+
+// number of states in the list, sorted so lists from different thread counts compare
+static size_t crypto1_bench_sort(struct Crypto1State *states) {
+    size_t n = 0;
+    while (states[n].odd | states[n].even) {
+        n++;
+    }
+    qsort(states, n, sizeof(uint64_t), compare_uint64);
+    return n;
+}
+
+static bool crypto1_bench_contains(const struct Crypto1State *states, size_t n, const struct Crypto1State *s) {
+    for (size_t i = 0; i < n; i++) {
+        // crypto1_word leaves bits above the 24 bit halves
+        if (((states[i].odd ^ s->odd) & 0xFFFFFF) == 0 && ((states[i].even ^ s->even) & 0xFFFFFF) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int CmdAnalyseCrypto1(const char *Cmd) {
+    CLIParserContext *ctx;
+    CLIParserInit(&ctx, "analyse crypto1",
+                  "Benchmark crypto1 lfsr state recovery as used by mfkey32 / mfkey64 / nested.\n"
+                  "Runs lfsr_recovery32 and lfsr_recovery64 on 1, 2, 4.. threads and checks\n"
+                  "every run returns the same states, including the one used to make the keystream.\n"
+                  "Then checks the bitsliced multi key crypto1 against the scalar one.",
+                  "analyse crypto1\n"
+                  "analyse crypto1 -n 5 -t 8   --> five rounds, up to eight threads\n"
+                 );
+
+    void *argtable[] = {
+        arg_param_begin,
+        arg_int0("n", "num", "<dec>", "rounds per thread count (def 1)"),
+        arg_int0("t", "threads", "<dec>", "max number of threads (def number of CPUs)"),
+        arg_param_end
+    };
+    CLIExecWithReturn(ctx, Cmd, argtable, true);
+    int rounds = arg_get_int_def(ctx, 1, 1);
+    int max_threads = arg_get_int_def(ctx, 2, num_CPUs());
+    CLIParserFree(ctx);
+
+    if (rounds <= 0 || max_threads <= 0) {
+        PrintAndLogEx(WARNING, "parameters must be positive");
+        return PM3_EINVARG;
+    }
+
+    bool ok = true;
+
+    for (int r = 0; r < rounds && ok; r++) {
+
+        // keystream from a known state, the recovered lists must contain it
+        uint64_t key = 0xA0A1A2A3A4A5 ^ ((uint64_t)r * 0x0123456789AB);
+        uint32_t in = 0x12345678 + r;
+
+        struct Crypto1State *cs = crypto1_create(key);
+        if (cs == NULL) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            return PM3_EMALLOC;
+        }
+        uint32_t ks2 = crypto1_word(cs, in, 0);
+        struct Crypto1State s32 = *cs;
+        uint32_t ks3 = crypto1_word(cs, 0, 0);
+        uint32_t ks4 = crypto1_word(cs, 0, 0);
+        struct Crypto1State s64 = *cs;
+        crypto1_destroy(cs);
+
+        PrintAndLogEx(INFO, "round " _YELLOW_("%d") "  key " _YELLOW_("%012" PRIX64), r + 1, key);
+
+        struct Crypto1State *ref32 = NULL, *ref64 = NULL;
+        size_t n32 = 0, n64 = 0;
+
+        for (int t = 1; ok; t <<= 1) {
+            if (t > max_threads) {
+                t = max_threads;
+            }
+
+            uint64_t t1 = msclock();
+            struct Crypto1State *l32 = lfsr_recovery32_mt(ks2, in, t);
+            uint64_t d32 = msclock() - t1;
+
+            t1 = msclock();
+            struct Crypto1State *l64 = lfsr_recovery64_mt(ks3, ks4, t);
+            uint64_t d64 = msclock() - t1;
+
+            if (l32 == NULL || l64 == NULL) {
+                PrintAndLogEx(WARNING, "Failed to allocate memory");
+                free(l32);
+                free(l64);
+                ok = false;
+                break;
+            }
+
+            size_t c32 = crypto1_bench_sort(l32);
+            size_t c64 = crypto1_bench_sort(l64);
+
+            PrintAndLogEx(SUCCESS, "  %2d thread%s  recovery32 " _YELLOW_("%5" PRIu64) " ms ( %zu states )   recovery64 " _YELLOW_("%5" PRIu64) " ms ( %zu states )"
+                          , t
+                          , (t == 1) ? " " : "s"
+                          , d32, c32
+                          , d64, c64
+                         );
+
+            if (ref32 == NULL) {
+                ok = crypto1_bench_contains(l32, c32, &s32) && crypto1_bench_contains(l64, c64, &s64);
+                ref32 = l32;
+                ref64 = l64;
+                n32 = c32;
+                n64 = c64;
+            } else {
+                ok = (c32 == n32) && (c64 == n64)
+                     && (memcmp(l32, ref32, c32 * sizeof(struct Crypto1State)) == 0)
+                     && (memcmp(l64, ref64, c64 * sizeof(struct Crypto1State)) == 0);
+                free(l32);
+                free(l64);
+            }
+
+            if (t == max_threads) {
+                break;
+            }
+        }
+        free(ref32);
+        free(ref64);
+    }
+
+    PrintAndLogEx((ok) ? SUCCESS : FAILED, "consistent.... %s", (ok) ? _GREEN_("ok") : _RED_("fail"));
+
+    // keystream of many keys at once, used for trace list dictionary checks
+    if (crypto1_bitsliced_test() != PM3_SUCCESS) {
+        ok = false;
+    }
+    return (ok) ? PM3_SUCCESS : PM3_ESOFT;
+}
+
 static command_t CommandTable[] = {
     {"help",    CmdHelp,            AlwaysAvailable, "This help"},
     {"lrc",     CmdAnalyseLRC,      AlwaysAvailable, "Generate final byte for XOR LRC"},
@@ -1181,6 +1433,8 @@ static command_t CommandTable[] = {
     {"freq",    CmdAnalyseFreq,     AlwaysAvailable, "Calc wave lengths"},
     {"foo",     CmdAnalyseFoo,      AlwaysAvailable, "muxer"},
     {"units",   CmdAnalyseUnits,    AlwaysAvailable, "convert ETU <> US <> SSP_CLK (3.39MHz)"},
+    {"ring",    CmdAnalyseRing,     AlwaysAvailable, "benchmark raw receive lock-free ring"},
+    {"crypto1", CmdAnalyseCrypto1,  AlwaysAvailable, "benchmark crypto1 lfsr state recovery"},
     {NULL, NULL, NULL, NULL}
 };
 
@@ -41,14 +41,11 @@
 #include "mbedtls/entropy.h"     //
 #include "mbedtls/ctr_drbg.h"    // random generator
 #include "atrs.h"                // ATR lookup
+#include "aidsearch.h"           // AID lookup
 #include "crypto/libpcrypto.h"   // Cryptography
+#include "graphdsp.h"            // DSP kernels
 
 
-uint8_t g_DemodBuffer[MAX_DEMOD_BUF_LEN] = { 0x00 };
-size_t g_DemodBufferLen = 0;
-int32_t g_DemodStartIdx = 0;
-int g_DemodClock = 0;
-
 static int CmdHelp(const char *Cmd);
 
 
@@ -155,9 +152,9 @@ static double median_uint8(uint8_t *src, size_t size) {
 */
 // function to compute mean for a series
 static double compute_mean(const int *data, size_t n) {
-    double mean = 0.0;
-    for (size_t i = 0; i < n; i++)
-        mean += data[i];
+    // integer sum, same as adding up in a double while below 2^53
+    int64_t sum = dsp_sum(data, n);
+    double mean = (double)sum;
     mean /= n;
     return mean;
 }
@@ -374,6 +371,7 @@ int CmdGetBitStream(const char *Cmd) {
     for (uint32_t i = 0; i < g_GraphTraceLen; i++) {
         g_GraphBuffer[i] = (g_GraphBuffer[i] >= 1) ? 1 : 0;
     }
+    graph_changed();
     RepaintGraphWindow();
     return PM3_SUCCESS;
 }
@@ -428,7 +426,7 @@ int ASKDemod_ext(int clk, int invert, int maxErr, size_t maxlen, bool amplify, b
         return PM3_EMALLOC;
     }
 
-    size_t bitlen = getFromGraphBuffer(bits);
+    size_t bitlen = getFromGraphBufferEx(bits, MAX_GRAPH_TRACE_LEN);
 
     PrintAndLogEx(DEBUG, "DEBUG: (ASKDemod_ext) #samples from graphbuff: %zu", bitlen);
 
@@ -864,16 +862,24 @@ int AutoCorrelate(const int *in, int *out, size_t len, size_t window, bool SaveG
     // Computed variance
     double variance = compute_variance(in, len);
 
-    int *correl_buf = calloc(MAX_GRAPH_TRACE_LEN, sizeof(int));
+    int *correl_buf = calloc(len, sizeof(int));
+    double *sums = calloc(len - window + 1, sizeof(double));
+    if (correl_buf == NULL || sums == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(correl_buf);
+        free(sums);
+        return -1;
+    }
+
+    // sum over j of (in[j] - mean) * (in[j + i] - mean) for every lag i
+    dsp_autocovariance(in, len, mean, len - window, sums);
 
     uint8_t peak_cnt = 0;
     size_t peaks[10] = {0};
 
     for (size_t i = 0; i < len - window; ++i) {
 
-        for (size_t j = 0; j < (len - i); j++) {
-            autocv += (in[j] - mean) * (in[j + i] - mean);
-        }
+        autocv += sums[i];
         autocv = (1.0 / (len - i)) * autocv;
 
         correl_buf[i] = autocv;
@@ -919,6 +925,8 @@ int AutoCorrelate(const int *in, int *out, size_t len, size_t window, bool SaveG
         }
     } else {
         PrintAndLogEx(HINT, "Hint: No repeating pattern found, try increasing window size");
+        free(correl_buf);
+        free(sums);
         // return value -1, indication to increase window size
         return -1;
     }
@@ -931,6 +939,7 @@ int AutoCorrelate(const int *in, int *out, size_t len, size_t window, bool SaveG
         RepaintGraphWindow();
     }
     free(correl_buf);
+    free(sums);
     return distance;
 }
 
@@ -967,6 +976,7 @@ static int CmdAutoCorr(const char *Cmd) {
     }
 
     AutoCorrelate(g_GraphBuffer, g_GraphBuffer, g_GraphTraceLen, window, updateGrph, true);
+    graph_changed();
     return PM3_SUCCESS;
 }
 
@@ -992,6 +1002,10 @@ static int CmdBitsamples(const char *Cmd) {
         return PM3_ETIMEOUT;
     }
 
+    if (graph_reserve(ARRAYLEN(got) * 8) == false) {
+        return PM3_EMALLOC;
+    }
+
     for (size_t j = 0; j < ARRAYLEN(got); j++) {
         for (uint8_t k = 0; k < 8; k++) {
             if (got[j] & (1 << (7 - k)))
@@ -1001,6 +1015,7 @@ static int CmdBitsamples(const char *Cmd) {
         }
     }
     g_GraphTraceLen = cnt;
+    graph_changed();
     RepaintGraphWindow();
     return PM3_SUCCESS;
 }
@@ -1043,10 +1058,13 @@ static int CmdDecimate(const char *Cmd) {
     int n = arg_get_int_def(ctx, 1, 2);
     CLIParserFree(ctx);
 
-    for (size_t i = 0; i < (g_GraphTraceLen / n); ++i)
-        g_GraphBuffer[i] = g_GraphBuffer[i * n];
+    if (n < 1) {
+        PrintAndLogEx(WARNING, "factor must be at least 1");
+        return PM3_EINVARG;
+    }
 
-    g_GraphTraceLen /= n;
+    g_GraphTraceLen = dsp_decimate(g_GraphBuffer, g_GraphTraceLen, n);
+    graph_changed();
     PrintAndLogEx(SUCCESS, "decimated by " _GREEN_("%u"), n);
     RepaintGraphWindow();
     return PM3_SUCCESS;
@@ -1094,8 +1112,14 @@ static int CmdUndecimate(const char *Cmd) {
         g_index++;
     }
 
+    if (graph_reserve(s_index) == false) {
+        free(swap);
+        return PM3_EMALLOC;
+    }
+
     memcpy(g_GraphBuffer, swap, s_index * sizeof(int));
     g_GraphTraceLen = s_index;
+    graph_changed();
     RepaintGraphWindow();
     free(swap);
     return PM3_SUCCESS;
@@ -1128,6 +1152,7 @@ static int CmdGraphShiftZero(const char *Cmd) {
             shiftedVal = -127;
         g_GraphBuffer[i] = shiftedVal;
     }
+    graph_changed();
     CmdNorm("");
     return PM3_SUCCESS;
 }
@@ -1166,6 +1191,7 @@ static int CmdAskEdgeDetect(const char *Cmd) {
 
     PrintAndLogEx(INFO, "using threshold " _YELLOW_("%i"), threshold);
     int res = AskEdgeDetect(g_GraphBuffer, g_GraphBuffer, g_GraphTraceLen, threshold);
+    graph_changed();
     RepaintGraphWindow();
     return res;
 }
@@ -1279,7 +1305,7 @@ int FSKrawDemod(uint8_t rfLen, uint8_t invert, uint8_t fchigh, uint8_t fclow, bo
         return PM3_EMALLOC;
     }
 
-    size_t bitlen = getFromGraphBuffer(bits);
+    size_t bitlen = getFromGraphBufferEx(bits, MAX_GRAPH_TRACE_LEN);
     if (bitlen == 0) {
         PrintAndLogEx(DEBUG, "DEBUG: no data in graphbuf");
         free(bits);
@@ -1381,7 +1407,7 @@ int PSKDemod(int clk, int invert, int maxErr, bool verbose) {
         PrintAndLogEx(WARNING, "Failed to allocate memory");
         return PM3_EMALLOC;
     }
-    size_t bitlen = getFromGraphBuffer(bits);
+    size_t bitlen = getFromGraphBufferEx(bits, MAX_GRAPH_TRACE_LEN);
     if (bitlen == 0) {
         free(bits);
         return PM3_ESOFT;
@@ -1432,7 +1458,7 @@ int NRZrawDemod(int clk, int invert, int maxErr, bool verbose) {
         return PM3_EMALLOC;
     }
 
-    size_t bitlen = getFromGraphBuffer(bits);
+    size_t bitlen = getFromGraphBufferEx(bits, MAX_GRAPH_TRACE_LEN);
 
     if (bitlen == 0) {
         free(bits);
@@ -1655,6 +1681,9 @@ void setClockGrid(uint32_t clk, int offset) {
     else
         PrintAndLogEx(DEBUG, "DEBUG: (setClockGrid) demodoffset %d, clk %d", offset, clk);
 
+    // the grid belongs to the plot window
+    if (demod_ctx_is_main() == false) return;
+
     if (offset > clk) offset %= clk;
     if (offset < 0) offset += clk;
 
@@ -1896,6 +1925,12 @@ int getSamplesFromBufEx(uint8_t *data, size_t sample_num, uint8_t bits_per_sampl
 
     size_t max_num = MIN(sample_num, MAX_GRAPH_TRACE_LEN);
 
+    // ADC samples are kept as they are until a command needs them as int32
+    uint8_t *compact = graph_reserve_u8(max_num, 127);
+    if (compact == NULL && graph_reserve(max_num) == false) {
+        return PM3_EMALLOC;
+    }
+
     if (bits_per_sample < 8) {
 
         if (verbose) PrintAndLogEx(INFO, "Unpacking...");
@@ -1904,18 +1939,26 @@ int getSamplesFromBufEx(uint8_t *data, size_t sample_num, uint8_t bits_per_sampl
         size_t j = 0;
         for (j = 0; j < max_num; j++) {
             uint8_t sample = getByte(bits_per_sample, &bout);
-            g_GraphBuffer[j] = ((int) sample) - 127;
+            if (compact) {
+                compact[j] = sample;
+            } else {
+                g_GraphBuffer[j] = ((int) sample) - 127;
+            }
         }
         g_GraphTraceLen = j;
 
         if (verbose) PrintAndLogEx(INFO, "Unpacked %zu samples", j);
 
+    } else if (compact) {
+        memcpy(compact, data, max_num);
+        g_GraphTraceLen = max_num;
     } else {
         for (size_t j = 0; j < max_num; j++) {
             g_GraphBuffer[j] = ((int)data[j]) - 127;
         }
         g_GraphTraceLen = max_num;
     }
+    graph_changed();
 
     uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
     if (bits == NULL) {
@@ -2003,29 +2046,51 @@ static int CmdLoad(const char *Cmd) {
 
     g_GraphTraceLen = 0;
 
+    // samples are stored compact as long as they fit, see graph.h
+    bool compact = true;
     if (is_bin) {
         uint8_t val[2];
         while (fread(val, 1, 1, f)) {
-            g_GraphBuffer[g_GraphTraceLen] = val[0] - 127;
-            g_GraphTraceLen++;
+            uint8_t *u8 = (compact) ? graph_reserve_u8(g_GraphTraceLen + 1, 127) : NULL;
+            if (u8 != NULL) {
+                u8[g_GraphTraceLen++] = val[0];
+                continue;
+            }
 
-            if (g_GraphTraceLen >= MAX_GRAPH_TRACE_LEN) {
+            compact = false;
+            if (graph_reserve(g_GraphTraceLen + 1) == false) {
                 break;
             }
+
+            g_GraphBuffer[g_GraphTraceLen] = val[0] - 127;
+            g_GraphTraceLen++;
         }
     } else {
         char line[80];
         while (fgets(line, sizeof(line), f)) {
-            g_GraphBuffer[g_GraphTraceLen] = atoi(line);
-            g_GraphTraceLen++;
+            int val = atoi(line);
+            int16_t *s16 = (compact && val >= INT16_MIN && val <= INT16_MAX) ? graph_reserve_s16(g_GraphTraceLen + 1) : NULL;
+            if (s16 != NULL) {
+                s16[g_GraphTraceLen++] = val;
+                continue;
+            }
 
-            if (g_GraphTraceLen >= MAX_GRAPH_TRACE_LEN)
+            compact = false;
+            if (graph_reserve(g_GraphTraceLen + 1) == false) {
                 break;
+            }
+
+            g_GraphBuffer[g_GraphTraceLen] = val;
+            g_GraphTraceLen++;
         }
     }
     fclose(f);
+    graph_changed();
 
-    PrintAndLogEx(SUCCESS, "loaded " _YELLOW_("%s") " samples", commaprint(g_GraphTraceLen));
+    PrintAndLogEx(SUCCESS, "loaded " _YELLOW_("%s") " samples%s", commaprint(g_GraphTraceLen), (graph_is_mapped()) ? " ( file backed )" : "");
+    if (g_GraphTraceLen > MAX_GRAPH_TRACE_LEN) {
+        PrintAndLogEx(INFO, "demodulators only look at the first " _YELLOW_("%s") " samples", commaprint(MAX_GRAPH_TRACE_LEN));
+    }
 
     if (nofix == false) {
         uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
@@ -2074,6 +2139,7 @@ int CmdLtrim(const char *Cmd) {
     }
     g_GraphTraceLen -= ds;
     g_DemodStartIdx -= ds;
+    graph_changed();
     RepaintGraphWindow();
     return PM3_SUCCESS;
 }
@@ -2102,6 +2168,7 @@ static int CmdRtrim(const char *Cmd) {
     }
 
     g_GraphTraceLen = ds;
+    graph_changed();
     RepaintGraphWindow();
     return PM3_SUCCESS;
 }
@@ -2140,6 +2207,7 @@ static int CmdMtrim(const char *Cmd) {
     for (uint32_t i = 0; i < g_GraphTraceLen; i++) {
         g_GraphBuffer[i] = g_GraphBuffer[start + i];
     }
+    graph_changed();
 
     g_DemodStartIdx = 0;
     RepaintGraphWindow();
@@ -2163,16 +2231,14 @@ int CmdNorm(const char *Cmd) {
     int max = INT_MIN, min = INT_MAX;
 
     // Find local min, max
-    for (uint32_t i = 10; i < g_GraphTraceLen; ++i) {
-        if (g_GraphBuffer[i] > max) max = g_GraphBuffer[i];
-        if (g_GraphBuffer[i] < min) min = g_GraphBuffer[i];
+    if (g_GraphTraceLen > 10) {
+        dsp_minmax(g_GraphBuffer + 10, g_GraphTraceLen - 10, &min, &max);
     }
 
     if ((g_GraphTraceLen > 10) && (max != min)) {
-        for (uint32_t i = 0; i < g_GraphTraceLen; ++i) {
-            g_GraphBuffer[i] = ((long)(g_GraphBuffer[i] - ((max + min) / 2)) * 256) / (max - min);
-            //marshmelow: adjusted *1000 to *256 to make +/- 128 so demod commands still work
-        }
+        //marshmelow: adjusted *1000 to *256 to make +/- 128 so demod commands still work
+        dsp_normalize(g_GraphBuffer, g_GraphTraceLen, min, max);
+        graph_changed();
     }
 
     uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
@@ -2276,31 +2342,7 @@ static int CmdTimeScale(const char *Cmd) {
 }
 
 int directionalThreshold(const int *in, int *out, size_t len, int8_t up, int8_t down) {
-
-    int lastValue = in[0];
-
-    // Will be changed at the end, but init 0 as we adjust to last samples
-    // value if no threshold kicks in.
-    out[0] = 0;
-
-    for (size_t i = 1; i < len; ++i) {
-        // Apply first threshold to samples heading up
-        if (in[i] >= up && in[i] > lastValue) {
-            lastValue = out[i]; // Buffer last value as we overwrite it.
-            out[i] = 1;
-        }
-        // Apply second threshold to samples heading down
-        else if (in[i] <= down && in[i] < lastValue) {
-            lastValue = out[i]; // Buffer last value as we overwrite it.
-            out[i] = -1;
-        } else {
-            lastValue = out[i]; // Buffer last value as we overwrite it.
-            out[i] = out[i - 1];
-        }
-    }
-
-    // Align with first edited sample.
-    out[0] = out[1];
+    dsp_directional_threshold(in, out, len, up, down);
     return PM3_SUCCESS;
 }
 
@@ -2324,6 +2366,7 @@ static int CmdDirectionalThreshold(const char *Cmd) {
     PrintAndLogEx(INFO, "Applying up threshold: " _YELLOW_("%i") ", down threshold: " _YELLOW_("%i") "\n", up, down);
 
     directionalThreshold(g_GraphBuffer, g_GraphBuffer, g_GraphTraceLen, up, down);
+    graph_changed();
 
     // set signal properties low/high/mean/amplitude and isnoice detection
     uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
@@ -2373,6 +2416,7 @@ static int CmdZerocrossings(const char *Cmd) {
             }
         }
     }
+    graph_changed();
 
     uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
     if (bits == NULL) {
@@ -2567,6 +2611,7 @@ static int CmdFSKToNRZ(const char *Cmd) {
     setClockGrid(0, 0);
     g_DemodBufferLen = 0;
     int ans = FSKToNRZ(g_GraphBuffer, &g_GraphTraceLen, clk, fc_low, fc_high);
+    graph_changed();
     CmdNorm("");
     RepaintGraphWindow();
     return ans;
@@ -2624,23 +2669,6 @@ void iceIIR_Butterworth(int *data, const size_t len) {
 }
 */
 
-static void iceSimple_Filter(int *data, const size_t len, uint8_t k) {
-// ref: http://www.edn.com/design/systems-design/4320010/A-simple-software-lowpass-filter-suits-embedded-system-applications
-// parameter K
-#define FILTER_SHIFT 4
-
-    int32_t filter_reg = 0;
-    int8_t shift = (k <= 8) ? k : FILTER_SHIFT;
-
-    for (size_t i = 0; i < len; ++i) {
-        // Update filter with current sample
-        filter_reg = filter_reg - (filter_reg >> shift) + data[i];
-
-        // Scale output for unity gain
-        data[i] = filter_reg >> shift;
-    }
-}
-
 static int CmdDataIIR(const char *Cmd) {
 
     CLIParserContext *ctx;
@@ -2657,7 +2685,8 @@ static int CmdDataIIR(const char *Cmd) {
     uint8_t k = (arg_get_u32_def(ctx, 1, 0) & 0xFF);
     CLIParserFree(ctx);
 
-    iceSimple_Filter(g_GraphBuffer, g_GraphTraceLen, k);
+    dsp_iir_simple(g_GraphBuffer, g_GraphTraceLen, k);
+    graph_changed();
 
     uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
     if (bits == NULL) {
@@ -2787,7 +2816,7 @@ static int try_detect_modulation(void) {
         clk = GetPskClock("", false);
         if (clk > 0) {
             // allow undo
-            buffer_savestate_t saveState = save_bufferS32(g_GraphBuffer, g_GraphTraceLen);
+            buffer_savestate_t saveState = graph_save();
             saveState.offset = g_GridOffset;
             // skip first 160 samples to allow antenna to settle in (psk gets inverted occasionally otherwise)
             CmdLtrim("-i 160");
@@ -2800,7 +2829,7 @@ static int try_detect_modulation(void) {
                 tests[hits].carrier = GetPskCarrier(false);
             }
             //undo trim samples
-            restore_bufferS32(saveState, g_GraphBuffer);
+            graph_restore(saveState);
             g_GridOffset = saveState.offset;
         }
     }
@@ -3383,21 +3412,7 @@ int centerThreshold(const int *in, int *out, size_t len, int8_t up, int8_t down)
         return PM3_EINVARG;
     }
 
-    for (size_t i = 0; i < len; ++i) {
-        if ((in[i] <= up) && (in[i] >= down)) {
-            out[i] = 0;
-        }
-    }
-
-    // clean out spikes.
-    for (size_t i = 2; i < len - 2; ++i) {
-
-        int a = out[i - 2] + out[i - 1];
-        int b = out[i + 2] + out[i + 1];
-        if (a == 0 && b == 0) {
-            out[i] = 0;
-        }
-    }
+    dsp_center_threshold(in, out, len, up, down);
     return PM3_SUCCESS;
 }
 
@@ -3421,6 +3436,7 @@ static int CmdCenterThreshold(const char *Cmd) {
     PrintAndLogEx(INFO, "Applying up threshold: " _YELLOW_("%i") ", down threshold: " _YELLOW_("%i") "\n", up, down);
 
     centerThreshold(g_GraphBuffer, g_GraphBuffer, g_GraphTraceLen, up, down);
+    graph_changed();
 
     // set signal properties low/high/mean/amplitude and isnoice detection
     uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
@@ -3436,28 +3452,6 @@ static int CmdCenterThreshold(const char *Cmd) {
     return PM3_SUCCESS;
 }
 
-static int envelope_square(const int *in, int *out, size_t len) {
-    if (len < 10) {
-        return PM3_EINVARG;
-    }
-
-
-    size_t i = 0;
-    while (i < len - 8) {
-
-        if (in[i] == 0 && in[i + 1] == 0 && in[i + 2] == 0 && in[i + 3] == 0 &&
-                in[i + 4] == 0 && in[i + 5] == 0 && in[i + 6] == 0 && in[i + 7] == 0) {
-
-            i += 8;
-            continue;
-        }
-
-        out[i] = 255;
-        i++;
-    }
-    return PM3_SUCCESS;
-}
-
 static int CmdEnvelope(const char *Cmd) {
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "data envelope",
@@ -3471,7 +3465,8 @@ static int CmdEnvelope(const char *Cmd) {
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
 
-    envelope_square(g_GraphBuffer, g_GraphBuffer, g_GraphTraceLen);
+    dsp_envelope_square(g_GraphBuffer, g_GraphBuffer, g_GraphTraceLen);
+    graph_changed();
 
     uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
     if (bits == NULL) {
@@ -3486,30 +3481,52 @@ static int CmdEnvelope(const char *Cmd) {
     return PM3_SUCCESS;
 }
 
+static int CmdDataBench(const char *Cmd) {
+    CLIParserContext *ctx;
+    CLIParserInit(&ctx, "data bench",
+                  "Time the graph buffer filters on a synthetic capture.\n"
+                  "Every SIMD kernel is checked against the scalar one.\n"
+                  "The graph buffer is left untouched",
+                  "data bench\n"
+                  "data bench -n 65536"
+                 );
+    void *argtable[] = {
+        arg_param_begin,
+        arg_u64_0("n", "samples", "<dec>", "number of samples (def 1048576)"),
+        arg_param_end
+    };
+    CLIExecWithReturn(ctx, Cmd, argtable, true);
+    uint32_t n = arg_get_u32_def(ctx, 1, 1024 * 1024);
+    CLIParserFree(ctx);
+
+    return dsp_bench(n);
+}
+
 static int CmdAtrLookup(const char *Cmd) {
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "data atr",
                   "look up ATR record from bytearray\n"
                   "",
                   "data atr -d 3B6B00000031C064BE1B0100079000\n"
+                  "data atr -t                                    -> self test and lookup speed over the whole table\n"
                  );
 
     void *argtable[] = {
         arg_param_begin,
         arg_str0("d", NULL, "<hex>", "ASN1 encoded byte array"),
-//        arg_lit0("t", "test", "perform self test"),
+        arg_lit0("t", "test", "perform self test"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, false);
-    uint8_t data[129];
+    uint8_t data[129] = {0};
     int dlen = sizeof(data) - 1; // CLIGetStrWithReturn does not guarantee string to be null-terminated
     CLIGetStrWithReturn(ctx, 1, data, &dlen);
 
-//    bool selftest = arg_get_lit(ctx, 2);
+    bool selftest = arg_get_lit(ctx, 2);
     CLIParserFree(ctx);
-//    if (selftest) {
-//        return atr_selftest();
-//    }
+    if (selftest) {
+        return atr_selftest();
+    }
     PrintAndLogEx(INFO, "ISO7816-3 ATR... " _YELLOW_("%s"), data);
     PrintAndLogEx(INFO, "Fingerprint...");
 
@@ -3524,6 +3541,44 @@ static int CmdAtrLookup(const char *Cmd) {
     return PM3_SUCCESS;
 }
 
+static int CmdAidLookup(const char *Cmd) {
+    CLIParserContext *ctx;
+    CLIParserInit(&ctx, "data aid",
+                  "look up AID record in the aid list. The longest known AID which is a prefix of the input is shown\n"
+                  "",
+                  "data aid -d A0000000031010\n"
+                  "data aid -t                                    -> self test and lookup speed over the whole list\n"
+                 );
+
+    void *argtable[] = {
+        arg_param_begin,
+        arg_str0("d", NULL, "<hex>", "AID"),
+        arg_lit0("t", "test", "perform self test"),
+        arg_param_end
+    };
+    CLIExecWithReturn(ctx, Cmd, argtable, false);
+    uint8_t data[65] = {0};
+    int dlen = sizeof(data) - 1; // CLIGetStrWithReturn does not guarantee string to be null-terminated
+    CLIGetStrWithReturn(ctx, 1, data, &dlen);
+
+    bool selftest = arg_get_lit(ctx, 2);
+    CLIParserFree(ctx);
+    if (selftest) {
+        return AIDSearchSelftest();
+    }
+
+    if (dlen == 0) {
+        PrintAndLogEx(WARNING, "Missing AID");
+        return PM3_EINVARG;
+    }
+
+    if (AIDSearchFind((char *)data) == NULL) {
+        PrintAndLogEx(INFO, "AID " _YELLOW_("%s") " not found", data);
+        return PM3_ENODATA;
+    }
+    return PrintAIDDescription(NULL, (char *)data, true);
+}
+
 static int CmdCryptography(const char *Cmd) {
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "data crypto",
@@ -3945,6 +4000,24 @@ static int CmdTestSaveState32S(const char *Cmd) {
     }
     PrintAndLogEx(SUCCESS, _GREEN_("Save State (signed 32-bit) test success!") "\n");
 
+    // ADC range samples are stored packed
+    for (int i = 0; i < length; i++) {
+        srcBuffer[i] = (rand() % 255) - 127;
+    }
+    memset(destBuffer, 0, length * sizeof(int32_t));
+
+    buffer_savestate_t test8 = save_bufferS32(srcBuffer, length);
+    PrintAndLogEx(DEBUG, "Save State created, length=%llu, type=%i", test8.bufferSize, test8.type);
+
+    returnedLength = restore_bufferS32(test8, destBuffer);
+    if (returnedLength != length || memcmp(srcBuffer, destBuffer, length * sizeof(int32_t)) != 0) {
+        PrintAndLogEx(FAILED, "Packed Save State doesn't match");
+        free(srcBuffer);
+        free(destBuffer);
+        return PM3_EFAILED;
+    }
+    PrintAndLogEx(SUCCESS, _GREEN_("Save State (signed 32-bit, packed samples) test success!") "\n");
+
     free(srcBuffer);
     free(destBuffer);
     return PM3_SUCCESS;
@@ -3974,6 +4047,7 @@ static command_t CommandTable[] = {
     {"-----------",      CmdHelp,                 AlwaysAvailable, "------------------------- " _CYAN_("Graph") "-------------------------"},
     {"askedgedetect",    CmdAskEdgeDetect,        AlwaysAvailable,  "Adjust Graph for manual ASK demod"},
     {"autocorr",         CmdAutoCorr,             AlwaysAvailable,  "Autocorrelation over window"},
+    {"bench",            CmdDataBench,            AlwaysAvailable,  "Benchmark the graph filters"},
     {"convertbitstream", CmdConvertBitStream,     AlwaysAvailable,  "Convert GraphBuffer's 0/1 values to 127 / -127"},
     {"cthreshold",       CmdCenterThreshold,      AlwaysAvailable,  "Average out all values between"},
     {"dirthreshold",     CmdDirectionalThreshold, AlwaysAvailable,  "Max rising higher up-thres/ Min falling lower down-thres"},
@@ -3995,6 +4069,7 @@ static command_t CommandTable[] = {
 
     {"-----------",      CmdHelp,                 AlwaysAvailable, "------------------------- " _CYAN_("Operations") "-------------------------"},
     {"asn1",             CmdAsn1Decoder,          AlwaysAvailable,  "ASN1 decoder"},
+    {"aid",              CmdAidLookup,            AlwaysAvailable,  "AID lookup"},
     {"atr",              CmdAtrLookup,            AlwaysAvailable,  "ATR lookup"},
     {"bitsamples",       CmdBitsamples,           IfPm3Present,     "Get raw samples as bitstring"},
     {"bmap",             CmdBinaryMap,            AlwaysAvailable,  "Convert hex value according a binary template"},
@@ -21,6 +21,7 @@
 
 #include "common.h"
 #include <stdbool.h>
+#include "demodctx.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -92,12 +93,11 @@ int directionalThreshold(const int *in, int *out, size_t len, int8_t up, int8_t
 int centerThreshold(const int *in, int *out, size_t len, int8_t up, int8_t down);
 int AskEdgeDetect(const int *in, int *out, int len, int threshold);
 
-#define MAX_DEMOD_BUF_LEN (1024*128)
-extern uint8_t g_DemodBuffer[MAX_DEMOD_BUF_LEN];
-extern size_t g_DemodBufferLen;
-
-extern int g_DemodClock;
-extern int32_t g_DemodStartIdx;
+// demod buffer of the demod context bound to the calling thread, see demodctx.h
+#define g_DemodBuffer    (demod_ctx()->buffer)
+#define g_DemodBufferLen (demod_ctx()->buffer_len)
+#define g_DemodClock     (demod_ctx()->clock)
+#define g_DemodStartIdx  (demod_ctx()->start_idx)
 
 #ifdef __cplusplus
 }
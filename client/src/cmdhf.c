@@ -530,11 +530,16 @@ int handle_hf_plot(bool show_plot) {
         return PM3_ETIMEOUT;
     }
 
+    if (graph_reserve(FPGA_TRACE_SIZE) == false) {
+        return PM3_EMALLOC;
+    }
+
     for (size_t i = 0; i < FPGA_TRACE_SIZE; i++) {
         g_GraphBuffer[i] = ((int)buf[i]) - 128;
     }
 
     g_GraphTraceLen = FPGA_TRACE_SIZE;
+    graph_changed();
 
     if (show_plot) {
         ShowGraphWindow();
@@ -1785,6 +1785,17 @@ static int CmdHF15WriteDsfid(const char *Cmd) {
     return PM3_SUCCESS;
 }
 
+// Consumes the replies of `count` pipelined requests so they don't leak into the next command
+static void hf15_drain_replies(int count) {
+    PacketResponseNG resp;
+    for (int i = 0; i < count; i++) {
+        if (WaitForResponseTimeout(CMD_HF_ISO15693_COMMAND, &resp, 2000) == false) {
+            break;
+        }
+    }
+    clearCommandBuffer();
+}
+
 // Reads all memory pages
 // need to write to file
 static int CmdHF15Dump(const char *Cmd) {
@@ -1956,60 +1967,76 @@ static int CmdHF15Dump(const char *Cmd) {
 
     PrintAndLogEx(SUCCESS, "Reading memory");
 
-    int blocknum = 0;
+    // Keep up to COMM_TX_QUEUE_LEN block reads in flight instead of stop-and-wait.
+    // The device handles commands in order, so the n-th reply belongs to the n-th request.
+    int blocknum = 0;   // next block to store
+    int requested = 0;  // next block to request
+    int retry = 0;
+    bool done = false;
 
-    for (int retry = 0; (retry < 2 && blocknum < tag->pagesCount); retry++) {
-        if (used_uid) {
-            packet->raw[10] = (uint8_t)blocknum & 0xFF;
-            AddCrc15(packet->raw, 11);
-        } else {
-            packet->raw[2] = (uint8_t)blocknum & 0xFF;
-            AddCrc15(packet->raw, 3);
-        }
+    clearCommandBuffer();
 
-        clearCommandBuffer();
-        SendCommandNG(CMD_HF_ISO15693_COMMAND, (uint8_t *)packet, ISO15_RAW_LEN(packet->rawlen));
+    while (done == false && retry < 2 && blocknum < tag->pagesCount) {
 
+        while (requested < tag->pagesCount && (requested - blocknum) < COMM_TX_QUEUE_LEN) {
+            if (used_uid) {
+                packet->raw[10] = (uint8_t)requested & 0xFF;
+                AddCrc15(packet->raw, 11);
+            } else {
+                packet->raw[2] = (uint8_t)requested & 0xFF;
+                AddCrc15(packet->raw, 3);
+            }
+            SendCommandNG(CMD_HF_ISO15693_COMMAND, (uint8_t *)packet, ISO15_RAW_LEN(packet->rawlen));
+            requested++;
+        }
+
+        bool ok = false;
         if (WaitForResponseTimeout(CMD_HF_ISO15693_COMMAND, &resp, 2000)) {
 
+            d = resp.data.asBytes;
+
             if (resp.length < 2) {
                 PrintAndLogEx(NORMAL, "");
                 PrintAndLogEx(FAILED, "iso15693 command failed");
-                continue;
-            }
-
-            d = resp.data.asBytes;
-
-            if (CheckCrc15(d, resp.length) == false) {
+            } else if (CheckCrc15(d, resp.length) == false) {
                 PrintAndLogEx(NORMAL, "");
                 PrintAndLogEx(FAILED, "crc ( " _RED_("fail") " )");
-                continue;
-            }
-
-            if ((d[0] & ISO15_RES_ERROR) == ISO15_RES_ERROR) {
+            } else if ((d[0] & ISO15_RES_ERROR) == ISO15_RES_ERROR) {
 
                 // heuristic determine end of available memory
-                if (d[1] == 0x0F || d[1] == 0x10) {
-                    break;
+                if (d[1] != 0x0F && d[1] != 0x10) {
+                    PrintAndLogEx(NORMAL, "");
+                    PrintAndLogEx(FAILED, "Tag returned Error %i: %s", d[1], TagErrorStr(d[1]));
                 }
+                done = true;
+            } else {
 
-                PrintAndLogEx(NORMAL, "");
-                PrintAndLogEx(FAILED, "Tag returned Error %i: %s", d[1], TagErrorStr(d[1]));
-                break;
-            }
+                tag->locks[blocknum] = d[1];
 
-            tag->locks[blocknum] = d[1];
+                // copy read data
+                memcpy(&tag->data[blocknum * tag->bytesPerPage], d + 2, tag->bytesPerPage);
 
-            // copy read data
-            memcpy(&tag->data[blocknum * tag->bytesPerPage], d + 2, tag->bytesPerPage);
+                retry = 0;
+                blocknum++;
+                ok = true;
 
-            retry = 0;
-            blocknum++;
+                PrintAndLogEx(INPLACE, "blk %3d", blocknum);
+            }
+        }
 
-            PrintAndLogEx(INPLACE, "blk %3d", blocknum);
+        if (ok == false && done == false) {
+            // drop the replies of the requests still in flight and restart from the failing block
+            hf15_drain_replies(requested - blocknum - 1);
+            requested = blocknum;
+            retry++;
         }
     }
 
+    if (done) {
+        // end of memory, the reads past it are still in flight
+        hf15_drain_replies(requested - blocknum - 1);
+    }
+
     free(packet);
     DropField();
 
@@ -27,6 +27,7 @@
 #include "des.h"
 #include "loclass/cipherutils.h"
 #include "loclass/cipher.h"
+#include "loclass/cipher_bitslice.h"
 #include "loclass/ikeys.h"
 #include "loclass/elite_crack.h"
 #include "fileutils.h"
@@ -3145,6 +3146,7 @@ static int CmdHFiClass_loclass(const char *Cmd) {
     if (test || longtest) {
         int errors = testCipherUtils();
         errors += testMAC();
+        errors += testMAC_bitsliced();
         errors += doKeyTests();
         errors += testElite(longtest);
 
@@ -4572,28 +4574,39 @@ static int CmdHFiClassUnhash(const char *Cmd) {
     return PM3_SUCCESS;
 }
 
+static int iclass_lookup_bench(bool use_raw, bool use_elite);
+
 static int CmdHFiClassLookUp(const char *Cmd) {
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "hf iclass lookup",
                   "This command take sniffed trace data and try to recovery a iCLASS Standard or iCLASS Elite key.",
                   "hf iclass lookup --csn 9655a400f8ff12e0 --epurse f0ffffffffffffff --macs 0000000089cb984b -f iclass_default_keys.dic\n"
                   "hf iclass lookup --csn 9655a400f8ff12e0 --epurse f0ffffffffffffff --macs 0000000089cb984b -f iclass_default_keys.dic --elite\n"
-                  "hf iclass lookup --csn 9655a400f8ff12e0 --epurse f0ffffffffffffff --macs 0000000089cb984b --vb6rng"
+                  "hf iclass lookup --csn 9655a400f8ff12e0 --epurse f0ffffffffffffff --macs 0000000089cb984b --vb6rng\n"
+                  "hf iclass lookup --bench --elite    --> key generation speed per thread count"
                  );
 
     void *argtable[] = {
         arg_param_begin,
         arg_str0("f", "file", "<fn>", "Dictionary file with default iclass keys"),
-        arg_str1(NULL, "csn", "<hex>", "Specify CSN as 8 hex bytes"),
-        arg_str1(NULL, "epurse", "<hex>", "Specify ePurse as 8 hex bytes"),
-        arg_str1(NULL, "macs", "<hex>", "MACs"),
+        arg_str0(NULL, "csn", "<hex>", "Specify CSN as 8 hex bytes"),
+        arg_str0(NULL, "epurse", "<hex>", "Specify ePurse as 8 hex bytes"),
+        arg_str0(NULL, "macs", "<hex>", "MACs"),
         arg_lit0(NULL, "elite", "Elite computations applied to key"),
         arg_lit0(NULL, "raw", "no computations applied to key"),
         arg_lit0(NULL, "vb6rng", "use the VB6 rng for elite keys instead of a dictionary file"),
+        arg_lit0(NULL, "bench", "benchmark key generation, keys/s per thread count"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, false);
 
+    if (arg_get_lit(ctx, 8)) {
+        bool b_elite = arg_get_lit(ctx, 5);
+        bool b_raw = arg_get_lit(ctx, 6);
+        CLIParserFree(ctx);
+        return iclass_lookup_bench(b_raw, b_elite);
+    }
+
     bool use_vb6kdf = arg_get_lit(ctx, 7);
     int fnlen = 0;
     char filename[FILE_PATH_SIZE] = {0};
@@ -4644,6 +4657,11 @@ static int CmdHFiClassLookUp(const char *Cmd) {
 
     CLIParserFree(ctx);
 
+    if (csn_len == 0 || epurse_len == 0 || macs_len == 0) {
+        PrintAndLogEx(ERR, "Must specify CSN, ePurse and MACs");
+        return PM3_EINVARG;
+    }
+
     uint8_t CCNR[12];
     uint8_t MAC_TAG[4] = { 0, 0, 0, 0 };
 
@@ -4732,10 +4750,10 @@ static int CmdHFiClassLookUp(const char *Cmd) {
 }
 
 typedef struct {
-    uint8_t thread_idx;
+    uint32_t start;
+    uint32_t stop;
     uint8_t use_raw;
     uint8_t use_elite;
-    uint32_t keycnt;
     uint8_t csn[PICOPASS_BLOCK_SIZE];
     uint8_t cc_nr[12];
     uint8_t *keys;
@@ -4745,16 +4763,13 @@ typedef struct {
     } list;
 } PACKED iclass_thread_arg_t;
 
-static size_t iclass_tc = 1;
-
-static pthread_mutex_t generator_mutex = PTHREAD_MUTEX_INITIALIZER;
+// Diversification and MAC only use stack state (per call DES context in hash2 / diversifyKey),
+// so the threads don't need any lock. Each thread gets its own contiguous slice of the key list.
 static void *bf_generate_mac(void *thread_arg) {
 
     iclass_thread_arg_t *targ = (iclass_thread_arg_t *)thread_arg;
-    const uint8_t idx = targ->thread_idx;
     const uint8_t use_raw = targ->use_raw;
     const uint8_t use_elite = targ->use_elite;
-    const uint32_t keycnt = targ->keycnt;
 
     uint8_t *keys = targ->keys;
     iclass_premac_t *list = targ->list.premac;
@@ -4767,64 +4782,25 @@ static void *bf_generate_mac(void *thread_arg) {
     uint8_t key[8] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
     uint8_t div_key[8] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-    for (uint32_t i = idx; i < keycnt; i += iclass_tc) {
+    for (uint32_t i = targ->start; i < targ->stop; i++) {
 
         memcpy(key, keys + 8 * i, 8);
 
-        pthread_mutex_lock(&generator_mutex);
         if (use_raw)
             memcpy(div_key, key, 8);
         else
             HFiClassCalcDivKey(csn, key, div_key, use_elite);
 
         doMAC(cc_nr, div_key, list[i].mac);
-        pthread_mutex_unlock(&generator_mutex);
     }
     return NULL;
 }
 
-// precalc diversified keys and their MAC
-void GenerateMacFrom(uint8_t *CSN, uint8_t *CCNR, bool use_raw, bool use_elite, uint8_t *keys, uint32_t keycnt, iclass_premac_t *list) {
-
-    pthread_mutex_init(&generator_mutex, NULL);
-
-    iclass_tc = num_CPUs();
-    pthread_t threads[iclass_tc];
-    iclass_thread_arg_t args[iclass_tc];
-    // init thread arguments
-    for (size_t i = 0; i < iclass_tc; i++) {
-        args[i].thread_idx = i;
-        args[i].use_raw = use_raw;
-        args[i].use_elite = use_elite;
-        args[i].keycnt = keycnt;
-        args[i].keys = keys;
-        args[i].list.premac = list;
-
-        memcpy(args[i].csn, CSN, sizeof(args[i].csn));
-        memcpy(args[i].cc_nr, CCNR, sizeof(args[i].cc_nr));
-    }
-
-    for (int i = 0; i < iclass_tc; i++) {
-        int res = pthread_create(&threads[i], NULL, bf_generate_mac, (void *)&args[i]);
-        if (res) {
-            PrintAndLogEx(NORMAL, "");
-            PrintAndLogEx(WARNING, "Failed to create pthreads. Quitting");
-            return;
-        }
-    }
-
-    for (int i = 0; i < iclass_tc; i++) {
-        pthread_join(threads[i], NULL);
-    }
-}
-
 static void *bf_generate_mackey(void *thread_arg) {
 
     iclass_thread_arg_t *targ = (iclass_thread_arg_t *)thread_arg;
-    const uint8_t idx = targ->thread_idx;
     const uint8_t use_raw = targ->use_raw;
     const uint8_t use_elite = targ->use_elite;
-    const uint32_t keycnt = targ->keycnt;
 
     uint8_t *keys = targ->keys;
     iclass_prekey_t *list = targ->list.prekey;
@@ -4836,53 +4812,152 @@ static void *bf_generate_mackey(void *thread_arg) {
 
     uint8_t div_key[8] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
-    for (uint32_t i = idx; i < keycnt; i += iclass_tc) {
+    for (uint32_t i = targ->start; i < targ->stop; i++) {
 
         memcpy(list[i].key, keys + 8 * i, 8);
 
-        pthread_mutex_lock(&generator_mutex);
         if (use_raw)
             memcpy(div_key, list[i].key, 8);
         else
             HFiClassCalcDivKey(csn, list[i].key, div_key, use_elite);
 
         doMAC(cc_nr, div_key, list[i].mac);
-        pthread_mutex_unlock(&generator_mutex);
     }
     return NULL;
 }
 
-void GenerateMacKeyFrom(uint8_t *CSN, uint8_t *CCNR, bool use_raw, bool use_elite, uint8_t *keys, uint32_t keycnt, iclass_prekey_t *list) {
+static void iclass_generate_threaded(void *(*worker)(void *), size_t tc, uint8_t *CSN, uint8_t *CCNR, bool use_raw, bool use_elite, uint8_t *keys, uint32_t keycnt, void *list) {
+
+    if (tc == 0) {
+        tc = 1;
+    }
+    // no point in spawning threads without work
+    if (tc > keycnt) {
+        tc = (keycnt) ? keycnt : 1;
+    }
+
+    pthread_t threads[tc];
+    iclass_thread_arg_t args[tc];
+
+    uint32_t chunk = keycnt / tc;
+    uint32_t rest = keycnt % tc;
+    uint32_t start = 0;
 
-    pthread_mutex_init(&generator_mutex, NULL);
-    iclass_tc = num_CPUs();
-    pthread_t threads[iclass_tc];
-    iclass_thread_arg_t args[iclass_tc];
     // init thread arguments
-    for (size_t i = 0; i < iclass_tc; i++) {
-        args[i].thread_idx = i;
+    for (size_t i = 0; i < tc; i++) {
+        args[i].start = start;
+        args[i].stop = start + chunk + ((i < rest) ? 1 : 0);
+        start = args[i].stop;
+
         args[i].use_raw = use_raw;
         args[i].use_elite = use_elite;
-        args[i].keycnt = keycnt;
         args[i].keys = keys;
-        args[i].list.prekey = list;
+        args[i].list.premac = list;
 
         memcpy(args[i].csn, CSN, sizeof(args[i].csn));
         memcpy(args[i].cc_nr, CCNR, sizeof(args[i].cc_nr));
     }
 
-    for (size_t i = 0; i < iclass_tc; i++) {
-        int res = pthread_create(&threads[i], NULL, bf_generate_mackey, (void *)&args[i]);
-        if (res) {
-            PrintAndLogEx(NORMAL, "");
-            PrintAndLogEx(WARNING, "Failed to create pthreads. Quitting");
-            return;
+    size_t started = 0;
+    for (; started < tc; started++) {
+        if (pthread_create(&threads[started], NULL, worker, (void *)&args[started])) {
+            break;
         }
     }
 
-    for (int i = 0; i < iclass_tc; i++)
+    for (size_t i = 0; i < started; i++) {
         pthread_join(threads[i], NULL);
+    }
+
+    if (started != tc) {
+        // whatever the failed threads were supposed to do, do it here
+        for (size_t i = started; i < tc; i++) {
+            worker((void *)&args[i]);
+        }
+        PrintAndLogEx(DEBUG, "Failed to create pthreads, used %zu of %zu", started, tc);
+    }
+}
+
+// precalc diversified keys and their MAC
+void GenerateMacFrom(uint8_t *CSN, uint8_t *CCNR, bool use_raw, bool use_elite, uint8_t *keys, uint32_t keycnt, iclass_premac_t *list) {
+    iclass_generate_threaded(bf_generate_mac, num_CPUs(), CSN, CCNR, use_raw, use_elite, keys, keycnt, list);
+}
+
+void GenerateMacKeyFrom(uint8_t *CSN, uint8_t *CCNR, bool use_raw, bool use_elite, uint8_t *keys, uint32_t keycnt, iclass_prekey_t *list) {
+    iclass_generate_threaded(bf_generate_mackey, num_CPUs(), CSN, CCNR, use_raw, use_elite, keys, keycnt, list);
+}
+
+#define ICLASS_BENCH_KEYS   20000
+
+static int iclass_lookup_bench(bool use_raw, bool use_elite) {
+
+    uint8_t csn[8] = {0x96, 0x55, 0xA4, 0x00, 0xF8, 0xFF, 0x12, 0xE0};
+    uint8_t ccnr[12] = {0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00};
+
+    uint8_t *keys = calloc(ICLASS_BENCH_KEYS, 8);
+    iclass_prekey_t *ref = calloc(ICLASS_BENCH_KEYS, sizeof(iclass_prekey_t));
+    iclass_prekey_t *list = calloc(ICLASS_BENCH_KEYS, sizeof(iclass_prekey_t));
+    if (keys == NULL || ref == NULL || list == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(keys);
+        free(ref);
+        free(list);
+        return PM3_EMALLOC;
+    }
 
+    picopass_elite_reset();
+    for (uint32_t i = 0; i < ICLASS_BENCH_KEYS; i++) {
+        picopass_elite_nextKey(keys + (i * 8));
+    }
+
+    PrintAndLogEx(INFO, "Benchmarking %u keys, %s", ICLASS_BENCH_KEYS, (use_raw) ? "raw" : (use_elite) ? "elite" : "standard");
+    PrintAndLogEx(INFO, "---------+-------------+----------+--------");
+    PrintAndLogEx(INFO, " threads |      keys/s |  speedup | result");
+    PrintAndLogEx(INFO, "---------+-------------+----------+--------");
+
+    int res = PM3_SUCCESS;
+    double base = 0;
+    size_t max_tc = num_CPUs();
+
+    // 1, 2, 4 ... threads, always ending with all CPUs
+    size_t tc = 1;
+    while (true) {
+
+        iclass_prekey_t *out = (tc == 1) ? ref : list;
+        memset(out, 0, ICLASS_BENCH_KEYS * sizeof(iclass_prekey_t));
+
+        uint64_t t1 = usclock();
+        iclass_generate_threaded(bf_generate_mackey, tc, csn, ccnr, use_raw, use_elite, keys, ICLASS_BENCH_KEYS, out);
+        uint64_t delta = usclock() - t1;
+        if (delta == 0) {
+            delta = 1;
+        }
+
+        double kps = (double)ICLASS_BENCH_KEYS * 1000000.0 / (double)delta;
+        if (tc == 1) {
+            base = kps;
+        }
+
+        // every thread count must give the exact same list as the single threaded run
+        bool ok = (memcmp(ref, out, ICLASS_BENCH_KEYS * sizeof(iclass_prekey_t)) == 0);
+        if (ok == false) {
+            res = PM3_ESOFT;
+        }
+
+        PrintAndLogEx(INFO, " %7zu | %11.0f | %7.2fx | %s", tc, kps, kps / base, (ok) ? _GREEN_("ok") : _RED_("fail"));
+
+        if (tc >= max_tc) {
+            break;
+        }
+        tc = (tc * 2 < max_tc) ? tc * 2 : max_tc;
+    }
+    PrintAndLogEx(INFO, "---------+-------------+----------+--------");
+    PrintAndLogEx((res == PM3_SUCCESS) ? SUCCESS : FAILED, "Thread results consistent ( %s )", (res == PM3_SUCCESS) ? _GREEN_("ok") : _RED_("fail"));
+
+    free(keys);
+    free(ref);
+    free(list);
+    return res;
 }
 
 // print diversified keys
@@ -19,8 +19,10 @@
 #include "cmdhflist.h"
 
 #include <inttypes.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <pthread.h>
 
 #include "commonutil.h"  // ARRAYLEN
 #include "mifare/mifarehost.h"
@@ -31,6 +33,10 @@
 #include "protocols.h"
 #include "cmdhficlass.h"
 #include "mifare/mifaredefault.h"  // mifare consts
+#include "mifare/mifare4.h"      // mfSectorNum
+#include "mifare/crypto1_bitslice.h"
+#include "mifare.h"              // MF_KEY_A / MF_KEY_B
+#include "util.h"                // num_CPUs
 #include "cmdhfseos.h"
 
 enum MifareAuthSeq {
@@ -52,6 +58,60 @@ void ClearAuthData(void) {
     AuthData.first_auth = true;
     AuthData.ks2 = 0;
     AuthData.ks3 = 0;
+    AuthData.block = 0;
+    AuthData.keytype = MF_KEY_A;
+}
+
+// Keys found while decoding, per card / sector / key type, so the next
+// authentication of the same sector skips the dictionary. Kept for the
+// session, an entry is only used after NestedCheckKey confirms it.
+#define MF_TRACE_KEY_CACHE_SIZE    256
+
+typedef struct {
+    uint32_t uid;
+    uint8_t sector;
+    uint8_t keytype;
+    uint64_t key;
+} mf_trace_key_t;
+
+static mf_trace_key_t gs_mf_trace_keys[MF_TRACE_KEY_CACHE_SIZE];
+static uint16_t gs_mf_trace_keys_count = 0;
+static uint16_t gs_mf_trace_keys_next = 0;
+
+static mf_trace_key_t *mf_trace_key_find(uint32_t uid, uint8_t sector, uint8_t keytype) {
+    for (uint16_t i = 0; i < gs_mf_trace_keys_count; i++) {
+        mf_trace_key_t *e = &gs_mf_trace_keys[i];
+        if (e->uid == uid && e->sector == sector && e->keytype == keytype) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+static void mf_trace_key_store(const AuthData_t *ad, uint64_t key) {
+    uint8_t sector = mfSectorNum(ad->block);
+    mf_trace_key_t *e = mf_trace_key_find(ad->uid, sector, ad->keytype);
+    if (e == NULL) {
+        // when full, overwrite the oldest entry
+        e = &gs_mf_trace_keys[gs_mf_trace_keys_next];
+        gs_mf_trace_keys_next = (gs_mf_trace_keys_next + 1) % MF_TRACE_KEY_CACHE_SIZE;
+        if (gs_mf_trace_keys_count < MF_TRACE_KEY_CACHE_SIZE) {
+            gs_mf_trace_keys_count++;
+        }
+    }
+    e->uid = ad->uid;
+    e->sector = sector;
+    e->keytype = ad->keytype;
+    e->key = key;
+}
+
+static bool mf_trace_key_lookup(const AuthData_t *ad, uint64_t *key) {
+    mf_trace_key_t *e = mf_trace_key_find(ad->uid, mfSectorNum(ad->block), ad->keytype);
+    if (e == NULL) {
+        return false;
+    }
+    *key = e->key;
+    return true;
 }
 
 
@@ -341,6 +401,8 @@ int applyIso14443a(char *exp, size_t size, uint8_t *cmd, uint8_t cmdsize, bool i
                 if (cmdsize > 3) {
                     snprintf(exp, size, "AUTH-A(" _MAGENTA_("%d") ")", cmd[1]);
                     MifareAuthState = masNt;
+                    AuthData.block = cmd[1];
+                    AuthData.keytype = MF_KEY_A;
                 } else {
                     // case MIFARE_ULEV1_VERSION :  both 0x60.
                     snprintf(exp, size, "EV1 VERSION");
@@ -349,6 +411,8 @@ int applyIso14443a(char *exp, size_t size, uint8_t *cmd, uint8_t cmdsize, bool i
             }
             case MIFARE_AUTH_KEYB: {
                 MifareAuthState = masNt;
+                AuthData.block = cmd[1];
+                AuthData.keytype = MF_KEY_B;
                 snprintf(exp, size, "AUTH-B(" _MAGENTA_("%d") ")", cmd[1]);
                 break;
             }
@@ -2244,6 +2308,114 @@ static void mf_get_paritybinstr(char *s, uint32_t val, uint8_t par) {
     s[0] = '\0';
 }
 
+// state after the nested authentication, for a key that passed NestedCheckKey
+static struct Crypto1State *mf_trace_state_from_key(uint64_t key, const AuthData_t *ad) {
+    struct Crypto1State *pcs = crypto1_create(key);
+    if (pcs == NULL) {
+        return NULL;
+    }
+    crypto1_word(pcs, ad->nt_enc ^ ad->uid, 1);
+    crypto1_word(pcs, ad->nr_enc, 1);
+    crypto1_word(pcs, 0, 0);
+    crypto1_word(pcs, 0, 0);
+    return pcs;
+}
+
+typedef struct {
+    const AuthData_t *ad;
+    const uint64_t *keys;
+    size_t count;
+    int64_t found;
+} mf_trace_dict_arg_t;
+
+// first key of the slice matching nt / ar / at, bitsliced
+static void
+#ifdef __has_attribute
+#if __has_attribute(force_align_arg_pointer)
+__attribute__((force_align_arg_pointer))
+#endif
+#endif
+*mf_trace_dict_thread(void *arg) {
+    mf_trace_dict_arg_t *a = (mf_trace_dict_arg_t *)arg;
+    const AuthData_t *ad = a->ad;
+    uint32_t ks[CRYPTO1_BS_MAX_LANES * 3];
+
+    a->found = -1;
+    for (size_t i = 0; i < a->count; i += CRYPTO1_BS_MAX_LANES) {
+        size_t cnt = a->count - i;
+        if (cnt > CRYPTO1_BS_MAX_LANES) {
+            cnt = CRYPTO1_BS_MAX_LANES;
+        }
+
+        crypto1_auth_bitsliced(a->keys + i, cnt, ad->nt_enc ^ ad->uid, ad->nr_enc, ks);
+
+        for (size_t j = 0; j < cnt; j++) {
+            uint32_t nt1 = ks[j * 3] ^ ad->nt_enc;
+            if ((ks[(j * 3) + 1] ^ ad->ar_enc) == prng_successor(nt1, 64) &&
+                    (ks[(j * 3) + 2] ^ ad->at_enc) == prng_successor(nt1, 96)) {
+                a->found = i + j;
+                return NULL;
+            }
+        }
+    }
+    return NULL;
+}
+
+// Index of the first dictionary key decrypting this nested authentication, or -1.
+// Keys are split over all CPUs, candidates are confirmed with NestedCheckKey in dictionary order.
+static int64_t mf_trace_check_dictionary(const uint64_t *keys, uint32_t count, uint8_t *cmd, uint8_t cmdsize, uint8_t *parity) {
+
+    // no point in a thread for less than a kernel pass
+    uint32_t num_threads = num_CPUs();
+    uint32_t lanes = crypto1_bitsliced_lanes();
+    if (num_threads > (count + lanes - 1) / lanes) {
+        num_threads = (count + lanes - 1) / lanes;
+    }
+    if (num_threads == 0) {
+        num_threads = 1;
+    }
+
+    pthread_t thread_id[num_threads];
+    bool started[num_threads];
+    mf_trace_dict_arg_t args[num_threads];
+
+    // AuthData is only read while the threads run
+    for (uint32_t i = 0; i < num_threads; i++) {
+        size_t from = (size_t)count * i / num_threads;
+        size_t to = (size_t)count * (i + 1) / num_threads;
+        args[i] = (mf_trace_dict_arg_t) { .ad = &AuthData, .keys = keys + from, .count = to - from, .found = -1 };
+        started[i] = (i < num_threads - 1) && (pthread_create(&thread_id[i], NULL, mf_trace_dict_thread, &args[i]) == 0);
+        if (started[i] == false) {
+            mf_trace_dict_thread(&args[i]);
+        }
+    }
+
+    for (uint32_t i = 0; i < num_threads; i++) {
+        if (started[i]) {
+            pthread_join(thread_id[i], NULL);
+        }
+    }
+
+    for (uint32_t i = 0; i < num_threads; i++) {
+        if (args[i].found < 0) {
+            continue;
+        }
+
+        int64_t base = args[i].keys - keys;
+        if (NestedCheckKey(keys[base + args[i].found], &AuthData, cmd, cmdsize, parity)) {
+            return base + args[i].found;
+        }
+
+        // the data did not decrypt, rest of the slice the slow way
+        for (size_t j = args[i].found + 1; j < args[i].count; j++) {
+            if (NestedCheckKey(keys[base + j], &AuthData, cmd, cmdsize, parity)) {
+                return base + j;
+            }
+        }
+    }
+    return -1;
+}
+
 bool DecodeMifareData(uint8_t *cmd, uint8_t cmdsize, uint8_t *parity, bool isResponse, uint8_t *mfData, size_t *mfDataLen, const uint64_t *dicKeys, uint32_t dicKeysCount) {
     static struct Crypto1State *traceCrypto1;
 
@@ -2277,30 +2449,39 @@ bool DecodeMifareData(uint8_t *cmd, uint8_t cmdsize, uint8_t *parity, bool isRes
             AuthData.first_auth = false;
 
             traceCrypto1 = lfsr_recovery64(AuthData.ks2, AuthData.ks3);
+            mf_trace_key_store(&AuthData, mfLastKey);
         } else {
             if (traceCrypto1) {
                 crypto1_destroy(traceCrypto1);
                 traceCrypto1 = NULL;
             }
 
+            // key already found for this card / sector
+            uint64_t cached = 0;
+            if (mf_trace_key_lookup(&AuthData, &cached)) {
+                if (NestedCheckKey(cached, &AuthData, cmd, cmdsize, parity)) {
+                    PrintAndLogEx(NORMAL, "            |            |  *  |%60s " _GREEN_("%012" PRIX64) "|     |", "known key", cached);
+                    mfLastKey = cached;
+                    traceCrypto1 = mf_trace_state_from_key(cached, &AuthData);
+                }
+            }
+
             // check last used key
-            if (mfLastKey) {
+            if (!traceCrypto1 && mfLastKey) {
                 if (NestedCheckKey(mfLastKey, &AuthData, cmd, cmdsize, parity)) {
                     PrintAndLogEx(NORMAL, "            |            |  *  |%60s " _GREEN_("%012" PRIX64) "|     |", "last used key", mfLastKey);
-                    traceCrypto1 = lfsr_recovery64(AuthData.ks2, AuthData.ks3);
+                    traceCrypto1 = mf_trace_state_from_key(mfLastKey, &AuthData);
                 };
             }
 
             // check default keys
             if (!traceCrypto1 && dicKeys != NULL && dicKeysCount > 0) {
-                for (int i = 0; i < dicKeysCount; i++) {
-                    if (NestedCheckKey(dicKeys[i], &AuthData, cmd, cmdsize, parity)) {
-                        PrintAndLogEx(NORMAL, "            |            |  *  |%60s " _GREEN_("%012" PRIX64) "|     |", "key", dicKeys[i]);
+                int64_t i = mf_trace_check_dictionary(dicKeys, dicKeysCount, cmd, cmdsize, parity);
+                if (i >= 0) {
+                    PrintAndLogEx(NORMAL, "            |            |  *  |%60s " _GREEN_("%012" PRIX64) "|     |", "key", dicKeys[i]);
 
-                        mfLastKey = dicKeys[i];
-                        traceCrypto1 = lfsr_recovery64(AuthData.ks2, AuthData.ks3);
-                        break;
-                    };
+                    mfLastKey = dicKeys[i];
+                    traceCrypto1 = mf_trace_state_from_key(dicKeys[i], &AuthData);
                 }
             }
 
@@ -2335,6 +2516,10 @@ bool DecodeMifareData(uint8_t *cmd, uint8_t cmdsize, uint8_t *parity, bool isRes
                 }
             }
 
+            if (traceCrypto1) {
+                mf_trace_key_store(&AuthData, mfLastKey);
+            }
+
             //hardnested
             if (!traceCrypto1) {
 
@@ -35,6 +35,8 @@ typedef struct {
     bool first_auth;    // is first authentication
     uint32_t ks2;       // ar ^ ar_enc
     uint32_t ks3;       // at ^ at_enc
+    uint8_t block;      // block of the last AUTH command seen
+    uint8_t keytype;    // MF_KEY_A / MF_KEY_B of the last AUTH command seen
     uint8_t mem[MIFARE_4K_MAX_BYTES];
 } AuthData_t;
 
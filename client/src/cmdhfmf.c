@@ -549,6 +549,76 @@ static int mf_analyse_st_block(uint8_t blockno, uint8_t *block, bool force) {
     return PM3_SUCCESS;
 }
 
+/* Pipelined first read attempt of every readable block in a sector.
+ * Up to COMM_TX_QUEUE_LEN reads are kept in flight, the device answers in order,
+ * so the n-th reply belongs to the n-th request.
+ * @param sectorNo: sector to read
+ * @param rights: decoded access rights of the sector
+ * @param keyA / keyB: key arrays as loaded from key file
+ * @param data: (output) block data
+ * @param ok: (output) true for every block read successfully
+*/
+static void mfc_prefetch_sector(uint8_t sectorNo, const uint8_t *rights, const uint8_t *keyA, const uint8_t *keyB, uint8_t data[][MFBLOCK_SIZE], bool *ok) {
+
+    uint8_t blocks[MIFARE_MAX_BLOCKS_PER_SECTOR];
+    uint8_t count = 0;
+
+    for (uint8_t blockNo = 0; blockNo < mfNumBlocksPerSector(sectorNo); blockNo++) {
+        ok[blockNo] = false;
+        uint8_t data_area = (sectorNo < 32) ? blockNo : blockNo / 5;
+        if (rights[data_area] != 0x07) {
+            blocks[count++] = blockNo;
+        }
+    }
+
+    clearCommandBuffer();
+
+    uint8_t requested = 0;
+    uint8_t consumed = 0;
+    for (uint8_t i = 0; i < count; i++) {
+
+        while (requested < count && (requested - i) < COMM_TX_QUEUE_LEN) {
+
+            uint8_t blockNo = blocks[requested];
+            uint8_t data_area = (sectorNo < 32) ? blockNo : blockNo / 5;
+
+            // same key selection as the first try in mfc_read_tag()
+            mf_readblock_t payload;
+            payload.blockno = mfFirstBlockOfSector(sectorNo) + blockNo;
+            payload.keytype = MF_KEY_A;
+            if ((mfIsSectorTrailerBasedOnBlocks(sectorNo, blockNo) == false) && ((rights[data_area] == 0x03) || (rights[data_area] == 0x05))) {
+                payload.keytype = MF_KEY_B;
+            }
+            memcpy(payload.key, (payload.keytype == MF_KEY_A) ? keyA + (sectorNo * MIFARE_KEY_SIZE) : keyB + (sectorNo * MIFARE_KEY_SIZE), MIFARE_KEY_SIZE);
+
+            SendCommandNG(CMD_HF_MIFARE_READBL, (uint8_t *)&payload, sizeof(mf_readblock_t));
+            requested++;
+        }
+
+        PacketResponseNG resp;
+        if (WaitForResponseTimeout(CMD_HF_MIFARE_READBL, &resp, 1500) == false) {
+            // replies out of sync, leave the remaining blocks to the regular retry loop
+            break;
+        }
+        consumed++;
+
+        if (resp.status == PM3_SUCCESS) {
+            memcpy(data[blocks[i]], resp.data.asBytes, MFBLOCK_SIZE);
+            ok[blocks[i]] = true;
+        }
+    }
+
+    // drop replies still in flight before the retry loop sends anything
+    for (uint8_t i = consumed; i < requested; i++) {
+        if (WaitForResponseTimeout(CMD_HF_MIFARE_READBL, NULL, 1500) == false) {
+            break;
+        }
+    }
+    if (consumed < requested) {
+        clearCommandBuffer();
+    }
+}
+
 /* Reads data from tag
  * @param card: (output) card info
  * @param carddata: (output) card data
@@ -653,6 +723,11 @@ static int mfc_read_tag(iso14a_card_select_t *card, uint8_t *carddata, uint8_t n
     PrintAndLogEx(INFO, "Dumping all blocks from card...");
 
     for (uint8_t sectorNo = 0; sectorNo < numSectors; sectorNo++) {
+
+        uint8_t prefetched[MIFARE_MAX_BLOCKS_PER_SECTOR][MFBLOCK_SIZE];
+        bool prefetched_ok[MIFARE_MAX_BLOCKS_PER_SECTOR];
+        mfc_prefetch_sector(sectorNo, rights[sectorNo], keyA, keyB, prefetched, prefetched_ok);
+
         for (uint8_t blockNo = 0; blockNo < mfNumBlocksPerSector(sectorNo); blockNo++) {
             bool received = false;
             current_key = MF_KEY_A;
@@ -662,7 +737,14 @@ static int mfc_read_tag(iso14a_card_select_t *card, uint8_t *carddata, uint8_t n
                 continue;
             }
 
-            for (uint8_t tries = 0; tries < MIFARE_SECTOR_RETRY; tries++) {
+            // first try already done by the pipelined read
+            if (prefetched_ok[blockNo]) {
+                received = true;
+                resp.status = PM3_SUCCESS;
+                memcpy(resp.data.asBytes, prefetched[blockNo], MFBLOCK_SIZE);
+            }
+
+            for (uint8_t tries = 0; (prefetched_ok[blockNo] == false) && (tries < MIFARE_SECTOR_RETRY); tries++) {
 
                 if (mfIsSectorTrailerBasedOnBlocks(sectorNo, blockNo)) {
 
@@ -2228,6 +2310,36 @@ jumptoend:
     return PM3_SUCCESS;
 }
 
+// solve several nonce files in a row, bitflip tables and worker threads are loaded once
+static int mf_hardnested_batch(char (*files)[FILE_PATH_SIZE], int count, uint8_t *trg_key) {
+
+    hardnested_batch_begin();
+
+    int res = PM3_SUCCESS;
+    for (int i = 0; i < count; i++) {
+
+        if (kbd_enter_pressed()) {
+            PrintAndLogEx(WARNING, "\naborted via keyboard!\n");
+            res = PM3_EOPABORTED;
+            break;
+        }
+
+        PrintAndLogEx(NORMAL, "");
+        PrintAndLogEx(INFO, "--- " _CYAN_("Target %d of %d") " ------------ " _YELLOW_("%s"), i + 1, count, files[i]);
+
+        uint8_t key[MIFARE_KEY_SIZE] = {0};
+        uint64_t foundkey = 0;
+        int isOK = mfnestedhard(0, MF_KEY_A, key, 0, MF_KEY_A, trg_key, true, false, false, 0, &foundkey, files[i]);
+        if (isOK != PM3_SUCCESS) {
+            // carry on with the next file
+            res = isOK;
+        }
+    }
+
+    hardnested_batch_end();
+    return res;
+}
+
 static int CmdHF14AMfNestedHard(const char *Cmd) {
 
     CLIParserContext *ctx;
@@ -2248,6 +2360,8 @@ static int CmdHF14AMfNestedHard(const char *Cmd) {
                   "hf mf hardnested -r\n"
                   "hf mf hardnested -r --tk a0a1a2a3a4a5\n"
                   "hf mf hardnested -t --tk a0a1a2a3a4a5\n"
+                  "hf mf hardnested -r --cache     --> expand bitflip tables to a cache, next runs map it\n"
+                  "hf mf hardnested --batch s1.bin --batch s2.bin     --> solve several nonce files in one run\n"
                   "hf mf hardnested --blk 0 -a -k a0a1a2a3a4a5 --tblk 4 --ta --tk FFFFFFFFFFFF\n"
                  );
 
@@ -2267,6 +2381,8 @@ static int CmdHF14AMfNestedHard(const char *Cmd) {
         arg_lit0("s",  "slow",           "Slower acquisition (required by some non standard cards)"),
         arg_lit0("t",  "tests",          "Run tests"),
         arg_lit0("w",  "wr",             "Acquire nonces and UID, and write them to file `hf-mf-<UID>-nonces.bin`"),
+        arg_lit0(NULL, "cache",          "Expand bitflip tables once to a cache file in the user directory, later runs map it"),
+        arg_strx0(NULL, "batch", "<fn>", "Read nonces from <fn> and attack, repeat to solve several files with tables and threads loaded once"),
 
         arg_lit0(NULL, "in", "None (use CPU regular instruction set)"),
 #if defined(COMPILER_HAS_SIMD_X86)
@@ -2327,22 +2443,40 @@ static int CmdHF14AMfNestedHard(const char *Cmd) {
     bool slow = arg_get_lit(ctx, 12);
     bool tests = arg_get_lit(ctx, 13);
     bool nonce_file_write = arg_get_lit(ctx, 14);
+    bool table_cache = arg_get_lit(ctx, 15);
+
+    struct arg_str *batch_arg = arg_get_str(ctx, 16);
+    int batch_cnt = batch_arg->count;
+    char (*batch_files)[FILE_PATH_SIZE] = NULL;
+    if (batch_cnt) {
+        batch_files = calloc(batch_cnt, FILE_PATH_SIZE);
+        if (batch_files == NULL) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            CLIParserFree(ctx);
+            return PM3_EMALLOC;
+        }
+        for (int i = 0; i < batch_cnt; i++) {
+            strncpy(batch_files[i], batch_arg->sval[i], FILE_PATH_SIZE - 1);
+        }
+    }
 
-    bool in = arg_get_lit(ctx, 15);
+    bool in = arg_get_lit(ctx, 17);
 #if defined(COMPILER_HAS_SIMD_X86)
-    bool im = arg_get_lit(ctx, 16);
-    bool is = arg_get_lit(ctx, 17);
-    bool ia = arg_get_lit(ctx, 18);
-    bool i2 = arg_get_lit(ctx, 19);
+    bool im = arg_get_lit(ctx, 18);
+    bool is = arg_get_lit(ctx, 19);
+    bool ia = arg_get_lit(ctx, 20);
+    bool i2 = arg_get_lit(ctx, 21);
 #endif
 #if defined(COMPILER_HAS_SIMD_AVX512)
-    bool i5 = arg_get_lit(ctx, 20);
+    bool i5 = arg_get_lit(ctx, 22);
 #endif
 #if defined(COMPILER_HAS_SIMD_NEON)
-    bool ie = arg_get_lit(ctx, 16);
+    bool ie = arg_get_lit(ctx, 18);
 #endif
     CLIParserFree(ctx);
 
+    hardnested_set_table_cache(table_cache);
+
     // set SIM instructions
     SetSIMDInstr(SIMD_AUTO);
 
@@ -2370,6 +2504,11 @@ static int CmdHF14AMfNestedHard(const char *Cmd) {
     if (in)
         SetSIMDInstr(SIMD_NONE);
 
+    if (batch_cnt) {
+        int res = mf_hardnested_batch(batch_files, batch_cnt, (trg_keylen) ? trg_key : NULL);
+        free(batch_files);
+        return res;
+    }
 
     bool known_target_key = (trg_keylen);
 
@@ -2462,7 +2601,17 @@ static int CmdHF14AMfNestedHard(const char *Cmd) {
     return isOK;
 }
 
+static int mf_autopwn(const char *Cmd);
+
+// hardnested targets of one card share the tables and worker threads
 static int CmdHF14AMfAutoPWN(const char *Cmd) {
+    hardnested_batch_begin();
+    int res = mf_autopwn(Cmd);
+    hardnested_batch_end();
+    return res;
+}
+
+static int mf_autopwn(const char *Cmd) {
 
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "hf mf autopwn",
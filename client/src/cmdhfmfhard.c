@@ -32,6 +32,12 @@
 #include <time.h> // MingW
 #include <lz4frame.h>
 #include <bzlib.h>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 #include "commonutil.h"  // ARRAYLEN
 #include "comms.h"
@@ -56,6 +62,14 @@
 #define STATE_FILE_TEMPLATE_LZ4         "bitflip_%d_%03" PRIx16 "_states.bin.lz4"
 #define STATE_FILE_TEMPLATE_BZ2         "bitflip_%d_%03" PRIx16 "_states.bin.bz2"
 
+// expanded bitflip tables, one file in the user directory, mmap'ed read only and shared by all clients
+#define BITFLIP_CACHE_FILE              "hardnested_bitflips.cache"
+#define BITFLIP_CACHE_MAGIC             "PM3HNBFC"
+// bump when the layout, the state tables or IGNORE_BITFLIP_THRESHOLD change
+#define BITFLIP_CACHE_VERSION           1
+#define BITFLIP_CACHE_HDR_SIZE          (4 * 4096)
+#define BITFLIP_TABLE_SIZE              (sizeof(uint32_t) * (1 << 19))
+
 #define DEBUG_KEY_ELIMINATION
 // #define DEBUG_REDUCTION
 
@@ -254,7 +268,167 @@ static void init_bunzip2(bz_stream *compressed_stream, char *input_buffer, uint3
 
 }
 
-static void init_bitflip_bitarrays(void) {
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t table_size;
+    uint32_t num_tables;
+    uint32_t reserved;
+    // 0 = table not used, otherwise 1 + position of the table after the header
+    uint16_t slot[2][0x400];
+    uint32_t count[2][0x400];
+} PACKED bitflip_cache_hdr_t;
+
+static bool bitflip_cache_create = false;
+#if !defined(_WIN32)
+static uint8_t *bitflip_cache_map = NULL;
+static size_t bitflip_cache_len = 0;
+#endif
+
+void hardnested_set_table_cache(bool create) {
+    bitflip_cache_create = create;
+}
+
+#if !defined(_WIN32)
+static bool load_bitflip_cache(void) {
+
+    char *path = NULL;
+    if (searchHomeFilePath(&path, CACHE_SUBDIR, BITFLIP_CACHE_FILE, false) != PM3_SUCCESS) {
+        return false;
+    }
+
+    int fd = open(path, O_RDONLY);
+    free(path);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < BITFLIP_CACHE_HDR_SIZE) {
+        close(fd);
+        return false;
+    }
+
+    size_t len = (size_t)st.st_size;
+    uint8_t *map = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+
+    const bitflip_cache_hdr_t *hdr = (const bitflip_cache_hdr_t *)map;
+    bool valid = (memcmp(hdr->magic, BITFLIP_CACHE_MAGIC, sizeof(hdr->magic)) == 0)
+                 && (hdr->version == BITFLIP_CACHE_VERSION)
+                 && (hdr->table_size == BITFLIP_TABLE_SIZE)
+                 && (len == BITFLIP_CACHE_HDR_SIZE + (size_t)hdr->num_tables * BITFLIP_TABLE_SIZE);
+
+    for (odd_even_t odd_even = EVEN_STATE; valid && odd_even <= ODD_STATE; odd_even++) {
+        for (uint16_t bitflip = 0x001; bitflip < 0x400; bitflip++) {
+            if (hdr->slot[odd_even][bitflip] > hdr->num_tables) {
+                valid = false;
+                break;
+            }
+        }
+    }
+
+    if (valid == false) {
+        munmap(map, len);
+        PrintAndLogEx(WARNING, "Ignoring outdated or damaged bitflip table cache, recreate it with `" _YELLOW_("hf mf hardnested --cache") "`");
+        return false;
+    }
+
+    for (odd_even_t odd_even = EVEN_STATE; odd_even <= ODD_STATE; odd_even++) {
+        num_effective_bitflips[odd_even] = 0;
+        for (uint16_t bitflip = 0x001; bitflip < 0x400; bitflip++) {
+            bitflip_bitarrays[odd_even][bitflip] = NULL;
+            count_bitflip_bitarrays[odd_even][bitflip] = 1 << 24;
+
+            uint16_t slot = hdr->slot[odd_even][bitflip];
+            if (slot == 0) {
+                continue;
+            }
+            effective_bitflip[odd_even][num_effective_bitflips[odd_even]++] = bitflip;
+            bitflip_bitarrays[odd_even][bitflip] = (uint32_t *)(map + BITFLIP_CACHE_HDR_SIZE + (size_t)(slot - 1) * BITFLIP_TABLE_SIZE);
+            count_bitflip_bitarrays[odd_even][bitflip] = hdr->count[odd_even][bitflip];
+        }
+        effective_bitflip[odd_even][num_effective_bitflips[odd_even]] = 0x400; // EndOfList marker
+    }
+
+#if defined(MADV_WILLNEED)
+    madvise(map, len, MADV_WILLNEED);
+#endif
+
+    bitflip_cache_map = map;
+    bitflip_cache_len = len;
+    return true;
+}
+
+static void save_bitflip_cache(void) {
+
+    bitflip_cache_hdr_t *hdr = calloc(1, BITFLIP_CACHE_HDR_SIZE);
+    if (hdr == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return;
+    }
+
+    memcpy(hdr->magic, BITFLIP_CACHE_MAGIC, sizeof(hdr->magic));
+    hdr->version = BITFLIP_CACHE_VERSION;
+    hdr->table_size = BITFLIP_TABLE_SIZE;
+
+    for (odd_even_t odd_even = EVEN_STATE; odd_even <= ODD_STATE; odd_even++) {
+        for (uint16_t i = 0; i < num_effective_bitflips[odd_even]; i++) {
+            uint16_t bitflip = effective_bitflip[odd_even][i];
+            hdr->slot[odd_even][bitflip] = ++hdr->num_tables;
+            hdr->count[odd_even][bitflip] = count_bitflip_bitarrays[odd_even][bitflip];
+        }
+    }
+
+    char *path = NULL;
+    if (searchHomeFilePath(&path, CACHE_SUBDIR, BITFLIP_CACHE_FILE, true) != PM3_SUCCESS) {
+        free(hdr);
+        return;
+    }
+
+    // write aside and rename, so a concurrent client never maps a half written file
+    size_t tmplen = strlen(path) + 16;
+    char *tmppath = calloc(tmplen, sizeof(char));
+    if (tmppath == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(path);
+        free(hdr);
+        return;
+    }
+    snprintf(tmppath, tmplen, "%s.%d", path, (int)getpid());
+
+    FILE *f = fopen(tmppath, "wb");
+    bool ok = (f != NULL);
+    if (ok) {
+        ok = (fwrite(hdr, 1, BITFLIP_CACHE_HDR_SIZE, f) == BITFLIP_CACHE_HDR_SIZE);
+        for (odd_even_t odd_even = EVEN_STATE; ok && odd_even <= ODD_STATE; odd_even++) {
+            for (uint16_t i = 0; ok && i < num_effective_bitflips[odd_even]; i++) {
+                uint16_t bitflip = effective_bitflip[odd_even][i];
+                ok = (fwrite(bitflip_bitarrays[odd_even][bitflip], 1, BITFLIP_TABLE_SIZE, f) == BITFLIP_TABLE_SIZE);
+            }
+        }
+        ok = (fclose(f) == 0) && ok;
+    }
+
+    if (ok && rename(tmppath, path) == 0) {
+        char progress_text[80];
+        snprintf(progress_text, sizeof(progress_text), "Saved %u bitflip tables to cache (%zu MB)", hdr->num_tables, ((size_t)hdr->num_tables * BITFLIP_TABLE_SIZE) >> 20);
+        hardnested_print_progress(0, progress_text, (float)(1LL << 47), 0);
+    } else {
+        PrintAndLogEx(WARNING, "Failed to write bitflip table cache " _YELLOW_("%s"), path);
+        remove(tmppath);
+    }
+
+    free(tmppath);
+    free(path);
+    free(hdr);
+}
+#endif
+
+static void load_bitflip_files(void) {
 #if defined (DEBUG_REDUCTION)
     uint8_t line = 0;
 #endif
@@ -490,6 +664,30 @@ static void init_bitflip_bitarrays(void) {
         snprintf(progress_text, sizeof(progress_text), "Loaded %u RAW / %u LZ4 / %u BZ2 in %"PRIu64" ms", nraw, nlz4, nbz2, msclock() - init_bitflip_bitarrays_starttime);
         hardnested_print_progress(0, progress_text, (float)(1LL << 47), 0);
     }
+}
+
+static void init_bitflip_bitarrays(void) {
+
+#if !defined(_WIN32)
+    uint64_t starttime = msclock();
+    if (load_bitflip_cache()) {
+        char progress_text[80];
+        snprintf(progress_text, sizeof(progress_text), "Mapped %u + %u tables from cache in %"PRIu64" ms", num_effective_bitflips[EVEN_STATE], num_effective_bitflips[ODD_STATE], msclock() - starttime);
+        hardnested_print_progress(0, progress_text, (float)(1LL << 47), 0);
+    } else {
+        load_bitflip_files();
+        // don't cache an incomplete install
+        if (bitflip_cache_create && (num_effective_bitflips[EVEN_STATE] + num_effective_bitflips[ODD_STATE])) {
+            save_bitflip_cache();
+        }
+    }
+#else
+    load_bitflip_files();
+    if (bitflip_cache_create) {
+        PrintAndLogEx(WARNING, "Bitflip table cache is not supported on this platform");
+    }
+#endif
+
     uint16_t i = 0;
     uint16_t j = 0;
     num_all_effective_bitflips = 0;
@@ -532,6 +730,15 @@ static void init_bitflip_bitarrays(void) {
 }
 
 static void free_bitflip_bitarrays(void) {
+#if !defined(_WIN32)
+    if (bitflip_cache_map != NULL) {
+        munmap(bitflip_cache_map, bitflip_cache_len);
+        bitflip_cache_map = NULL;
+        bitflip_cache_len = 0;
+        memset(bitflip_bitarrays, 0, sizeof(bitflip_bitarrays));
+        return;
+    }
+#endif
     for (int16_t bitflip = 0x3ff; bitflip > 0x000; bitflip--) {
         free_bitarray(bitflip_bitarrays[ODD_STATE][bitflip]);
     }
@@ -685,6 +892,7 @@ static bool all_bitflips_bitarray_dirty[2];
 static uint64_t last_sample_clock = 0;
 static uint64_t sample_period = 0;
 static uint64_t num_keys_tested = 0;
+static uint64_t num_keys_brute_forced = 0;
 static statelist_t *candidates = NULL;
 
 static int add_nonce(uint32_t nonce_enc, uint8_t par_enc) {
@@ -1208,7 +1416,7 @@ static void estimate_sum_a8(void) {
     }
 }
 
-static int read_nonce_file(char *filename) {
+static int read_nonce_file(char *filename, uint8_t *trgBlockNo, uint8_t *trgKeyType) {
 
     if (filename == NULL) {
         PrintAndLogEx(WARNING, "Filename is NULL");
@@ -1233,8 +1441,8 @@ static int read_nonce_file(char *filename) {
         return PM3_EFILE;
     }
     cuid = bytes_to_num(read_buf, 4);
-    uint8_t trgBlockNo = bytes_to_num(read_buf + 4, 1);
-    uint8_t trgKeyType = bytes_to_num(read_buf + 5, 1);
+    *trgBlockNo = bytes_to_num(read_buf + 4, 1);
+    *trgKeyType = bytes_to_num(read_buf + 5, 1);
 
     bytes_read = fread(read_buf, 1, 9, fnonces);
     while (bytes_read == 9) {
@@ -1251,7 +1459,7 @@ static int read_nonce_file(char *filename) {
     char progress_string[80];
     snprintf(progress_string, sizeof(progress_string), "Read %u nonces from file. cuid = %08x", num_acquired_nonces, cuid);
     hardnested_print_progress(num_acquired_nonces, progress_string, (float)(1LL << 47), 0);
-    snprintf(progress_string, sizeof(progress_string), "Target Block=%d, Keytype=%c", trgBlockNo, trgKeyType == 0 ? 'A' : 'B');
+    snprintf(progress_string, sizeof(progress_string), "Target Block=%d, Keytype=%c", *trgBlockNo, *trgKeyType == 0 ? 'A' : 'B');
     hardnested_print_progress(num_acquired_nonces, progress_string, (float)(1LL << 47), 0);
 
     bool got_match = false;
@@ -1386,7 +1594,6 @@ __attribute__((force_align_arg_pointer))
 static void check_for_BitFlipProperties(bool time_budget) {
     // create and run worker threads
     const size_t num_check_bitflip_threads = NUM_CHECK_BITFLIPS_THREADS;
-    pthread_t thread_id[num_check_bitflip_threads];
 
     uint8_t args[num_check_bitflip_threads][3];
     uint16_t bytes_per_thread = (256 + (num_check_bitflip_threads / 2)) / num_check_bitflip_threads;
@@ -1398,15 +1605,8 @@ static void check_for_BitFlipProperties(bool time_budget) {
     // args[][] is uint8_t so max 255, no need to check it
     // args[num_check_bitflip_threads - 1][1] = MAX(args[num_check_bitflip_threads - 1][1], 255);
 
-    // start threads
-    for (uint32_t i = 0; i < num_check_bitflip_threads; i++) {
-        pthread_create(&thread_id[i], NULL, check_for_BitFlipProperties_thread, args[i]);
-    }
-
-    // wait for threads to terminate:
-    for (uint32_t i = 0; i < num_check_bitflip_threads; i++) {
-        pthread_join(thread_id[i], NULL);
-    }
+    // run worker threads and wait for them to terminate
+    hardnested_run_threads(check_for_BitFlipProperties_thread, args, sizeof(args[0]), num_check_bitflip_threads);
 
     if (hardnested_stage & CHECK_2ND_BYTES) {
         hardnested_stage &= ~CHECK_1ST_BYTES; // we are done with 1st stage, except...
@@ -2224,20 +2424,16 @@ static void generate_candidates(uint8_t sum_a0_idx, uint8_t sum_a8_idx) {
 
     // create and run worker threads
     const size_t num_reduction_working_threads = NUM_REDUCTION_WORKING_THREADS;
-    pthread_t thread_id[num_reduction_working_threads];
 
     uint16_t sums1[num_reduction_working_threads][3];
     for (uint32_t i = 0; i < num_reduction_working_threads; i++) {
         sums1[i][0] = sum_a0_idx;
         sums1[i][1] = sum_a8_idx;
         sums1[i][2] = i + 1;
-        pthread_create(thread_id + i, NULL, generate_candidates_worker_thread, sums1[i]);
     }
 
-    // wait for threads to terminate:
-    for (uint32_t i = 0; i < num_reduction_working_threads; i++) {
-        pthread_join(thread_id[i], NULL);
-    }
+    // run and wait for threads to terminate:
+    hardnested_run_threads(generate_candidates_worker_thread, sums1, sizeof(sums1[0]), num_reduction_working_threads);
 
     maximum_states = 0;
     for (statelist_t *sl = candidates; sl != NULL; sl = sl->next) {
@@ -2286,7 +2482,9 @@ static bool brute_force(uint64_t *found_key) {
     if (known_target_key != -1) {
         TestIfKeyExists(known_target_key);
     }
-    return brute_force_bs(NULL, candidates, cuid, num_acquired_nonces, maximum_states, nonces, best_first_bytes, found_key);
+    bool found = brute_force_bs(NULL, candidates, cuid, num_acquired_nonces, maximum_states, nonces, best_first_bytes, found_key);
+    num_keys_brute_forced += brute_force_keys_tested();
+    return found;
 }
 
 static uint16_t SumProperty(struct Crypto1State *s) {
@@ -2352,6 +2550,194 @@ static void set_test_state(uint8_t byte) {
     crypto1_destroy(pcs);
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// batch mode, all targets of one run share the tables and the worker threads
+
+typedef struct {
+    uint8_t blockno;
+    uint8_t keytype;
+    bool found;
+    uint64_t key;
+    uint64_t time_ms;
+    uint64_t keys_tested;
+} hardnested_result_t;
+
+static bool batch_active = false;
+static bool batch_resident = false;
+static float batch_bf_rate = 0;
+// update_sum_bitarrays() narrows the part sum bitarrays down per target, keep the originals
+static uint32_t *batch_part_sum_a0_bitarrays[2][NUM_PART_SUMS];
+static uint32_t *batch_part_sum_a8_bitarrays[2][NUM_PART_SUMS];
+static hardnested_result_t *batch_results = NULL;
+static uint32_t batch_num_results = 0;
+static uint64_t batch_start_time = 0;
+
+static void free_batch_part_sum_bitarrays(void) {
+    for (odd_even_t odd_even = EVEN_STATE; odd_even <= ODD_STATE; odd_even++) {
+        for (uint16_t part_sum = 0; part_sum < NUM_PART_SUMS; part_sum++) {
+            if (batch_part_sum_a0_bitarrays[odd_even][part_sum] != NULL) {
+                free_bitarray(batch_part_sum_a0_bitarrays[odd_even][part_sum]);
+            }
+            if (batch_part_sum_a8_bitarrays[odd_even][part_sum] != NULL) {
+                free_bitarray(batch_part_sum_a8_bitarrays[odd_even][part_sum]);
+            }
+        }
+    }
+    memset(batch_part_sum_a0_bitarrays, 0, sizeof(batch_part_sum_a0_bitarrays));
+    memset(batch_part_sum_a8_bitarrays, 0, sizeof(batch_part_sum_a8_bitarrays));
+}
+
+static bool save_batch_part_sum_bitarrays(void) {
+    for (odd_even_t odd_even = EVEN_STATE; odd_even <= ODD_STATE; odd_even++) {
+        for (uint16_t part_sum = 0; part_sum < NUM_PART_SUMS; part_sum++) {
+            batch_part_sum_a0_bitarrays[odd_even][part_sum] = (uint32_t *)malloc_bitarray(BITFLIP_TABLE_SIZE);
+            batch_part_sum_a8_bitarrays[odd_even][part_sum] = (uint32_t *)malloc_bitarray(BITFLIP_TABLE_SIZE);
+            if (batch_part_sum_a0_bitarrays[odd_even][part_sum] == NULL || batch_part_sum_a8_bitarrays[odd_even][part_sum] == NULL) {
+                free_batch_part_sum_bitarrays();
+                return false;
+            }
+            memcpy(batch_part_sum_a0_bitarrays[odd_even][part_sum], part_sum_a0_bitarrays[odd_even][part_sum], BITFLIP_TABLE_SIZE);
+            memcpy(batch_part_sum_a8_bitarrays[odd_even][part_sum], part_sum_a8_bitarrays[odd_even][part_sum], BITFLIP_TABLE_SIZE);
+        }
+    }
+    return true;
+}
+
+// bitflip, part sum and sum bitarrays. In batch mode they are built for the first target only
+static void init_tables(void) {
+
+    if (batch_resident) {
+        for (odd_even_t odd_even = EVEN_STATE; odd_even <= ODD_STATE; odd_even++) {
+            for (uint16_t part_sum = 0; part_sum < NUM_PART_SUMS; part_sum++) {
+                memcpy(part_sum_a0_bitarrays[odd_even][part_sum], batch_part_sum_a0_bitarrays[odd_even][part_sum], BITFLIP_TABLE_SIZE);
+                memcpy(part_sum_a8_bitarrays[odd_even][part_sum], batch_part_sum_a8_bitarrays[odd_even][part_sum], BITFLIP_TABLE_SIZE);
+            }
+        }
+        char progress_text[80];
+        snprintf(progress_text, sizeof(progress_text), "Reusing %d resident bitflip state tables", num_all_effective_bitflips);
+        hardnested_print_progress(0, progress_text, (float)(1LL << 47), 0);
+        return;
+    }
+
+    init_bitflip_bitarrays();
+    init_part_sum_bitarrays();
+    init_sum_bitarrays();
+
+    if (batch_active) {
+        if (save_batch_part_sum_bitarrays()) {
+            batch_resident = true;
+            hardnested_pool_start();
+        } else {
+            PrintAndLogEx(WARNING, "Not enough memory to keep tables resident, loading them per target");
+        }
+    }
+}
+
+// the bitflip bitarrays aren't needed any more once the states are reduced
+static void release_bitflip_bitarrays(void) {
+    if (batch_resident == false) {
+        free_bitflip_bitarrays();
+    }
+}
+
+static void release_sum_bitarrays(void) {
+    if (batch_resident == false) {
+        free_sum_bitarrays();
+        free_part_sum_bitarrays();
+    }
+}
+
+static void batch_add_result(uint8_t blockno, uint8_t keytype, bool found, uint64_t key) {
+    if (batch_active == false) {
+        return;
+    }
+
+    hardnested_result_t *tmp = realloc(batch_results, (batch_num_results + 1) * sizeof(hardnested_result_t));
+    if (tmp == NULL) {
+        return;
+    }
+    batch_results = tmp;
+
+    hardnested_result_t *r = &batch_results[batch_num_results++];
+    r->blockno = blockno;
+    r->keytype = keytype;
+    r->found = found;
+    r->key = key;
+    r->time_ms = msclock() - start_time;
+    r->keys_tested = num_keys_brute_forced;
+}
+
+void hardnested_batch_begin(void) {
+    if (batch_active) {
+        return;
+    }
+    batch_active = true;
+    batch_resident = false;
+    batch_bf_rate = 0;
+    batch_num_results = 0;
+    batch_start_time = msclock();
+}
+
+void hardnested_batch_end(void) {
+    if (batch_active == false) {
+        return;
+    }
+
+    if (batch_num_results) {
+        uint64_t total_keys = 0;
+        uint64_t total_time = 0;
+        uint32_t num_found = 0;
+
+        PrintAndLogEx(NORMAL, "");
+        PrintAndLogEx(INFO, "----+-----+-----+--------------+----------+-----------------");
+        PrintAndLogEx(INFO, " #  | blk | key |  found key   | time (s) |  brute force");
+        PrintAndLogEx(INFO, "----+-----+-----+--------------+----------+-----------------");
+        for (uint32_t i = 0; i < batch_num_results; i++) {
+            const hardnested_result_t *r = &batch_results[i];
+            char keystr[40] = "------------";
+            if (r->found) {
+                snprintf(keystr, sizeof(keystr), _GREEN_("%012" PRIX64), r->key);
+                num_found++;
+            }
+            PrintAndLogEx(INFO, "%3u | %3u |  %c  | %s | %8.1f | 2^%4.1f keys",
+                          i + 1,
+                          r->blockno,
+                          (r->keytype == 0) ? 'A' : 'B',
+                          keystr,
+                          (float)r->time_ms / 1000.0,
+                          (r->keys_tested) ? log(r->keys_tested) / log(2.0) : 0.0
+                         );
+            total_keys += r->keys_tested;
+            total_time += r->time_ms;
+        }
+        PrintAndLogEx(INFO, "----+-----+-----+--------------+----------+-----------------");
+
+        uint64_t elapsed = msclock() - batch_start_time;
+        PrintAndLogEx(SUCCESS, "Found " _YELLOW_("%u") " of " _YELLOW_("%u") " keys in " _YELLOW_("%1.1f") " s, " _YELLOW_("%1.1f") " s per target",
+                      num_found, batch_num_results,
+                      (float)elapsed / 1000.0,
+                      (float)total_time / 1000.0 / batch_num_results
+                     );
+        if (total_time) {
+            PrintAndLogEx(SUCCESS, "Brute force " _YELLOW_("%1.0f") " million keys/s overall", (float)total_keys / ((float)total_time / 1000.0) / 1000000.0);
+        }
+    }
+
+    if (batch_resident) {
+        free_bitflip_bitarrays();
+        free_sum_bitarrays();
+        free_part_sum_bitarrays();
+        free_batch_part_sum_bitarrays();
+        batch_resident = false;
+    }
+    hardnested_pool_stop();
+
+    free(batch_results);
+    batch_results = NULL;
+    batch_num_results = 0;
+    batch_active = false;
+}
+
 static void init_it_all(void) {
     memset(nonces, 0, sizeof(nonces));
     maximum_states = 0;
@@ -2371,18 +2757,23 @@ static void init_it_all(void) {
     candidates = NULL;
     num_acquired_nonces = 0;
     start_time = 0;
-    num_effective_bitflips[0] = 0;
-    num_effective_bitflips[1] = 0;
-    num_all_effective_bitflips = 0;
-    num_1st_byte_effective_bitflips = 0;
     hardnested_stage = CHECK_1ST_BYTES;
     known_target_key = 0;
     test_state[0] = 0;
     test_state[1] = 0;
     brute_force_per_second = 0;
+    num_keys_brute_forced = 0;
     init_book_of_work();
     real_sum_a8 = 0;
 
+    if (batch_resident) {
+        return;
+    }
+
+    num_effective_bitflips[0] = 0;
+    num_effective_bitflips[1] = 0;
+    num_all_effective_bitflips = 0;
+    num_1st_byte_effective_bitflips = 0;
     memset(effective_bitflip, 0, sizeof(effective_bitflip));
     memset(all_effective_bitflip, 0, sizeof(all_effective_bitflip));
     memset(bitflip_bitarrays, 0, sizeof(bitflip_bitarrays));
@@ -2403,7 +2794,14 @@ int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBloc
     init_it_all();
 
     srand((unsigned) time(NULL));
-    brute_force_per_second = brute_force_benchmark();
+    if (batch_bf_rate > 0) {
+        brute_force_per_second = batch_bf_rate;
+    } else {
+        brute_force_per_second = brute_force_benchmark();
+        if (batch_active) {
+            batch_bf_rate = brute_force_per_second;
+        }
+    }
     write_stats = false;
 
     if (tests) {
@@ -2535,23 +2933,20 @@ int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBloc
         print_progress_header();
         snprintf(progress_text, sizeof(progress_text), "Brute force benchmark: %1.0f million (2^%1.1f) keys/s", brute_force_per_second / 1000000, log(brute_force_per_second) / log(2.0));
         hardnested_print_progress(0, progress_text, (float)(1LL << 47), 0);
-        init_bitflip_bitarrays();
-        init_part_sum_bitarrays();
-        init_sum_bitarrays();
+        init_tables();
         init_allbitflips_array();
         init_nonce_memory();
         update_reduction_rate(0.0, true);
 
         int res;
         if (nonce_file_read) {  // use pre-acquired data from file nonces.bin
-            res = read_nonce_file(filename);
+            res = read_nonce_file(filename, &trgBlockNo, &trgKeyType);
             if (res != PM3_SUCCESS) {
-                free_bitflip_bitarrays();
+                release_bitflip_bitarrays();
                 free_nonces_memory();
                 free_bitarray(all_bitflips_bitarray[ODD_STATE]);
                 free_bitarray(all_bitflips_bitarray[EVEN_STATE]);
-                free_sum_bitarrays();
-                free_part_sum_bitarrays();
+                release_sum_bitarrays();
                 return res;
             }
             hardnested_stage = CHECK_1ST_BYTES | CHECK_2ND_BYTES;
@@ -2561,12 +2956,11 @@ int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBloc
         } else { // acquire nonces.
             res = acquire_nonces(blockNo, keyType, key, trgBlockNo, trgKeyType, nonce_file_write, slow, filename);
             if (res != PM3_SUCCESS) {
-                free_bitflip_bitarrays();
+                release_bitflip_bitarrays();
                 free_nonces_memory();
                 free_bitarray(all_bitflips_bitarray[ODD_STATE]);
                 free_bitarray(all_bitflips_bitarray[EVEN_STATE]);
-                free_sum_bitarrays();
-                free_part_sum_bitarrays();
+                release_sum_bitarrays();
                 return res;
             }
         }
@@ -2580,7 +2974,7 @@ int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBloc
 
         Tests();
 
-        free_bitflip_bitarrays();
+        release_bitflip_bitarrays();
         bool key_found = false;
         num_keys_tested = 0;
         uint32_t num_odd = nonces[best_first_byte_smallest_bitarray].num_states_bitarray[ODD_STATE];
@@ -2641,9 +3035,9 @@ int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBloc
         free_nonces_memory();
         free_bitarray(all_bitflips_bitarray[ODD_STATE]);
         free_bitarray(all_bitflips_bitarray[EVEN_STATE]);
-        free_sum_bitarrays();
-        free_part_sum_bitarrays();
+        release_sum_bitarrays();
 
+        batch_add_result(trgBlockNo, trgKeyType, key_found, *foundkey);
         return (key_found) ? PM3_SUCCESS : PM3_EFAILED;
     }
 
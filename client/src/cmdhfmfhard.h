@@ -22,6 +22,10 @@
 #include "common.h"
 
 int mfnestedhard(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBlockNo, uint8_t trgKeyType, uint8_t *trgkey, bool nonce_file_read, bool nonce_file_write, bool slow, int tests, uint64_t *foundkey, char *filename);
+void hardnested_set_table_cache(bool create);
+// keep tables and worker threads loaded for several mfnestedhard() calls, end prints a summary
+void hardnested_batch_begin(void);
+void hardnested_batch_end(void);
 void hardnested_print_progress(uint32_t nonces, const char *activity, float brute_force, uint64_t min_diff_print_time);
 
 #endif
@@ -1072,12 +1072,15 @@ static int CmdTune(const char *Cmd) {
     // graph LF measurements
     // even here, these values has 3% error.
     uint16_t test1 = 0;
+    bool graph = graph_reserve(256);
     for (int i = 0; i < 256; i++) {
-        g_GraphBuffer[i] = package->results[i] - 128;
+        if (graph) {
+            g_GraphBuffer[i] = package->results[i] - 128;
+        }
         test1 += package->results[i];
     }
 
-    if (test1 > 0) {
+    if (test1 > 0 && graph) {
         PrintAndLogEx(NORMAL, "");
         PrintAndLogEx(INFO, "-------- " _CYAN_("LF tuning graph") " ------------");
         PrintAndLogEx(SUCCESS, "Orange line - divisor %d / %.2f kHz"
@@ -1089,6 +1092,7 @@ static int CmdTune(const char *Cmd) {
                       , LF_DIV2FREQ(LF_DIVISOR_134)
                      );
         g_GraphTraceLen = 256;
+        graph_changed();
         g_MarkerC.pos = LF_DIVISOR_125;
         g_MarkerD.pos = LF_DIVISOR_134;
         ShowGraphWindow();
@@ -1126,15 +1130,18 @@ static int CmdStatus(const char *Cmd) {
                   "Show runtime status information about the connected Proxmark3",
                   "hw status\n"
                   "hw status --ms 1000 -> Test connection speed with 1000ms timeout\n"
+                  "hw status --reset   -> Clear client round-trip latency histogram after showing it\n"
                  );
 
     void *argtable[] = {
         arg_param_begin,
         arg_int0("m", "ms", "<ms>", "speed test timeout in micro seconds"),
+        arg_lit0("r", "reset", "clear client round-trip latency histogram"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     int32_t speedTestTimeout = arg_get_int_def(ctx, 1, -1);
+    bool reset_latency = arg_get_lit(ctx, 2);
     CLIParserFree(ctx);
 
     clearCommandBuffer();
@@ -1150,6 +1157,11 @@ static int CmdStatus(const char *Cmd) {
         PrintAndLogEx(WARNING, "Status command timeout. Communication speed test timed out");
         return PM3_ETIMEOUT;
     }
+
+    PrintCommunicationLatency();
+    if (reset_latency) {
+        ResetCommunicationLatency();
+    }
     return PM3_SUCCESS;
 }
 
@@ -22,6 +22,7 @@
 #include <limits.h>
 #include <ctype.h>
 #include <math.h>
+#include <pthread.h>
 #include "cmdparser.h"      // command_t
 #include "comms.h"
 #include "commonutil.h"     // ARRAYLEN
@@ -31,6 +32,8 @@
 #include "cliparser.h"      // args parsing
 #include "graph.h"          // for graph data
 #include "cmddata.h"        // for `lf search`
+#include "demodctx.h"       // for parallel `lf search`
+#include "util.h"           // num_CPUs
 #include "cmdhw.h"          // for setting FPGA image
 #include "cmdlfawid.h"      // for awid menu
 #include "cmdlfem.h"        // for em menu
@@ -70,6 +73,8 @@
 #include "crc.h"
 #include "pm3_cmd.h"        // for LF_CMDREAD_MAX_EXTRA_SYMBOLS
 #include "fpga.h"           // for set_fpga_mode
+#include "fileutils.h"      // searchFile
+#include "lfstream.h"       // streaming demodulation
 
 static int CmdHelp(const char *Cmd);
 
@@ -529,6 +534,10 @@ int CmdFlexdemod(const char *Cmd) {
 
     // iceman,  use g_DemodBuffer?  blue line?
     // HACK writing back to graphbuffer.
+    if (graph_reserve(32 * 64) == false) {
+        free(data);
+        return PM3_EMALLOC;
+    }
     g_GraphTraceLen = 32 * 64;
     i = 0;
     for (bit = 0; bit < 64; bit++) {
@@ -540,6 +549,7 @@ int CmdFlexdemod(const char *Cmd) {
             phase = !phase;
         }
     }
+    graph_changed();
     RepaintGraphWindow();
     free(data);
     return PM3_SUCCESS;
@@ -867,6 +877,178 @@ int CmdLFRead(const char *Cmd) {
     return ret;
 }
 
+// bits per sample of the capture being streamed, for the raw data callback
+static uint8_t lf_stream_bps = 8;
+
+static void lf_stream_raw_cb(const uint8_t *data, size_t len, void *cb_data) {
+    lf_stream_push_raw((lf_stream_t *)cb_data, data, len, lf_stream_bps);
+}
+
+static int lf_stream_device(uint8_t decoders, uint64_t samples) {
+
+    sample_config current_config;
+    int res = lf_getconfig(&current_config);
+    if (res != PM3_SUCCESS) {
+        PrintAndLogEx(ERR, "failed to get current device config");
+        return res;
+    }
+
+    lf_stream_bps = current_config.bits_per_sample;
+    uint32_t rate = 12000000 / (current_config.divisor + 1) / MAX(current_config.decimation, 1);
+
+    lf_stream_t *s = lf_stream_new(decoders, rate);
+    if (s == NULL) {
+        return PM3_EMALLOC;
+    }
+
+    // the LF bitstream has to be loaded before the raw data starts
+    res = set_fpga_mode(FPGA_BITSTREAM_LF);
+    if (res != PM3_SUCCESS) {
+        PrintAndLogEx(FAILED, "failed to load LF bitstream to FPGA");
+        lf_stream_free(s);
+        return res;
+    }
+
+    clearCommandBuffer();
+    lf_sample_payload_t payload = {0};
+    payload.realtime = true;
+    SendCommandNG(CMD_LF_ACQ_RAW_ADC, (uint8_t *)&payload, sizeof(payload));
+
+    // unlimited, or waiting on a trigger, ends with <Enter> only
+    size_t len = SIZE_MAX;
+    size_t timeout = (size_t) - 1;
+    if (samples) {
+        len = ((samples * lf_stream_bps) / 8) + (((samples * lf_stream_bps) % 8) != 0);
+        if (current_config.trigger_threshold == 0) {
+            timeout = 1000;
+        }
+    }
+
+    size_t got = WaitForRawDataTimeoutEx(NULL, len, timeout, false, lf_stream_raw_cb, s);
+    // the device keeps streaming until it gets a command
+    if (got == len) {
+        SendCommandNG(CMD_BREAK_LOOP, NULL, 0);
+    }
+
+    lf_stream_flush(s);
+    PrintAndLogEx(INFO, "Done: %zu bytes", got);
+    lf_stream_print_stats(s);
+    lf_stream_free(s);
+    return PM3_SUCCESS;
+}
+
+static int lf_stream_file(uint8_t decoders, const char *filename, size_t chunk, uint64_t samples) {
+
+    char *path = NULL;
+    if (searchFile(&path, TRACES_SUBDIR, filename, ".pm3", true) != PM3_SUCCESS) {
+        if (searchFile(&path, TRACES_SUBDIR, filename, "", false) != PM3_SUCCESS) {
+            return PM3_EFILE;
+        }
+    }
+
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        PrintAndLogEx(WARNING, "couldn't open `" _YELLOW_("%s") "`", path);
+        free(path);
+        return PM3_EFILE;
+    }
+    free(path);
+
+    int32_t *buf = calloc(chunk, sizeof(int32_t));
+    lf_stream_t *s = lf_stream_new(decoders, 0);
+    if (buf == NULL || s == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        fclose(f);
+        free(buf);
+        lf_stream_free(s);
+        return PM3_EMALLOC;
+    }
+
+    // read as data load would, handing over one chunk at a time
+    uint64_t total = 0;
+    size_t n = 0;
+    char line[80];
+    while (fgets(line, sizeof(line), f)) {
+        buf[n++] = atoi(line);
+        total++;
+
+        if (n == chunk) {
+            lf_stream_push(s, buf, n);
+            n = 0;
+        }
+
+        if (samples && total == samples) {
+            break;
+        }
+    }
+    lf_stream_push(s, buf, n);
+    lf_stream_flush(s);
+    fclose(f);
+
+    lf_stream_print_stats(s);
+    int res = (lf_stream_ids(s)) ? PM3_SUCCESS : PM3_ESOFT;
+    lf_stream_free(s);
+    free(buf);
+    return res;
+}
+
+static int CmdLFStream(const char *Cmd) {
+    CLIParserContext *ctx;
+    CLIParserInit(&ctx, "lf stream",
+                  "Read LF samples in real-time mode and decode tags while they arrive.\n"
+                  "A tag ID is printed as soon as one of its frames validates, and once only\n"
+                  "while the tag stays in the field.\n"
+                  "With a trace file, its samples are replayed in chunks instead.\n"
+                  "Decoders: EM410x, HID Prox, Indala and T55xx config block, def all",
+                  "lf stream                                    --> decode until <Enter>\n"
+                  "lf stream -s 250000 --em --hid               --> EM410x and HID for two seconds\n"
+                  "lf stream -f lf_EM4102-1.pm3 --chunk 64      --> replay a trace 64 samples at a time"
+                 );
+
+    void *argtable[] = {
+        arg_param_begin,
+        arg_str0("f", "file", "<fn>", "replay a trace file instead of reading the device"),
+        arg_u64_0("s", "samples", "<dec>", "stop after this many samples (def until <Enter> / end of file)"),
+        arg_u64_0(NULL, "chunk", "<dec>", "samples per chunk when replaying (def 512)"),
+        arg_lit0(NULL, "em", "EM410x"),
+        arg_lit0(NULL, "hid", "HID Prox"),
+        arg_lit0(NULL, "indala", "Indala"),
+        arg_lit0(NULL, "t55", "T55xx config block"),
+        arg_param_end
+    };
+    CLIExecWithReturn(ctx, Cmd, argtable, true);
+    int fnlen = 0;
+    char filename[FILE_PATH_SIZE] = {0};
+    CLIParamStrToBuf(arg_get_str(ctx, 1), (uint8_t *)filename, FILE_PATH_SIZE, &fnlen);
+    uint64_t samples = arg_get_u64_def(ctx, 2, 0);
+    uint64_t chunk = arg_get_u64_def(ctx, 3, 512);
+    uint8_t decoders = 0;
+    decoders |= (arg_get_lit(ctx, 4)) ? LF_STREAM_EM410X : 0;
+    decoders |= (arg_get_lit(ctx, 5)) ? LF_STREAM_HID : 0;
+    decoders |= (arg_get_lit(ctx, 6)) ? LF_STREAM_INDALA : 0;
+    decoders |= (arg_get_lit(ctx, 7)) ? LF_STREAM_T55XX : 0;
+    CLIParserFree(ctx);
+
+    if (decoders == 0) {
+        decoders = LF_STREAM_ALL;
+    }
+
+    if (fnlen) {
+        if (chunk == 0 || chunk > 0x10000) {
+            PrintAndLogEx(WARNING, "chunk must be between 1 and 65536 samples");
+            return PM3_EINVARG;
+        }
+        return lf_stream_file(decoders, filename, chunk, samples);
+    }
+
+    if (g_session.pm3_present == false) {
+        return PM3_ENOTTY;
+    }
+
+    PrintAndLogEx(INFO, "Press " _GREEN_("<Enter>") " to exit");
+    return lf_stream_device(decoders, samples);
+}
+
 int lf_sniff(bool realtime, bool verbose, uint64_t samples) {
     if (!g_session.pm3_present) return PM3_ENOTTY;
 
@@ -1540,6 +1722,9 @@ int CmdVchDemod(const char *Cmd) {
 
     // clone
     if (strcmp(Cmd, "clone") == 0) {
+        if (graph_reserve(strlen(bits) * 16) == false) {
+            return PM3_EMALLOC;
+        }
         g_GraphTraceLen = 0;
         char *s;
         for (s = bits; *s; s++) {
@@ -1547,6 +1732,7 @@ int CmdVchDemod(const char *Cmd) {
                 g_GraphBuffer[g_GraphTraceLen++] = (*s == '1') ? 1 : 0;
             }
         }
+        graph_changed();
         RepaintGraphWindow();
     }
     return PM3_SUCCESS;
@@ -1562,7 +1748,7 @@ static bool check_chiptype(bool getDeviceData) {
     }
 
     //Save the state of the Graph and Demod Buffers
-    buffer_savestate_t saveState_gb = save_bufferS32(g_GraphBuffer, g_GraphTraceLen);
+    buffer_savestate_t saveState_gb = graph_save();
     saveState_gb.offset = g_GridOffset;
     buffer_savestate_t saveState_db = save_buffer8(g_DemodBuffer, g_DemodBufferLen);
     saveState_db.clock = g_DemodClock;
@@ -1638,7 +1824,7 @@ out:
     g_DemodClock = saveState_db.clock;
     g_DemodStartIdx = saveState_db.offset;
 
-    restore_bufferS32(saveState_gb, g_GraphBuffer);
+    graph_restore(saveState_gb);
     g_GridOffset = saveState_gb.offset;
 
     return retval;
@@ -1683,6 +1869,192 @@ static int check_autocorrelate(const char *prefix, int clock) {
     return PM3_EFAILED;
 }
 
+static int demodParadoxSearch(bool verbose) {
+    return demodParadox(verbose, false);
+}
+
+static int demodIdteckSearch(bool verbose) {
+    return demodIdteck(NULL, verbose);
+}
+
+typedef struct {
+    int (*demod)(bool verbose);
+    const char *name;
+} lf_search_decoder_t;
+
+// known tags in the order `lf search` tries and reports them
+static const lf_search_decoder_t lf_search_decoders[] = {
+    // ask / man
+    { demodEM410x,          "EM410x ID" },
+    { demodDestron,         "FDX-A FECAVA Destron ID" }, // to do before HID
+    { demodGallagher,       "GALLAGHER ID" },
+    { demodNoralsy,         "Noralsy ID" },
+    { demodPresco,          "Presco ID" },
+    { demodSecurakey,       "Securakey ID" },
+    { demodViking,          "Viking ID" },
+    { demodVisa2k,          "Visa2000 ID" },
+    // ask / bi
+    { demodFDXB,            "FDX-B ID" },
+    { demodJablotron,       "Jablotron ID" },
+    { demodGuard,           "Guardall G-Prox II ID" },
+    { demodNedap,           "NEDAP ID" },
+    // nrz
+    { demodPac,             "PAC/Stanley ID" },
+    // fsk
+    { demodHID,             "HID Prox ID" },
+    { demodAWID,            "AWID ID" },
+    { demodIOProx,          "IO Prox ID" },
+    { demodPyramid,         "Pyramid ID" },
+    { demodParadoxSearch,   "Paradox ID" },
+    // psk
+    { demodIdteckSearch,    "Idteck ID" },
+    { demodKeri,            "KERI ID" },
+    { demodNexWatch,        "NexWatch ID" },
+    { demodIndala,          "Indala ID" },
+    // { demodTI,           "Texas Instrument ID" },
+    // { demodFermax,       "Fermax ID" },
+};
+
+#define LF_SEARCH_DECODERS ARRAYLEN(lf_search_decoders)
+
+typedef struct {
+    pthread_mutex_t lock;
+    size_t next;
+    size_t best;
+    bool search_cont;
+    int32_t *samples;
+    size_t samples_len;
+    signal_t signal;
+    demod_ctx_t *ctx[LF_SEARCH_DECODERS];
+    print_deferred_t out[LF_SEARCH_DECODERS];
+    int res[LF_SEARCH_DECODERS];
+    bool done[LF_SEARCH_DECODERS];
+} lf_search_pool_t;
+
+// every decoder gets its own demod context on the shared samples and
+// its output is held back until the results are reported in table order
+static void
+#ifdef __has_attribute
+#if __has_attribute(force_align_arg_pointer)
+__attribute__((force_align_arg_pointer))
+#endif
+#endif
+*lf_search_worker(void *arg) {
+    lf_search_pool_t *pool = (lf_search_pool_t *)arg;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        size_t i = pool->next;
+        // decoders after a successful one would never be reported
+        if (i >= LF_SEARCH_DECODERS || (pool->search_cont == false && i > pool->best)) {
+            pthread_mutex_unlock(&pool->lock);
+            break;
+        }
+        pool->next++;
+        pthread_mutex_unlock(&pool->lock);
+
+        int res = PM3_EMALLOC;
+        demod_ctx_t *ctx = demod_ctx_new(pool->samples, pool->samples_len, false);
+        if (ctx != NULL) {
+            ctx->signal = pool->signal;
+            demod_ctx_t *prev = demod_ctx_bind(ctx);
+            PrintAndLogDefer(&pool->out[i]);
+            res = lf_search_decoders[i].demod(true);
+            PrintAndLogDefer(NULL);
+            demod_ctx_bind(prev);
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        pool->ctx[i] = ctx;
+        pool->res[i] = res;
+        pool->done[i] = true;
+        if (res == PM3_SUCCESS && i < pool->best) {
+            pool->best = i;
+        }
+        pthread_mutex_unlock(&pool->lock);
+    }
+    return NULL;
+}
+
+static int lf_search_parallel(bool search_cont, int *found) {
+
+    lf_search_pool_t *pool = calloc(1, sizeof(lf_search_pool_t));
+    if (pool == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return PM3_EMALLOC;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pool->best = LF_SEARCH_DECODERS;
+    pool->search_cont = search_cont;
+    pool->samples = g_GraphBuffer;
+    pool->samples_len = g_GraphTraceLen;
+    pool->signal = *getSignalProperties();
+
+    size_t num_threads = MIN(MAX(num_CPUs(), 1), LF_SEARCH_DECODERS);
+    pthread_t threads[LF_SEARCH_DECODERS];
+    size_t started = 0;
+    for (; started < num_threads; started++) {
+        if (pthread_create(&threads[started], NULL, lf_search_worker, pool) != 0) {
+            break;
+        }
+    }
+
+    // no threads at all, run the pool here
+    if (started == 0) {
+        lf_search_worker(pool);
+    }
+
+    for (size_t i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    int res = PM3_SUCCESS;
+
+    // report in table order, exactly what the sequential search would print
+    size_t last = LF_SEARCH_DECODERS;
+    for (size_t i = 0; i < LF_SEARCH_DECODERS && pool->done[i]; i++) {
+
+        if (pool->res[i] == PM3_EMALLOC) {
+            res = PM3_EMALLOC;
+            break;
+        }
+
+        PrintAndLogDeferredFlush(&pool->out[i]);
+        last = i;
+
+        if (pool->res[i] == PM3_SUCCESS) {
+            PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("%s") " found!", lf_search_decoders[i].name);
+            (*found)++;
+            if (search_cont == false) {
+                break;
+            }
+        }
+    }
+
+    // leave demod buffer, grid and signal properties as the last reported decoder did
+    if (last < LF_SEARCH_DECODERS) {
+        demod_ctx_t *ctx = pool->ctx[last];
+        memcpy(g_DemodBuffer, ctx->buffer, ctx->buffer_len);
+        g_DemodBufferLen = ctx->buffer_len;
+        *getSignalProperties() = ctx->signal;
+        if (pool->res[last] == PM3_SUCCESS) {
+            setClockGrid(ctx->clock, ctx->start_idx);
+        } else {
+            g_DemodClock = ctx->clock;
+            g_DemodStartIdx = ctx->start_idx;
+        }
+    }
+
+    for (size_t i = 0; i < LF_SEARCH_DECODERS; i++) {
+        PrintAndLogDeferredFree(&pool->out[i]);
+        demod_ctx_free(pool->ctx[i]);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+    return res;
+}
+
 int CmdLFfind(const char *Cmd) {
 
     CLIParserContext *ctx;
@@ -1692,6 +2064,7 @@ int CmdLFfind(const char *Cmd) {
                   "lf search -u    -> try reading data from tag & search for known and unknown tag\n"
                   "lf search -1    -> use data from the GraphBuffer & search for known tag\n"
                   "lf search -1uc  -> use data from the GraphBuffer & search for known and unknown tag\n"
+                  "lf search -1p   -> use data from the GraphBuffer & run the tag decoders in parallel\n"
                  );
 
     void *argtable[] = {
@@ -1699,12 +2072,14 @@ int CmdLFfind(const char *Cmd) {
         arg_lit0("1", NULL, "Use data from Graphbuffer to search (offline mode)"),
         arg_lit0("c", NULL, "Continue searching after successful match"),
         arg_lit0("u", NULL, "Search for unknown tags"),
+        arg_lit0("p", "par", "Run the known tag decoders in parallel"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     bool use_gb = arg_get_lit(ctx, 1);
     bool search_cont = arg_get_lit(ctx, 2);
     bool search_unk = arg_get_lit(ctx, 3);
+    bool search_par = arg_get_lit(ctx, 4);
     CLIParserFree(ctx);
     int found = 0;
     bool is_online = (g_session.pm3_present && (use_gb == false));
@@ -1791,209 +2166,27 @@ int CmdLFfind(const char *Cmd) {
         }
     }
 
-    // ask / man
-    if (demodEM410x(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("EM410x ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodDestron(true) == PM3_SUCCESS) { // to do before HID
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("FDX-A FECAVA Destron ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodGallagher(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("GALLAGHER ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodNoralsy(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Noralsy ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodPresco(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Presco ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodSecurakey(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Securakey ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodViking(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Viking ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodVisa2k(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Visa2000 ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-
-    // ask / bi
-    if (demodFDXB(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("FDX-B ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
+    if (search_par) {
+        int res = lf_search_parallel(search_cont, &found);
+        if (res != PM3_SUCCESS) {
+            return res;
         }
-    }
-    if (demodJablotron(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Jablotron ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodGuard(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Guardall G-Prox II ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodNedap(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("NEDAP ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
+        if (found && search_cont == false) {
             goto out;
         }
-    }
-
-    // nrz
-    if (demodPac(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("PAC/Stanley ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-
-    // fsk
-    if (demodHID(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("HID Prox ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodAWID(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("AWID ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodIOProx(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("IO Prox ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodPyramid(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Pyramid ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodParadox(true, false) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Paradox ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
+    } else {
+        for (size_t i = 0; i < ARRAYLEN(lf_search_decoders); i++) {
+            if (lf_search_decoders[i].demod(true) == PM3_SUCCESS) {
+                PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("%s") " found!", lf_search_decoders[i].name);
+                if (search_cont) {
+                    found++;
+                } else {
+                    goto out;
+                }
+            }
         }
     }
 
-    // psk
-    if (demodIdteck(NULL, true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Idteck ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodKeri(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("KERI ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodNexWatch(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("NexWatch ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodIndala(true) == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Indala ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    /*
-    if (demodTI() == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Texas Instrument ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    if (demodFermax() == PM3_SUCCESS) {
-        PrintAndLogEx(SUCCESS, "\nValid " _GREEN_("Fermax ID") " found!");
-        if (search_cont) {
-            found++;
-        } else {
-            goto out;
-        }
-    }
-    */
     if (found == 0) {
         PrintAndLogEx(FAILED, _RED_("No known 125/134 kHz tags found!"));
     }
@@ -2149,6 +2342,7 @@ static command_t CommandTable[] = {
 //    {"simnrz",      CmdLFnrzSim,        IfPm3Lf,         "Simulate " _YELLOW_("NRZ") " tag"},
     {"simbidir",    CmdLFSimBidir,      IfPm3Lf,         "Simulate LF tag (with bidirectional data transmission between reader and tag)"},
     {"sniff",       CmdLFSniff,         IfPm3Lf,         "Sniff LF traffic between reader and tag"},
+    {"stream",      CmdLFStream,        AlwaysAvailable, "Decode tags while reading in real-time mode"},
     {"tune",        CmdLFTune,          IfPm3Lf,         "Continuously measure LF antenna tuning"},
 //    {"vchdemod",    CmdVchDemod,        AlwaysAvailable, "Demodulate samples for VeriChip"},
 //    {"flexdemod",   CmdFlexdemod,       AlwaysAvailable, "Demodulate samples for Motorola FlexPass"},
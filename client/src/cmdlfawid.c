@@ -155,7 +155,7 @@ int demodAWID(bool verbose) {
         return PM3_EMALLOC;
     }
 
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBufferEx(bits, MAX_GRAPH_TRACE_LEN);
     if (size == 0) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - AWID not enough samples");
         free(bits);
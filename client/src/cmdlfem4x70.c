@@ -26,6 +26,10 @@
 #include "id48.h"
 #include "time.h"
 #include "util_posix.h" // msleep()
+#include "util.h"       // num_CPUs()
+#include <pthread.h>
+#include "jansson.h"
+#include "emv/emvjson.h"
 
 #define LOCKBIT_0 BITMASK(6)
 #define LOCKBIT_1 BITMASK(7)
@@ -153,6 +157,7 @@ typedef struct _em4x70_cmd_input_recover_t {
     ID48LIB_GRN   grn;
     bool parity; // if true, add parity bit to commands sent to tag
     bool verify; // if true, tag must be present
+    char checkpoint[FILE_PATH_SIZE]; // progress is saved to / resumed from this file, if set
 } em4x70_cmd_input_recover_t;
 
 // largest seen "in the wild" was 6
@@ -401,27 +406,278 @@ static int setpin_em4x70(const em4x70_cmd_input_setpin_t *opts, em4x70_tag_info_
     return resp.status;
 }
 
+// The key space is split on K47..K40 into ID48LIB_KEY_RECOVERY_PARTITIONS
+// partitions, searched by a pool of threads.  Searched partitions are kept
+// in a bitmap, which is what the checkpoint file saves.
+typedef struct {
+    const em4x70_cmd_input_recover_t *opts;
+    pthread_mutex_t lock;
+    uint16_t next;
+    uint16_t done_count;
+    uint8_t done[ID48LIB_KEY_RECOVERY_PARTITIONS / 8];
+    bool abort;
+    // may be larger than the number of keys kept
+    size_t key_count;
+    ID48LIB_KEY keys[MAXIMUM_ID48_RECOVERED_KEY_COUNT];
+} em4x70_recover_job_t;
+
+static bool recover_em4x70_is_done(const em4x70_recover_job_t *job, uint16_t partition) {
+    return (job->done[partition / 8] >> (partition % 8)) & 1;
+}
+
+// keys past the first MAXIMUM_ID48_RECOVERED_KEY_COUNT are only counted
+static void recover_em4x70_add_keys(em4x70_recover_job_t *job, const ID48LIB_KEY *keys, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (job->key_count + i < MAXIMUM_ID48_RECOVERED_KEY_COUNT) {
+            job->keys[job->key_count + i] = keys[i];
+        }
+    }
+    job->key_count += count;
+}
+
+// searches the next partition not done yet, false when there is none left or on abort
+static bool recover_em4x70_step(em4x70_recover_job_t *job) {
+    const em4x70_cmd_input_recover_t *opts = job->opts;
+
+    pthread_mutex_lock(&job->lock);
+    while ((job->next < ID48LIB_KEY_RECOVERY_PARTITIONS) && recover_em4x70_is_done(job, job->next)) {
+        job->next++;
+    }
+    if (job->abort || (job->next >= ID48LIB_KEY_RECOVERY_PARTITIONS)) {
+        pthread_mutex_unlock(&job->lock);
+        return false;
+    }
+    uint16_t partition = job->next++;
+    pthread_mutex_unlock(&job->lock);
+
+    ID48LIB_KEY found[MAXIMUM_ID48_RECOVERED_KEY_COUNT];
+    size_t count = id48lib_key_recovery_partition(&opts->key, &opts->nonce, &opts->frn, &opts->grn,
+                                                  partition, found, ARRAYLEN(found));
+
+    pthread_mutex_lock(&job->lock);
+    recover_em4x70_add_keys(job, found, count);
+    job->done[partition / 8] |= 1 << (partition % 8);
+    job->done_count++;
+    pthread_mutex_unlock(&job->lock);
+    return true;
+}
+
+static void
+#ifdef __has_attribute
+#if __has_attribute(force_align_arg_pointer)
+__attribute__((force_align_arg_pointer))
+#endif
+#endif
+*recover_em4x70_worker(void *arg) {
+    em4x70_recover_job_t *job = (em4x70_recover_job_t *)arg;
+    while (recover_em4x70_step(job)) {};
+    return NULL;
+}
+
+// the checkpoint only applies to the exact same inputs
+static void recover_em4x70_checkpoint_inputs(const em4x70_cmd_input_recover_t *opts, json_t *root) {
+    JsonSaveBufAsHexCompact(root, "$.Recover.Key", (uint8_t *)opts->key.k, 6);
+    JsonSaveBufAsHexCompact(root, "$.Recover.Rnd", (uint8_t *)opts->nonce.rn, 7);
+    JsonSaveBufAsHexCompact(root, "$.Recover.Frn", (uint8_t *)opts->frn.frn, 4);
+    JsonSaveBufAsHexCompact(root, "$.Recover.Grn", (uint8_t *)opts->grn.grn, 3);
+}
+
+static int recover_em4x70_save_checkpoint(em4x70_recover_job_t *job) {
+    json_t *root = json_object();
+    JsonSaveStr(root, "Created", "proxmark3");
+    JsonSaveStr(root, "FileType", "em4x70 recover");
+    recover_em4x70_checkpoint_inputs(job->opts, root);
+
+    pthread_mutex_lock(&job->lock);
+    JsonSaveBufAsHexCompact(root, "$.Progress.Done", job->done, sizeof(job->done));
+    json_t *keys = json_array();
+    for (size_t i = 0; i < MIN(job->key_count, MAXIMUM_ID48_RECOVERED_KEY_COUNT); i++) {
+        char hex[25] = {0};
+        hex_to_buffer((uint8_t *)hex, job->keys[i].k, sizeof(job->keys[i].k), sizeof(hex) - 1, 0, 0, false);
+        json_array_append_new(keys, json_string(hex));
+    }
+    pthread_mutex_unlock(&job->lock);
+    JsonSaveJsonObject(root, "$.Progress.Keys", keys);
+
+    // write aside and rename, an interrupted save must not lose the last checkpoint
+    char tmp[FILE_PATH_SIZE + 4];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", job->opts->checkpoint);
+    int res = json_dump_file(root, tmp, JSON_INDENT(2));
+    json_decref(root);
+    if (res != 0 || rename(tmp, job->opts->checkpoint) != 0) {
+        PrintAndLogEx(WARNING, "Failed to save checkpoint " _YELLOW_("%s"), job->opts->checkpoint);
+        return PM3_EFILE;
+    }
+    return PM3_SUCCESS;
+}
+
+static int recover_em4x70_load_checkpoint(em4x70_recover_job_t *job) {
+    if (fileExists(job->opts->checkpoint) == false) {
+        return PM3_SUCCESS;
+    }
+
+    json_error_t error;
+    json_t *root = json_load_file(job->opts->checkpoint, 0, &error);
+    if (root == NULL) {
+        PrintAndLogEx(ERR, "ERROR: json " _YELLOW_("%s") " error on line %d: %s", job->opts->checkpoint, error.line, error.text);
+        return PM3_EFILE;
+    }
+
+    // compare with what this run would save
+    json_t *expect = json_object();
+    recover_em4x70_checkpoint_inputs(job->opts, expect);
+    bool same = json_equal(json_object_get(root, "Recover"), json_object_get(expect, "Recover"));
+    json_decref(expect);
+    if (same == false) {
+        PrintAndLogEx(ERR, "Checkpoint " _YELLOW_("%s") " is for a different key, rnd, frn or grn", job->opts->checkpoint);
+        json_decref(root);
+        return PM3_EINVARG;
+    }
+
+    size_t len = 0;
+    JsonLoadBufAsHex(root, "$.Progress.Done", job->done, sizeof(job->done), &len);
+    for (uint16_t i = 0; i < ID48LIB_KEY_RECOVERY_PARTITIONS; i++) {
+        job->done_count += recover_em4x70_is_done(job, i);
+    }
+
+    json_t *keys = json_object_get(json_object_get(root, "Progress"), "Keys");
+    for (size_t i = 0; i < json_array_size(keys); i++) {
+        ID48LIB_KEY k = {0};
+        int klen = 0;
+        if (param_gethex_to_eol(json_string_value(json_array_get(keys, i)), 0, k.k, sizeof(k.k), &klen) == 0 && klen == sizeof(k.k)) {
+            recover_em4x70_add_keys(job, &k, 1);
+        }
+    }
+
+    json_decref(root);
+    PrintAndLogEx(INFO, "Resuming from " _YELLOW_("%s") ", %u of %u partitions already searched"
+                  , job->opts->checkpoint
+                  , job->done_count
+                  , ID48LIB_KEY_RECOVERY_PARTITIONS
+                 );
+    return PM3_SUCCESS;
+}
+
+static int recover_em4x70_cmp_keys(const void *a, const void *b) {
+    return memcmp(a, b, sizeof(ID48LIB_KEY));
+}
+
 static int recover_em4x70(const em4x70_cmd_input_recover_t *opts, em4x70_cmd_output_recover_t *data_out) {
     memset(data_out, 0, sizeof(em4x70_cmd_output_recover_t));
 
-    // The library is stateful.  First must initialize its internal context.
-    id48lib_key_recovery_init(&opts->key, &opts->nonce, &opts->frn, &opts->grn);
+    em4x70_recover_job_t job = { .opts = opts };
+    pthread_mutex_init(&job.lock, NULL);
 
-    // repeatedly call id48lib_key_recovery_next() to get the next potential key
-    ID48LIB_KEY q;
+    bool checkpoint = (opts->checkpoint[0] != '\0');
     int result = PM3_SUCCESS;
+    if (checkpoint) {
+        result = recover_em4x70_load_checkpoint(&job);
+        if (PM3_SUCCESS != result) {
+            pthread_mutex_destroy(&job.lock);
+            return result;
+        }
+    }
+    uint16_t done_at_start = job.done_count;
+
+    size_t num_threads = MIN(MAX(num_CPUs(), 1), ID48LIB_KEY_RECOVERY_PARTITIONS);
+    pthread_t threads[num_threads];
+    size_t started = 0;
+    for (size_t i = 0; i < num_threads; i++) {
+        if (pthread_create(&threads[started], NULL, recover_em4x70_worker, &job) == 0) {
+            started++;
+        }
+    }
 
-    while ((PM3_SUCCESS == result) && id48lib_key_recovery_next(&q)) {
+    uint64_t t_start = msclock();
+    uint64_t t_report = t_start;
 
-        if (data_out->potential_key_count >= MAXIMUM_ID48_RECOVERED_KEY_COUNT) {
-            result = PM3_EOVFLOW;
-        } else {
-            data_out->potential_keys[data_out->potential_key_count] = q;
-            ++data_out->potential_key_count;
+    if (started == 0) {
+        // no threads, search here one partition at a time
+        while (recover_em4x70_step(&job)) {
+            if (kbd_enter_pressed()) {
+                job.abort = true;
+                break;
+            }
+            uint64_t now = msclock();
+            if (checkpoint && (now - t_report >= 1000)) {
+                t_report = now;
+                recover_em4x70_save_checkpoint(&job);
+            }
+        }
+    } else {
+        for (;;) {
+            pthread_mutex_lock(&job.lock);
+            bool finished = (job.done_count == ID48LIB_KEY_RECOVERY_PARTITIONS);
+            uint16_t done = job.done_count;
+            pthread_mutex_unlock(&job.lock);
+
+            if (finished) {
+                break;
+            }
+
+            if (kbd_enter_pressed()) {
+                pthread_mutex_lock(&job.lock);
+                job.abort = true;
+                pthread_mutex_unlock(&job.lock);
+                break;
+            }
+
+            // progress, and a checkpoint, once a second
+            uint64_t now = msclock();
+            if (now - t_report >= 1000) {
+                t_report = now;
+                PrintAndLogEx(INPLACE, "Searched %3u of %u partitions ( %.3g keys/s )"
+                              , done
+                              , ID48LIB_KEY_RECOVERY_PARTITIONS
+                              , (double)(done - done_at_start) * (double)(1ull << 40) * 1000.0 / (double)(now - t_start)
+                             );
+                if (checkpoint) {
+                    recover_em4x70_save_checkpoint(&job);
+                }
+            }
+            msleep(10);
         }
+
+        for (size_t i = 0; i < started; i++) {
+            pthread_join(threads[i], NULL);
+        }
+    }
+
+    uint64_t elapsed = msclock() - t_start;
+    pthread_mutex_destroy(&job.lock);
+
+    if (checkpoint) {
+        recover_em4x70_save_checkpoint(&job);
     }
 
-    if ((PM3_SUCCESS == result) && (data_out->potential_key_count == 0)) {
+    if (job.abort) {
+        PrintAndLogEx(NORMAL, "");
+        PrintAndLogEx(WARNING, "Aborted after %u of %u partitions", job.done_count, ID48LIB_KEY_RECOVERY_PARTITIONS);
+        if (checkpoint) {
+            PrintAndLogEx(HINT, "Hint: run the same command again to resume");
+        }
+        return PM3_EOPABORTED;
+    }
+
+    if (job.done_count > done_at_start) {
+        PrintAndLogEx(INFO, "Searched %u partitions in %.1f s using %zu threads ( %.3g keys/s )"
+                      , job.done_count - done_at_start
+                      , (double)elapsed / 1000.0
+                      , MAX(started, 1)
+                      , (double)(job.done_count - done_at_start) * (double)(1ull << 40) * 1000.0 / (double)MAX(elapsed, 1)
+                     );
+    }
+
+    if (job.key_count > MAXIMUM_ID48_RECOVERED_KEY_COUNT) {
+        return PM3_EOVFLOW;
+    }
+
+    // partitions finish in any order, the keys are reported in key order
+    qsort(job.keys, job.key_count, sizeof(ID48LIB_KEY), recover_em4x70_cmp_keys);
+    data_out->potential_key_count = job.key_count;
+    memcpy(data_out->potential_keys, job.keys, job.key_count * sizeof(ID48LIB_KEY));
+
+    if (data_out->potential_key_count == 0) {
         result = PM3_EFAILED;
     }
     return result;
@@ -897,6 +1153,9 @@ static int CmdEM4x70Recover_ParseArgs(const char *Cmd, em4x70_cmd_input_recover_
         "'lf em 4x70 auth' command that will authenticate, if that potential key is correct.\n"
         "The user can copy/paste these commands when the tag is present to manually check\n"
         "which of the potential keys is correct.\n"
+        "\n"
+        "The search runs on all CPU cores.  With a checkpoint file, the progress is saved\n"
+        "every second and an interrupted recovery resumes where it stopped.\n"
         //   "\n"
         //   "If the `--verify` option is provided, the tag must be present.  The rnd/frn parameters will\n"
         //   "be used to authenticate against the tag, and then any potential keys will be automatically\n"
@@ -905,6 +1164,7 @@ static int CmdEM4x70Recover_ParseArgs(const char *Cmd, em4x70_cmd_input_recover_
         "lf em 4x70 recover --key F32AA98CF5BE --rnd 45F54ADA252AAC --frn 4866BB70 --grn 9BD180   (pm3 test key)\n"
         "lf em 4x70 recover --key A090A0A02080 --rnd 3FFE1FB6CC513F --frn F355F1A0 --grn 609D60   (research paper key)\n"
         "lf em 4x70 recover --key 022A028C02BE --rnd 7D5167003571F8 --frn 982DBCC0 --grn 36C0E0   (autorecovery test key)\n"
+        "lf em 4x70 recover --key 022A028C02BE --rnd 7D5167003571F8 --frn 982DBCC0 --grn 36C0E0 -f recover.json\n"
     );
 
     void *argtable[] = {
@@ -914,6 +1174,7 @@ static int CmdEM4x70Recover_ParseArgs(const char *Cmd, em4x70_cmd_input_recover_
         arg_str1(NULL, "rnd",    "<hex>", "Random 56-bit"),
         arg_str1(NULL, "frn",    "<hex>", "F(RN) 28-bit as 4 hex bytes"),
         arg_str1(NULL, "grn",    "<hex>", "G(RN) 20-bit as 3 hex bytes"),
+        arg_str0("f",  "file",   "<fn>",  "Checkpoint file, progress is saved to it and resumed from it"),
         //arg_lit0(NULL, "verify", "automatically use tag for validation"),
         arg_param_end
     };
@@ -944,7 +1205,11 @@ static int CmdEM4x70Recover_ParseArgs(const char *Cmd, em4x70_cmd_input_recover_
         if (CLIParamHexToBuf(arg_get_str(ctx, 5), &(out_results->grn.grn[0]), 3, &grn_len)) {
             result = PM3_ESOFT;
         }
-        //out_results->verify = arg_get_lit(ctx, 6);
+        int fnlen = 0;
+        if (CLIParamStrToBuf(arg_get_str(ctx, 6), (uint8_t *)out_results->checkpoint, FILE_PATH_SIZE, &fnlen)) {
+            result = PM3_ESOFT;
+        }
+        //out_results->verify = arg_get_lit(ctx, 7);
     }
 
     // if all OK so far, do additional parameter validation
@@ -1849,7 +1849,7 @@ static int CmdLFHitag2PWMDemod(const char *Cmd) {
         return PM3_EMALLOC;
     }
 
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBufferEx(bits, MAX_GRAPH_TRACE_LEN);
 
     PrintAndLogEx(DEBUG, "DEBUG: (Hitag2PWM) #samples from graphbuff... %zu", size);
 
@@ -412,7 +412,7 @@ static int CmdIndalaDemodAlt(const char *Cmd) {
         PrintAndLogEx(WARNING, "Failed to allocate memory");
         return PM3_EMALLOC;
     }
-    size_t datasize = getFromGraphBuffer(data);
+    size_t datasize = getFromGraphBufferEx(data, MAX_GRAPH_TRACE_LEN);
 
     uint8_t rawbits[4096] = {0};
     int rawbit = 0;
@@ -583,6 +583,9 @@ static int CmdIndalaDemodAlt(const char *Cmd) {
     // Remodulating for tag cloning
     // HACK: 2015-01-04 this will have an impact on our new way of seening lf commands (demod)
     // since this changes graphbuffer data.
+    if (graph_reserve(32 * uidlen) == false) {
+        return PM3_EMALLOC;
+    }
     g_GraphTraceLen = 32 * uidlen;
     i = 0;
     int phase;
@@ -597,6 +600,7 @@ static int CmdIndalaDemodAlt(const char *Cmd) {
             phase = !phase;
         }
     }
+    graph_changed();
 
     RepaintGraphWindow();
     return PM3_SUCCESS;
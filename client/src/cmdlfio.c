@@ -71,7 +71,7 @@ int demodIOProx(bool verbose) {
         PrintAndLogEx(WARNING, "Failed to allocate memory");
         return PM3_EMALLOC;
     }
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBufferEx(bits, MAX_GRAPH_TRACE_LEN);
     if (size < 65) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - IO prox not enough samples in GraphBuffer");
         free(bits);
@@ -163,7 +163,7 @@ int demodKeri(bool verbose) {
         raw1 = bytebits_to_byte(g_DemodBuffer, 32);
         raw2 = bytebits_to_byte(g_DemodBuffer + 32, 32);
 
-        CmdPrintDemodBuff("-x");
+        printDemodBuff(0, false, false, true);
     }
 
     //get internal id
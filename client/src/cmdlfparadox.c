@@ -108,7 +108,7 @@ int demodParadox(bool verbose, bool oldChksum) {
         PrintAndLogEx(WARNING, "Failed to allocate memory");
         return PM3_EMALLOC;
     }
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBufferEx(bits, MAX_GRAPH_TRACE_LEN);
     if (size == 0) {
         PrintAndLogEx(DEBUG, "DEBUG: Error - Paradox not enough samples");
         free(bits);
@@ -38,6 +38,9 @@
 #include "cmdlf.h"        // for lf sniff
 #include "generator.h"
 #include "cliparser.h"    // cliparsing
+#include "util.h"         // num_CPUs
+#include "demodctx.h"
+#include <pthread.h>
 
 // Some defines for readability
 #define T55XX_DLMODE_FIXED         0 // Default Mode
@@ -1162,6 +1165,147 @@ static int CmdT55xxWakeUp(const char *Cmd) {
     return PM3_SUCCESS;
 }
 
+// a trace as `data load` leaves it, in a context of its own
+static demod_ctx_t *t55xx_load_capture(const char *filename) {
+
+    char *path = NULL;
+    if (searchFile(&path, TRACES_SUBDIR, filename, ".pm3", true) != PM3_SUCCESS) {
+        if (searchFile(&path, TRACES_SUBDIR, filename, "", false) != PM3_SUCCESS) {
+            return NULL;
+        }
+    }
+
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        PrintAndLogEx(WARNING, "couldn't open `" _YELLOW_("%s") "`", path);
+        free(path);
+        return NULL;
+    }
+    free(path);
+
+    demod_ctx_t *ctx = demod_ctx_new(NULL, 0, false);
+    if (ctx == NULL) {
+        fclose(f);
+        return NULL;
+    }
+
+    demod_ctx_t *prev = demod_ctx_bind(ctx);
+
+    bool ok = true;
+    char line[80];
+    while (fgets(line, sizeof(line), f)) {
+        if (g_GraphTraceLen == ctx->samples_size) {
+            ok = demod_ctx_reserve(ctx, MAX(ctx->samples_size * 2, 4096));
+            if (ok == false) {
+                break;
+            }
+        }
+        g_GraphBuffer[g_GraphTraceLen++] = atoi(line);
+    }
+    fclose(f);
+    graph_changed();
+
+    uint8_t *bits = calloc(MAX(g_GraphTraceLen, 1), sizeof(uint8_t));
+    if (ok && bits) {
+        size_t size = getFromGraphBuffer(bits);
+        removeSignalOffset(bits, size);
+        setGraphBuffer(bits, size);
+        computeSignalProperties(bits, size);
+    } else {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        ok = false;
+    }
+    free(bits);
+
+    demod_ctx_bind(prev);
+
+    if (ok == false) {
+        demod_ctx_free(ctx);
+        return NULL;
+    }
+    return ctx;
+}
+
+static int t55xx_detect_files(char (*files)[FILE_PATH_SIZE], int count, uint8_t downlink_mode) {
+
+    static const uint8_t bit_rates[8] = {8, 16, 32, 40, 50, 64, 100, 128};
+
+    demod_ctx_t **ctxs = calloc(count, sizeof(demod_ctx_t *));
+    t55xx_capture_t *caps = calloc(count, sizeof(t55xx_capture_t));
+    t55xx_detect_result_t *results = calloc(count, sizeof(t55xx_detect_result_t));
+    if (ctxs == NULL || caps == NULL || results == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(ctxs);
+        free(caps);
+        free(results);
+        return PM3_EMALLOC;
+    }
+
+    int res = PM3_SUCCESS;
+    for (int i = 0; i < count; i++) {
+        ctxs[i] = t55xx_load_capture(files[i]);
+        if (ctxs[i] == NULL) {
+            res = PM3_EFILE;
+            goto out;
+        }
+        caps[i].samples = ctxs[i]->samples;
+        caps[i].len = ctxs[i]->samples_len;
+        caps[i].signal = ctxs[i]->signal;
+    }
+
+    uint64_t t1 = msclock();
+    res = t55xx_detect_batch(caps, count, downlink_mode, results);
+    if (res != PM3_SUCCESS) {
+        goto out;
+    }
+    t1 = msclock() - t1;
+
+    for (int i = 0; i < count; i++) {
+        const t55xx_detect_result_t *r = &results[i];
+
+        PrintAndLogEx(NORMAL, "");
+        PrintAndLogEx(INFO, _YELLOW_("%s") " ( %zu samples )%s", files[i], caps[i].len, (r->cached) ? " ( cached )" : "");
+        if (r->hits == 0) {
+            PrintAndLogEx(WARNING, "no modulation found");
+            continue;
+        }
+
+        PrintAndLogEx(INFO, " # | score | modulation  | rate   | inv | ST | Q5 | offset | block0");
+        PrintAndLogEx(INFO, "---+-------+-------------+--------+-----+----+----+--------+----------");
+        for (uint8_t j = 0; j < r->hits; j++) {
+            const t55xx_hypothesis_t *h = &r->h[r->rank[j]];
+            const t55xx_conf_block_t *b = &h->conf;
+            bool xmode = (b->block0 & T55x7_X_MODE && (b->block0 >> 28 == 6 || b->block0 >> 28 == 9));
+            char rate[12];
+            snprintf(rate, sizeof(rate), "RF/%u", (xmode) ? EM4x05_GET_BITRATE(b->bitrate) : bit_rates[b->bitrate & 7]);
+            PrintAndLogEx((j == 0) ? SUCCESS : INFO, "%2u |  %3u  | %-11s | %-6s | %s | %s | %s |   %3u  | %08X%s"
+                          , j + 1
+                          , h->score
+                          , GetSelectedModulationStr(b->modulation)
+                          , rate
+                          , (b->inverted) ? "yes" : "no "
+                          , (b->ST) ? "y " : "n "
+                          , (b->Q5) ? "y " : "n "
+                          , b->offset
+                          , b->block0
+                          , (testKnownConfigBlock(b->block0)) ? " ( known )" : ""
+                         );
+        }
+    }
+
+    PrintAndLogEx(NORMAL, "");
+    PrintAndLogEx(INFO, "Detected " _YELLOW_("%d") " capture%s in %" PRIu64 " ms", count, (count == 1) ? "" : "s", t1);
+
+out:
+    for (int i = 0; i < count; i++) {
+        demod_ctx_free(ctxs[i]);
+    }
+    free(ctxs);
+    free(caps);
+    free(results);
+    return res;
+}
+
 static int CmdT55xxDetect(const char *Cmd) {
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "lf t55xx detect",
@@ -1169,15 +1313,17 @@ static int CmdT55xxDetect(const char *Cmd) {
                   "lf t55xx detect\n"
                   "lf t55xx detect -1\n"
                   "lf t55xx detect -p 11223344\n"
+                  "lf t55xx detect -f lf_ATA5577_noralsy.pm3 -f lf_Q5_mod-psk1.pm3   -> rank the candidates of each trace"
                  );
 
-    // 1 (help) + 2 (two user specified params) + (6 T55XX_DLMODE_ALL)
-    void *argtable[3 + 6] = {
+    // 1 (help) + 3 (three user specified params) + (6 T55XX_DLMODE_ALL)
+    void *argtable[4 + 6] = {
         arg_param_begin,
         arg_lit0("1", NULL, "extract using data from graphbuffer"),
         arg_str0("p", "pwd", "<hex>", "password (4 hex bytes)"),
+        arg_strn("f", "file", "<fn>", 0, 32, "block 0 capture(s) to detect on, offline"),
     };
-    uint8_t idx = 3;
+    uint8_t idx = 4;
     arg_add_t55xx_downloadlink(argtable, &idx, T55XX_DLMODE_ALL, config.downlink_mode);
     CLIExecWithReturn(ctx, Cmd, argtable, true);
 
@@ -1197,18 +1343,41 @@ static int CmdT55xxDetect(const char *Cmd) {
         password = tmp_pwd;
     }
 
-    bool r0 = arg_get_lit(ctx, 3);
-    bool r1 = arg_get_lit(ctx, 4);
-    bool r2 = arg_get_lit(ctx, 5);
-    bool r3 = arg_get_lit(ctx, 6);
-    bool ra = arg_get_lit(ctx, 7);
+    struct arg_str *file_arg = arg_get_str(ctx, 3);
+    int file_cnt = file_arg->count;
+    char (*files)[FILE_PATH_SIZE] = NULL;
+    if (file_cnt) {
+        files = calloc(file_cnt, FILE_PATH_SIZE);
+        if (files == NULL) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            CLIParserFree(ctx);
+            return PM3_EMALLOC;
+        }
+        for (int i = 0; i < file_cnt; i++) {
+            strncpy(files[i], file_arg->sval[i], FILE_PATH_SIZE - 1);
+        }
+    }
+
+    bool r0 = arg_get_lit(ctx, 4);
+    bool r1 = arg_get_lit(ctx, 5);
+    bool r2 = arg_get_lit(ctx, 6);
+    bool r3 = arg_get_lit(ctx, 7);
+    bool ra = arg_get_lit(ctx, 8);
     CLIParserFree(ctx);
 
     if ((r0 + r1 + r2 + r3 + ra) > 1) {
         PrintAndLogEx(FAILED, "Error multiple downlink encoding");
+        free(files);
         return PM3_EINVARG;
     }
 
+    if (file_cnt) {
+        uint8_t dl = (r1) ? refLongLeading : (r2) ? refLeading0 : (r3) ? ref1of4 : (r0) ? refFixedBit : config.downlink_mode;
+        res = t55xx_detect_files(files, file_cnt, dl);
+        free(files);
+        return res;
+    }
+
     bool try_all_dl_modes = false;
     uint8_t downlink_mode = config.downlink_mode;
     if (r0)
@@ -1315,173 +1484,418 @@ bool t55xxTryDetectModulation(uint8_t downlink_mode, bool print_config) {
     return t55xxTryDetectModulationEx(downlink_mode, print_config, 0, -1);
 }
 
-bool t55xxTryDetectModulationEx(uint8_t downlink_mode, bool print_config, uint32_t wanted_conf, uint64_t pwd) {
+// Detection engine.
+//
+// The ladder tries every modulation a T55xx can use on a block 0 capture.
+// It is split per modulation family so the families of one capture, or of a
+// whole batch of captures, run at the same time, each on a private copy of
+// its capture. What a capture yields is kept by a hash of its samples, so
+// detecting on an unchanged capture again skips the demodulators entirely.
+enum {
+    T55XX_FAMILY_FSK,
+    T55XX_FAMILY_ASK,
+    T55XX_FAMILY_NRZ,
+    T55XX_FAMILY_PSK,
+    T55XX_FAMILIES
+};
 
-    t55xx_conf_block_t tests[15];
-    int bitRate = 0, clk = 0, firstClockEdge = 0;
-    uint8_t hits = 0, fc1 = 0, fc2 = 0, ans = 0;
+#define T55XX_DETECT_CACHE_SIZE 16
 
-    ans = fskClocks(&fc1, &fc2, (uint8_t *)&clk, &firstClockEdge);
+typedef struct {
+    uint64_t fingerprint;
+    size_t len;
+    uint8_t downlink_mode;
+    signal_t signal;
+    t55xx_detect_result_t result;
+} t55xx_detect_cache_t;
+
+static t55xx_detect_cache_t detect_cache[T55XX_DETECT_CACHE_SIZE];
+static size_t detect_cache_used = 0;
+static size_t detect_cache_next = 0;
+static pthread_mutex_t detect_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t t55xx_detect_fingerprint(const t55xx_capture_t *cap, uint8_t downlink_mode) {
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ cap->len ^ ((uint64_t)downlink_mode << 56);
+    for (size_t i = 0; i < cap->len; i++) {
+        h = (h ^ (uint32_t)cap->samples[i]) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 29;
+    }
+    return h;
+}
 
-    if (ans && ((fc1 == 10 && fc2 == 8) || (fc1 == 8 && fc2 == 5))) {
-        if ((FSKrawDemod(0, 0, 0, 0, false) == PM3_SUCCESS) && test(DEMOD_FSK, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-            tests[hits].modulation = DEMOD_FSK;
-            if (fc1 == 8 && fc2 == 5)
-                tests[hits].modulation = DEMOD_FSK1a;
-            else if (fc1 == 10 && fc2 == 8)
-                tests[hits].modulation = DEMOD_FSK2;
-            tests[hits].bitrate = bitRate;
-            tests[hits].inverted = false;
-            tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-            tests[hits].ST = false;
-            tests[hits].downlink_mode = downlink_mode;
-            ++hits;
+static bool t55xx_detect_signal_eq(const signal_t *a, const signal_t *b) {
+    return a->low == b->low && a->high == b->high && a->mean == b->mean &&
+           a->amplitude == b->amplitude && a->isnoise == b->isnoise;
+}
+
+static bool t55xx_detect_cache_get(uint64_t fp, const t55xx_capture_t *cap, uint8_t downlink_mode, t55xx_detect_result_t *res) {
+    // debug output of the demodulators is only there when they actually run
+    if (g_debugMode == 2) {
+        return false;
+    }
+
+    bool found = false;
+    pthread_mutex_lock(&detect_cache_lock);
+    for (size_t i = 0; i < detect_cache_used; i++) {
+        const t55xx_detect_cache_t *e = &detect_cache[i];
+        if (e->fingerprint == fp && e->len == cap->len && e->downlink_mode == downlink_mode &&
+                t55xx_detect_signal_eq(&e->signal, &cap->signal)) {
+            *res = e->result;
+            res->cached = true;
+            found = true;
+            break;
         }
-        if ((FSKrawDemod(0, 1, 0, 0, false) == PM3_SUCCESS) && test(DEMOD_FSK, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-            tests[hits].modulation = DEMOD_FSK;
-            if (fc1 == 8 && fc2 == 5)
-                tests[hits].modulation = DEMOD_FSK1;
-            else if (fc1 == 10 && fc2 == 8)
-                tests[hits].modulation = DEMOD_FSK2a;
-            tests[hits].bitrate = bitRate;
-            tests[hits].inverted = true;
-            tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-            tests[hits].ST = false;
-            tests[hits].downlink_mode = downlink_mode;
-            ++hits;
+    }
+    pthread_mutex_unlock(&detect_cache_lock);
+    return found;
+}
+
+static void t55xx_detect_cache_put(uint64_t fp, const t55xx_capture_t *cap, uint8_t downlink_mode, const t55xx_detect_result_t *res) {
+    if (g_debugMode == 2) {
+        return;
+    }
+
+    pthread_mutex_lock(&detect_cache_lock);
+    t55xx_detect_cache_t *e = &detect_cache[detect_cache_next];
+    detect_cache_used = MIN(detect_cache_used + 1, T55XX_DETECT_CACHE_SIZE);
+    detect_cache_next = (detect_cache_next + 1) % T55XX_DETECT_CACHE_SIZE;
+    e->fingerprint = fp;
+    e->len = cap->len;
+    e->downlink_mode = downlink_mode;
+    e->signal = cap->signal;
+    e->result = *res;
+    pthread_mutex_unlock(&detect_cache_lock);
+}
+
+// 0 - 100. Passing test() is where it starts, a known config block and the
+// same block 0 repeating further down the capture add to it
+static uint8_t t55xx_detect_score(const t55xx_conf_block_t *b) {
+    uint8_t score = 40;
+    if (testKnownConfigBlock(b->block0)) {
+        score += 40;
+    }
+
+    // sliding 32 bit window, counting windows that start after the block itself
+    uint8_t repeats = 0;
+    uint32_t w = 0;
+    for (size_t i = 0; i < g_DemodBufferLen && repeats < 3; i++) {
+        w = (w << 1) | (g_DemodBuffer[i] & 1);
+        if (i >= b->offset + 63 && w == b->block0) {
+            repeats++;
         }
-    } else {
-        clk = GetAskClock("", false);
-        if (clk > 0) {
-            tests[hits].ST = true;
+    }
+    return score + (5 * repeats);
+}
+
+static void t55xx_detect_add(t55xx_detect_result_t *r, uint8_t modulation, bool inverted, bool ST, uint8_t offset, int bitRate, bool Q5, uint8_t downlink_mode) {
+    t55xx_hypothesis_t *h = &r->h[r->hits++];
+    memset(h, 0, sizeof(t55xx_hypothesis_t));
+    h->conf.modulation = modulation;
+    h->conf.bitrate = bitRate;
+    h->conf.inverted = inverted;
+    h->conf.offset = offset;
+    h->conf.block0 = PackBits(offset, 32, g_DemodBuffer);
+    h->conf.Q5 = Q5;
+    h->conf.ST = ST;
+    h->conf.downlink_mode = downlink_mode;
+    h->score = t55xx_detect_score(&h->conf);
+}
+
+// one family of the ladder on the capture of the calling thread
+static void t55xx_detect_family(uint8_t family, uint8_t downlink_mode, t55xx_detect_result_t *r) {
+
+    int bitRate = 0, clk = 0, firstClockEdge = 0;
+    uint8_t fc1 = 0, fc2 = 0, offset = 0;
+    bool Q5 = false;
+
+    // a FSK capture is never tried with the other modulations and vice versa
+    uint8_t ans = fskClocks(&fc1, &fc2, (uint8_t *)&clk, &firstClockEdge);
+    bool is_fsk = (ans && ((fc1 == 10 && fc2 == 8) || (fc1 == 8 && fc2 == 5)));
+    if (is_fsk != (family == T55XX_FAMILY_FSK)) {
+        return;
+    }
+
+    switch (family) {
+        case T55XX_FAMILY_FSK: {
+            if ((FSKrawDemod(0, 0, 0, 0, false) == PM3_SUCCESS) && test(DEMOD_FSK, &offset, &bitRate, clk, &Q5)) {
+                uint8_t mod = (fc1 == 8 && fc2 == 5) ? DEMOD_FSK1a : DEMOD_FSK2;
+                t55xx_detect_add(r, mod, false, false, offset, bitRate, Q5, downlink_mode);
+            }
+            if ((FSKrawDemod(0, 1, 0, 0, false) == PM3_SUCCESS) && test(DEMOD_FSK, &offset, &bitRate, clk, &Q5)) {
+                uint8_t mod = (fc1 == 8 && fc2 == 5) ? DEMOD_FSK1 : DEMOD_FSK2a;
+                t55xx_detect_add(r, mod, true, false, offset, bitRate, Q5, downlink_mode);
+            }
+            break;
+        }
+        case T55XX_FAMILY_ASK: {
+            clk = GetAskClock("", false);
+            if (clk <= 0) {
+                break;
+            }
+
             // "0 0 1 " == clock auto, invert false, maxError 1.
             // false = no verbose
             // false = no emSearch
             // 1 = Ask/Man
             // st = true
-            if ((ASKDemod_ext(0, 0, 1, 0, false, false, false, 1, &tests[hits].ST) == PM3_SUCCESS) && test(DEMOD_ASK, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_ASK;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = false;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
+            bool st = true;
+            if ((ASKDemod_ext(0, 0, 1, 0, false, false, false, 1, &st) == PM3_SUCCESS) && test(DEMOD_ASK, &offset, &bitRate, clk, &Q5)) {
+                t55xx_detect_add(r, DEMOD_ASK, false, st, offset, bitRate, Q5, downlink_mode);
             }
-            tests[hits].ST = true;
-            // "0 0 1 " == clock auto, invert true, maxError 1.
-            // false = no verbose
-            // false = no emSearch
-            // 1 = Ask/Man
-            // st = true
-            if ((ASKDemod_ext(0, 1, 1, 0, false, false, false, 1, &tests[hits].ST) == PM3_SUCCESS) && test(DEMOD_ASK, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_ASK;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = true;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
+            // same, invert true
+            st = true;
+            if ((ASKDemod_ext(0, 1, 1, 0, false, false, false, 1, &st) == PM3_SUCCESS) && test(DEMOD_ASK, &offset, &bitRate, clk, &Q5)) {
+                t55xx_detect_add(r, DEMOD_ASK, true, st, offset, bitRate, Q5, downlink_mode);
             }
-            if ((ASKbiphaseDemod(0, 0, 0, 2, false) == PM3_SUCCESS) && test(DEMOD_BI, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_BI;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = false;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].ST = false;
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
+            if ((ASKbiphaseDemod(0, 0, 0, 2, false) == PM3_SUCCESS) && test(DEMOD_BI, &offset, &bitRate, clk, &Q5)) {
+                t55xx_detect_add(r, DEMOD_BI, false, false, offset, bitRate, Q5, downlink_mode);
             }
-            if ((ASKbiphaseDemod(0, 0, 1, 2, false) == PM3_SUCCESS) && test(DEMOD_BIa, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_BIa;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = true;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].ST = false;
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
+            if ((ASKbiphaseDemod(0, 0, 1, 2, false) == PM3_SUCCESS) && test(DEMOD_BIa, &offset, &bitRate, clk, &Q5)) {
+                t55xx_detect_add(r, DEMOD_BIa, true, false, offset, bitRate, Q5, downlink_mode);
             }
+            break;
         }
-        clk = GetNrzClock("", false);
-        if (clk > 8) { //clock of rf/8 is likely a false positive, so don't use it.
-            if ((NRZrawDemod(0, 0, 1, false) == PM3_SUCCESS) && test(DEMOD_NRZ, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_NRZ;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = false;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].ST = false;
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
+        case T55XX_FAMILY_NRZ: {
+            clk = GetNrzClock("", false);
+            if (clk <= 8) { //clock of rf/8 is likely a false positive, so don't use it.
+                break;
             }
 
-            if ((NRZrawDemod(0, 1, 1, false) == PM3_SUCCESS) && test(DEMOD_NRZ, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_NRZ;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = true;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].ST = false;
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
+            if ((NRZrawDemod(0, 0, 1, false) == PM3_SUCCESS) && test(DEMOD_NRZ, &offset, &bitRate, clk, &Q5)) {
+                t55xx_detect_add(r, DEMOD_NRZ, false, false, offset, bitRate, Q5, downlink_mode);
             }
+            if ((NRZrawDemod(0, 1, 1, false) == PM3_SUCCESS) && test(DEMOD_NRZ, &offset, &bitRate, clk, &Q5)) {
+                t55xx_detect_add(r, DEMOD_NRZ, true, false, offset, bitRate, Q5, downlink_mode);
+            }
+            break;
         }
+        case T55XX_FAMILY_PSK: {
+            clk = GetPskClock("", false);
+            if (clk <= 0) {
+                break;
+            }
 
-        clk = GetPskClock("", false);
-        if (clk > 0) {
-            // allow undo
-            buffer_savestate_t saveState = save_bufferS32(g_GraphBuffer, g_GraphTraceLen);
-            saveState.offset = g_GridOffset;
+            // the capture is a private copy, no need to undo the trim.
             // skip first 160 samples to allow antenna to settle in (psk gets inverted occasionally otherwise)
-            CmdLtrim("-i 160");
-            if ((PSKDemod(0, 0, 6, false) == PM3_SUCCESS) && test(DEMOD_PSK1, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_PSK1;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = false;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].ST = false;
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
+            // Trimmed here rather than with `data ltrim`, the CLI parser isn't thread safe
+            if (g_GraphTraceLen > 160) {
+                memmove(g_GraphBuffer, g_GraphBuffer + 160, (g_GraphTraceLen - 160) * sizeof(g_GraphBuffer[0]));
+                g_GraphTraceLen -= 160;
+                g_DemodStartIdx -= 160;
+                graph_changed();
+            }
+            if ((PSKDemod(0, 0, 6, false) == PM3_SUCCESS) && test(DEMOD_PSK1, &offset, &bitRate, clk, &Q5)) {
+                t55xx_detect_add(r, DEMOD_PSK1, false, false, offset, bitRate, Q5, downlink_mode);
             }
-            if ((PSKDemod(0, 1, 6, false) == PM3_SUCCESS) && test(DEMOD_PSK1, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                tests[hits].modulation = DEMOD_PSK1;
-                tests[hits].bitrate = bitRate;
-                tests[hits].inverted = true;
-                tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                tests[hits].ST = false;
-                tests[hits].downlink_mode = downlink_mode;
-                ++hits;
+            if ((PSKDemod(0, 1, 6, false) == PM3_SUCCESS) && test(DEMOD_PSK1, &offset, &bitRate, clk, &Q5)) {
+                t55xx_detect_add(r, DEMOD_PSK1, true, false, offset, bitRate, Q5, downlink_mode);
             }
-            //ICEMAN: are these PSKDemod calls needed?
-            // PSK2 - needs a call to psk1TOpsk2.
+            // PSK2 and PSK3 - need a call to psk1TOpsk2, inverse waves does not affect these
             if (PSKDemod(0, 0, 6, false) == PM3_SUCCESS) {
                 psk1TOpsk2(g_DemodBuffer, g_DemodBufferLen);
-                if (test(DEMOD_PSK2, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                    tests[hits].modulation = DEMOD_PSK2;
-                    tests[hits].bitrate = bitRate;
-                    tests[hits].inverted = false;
-                    tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                    tests[hits].ST = false;
-                    tests[hits].downlink_mode = downlink_mode;
-                    ++hits;
+                if (test(DEMOD_PSK2, &offset, &bitRate, clk, &Q5)) {
+                    t55xx_detect_add(r, DEMOD_PSK2, false, false, offset, bitRate, Q5, downlink_mode);
                 }
-            } // inverse waves does not affect this demod
-            // PSK3 - needs a call to psk1TOpsk2.
-            if (PSKDemod(0, 0, 6, false) == PM3_SUCCESS) {
-                psk1TOpsk2(g_DemodBuffer, g_DemodBufferLen);
-                if (test(DEMOD_PSK3, &tests[hits].offset, &bitRate, clk, &tests[hits].Q5)) {
-                    tests[hits].modulation = DEMOD_PSK3;
-                    tests[hits].bitrate = bitRate;
-                    tests[hits].inverted = false;
-                    tests[hits].block0 = PackBits(tests[hits].offset, 32, g_DemodBuffer);
-                    tests[hits].ST = false;
-                    tests[hits].downlink_mode = downlink_mode;
-                    ++hits;
+                if (test(DEMOD_PSK3, &offset, &bitRate, clk, &Q5)) {
+                    t55xx_detect_add(r, DEMOD_PSK3, false, false, offset, bitRate, Q5, downlink_mode);
                 }
-            } // inverse waves does not affect this demod
-            //undo trim samples
-            restore_bufferS32(saveState, g_GraphBuffer);
-            g_GridOffset = saveState.offset;
-            // t55xx_search_config_psk(g_GraphBuffer, 1);
-            // t55xx_search_config_psk(g_GraphBuffer, 2);
+            }
+            break;
+        }
+    }
+}
+
+typedef struct {
+    pthread_mutex_t lock;
+    size_t next;
+    size_t count;
+    uint8_t downlink_mode;
+    // capture index of every job, the family is the job index modulo T55XX_FAMILIES
+    size_t *capture;
+    const t55xx_capture_t *captures;
+    t55xx_detect_result_t *family;
+    print_deferred_t *out;
+} t55xx_detect_pool_t;
+
+static void
+#ifdef __has_attribute
+#if __has_attribute(force_align_arg_pointer)
+__attribute__((force_align_arg_pointer))
+#endif
+#endif
+*t55xx_detect_worker(void *arg) {
+    t55xx_detect_pool_t *pool = (t55xx_detect_pool_t *)arg;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        size_t i = pool->next;
+        if (i >= pool->count) {
+            pthread_mutex_unlock(&pool->lock);
+            break;
+        }
+        pool->next++;
+        pthread_mutex_unlock(&pool->lock);
+
+        const t55xx_capture_t *cap = &pool->captures[pool->capture[i / T55XX_FAMILIES]];
+        demod_ctx_t *ctx = demod_ctx_new(cap->samples, cap->len, true);
+        if (ctx == NULL) {
+            continue;
         }
+        ctx->signal = cap->signal;
+
+        demod_ctx_t *prev = demod_ctx_bind(ctx);
+        PrintAndLogDefer(&pool->out[i]);
+        t55xx_detect_family(i % T55XX_FAMILIES, pool->downlink_mode, &pool->family[i]);
+        PrintAndLogDefer(NULL);
+        demod_ctx_bind(prev);
+        demod_ctx_free(ctx);
+    }
+    return NULL;
+}
+
+int t55xx_detect_batch(const t55xx_capture_t *captures, size_t count, uint8_t downlink_mode, t55xx_detect_result_t *results) {
+    if (captures == NULL || results == NULL || count == 0) {
+        return PM3_EINVARG;
+    }
+
+    memset(results, 0, count * sizeof(t55xx_detect_result_t));
+
+    uint64_t *fp = calloc(count, sizeof(uint64_t));
+    // capture whose result a capture takes, itself when it gets detected
+    size_t *same = calloc(count, sizeof(size_t));
+    size_t *todo = calloc(count, sizeof(size_t));
+    if (fp == NULL || same == NULL || todo == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(fp);
+        free(same);
+        free(todo);
+        return PM3_EMALLOC;
     }
+
+    size_t ntodo = 0;
+    for (size_t i = 0; i < count; i++) {
+        fp[i] = t55xx_detect_fingerprint(&captures[i], downlink_mode);
+        same[i] = i;
+
+        if (t55xx_detect_cache_get(fp[i], &captures[i], downlink_mode, &results[i])) {
+            continue;
+        }
+
+        // the same capture twice in one batch is detected once
+        for (size_t j = 0; j < ntodo; j++) {
+            const t55xx_capture_t *a = &captures[todo[j]];
+            if (fp[todo[j]] == fp[i] && a->len == captures[i].len && t55xx_detect_signal_eq(&a->signal, &captures[i].signal)) {
+                same[i] = todo[j];
+                break;
+            }
+        }
+
+        if (same[i] == i) {
+            todo[ntodo++] = i;
+        }
+    }
+
+    int res = PM3_SUCCESS;
+    size_t jobs = ntodo * T55XX_FAMILIES;
+    if (jobs) {
+        t55xx_detect_pool_t pool = {0};
+        pool.count = jobs;
+        pool.downlink_mode = downlink_mode;
+        pool.capture = todo;
+        pool.captures = captures;
+        pool.family = calloc(jobs, sizeof(t55xx_detect_result_t));
+        pool.out = calloc(jobs, sizeof(print_deferred_t));
+        pthread_t *threads = calloc(jobs, sizeof(pthread_t));
+        if (pool.family == NULL || pool.out == NULL || threads == NULL) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            res = PM3_EMALLOC;
+            goto out;
+        }
+        pthread_mutex_init(&pool.lock, NULL);
+
+        size_t num_threads = MIN((size_t)MAX(num_CPUs(), 1), jobs);
+        size_t started = 0;
+        for (; started < num_threads; started++) {
+            if (pthread_create(&threads[started], NULL, t55xx_detect_worker, &pool) != 0) {
+                break;
+            }
+        }
+
+        // no threads at all, run the pool here
+        if (started == 0) {
+            t55xx_detect_worker(&pool);
+        }
+
+        for (size_t i = 0; i < started; i++) {
+            pthread_join(threads[i], NULL);
+        }
+        pthread_mutex_destroy(&pool.lock);
+
+        // hits in ladder order, FSK, ASK, NRZ then PSK
+        for (size_t i = 0; i < jobs; i++) {
+            PrintAndLogDeferredFlush(&pool.out[i]);
+
+            t55xx_detect_result_t *r = &results[todo[i / T55XX_FAMILIES]];
+            const t55xx_detect_result_t *f = &pool.family[i];
+            for (uint8_t j = 0; j < f->hits && r->hits < T55XX_DETECT_MAX; j++) {
+                r->h[r->hits++] = f->h[j];
+            }
+        }
+
+        for (size_t i = 0; i < ntodo; i++) {
+            t55xx_detect_result_t *r = &results[todo[i]];
+            // nothing else to choose from
+            if (r->hits == 1) {
+                r->h[0].score = MIN(r->h[0].score + 5, 100);
+            }
+            t55xx_detect_cache_put(fp[todo[i]], &captures[todo[i]], downlink_mode, r);
+        }
+
+out:
+        for (size_t i = 0; pool.out && i < jobs; i++) {
+            PrintAndLogDeferredFree(&pool.out[i]);
+        }
+        free(pool.out);
+        free(pool.family);
+        free(threads);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (same[i] != i) {
+            results[i] = results[same[i]];
+        }
+
+        // rank by score, ladder order on a tie
+        t55xx_detect_result_t *r = &results[i];
+        for (uint8_t j = 0; j < r->hits; j++) {
+            uint8_t k = j;
+            for (; k > 0 && r->h[r->rank[k - 1]].score < r->h[j].score; k--) {
+                r->rank[k] = r->rank[k - 1];
+            }
+            r->rank[k] = j;
+        }
+    }
+
+    free(fp);
+    free(same);
+    free(todo);
+    return res;
+}
+
+bool t55xxTryDetectModulationEx(uint8_t downlink_mode, bool print_config, uint32_t wanted_conf, uint64_t pwd) {
+
+    t55xx_capture_t capture = { g_GraphBuffer, g_GraphTraceLen, *getSignalProperties() };
+    t55xx_detect_result_t result;
+    if (t55xx_detect_batch(&capture, 1, downlink_mode, &result) != PM3_SUCCESS) {
+        return false;
+    }
+
+    t55xx_conf_block_t tests[T55XX_DETECT_MAX];
+    uint8_t hits = result.hits;
+    for (uint8_t i = 0; i < hits; i++) {
+        tests[i] = result.h[i].conf;
+    }
+
     if (hits == 1) {
         config.modulation = tests[0].modulation;
         config.bitrate = tests[0].bitrate;
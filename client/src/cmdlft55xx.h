@@ -20,6 +20,7 @@
 #define CMDLFT55XX_H__
 
 #include "common.h"
+#include "lfdemod.h"      // signal_t
 
 #define T55x7_CONFIGURATION_BLOCK       0x00
 #define T55x7_PWD_BLOCK                 0x07
@@ -204,6 +205,33 @@ int t55xxWrite(uint8_t block, bool page1, bool usepwd, bool testMode, uint32_t p
 
 bool GetT55xxBlockData(uint32_t *blockdata);
 bool DecodeT55xxBlock(void);
+// most modulations a block 0 capture can pass test() with: FSK 2, ASK 4, NRZ 2, PSK 4
+#define T55XX_DETECT_MAX                15
+
+typedef struct {
+    int32_t *samples;
+    size_t len;
+    signal_t signal;
+} t55xx_capture_t;
+
+typedef struct {
+    t55xx_conf_block_t conf;
+    // confidence, 0 - 100
+    uint8_t score;
+} t55xx_hypothesis_t;
+
+typedef struct {
+    // in the order the detection ladder finds them
+    t55xx_hypothesis_t h[T55XX_DETECT_MAX];
+    uint8_t hits;
+    // indexes into h, best score first
+    uint8_t rank[T55XX_DETECT_MAX];
+    // taken from an earlier detection on the same samples
+    bool cached;
+} t55xx_detect_result_t;
+
+// every modulation hypothesis of every capture, in parallel and memoised per capture
+int t55xx_detect_batch(const t55xx_capture_t *captures, size_t count, uint8_t downlink_mode, t55xx_detect_result_t *results);
 bool t55xxTryDetectModulation(uint8_t downlink_mode, bool print_config);
 //bool t55xxTryDetectModulationEx(uint8_t downlink_mode, bool print_config, uint32_t wanted_conf);
 bool t55xxTryDetectModulationEx(uint8_t downlink_mode, bool print_config, uint32_t wanted_conf, uint64_t pwd);
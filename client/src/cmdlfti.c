@@ -89,7 +89,7 @@ int demodTI(bool verbose) {
         1, 1, 1, 1, 1, 1, 1, 1
     };
 
-    buffer_savestate_t saveState = save_bufferS32(g_GraphBuffer, g_GraphTraceLen);
+    buffer_savestate_t saveState = graph_save();
     saveState.offset = g_GridOffset;
 
     int lowLen = ARRAYLEN(LowTone);
@@ -135,6 +135,7 @@ int demodTI(bool verbose) {
     }
 
     g_GraphTraceLen -= (convLen + 16);
+    graph_changed();
 
     RepaintGraphWindow();
 
@@ -278,7 +279,7 @@ int demodTI(bool verbose) {
 
 out:
     if (retval != PM3_SUCCESS) {
-        restore_bufferS32(saveState, g_GraphBuffer);
+        graph_restore(saveState);
         g_GridOffset = saveState.offset;
     }
 
@@ -18,6 +18,12 @@
 #include "cmdtrace.h"
 
 #include <ctype.h>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 #include "cmdparser.h"    // command_t
 #include "protocols.h"
@@ -35,20 +41,142 @@
 
 static int CmdHelp(const char *Cmd);
 
-// trace pointer
+// trace pointer, a loaded file is mapped rather than read in
 static uint8_t *gs_trace;
-static uint16_t gs_traceLen = 0;
+static uint32_t gs_traceLen = 0;
+static bool gs_trace_mapped = false;
+
+// Sidecar index of the trace buffer, built by the first filtered `trace list`
+// and kept until the buffer is replaced
+#define TRACE_IDX_RESPONSE      0x01
+#define TRACE_IDX_AUTH          0x02
+
+#define TRACE_IDX_MAX_UID       10
+
+typedef struct {
+    uint32_t offset;
+    // ticks since the first record, as in the Start column
+    uint32_t time;
+    uint32_t session;
+    // first frame byte as recorded, 0 for empty frames
+    uint8_t cmd;
+    uint8_t flags;
+    // see trace_crc_status
+    uint8_t crc;
+} trace_idx_rec_t;
+
+typedef struct {
+    // record starting the session
+    uint32_t first;
+    uint8_t uid[TRACE_IDX_MAX_UID];
+    uint8_t uidlen;
+    // MIFARE frames after an auth are encrypted, their CRC is not checked
+    bool crypto;
+} trace_idx_session_t;
+
+typedef struct {
+    trace_idx_rec_t *recs;
+    uint32_t count;
+    trace_idx_session_t *sessions;
+    uint32_t session_count;
+    uint32_t auths;
+    uint32_t crc_errors;
+    bool monotonic;
+    bool valid;
+    uint8_t protocol;
+} trace_index_t;
+
+static trace_index_t gs_trace_index;
+
+static void trace_index_free(void) {
+    free(gs_trace_index.recs);
+    free(gs_trace_index.sessions);
+    memset(&gs_trace_index, 0, sizeof(gs_trace_index));
+}
+
+static void trace_free(void) {
+    trace_index_free();
+#if !defined(_WIN32)
+    if (gs_trace_mapped) {
+        munmap(gs_trace, gs_traceLen);
+        gs_trace = NULL;
+    }
+#endif
+    free(gs_trace);
+    gs_trace = NULL;
+    gs_traceLen = 0;
+    gs_trace_mapped = false;
+}
+
+// `-t` names of the annotated protocols
+static const struct {
+    const char *name;
+    uint8_t protocol;
+} trace_protocols[] = {
+    {"14a",      ISO_14443A},
+    {"14b",      ISO_14443B},
+    {"15",       ISO_15693},
+    {"7816",     ISO_7816_4},
+    {"cryptorf", PROTO_CRYPTORF},
+    {"des",      MFDES},
+    {"felica",   FELICA},
+    {"ht1",      PROTO_HITAG1},
+    {"ht2",      PROTO_HITAG2},
+    {"hts",      PROTO_HITAGS},
+    {"htu",      PROTO_HITAGU},
+    {"iclass",   ICLASS},
+    {"legic",    LEGIC},
+    {"lto",      LTO},
+    {"mf",       PROTO_MIFARE},
+    {"seos",     SEOS},
+    {"thinfilm", THINFILM},
+    {"topaz",    TOPAZ},
+    {"mfp",      PROTO_MFPLUS},
+    {"fmcos20",  PROTO_FMCOS20},
+};
+
+static int trace_protocol_from_str(const char *type, uint8_t *protocol) {
+    // no crc, no annotations
+    *protocol = -1;
+
+    if (strcmp(type, "") == 0 || strcmp(type, "raw") == 0) {
+        return PM3_SUCCESS;
+    }
+
+    for (size_t i = 0; i < ARRAYLEN(trace_protocols); i++) {
+        if (strcmp(type, trace_protocols[i].name) == 0) {
+            *protocol = trace_protocols[i].protocol;
+            return PM3_SUCCESS;
+        }
+    }
+
+    PrintAndLogEx(FAILED, "Unknown protocol \"%s\"", type);
+    return PM3_EINVARG;
+}
+
+static const char *trace_protocol_name(uint8_t protocol) {
+    for (size_t i = 0; i < ARRAYLEN(trace_protocols); i++) {
+        if (trace_protocols[i].protocol == protocol) {
+            return trace_protocols[i].name;
+        }
+    }
+    return "raw";
+}
+
+static bool trace_is_14a_family(uint8_t protocol) {
+    return (protocol == ISO_14443A || protocol == PROTO_MIFARE || protocol == PROTO_MFPLUS || protocol == MFDES || protocol == TOPAZ || protocol == LTO);
+}
 
-static bool is_last_record(uint16_t tracepos, uint16_t traceLen) {
+static bool is_last_record(uint32_t tracepos, uint32_t traceLen) {
     return ((tracepos + TRACELOG_HDR_LEN) >= traceLen);
 }
 
-static bool next_record_is_response(uint16_t tracepos, uint8_t *trace) {
+static bool next_record_is_response(uint32_t tracepos, uint8_t *trace) {
     const tracelog_hdr_t *hdr = (tracelog_hdr_t *)(trace + tracepos);
     return (hdr->isResponse);
 }
 
-static bool merge_topaz_reader_frames(uint32_t timestamp, uint32_t *duration, uint16_t *tracepos, uint16_t traceLen,
+static bool merge_topaz_reader_frames(uint32_t timestamp, uint32_t *duration, uint32_t *tracepos, uint32_t traceLen,
                                       uint8_t *trace, const uint8_t *frame, uint8_t *topaz_reader_command, uint16_t *data_len) {
 
 #define MAX_TOPAZ_READER_CMD_LEN 16
@@ -95,12 +223,9 @@ static uint8_t calc_pos(const uint8_t *d) {
 
 // Copy an existing buffer into client trace buffer
 // I think this is cleaner than further globalizing gs_trace, and may lend itself to more modularity later?
-bool ImportTraceBuffer(const uint8_t *trace_src, uint16_t trace_len) {
+bool ImportTraceBuffer(const uint8_t *trace_src, uint32_t trace_len) {
     if (trace_len == 0 || trace_src == NULL) return (false);
-    if (gs_trace) {
-        free(gs_trace);
-        gs_traceLen = 0;
-    }
+    trace_free();
     gs_trace = calloc(trace_len, sizeof(uint8_t));
     if (gs_trace == NULL) {
         return (false);
@@ -116,7 +241,7 @@ static uint8_t extract_epurse[8] = {0};
 
 #define SKIP_TO_NEXT(a)  (TRACELOG_HDR_LEN + (a)->data_len + TRACELOG_PARITY_LEN((a)))
 
-static uint16_t extractChall_ev2(uint16_t tracepos, uint8_t *trace, uint8_t cmdpos, uint8_t long_jmp) {
+static uint32_t extractChall_ev2(uint32_t tracepos, uint8_t *trace, uint8_t cmdpos, uint8_t long_jmp) {
     tracelog_hdr_t *next_hdr = (tracelog_hdr_t *)(trace + tracepos);
     if (next_hdr->data_len != 21) {
         return 0;
@@ -137,7 +262,7 @@ static uint16_t extractChall_ev2(uint16_t tracepos, uint8_t *trace, uint8_t cmdp
     return tracepos;
 }
 
-static uint16_t extractChallenges(uint16_t tracepos, uint16_t traceLen, uint8_t *trace) {
+static uint32_t extractChallenges(uint32_t tracepos, uint32_t traceLen, uint8_t *trace) {
 
     // sanity check
     if (is_last_record(tracepos, traceLen)) {
@@ -411,7 +536,7 @@ static uint16_t extractChallenges(uint16_t tracepos, uint16_t traceLen, uint8_t
             }
             case MFDES_AUTHENTICATE_EV2F: {
                 PrintAndLogEx(INFO, "Found a MFDES Auth EV2 First");
-                uint16_t tmp = extractChall_ev2(tracepos, trace, pos, long_jmp);
+                uint32_t tmp = extractChall_ev2(tracepos, trace, pos, long_jmp);
                 if (tmp == 0)
                     break;
                 else
@@ -420,7 +545,7 @@ static uint16_t extractChallenges(uint16_t tracepos, uint16_t traceLen, uint8_t
             }
             case MFDES_AUTHENTICATE_EV2NF: {
                 PrintAndLogEx(INFO, "Found a MFDES Auth EV2 Non First");
-                uint16_t tmp = extractChall_ev2(tracepos, trace, pos, long_jmp);
+                uint32_t tmp = extractChall_ev2(tracepos, trace, pos, long_jmp);
                 if (tmp == 0)
                     break;
                 else
@@ -432,13 +557,13 @@ static uint16_t extractChallenges(uint16_t tracepos, uint16_t traceLen, uint8_t
     return tracepos;
 }
 
-static uint16_t printHexLine(uint16_t tracepos, uint16_t traceLen, uint8_t *trace, uint8_t protocol) {
+static uint32_t printHexLine(uint32_t tracepos, uint32_t traceLen, uint8_t *trace, uint8_t protocol) {
     // sanity check
     if (is_last_record(tracepos, traceLen)) return traceLen;
 
     tracelog_hdr_t *hdr = (tracelog_hdr_t *)(trace + tracepos);
 
-    if (TRACELOG_HDR_LEN + hdr->data_len + TRACELOG_PARITY_LEN(hdr) > traceLen) {
+    if (tracepos + TRACELOG_HDR_LEN + hdr->data_len + TRACELOG_PARITY_LEN(hdr) > traceLen) {
         return traceLen;
     }
 
@@ -450,7 +575,7 @@ static uint16_t printHexLine(uint16_t tracepos, uint16_t traceLen, uint8_t *trac
         return tracepos;
     }
 
-    uint16_t ret;
+    uint32_t ret;
 
     switch (protocol) {
         case ISO_14443A: {
@@ -498,56 +623,16 @@ static uint16_t printHexLine(uint16_t tracepos, uint16_t traceLen, uint8_t *trac
     return ret;
 }
 
-static uint16_t printTraceLine(uint16_t tracepos, uint16_t traceLen, uint8_t *trace, uint8_t protocol, bool showWaitCycles, bool markCRCBytes, uint32_t *prev_eot, bool use_us,
-                               const uint64_t *mfDicKeys, uint32_t mfDicKeysCount) {
-    // sanity check
-    if (is_last_record(tracepos, traceLen)) {
-        PrintAndLogEx(DEBUG, "last record triggered.  t-pos: %u  t-len %u", tracepos, traceLen);
-        return traceLen;
-    }
-
-    uint32_t end_of_transmission_timestamp = 0;
-    uint8_t topaz_reader_command[9];
-    char explanation[60] = {0};
-    tracelog_hdr_t *first_hdr = (tracelog_hdr_t *)(trace);
-    tracelog_hdr_t *hdr = (tracelog_hdr_t *)(trace + tracepos);
-
-    uint32_t duration = hdr->duration;
-    uint16_t data_len = hdr->data_len;
-
-    if (tracepos + TRACELOG_HDR_LEN + data_len + TRACELOG_PARITY_LEN(hdr) > traceLen) {
-        PrintAndLogEx(DEBUG, "trace pos offset %"PRIu64 " larger than reported tracelen %u",
-                      tracepos + TRACELOG_HDR_LEN + data_len + TRACELOG_PARITY_LEN(hdr),
-                      traceLen
-                     );
-        return traceLen;
-    }
-
-    // adjust for different time scales
-    if (protocol == ICLASS || protocol == ISO_15693) {
-        duration *= 32;
-    }
-
-    uint8_t *frame = hdr->frame;
-    uint8_t *parityBytes = hdr->frame + data_len;
-
-    tracepos += TRACELOG_HDR_LEN + data_len + TRACELOG_PARITY_LEN(hdr);
-
-    if (protocol == TOPAZ && !hdr->isResponse) {
-        // topaz reader commands come in 1 or 9 separate frames with 7 or 8 Bits each.
-        // merge them:
-        if (merge_topaz_reader_frames(hdr->timestamp, &duration, &tracepos, traceLen, trace, frame, topaz_reader_command, &data_len)) {
-            frame = topaz_reader_command;
-        }
-    }
-
-    //Check the CRC status
+// 0 CRC-command, CRC not ok
+// 1 CRC-command, CRC ok
+// 2 Not crc-command
+static uint8_t trace_crc_status(uint8_t protocol, bool isResponse, uint8_t *frame, uint16_t data_len, const uint8_t *parityBytes) {
     uint8_t crcStatus = 2;
 
     if (data_len > 2) {
         switch (protocol) {
             case ICLASS:
-                crcStatus = iclass_CRC_check(hdr->isResponse, frame, data_len);
+                crcStatus = iclass_CRC_check(isResponse, frame, data_len);
                 break;
             case ISO_14443B:
             case TOPAZ:
@@ -558,18 +643,18 @@ static uint16_t printTraceLine(uint16_t tracepos, uint16_t traceLen, uint8_t *tr
                 break;
             case PROTO_MIFARE:
             case PROTO_MFPLUS:
-                crcStatus = mifare_CRC_check(hdr->isResponse, frame, data_len);
+                crcStatus = mifare_CRC_check(isResponse, frame, data_len);
                 break;
             case ISO_14443A:
             case MFDES:
             case LTO:
-                crcStatus = iso14443A_CRC_check(hdr->isResponse, frame, data_len);
+                crcStatus = iso14443A_CRC_check(isResponse, frame, data_len);
                 break;
             case SEOS:
-                crcStatus = seos_CRC_check(hdr->isResponse, frame, data_len);
+                crcStatus = seos_CRC_check(isResponse, frame, data_len);
                 break;
             case ISO_7816_4:
-                crcStatus = iso14443A_CRC_check(hdr->isResponse, frame, data_len) == 1 ? 3 : 0;
+                crcStatus = iso14443A_CRC_check(isResponse, frame, data_len) == 1 ? 3 : 0;
                 crcStatus = iso14443B_CRC_check(frame, data_len) == 1 ? 4 : crcStatus;
                 break;
             case THINFILM:
@@ -597,6 +682,55 @@ static uint16_t printTraceLine(uint16_t tracepos, uint16_t traceLen, uint8_t *tr
                 break;
         }
     }
+    return crcStatus;
+}
+
+static uint32_t printTraceLine(uint32_t tracepos, uint32_t traceLen, uint8_t *trace, uint8_t protocol, bool showWaitCycles, bool markCRCBytes, uint32_t *prev_eot, bool use_us,
+                               const uint64_t *mfDicKeys, uint32_t mfDicKeysCount) {
+    // sanity check
+    if (is_last_record(tracepos, traceLen)) {
+        PrintAndLogEx(DEBUG, "last record triggered.  t-pos: %u  t-len %u", tracepos, traceLen);
+        return traceLen;
+    }
+
+    uint32_t end_of_transmission_timestamp = 0;
+    uint8_t topaz_reader_command[9];
+    char explanation[60] = {0};
+    tracelog_hdr_t *first_hdr = (tracelog_hdr_t *)(trace);
+    tracelog_hdr_t *hdr = (tracelog_hdr_t *)(trace + tracepos);
+
+    uint32_t duration = hdr->duration;
+    uint16_t data_len = hdr->data_len;
+
+    if (tracepos + TRACELOG_HDR_LEN + data_len + TRACELOG_PARITY_LEN(hdr) > traceLen) {
+        PrintAndLogEx(DEBUG, "trace pos offset %"PRIu64 " larger than reported tracelen %u",
+                      tracepos + TRACELOG_HDR_LEN + data_len + TRACELOG_PARITY_LEN(hdr),
+                      traceLen
+                     );
+        return traceLen;
+    }
+
+    // adjust for different time scales
+    if (protocol == ICLASS || protocol == ISO_15693) {
+        duration *= 32;
+    }
+
+    uint8_t *frame = hdr->frame;
+    uint8_t *parityBytes = hdr->frame + data_len;
+
+    tracepos += TRACELOG_HDR_LEN + data_len + TRACELOG_PARITY_LEN(hdr);
+
+    if (protocol == TOPAZ && !hdr->isResponse) {
+        // topaz reader commands come in 1 or 9 separate frames with 7 or 8 Bits each.
+        // merge them:
+        if (merge_topaz_reader_frames(hdr->timestamp, &duration, &tracepos, traceLen, trace, frame, topaz_reader_command, &data_len)) {
+            frame = topaz_reader_command;
+        }
+    }
+
+    //Check the CRC status
+    uint8_t crcStatus = trace_crc_status(protocol, hdr->isResponse, frame, data_len, parityBytes);
+
     //0 CRC-command, CRC not ok
     //1 CRC-command, CRC ok
     //2 Not crc-command
@@ -1095,11 +1229,7 @@ static int download_trace(void) {
     }
 
     // reserve some space.
-    if (gs_trace) {
-        free(gs_trace);
-    }
-
-    gs_traceLen = 0;
+    trace_free();
 
     gs_trace = calloc(PM3_CMD_DATA_SIZE, sizeof(uint8_t));
     if (gs_trace == NULL) {
@@ -1183,7 +1313,7 @@ static int CmdTraceExtract(const char *Cmd) {
         return PM3_SUCCESS;
     }
 
-    uint16_t tracepos = 0;
+    uint32_t tracepos = 0;
 
     while (tracepos < gs_traceLen) {
         tracepos = extractChallenges(tracepos, gs_traceLen, gs_trace);
@@ -1195,13 +1325,507 @@ static int CmdTraceExtract(const char *Cmd) {
     return PM3_SUCCESS;
 }
 
+// Maps a trace file instead of reading it in. The listing walks the records
+// straight from the mapping, so big concatenated sniffs are parsed in one pass
+// with only the pages being looked at in memory. Private and writable, the
+// annotators are free to scribble on frames
+static int trace_map_file(const char *filename) {
+#if !defined(_WIN32)
+    char *path = NULL;
+    if (searchFile(&path, RESOURCES_SUBDIR, filename, ".trace", true) != PM3_SUCCESS) {
+        return PM3_EFILE;
+    }
+
+    int fd = open(path, O_RDONLY);
+    free(path);
+    if (fd < 0) {
+        return PM3_EFILE;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return PM3_EFILE;
+    }
+
+    if ((uint64_t)st.st_size > UINT32_MAX) {
+        close(fd);
+        return PM3_EOVFLOW;
+    }
+
+    uint8_t *map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return PM3_EFILE;
+    }
+    madvise(map, st.st_size, MADV_SEQUENTIAL);
+
+    gs_trace = map;
+    gs_traceLen = st.st_size;
+    gs_trace_mapped = true;
+    return PM3_SUCCESS;
+#else
+    (void)filename;
+    return PM3_ENOTIMPL;
+#endif
+}
+
+// pcapng, one section with one interface for the protocol the trace is saved as.
+// 14a/14b use the ISO 14443 link type with the pseudo header of
+// https://www.kaiser.cx/pcap-iso14443.html so Wireshark dissects them, all
+// others are plain frames on USER0. Blocks are written in host byte order.
+#define PCAPNG_BOM                  0x1A2B3C4D
+#define PCAPNG_BLOCK_SHB            0x0A0D0D0A
+#define PCAPNG_BLOCK_IDB            0x00000001
+#define PCAPNG_BLOCK_EPB            0x00000006
+
+#define PCAPNG_OPT_END              0
+#define PCAPNG_OPT_SHB_USERAPPL     4
+#define PCAPNG_OPT_IF_NAME          2
+#define PCAPNG_OPT_IF_TSRESOL       9
+#define PCAPNG_OPT_EPB_FLAGS        2
+// custom binary option, keeps what a trace has and a packet has not
+#define PCAPNG_OPT_CUSTOM_BIN       2989
+
+#define PCAPNG_LINKTYPE_USER0       147
+#define PCAPNG_LINKTYPE_ISO14443    264
+
+// epb_flags direction
+#define PCAPNG_FLAG_INBOUND         1
+#define PCAPNG_FLAG_OUTBOUND        2
+
+// ISO 14443 pseudo header events
+#define PCAPNG_ISO14443_PCD         0xFE
+#define PCAPNG_ISO14443_PICC        0xFF
+
+// the custom option starts with an enterprise number, the value is not
+// registered and only told apart from other writers' options
+#define PCAPNG_PM3_PEN              0x504D3300
+
+#define PCAPNG_MAX_IF               16
+
+typedef struct {
+    uint32_t pen;
+    uint32_t timestamp;
+    uint16_t duration;
+    // parity bytes follow
+} PACKED pcapng_pm3_opt_t;
+
+static uint32_t pcapng_pad(uint32_t len) {
+    return (len + 3) & ~3U;
+}
+
+static uint32_t pcapng_put_u32(uint8_t *buf, uint32_t v) {
+    memcpy(buf, &v, sizeof(v));
+    return sizeof(v);
+}
+
+static uint32_t pcapng_put_option(uint8_t *buf, uint16_t code, const void *value, uint16_t len) {
+    memcpy(buf, &code, sizeof(code));
+    memcpy(buf + 2, &len, sizeof(len));
+    memset(buf + 4, 0, pcapng_pad(len));
+    if (len) {
+        memcpy(buf + 4, value, len);
+    }
+    return 4 + pcapng_pad(len);
+}
+
+// closes a block started at buf, the total length goes at both ends
+static uint32_t pcapng_end_block(uint8_t *buf, uint32_t len) {
+    len += 4;
+    memcpy(buf + 4, &len, sizeof(len));
+    memcpy(buf + len - 4, &len, sizeof(len));
+    return len;
+}
+
+static bool trace_pcapng_is_iso14443(uint8_t protocol) {
+    return (trace_is_14a_family(protocol) || protocol == ISO_14443B || protocol == PROTO_CRYPTORF);
+}
+
+// Streams the trace buffer to a pcapng file, one enhanced packet block per
+// record built in a single buffer. Timestamps are the carrier ticks in ns
+static int trace_save_pcapng(const char *preferredName, uint8_t protocol) {
+
+    char *fn = newfilenamemcopy(preferredName, ".pcapng");
+    if (fn == NULL) {
+        return PM3_EMALLOC;
+    }
+
+    FILE *f = fopen(fn, "wb");
+    if (f == NULL) {
+        PrintAndLogEx(WARNING, "file not found or locked `" _YELLOW_("%s") "`", fn);
+        free(fn);
+        return PM3_EFILE;
+    }
+
+    // largest block, a full record with its parity and options
+    uint8_t *block = calloc(1, 64 + 0x8000 + (0x8000 / 8) + sizeof(pcapng_pm3_opt_t));
+    if (block == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        fclose(f);
+        free(fn);
+        return PM3_EMALLOC;
+    }
+
+    const bool iso14443 = trace_pcapng_is_iso14443(protocol);
+
+    // section header
+    uint32_t len = pcapng_put_u32(block, PCAPNG_BLOCK_SHB) + 4;
+    len += pcapng_put_u32(block + len, PCAPNG_BOM);
+    uint16_t version[2] = {1, 0};
+    memcpy(block + len, version, sizeof(version));
+    len += sizeof(version);
+    int64_t section_len = -1;
+    memcpy(block + len, &section_len, sizeof(section_len));
+    len += sizeof(section_len);
+    len += pcapng_put_option(block + len, PCAPNG_OPT_SHB_USERAPPL, "proxmark3", 9);
+    len += pcapng_put_option(block + len, PCAPNG_OPT_END, NULL, 0);
+    len = pcapng_end_block(block, len);
+    fwrite(block, 1, len, f);
+
+    // interface
+    const char *name = trace_protocol_name(protocol);
+    uint8_t tsresol = 9;
+    len = pcapng_put_u32(block, PCAPNG_BLOCK_IDB) + 4;
+    uint16_t linktype[2] = {iso14443 ? PCAPNG_LINKTYPE_ISO14443 : PCAPNG_LINKTYPE_USER0, 0};
+    memcpy(block + len, linktype, sizeof(linktype));
+    len += sizeof(linktype);
+    len += pcapng_put_u32(block + len, 0);
+    len += pcapng_put_option(block + len, PCAPNG_OPT_IF_NAME, name, strlen(name));
+    len += pcapng_put_option(block + len, PCAPNG_OPT_IF_TSRESOL, &tsresol, sizeof(tsresol));
+    len += pcapng_put_option(block + len, PCAPNG_OPT_END, NULL, 0);
+    len = pcapng_end_block(block, len);
+    fwrite(block, 1, len, f);
+
+    uint32_t count = 0;
+    uint64_t ticks = 0;
+    uint32_t prev = 0;
+    uint32_t tracepos = 0;
+
+    while (is_last_record(tracepos, gs_traceLen) == false) {
+        const tracelog_hdr_t *hdr = (const tracelog_hdr_t *)(gs_trace + tracepos);
+        uint16_t parity_len = TRACELOG_PARITY_LEN(hdr);
+        if (tracepos + TRACELOG_HDR_LEN + hdr->data_len + parity_len > gs_traceLen) {
+            break;
+        }
+        tracepos += TRACELOG_HDR_LEN + hdr->data_len + parity_len;
+
+        // 32 bit ticks wrap after five minutes, keep counting
+        ticks = (count) ? ticks + (uint32_t)(hdr->timestamp - prev) : hdr->timestamp;
+        prev = hdr->timestamp;
+        uint64_t ns = (ticks * 100000) / 1356;
+
+        uint32_t caplen = hdr->data_len + ((iso14443) ? 4 : 0);
+
+        len = pcapng_put_u32(block, PCAPNG_BLOCK_EPB) + 4;
+        len += pcapng_put_u32(block + len, 0);
+        len += pcapng_put_u32(block + len, (uint32_t)(ns >> 32));
+        len += pcapng_put_u32(block + len, (uint32_t)ns);
+        len += pcapng_put_u32(block + len, caplen);
+        len += pcapng_put_u32(block + len, caplen);
+
+        uint8_t *data = block + len;
+        if (iso14443) {
+            // version, event, big endian length
+            *data++ = 0;
+            *data++ = (hdr->isResponse) ? PCAPNG_ISO14443_PICC : PCAPNG_ISO14443_PCD;
+            *data++ = hdr->data_len >> 8;
+            *data++ = hdr->data_len & 0xFF;
+        }
+        memcpy(data, hdr->frame, hdr->data_len);
+        memset(block + len + caplen, 0, pcapng_pad(caplen) - caplen);
+        len += pcapng_pad(caplen);
+
+        uint32_t flags = (hdr->isResponse) ? PCAPNG_FLAG_INBOUND : PCAPNG_FLAG_OUTBOUND;
+        len += pcapng_put_option(block + len, PCAPNG_OPT_EPB_FLAGS, &flags, sizeof(flags));
+
+        pcapng_pm3_opt_t *opt = (pcapng_pm3_opt_t *)(block + len + 4);
+        uint16_t optlen = sizeof(pcapng_pm3_opt_t) + parity_len;
+        memcpy(block + len + 4 + sizeof(pcapng_pm3_opt_t), hdr->frame + hdr->data_len, parity_len);
+        opt->pen = PCAPNG_PM3_PEN;
+        opt->timestamp = hdr->timestamp;
+        opt->duration = hdr->duration;
+        uint16_t code = PCAPNG_OPT_CUSTOM_BIN;
+        memcpy(block + len, &code, sizeof(code));
+        memcpy(block + len + 2, &optlen, sizeof(optlen));
+        memset(block + len + 4 + optlen, 0, pcapng_pad(optlen) - optlen);
+        len += 4 + pcapng_pad(optlen);
+
+        len += pcapng_put_option(block + len, PCAPNG_OPT_END, NULL, 0);
+        len = pcapng_end_block(block, len);
+        fwrite(block, 1, len, f);
+        count++;
+    }
+
+    free(block);
+    bool failed = ferror(f);
+    fclose(f);
+
+    if (failed) {
+        PrintAndLogEx(FAILED, "Could not write file " _YELLOW_("%s"), fn);
+        free(fn);
+        return PM3_EFILE;
+    }
+
+    PrintAndLogEx(SUCCESS, "Saved " _YELLOW_("%u") " records as " _YELLOW_("%s") " to pcapng file `" _YELLOW_("%s") "`", count, name, fn);
+    free(fn);
+    return PM3_SUCCESS;
+}
+
+typedef struct {
+    uint16_t linktype;
+    uint8_t tsresol;
+} pcapng_if_t;
+
+static uint64_t pcapng_ts_to_ns(uint64_t ts, uint8_t tsresol) {
+    uint8_t exp = tsresol & 0x7F;
+    if (tsresol & 0x80) {
+        // negative power of two
+        if (exp >= 64) {
+            return 0;
+        }
+        uint64_t frac = ts & ((1ULL << exp) - 1);
+        frac = (exp > 32) ? ((frac >> (exp - 32)) * 1000000000ULL) >> 32 : (frac * 1000000000ULL) >> exp;
+        return ((ts >> exp) * 1000000000ULL) + frac;
+    }
+    for (; exp < 9; exp++) {
+        ts *= 10;
+    }
+    for (; exp > 9; exp--) {
+        ts /= 10;
+    }
+    return ts;
+}
+
+// Converts the packets of a pcapng file back into trace records. Files saved by
+// `trace save --pcapng` come back as they were, others get their parity computed
+// and an approximated duration. Only sections in host byte order are read.
+// On success the caller owns *trace_out, nothing global is touched
+static int trace_load_pcapng(const char *filename, uint8_t **trace_out, uint32_t *tracelen_out) {
+
+    uint8_t *buf = NULL;
+    size_t buflen = 0;
+    if (loadFile_safe(filename, ".pcapng", (void **)&buf, &buflen) != PM3_SUCCESS) {
+        return PM3_EIO;
+    }
+
+    // records carry a parity byte per 8 data bytes the packet blocks don't have,
+    // so the buffer grows whenever a record would not fit
+    size_t tracecap = MAX(buflen + (buflen / 8), TRACELOG_HDR_LEN);
+    uint8_t *trace = calloc(tracecap, sizeof(uint8_t));
+    if (trace == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(buf);
+        return PM3_EMALLOC;
+    }
+
+    pcapng_if_t ifs[PCAPNG_MAX_IF];
+    uint32_t if_count = 0;
+    uint32_t tracelen = 0;
+    uint32_t skipped = 0;
+    uint64_t first_ns = 0;
+    bool have_first = false;
+    int res = PM3_SUCCESS;
+
+    size_t pos = 0;
+    while (pos + 12 <= buflen) {
+        uint32_t type, blen;
+        memcpy(&type, buf + pos, sizeof(type));
+        memcpy(&blen, buf + pos + 4, sizeof(blen));
+
+        if (pos == 0 && type != PCAPNG_BLOCK_SHB) {
+            PrintAndLogEx(FAILED, "File " _YELLOW_("%s") " is not a pcapng file", filename);
+            res = PM3_EFILE;
+            break;
+        }
+
+        if (blen < 12 || (blen & 3) || pos + blen > buflen) {
+            PrintAndLogEx(WARNING, "pcapng file is truncated at offset %zu", pos);
+            break;
+        }
+
+        const uint8_t *body = buf + pos + 8;
+        uint32_t bodylen = blen - 12;
+
+        if (type == PCAPNG_BLOCK_SHB) {
+            uint32_t bom;
+            memcpy(&bom, body, sizeof(bom));
+            if (bodylen < 16 || bom != PCAPNG_BOM) {
+                PrintAndLogEx(FAILED, "pcapng section in foreign byte order, not supported");
+                res = PM3_ENOTIMPL;
+                break;
+            }
+            if_count = 0;
+
+        } else if (type == PCAPNG_BLOCK_IDB && bodylen >= 8) {
+            if (if_count < PCAPNG_MAX_IF) {
+                pcapng_if_t *iface = &ifs[if_count];
+                memcpy(&iface->linktype, body, sizeof(iface->linktype));
+                iface->tsresol = 6;
+
+                uint32_t o = 8;
+                while (o + 4 <= bodylen) {
+                    uint16_t code, olen;
+                    memcpy(&code, body + o, sizeof(code));
+                    memcpy(&olen, body + o + 2, sizeof(olen));
+                    if (code == PCAPNG_OPT_END || o + 4 + olen > bodylen) {
+                        break;
+                    }
+                    if (code == PCAPNG_OPT_IF_TSRESOL && olen == 1) {
+                        iface->tsresol = body[o + 4];
+                    }
+                    o += 4 + pcapng_pad(olen);
+                }
+            }
+            if_count++;
+
+        } else if (type == PCAPNG_BLOCK_EPB && bodylen >= 20) {
+            uint32_t ifid, ts_hi, ts_lo, caplen;
+            memcpy(&ifid, body, sizeof(ifid));
+            memcpy(&ts_hi, body + 4, sizeof(ts_hi));
+            memcpy(&ts_lo, body + 8, sizeof(ts_lo));
+            memcpy(&caplen, body + 12, sizeof(caplen));
+
+            if (ifid >= MIN(if_count, PCAPNG_MAX_IF) || 20 + pcapng_pad(caplen) > bodylen) {
+                skipped++;
+                pos += blen;
+                continue;
+            }
+
+            const pcapng_if_t *iface = &ifs[ifid];
+            const uint8_t *data = body + 20;
+            uint32_t data_len = caplen;
+            bool response;
+
+            if (iface->linktype == PCAPNG_LINKTYPE_ISO14443) {
+                // field on/off and other events have no frame
+                if (caplen < 4 || (data[1] != PCAPNG_ISO14443_PCD && data[1] != PCAPNG_ISO14443_PICC)) {
+                    skipped++;
+                    pos += blen;
+                    continue;
+                }
+                response = (data[1] == PCAPNG_ISO14443_PICC);
+                data += 4;
+                data_len -= 4;
+            } else if (iface->linktype == PCAPNG_LINKTYPE_USER0) {
+                response = false;
+            } else {
+                skipped++;
+                pos += blen;
+                continue;
+            }
+
+            if (data_len > 0x7FFF) {
+                skipped++;
+                pos += blen;
+                continue;
+            }
+
+            uint64_t ns = pcapng_ts_to_ns(((uint64_t)ts_hi << 32) | ts_lo, iface->tsresol);
+            if (have_first == false) {
+                first_ns = ns;
+                have_first = true;
+            }
+
+            size_t need = (size_t)tracelen + TRACELOG_HDR_LEN + data_len + ((data_len + 7) / 8);
+            if (need > UINT32_MAX) {
+                PrintAndLogEx(WARNING, "pcapng file converts to more than 4 GiB of trace, stopping at offset %zu", pos);
+                break;
+            }
+            if (need > tracecap) {
+                size_t newcap = MAX(need, tracecap * 2);
+                uint8_t *tmp = realloc(trace, newcap);
+                if (tmp == NULL) {
+                    PrintAndLogEx(WARNING, "Failed to allocate memory");
+                    res = PM3_EMALLOC;
+                    break;
+                }
+                trace = tmp;
+                tracecap = newcap;
+            }
+
+            tracelog_hdr_t *hdr = (tracelog_hdr_t *)(trace + tracelen);
+            hdr->timestamp = (uint32_t)((((ns - first_ns) * 1356) + 50000) / 100000);
+            // as the listing approximates a 106 kbit/s frame, 128 * (9 * data_len)
+            hdr->duration = (iface->linktype == PCAPNG_LINKTYPE_ISO14443) ? MIN(128 * 9 * data_len, 0xFFFF) : 0;
+            hdr->data_len = data_len;
+            memcpy(hdr->frame, data, data_len);
+
+            uint16_t parity_len = TRACELOG_PARITY_LEN(hdr);
+            uint8_t *parity = hdr->frame + data_len;
+            memset(parity, 0, parity_len);
+            bool have_parity = false;
+
+            uint32_t o = 20 + pcapng_pad(caplen);
+            while (o + 4 <= bodylen) {
+                uint16_t code, olen;
+                memcpy(&code, body + o, sizeof(code));
+                memcpy(&olen, body + o + 2, sizeof(olen));
+                if (code == PCAPNG_OPT_END || o + 4 + olen > bodylen) {
+                    break;
+                }
+
+                const uint8_t *value = body + o + 4;
+                if (code == PCAPNG_OPT_EPB_FLAGS && olen == 4 && iface->linktype == PCAPNG_LINKTYPE_USER0) {
+                    uint32_t flags;
+                    memcpy(&flags, value, sizeof(flags));
+                    response = ((flags & 3) == PCAPNG_FLAG_INBOUND);
+                }
+
+                if (code == PCAPNG_OPT_CUSTOM_BIN && olen == sizeof(pcapng_pm3_opt_t) + parity_len) {
+                    pcapng_pm3_opt_t opt;
+                    memcpy(&opt, value, sizeof(opt));
+                    if (opt.pen == PCAPNG_PM3_PEN) {
+                        hdr->timestamp = opt.timestamp;
+                        hdr->duration = opt.duration;
+                        memcpy(parity, value + sizeof(opt), parity_len);
+                        have_parity = true;
+                    }
+                }
+                o += 4 + pcapng_pad(olen);
+            }
+
+            if (have_parity == false) {
+                for (uint32_t i = 0; i < data_len; i++) {
+                    parity[i / 8] |= oddparity8(data[i]) << (7 - (i % 8));
+                }
+            }
+
+            hdr->isResponse = response;
+            tracelen += TRACELOG_HDR_LEN + data_len + parity_len;
+        }
+
+        pos += blen;
+    }
+
+    free(buf);
+
+    if (res != PM3_SUCCESS || tracelen == 0) {
+        free(trace);
+        if (res == PM3_SUCCESS) {
+            PrintAndLogEx(FAILED, "No packets found in " _YELLOW_("%s"), filename);
+            res = PM3_ESOFT;
+        }
+        return res;
+    }
+
+    if (skipped) {
+        PrintAndLogEx(INFO, "Skipped " _YELLOW_("%u") " packets without frame or of unknown link type", skipped);
+    }
+
+    *trace_out = trace;
+    *tracelen_out = tracelen;
+    return PM3_SUCCESS;
+}
+
 static int CmdTraceLoad(const char *Cmd) {
 
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "trace load",
                   "Load protocol data from binary file to trace buffer\n"
-                  "File extension is <.trace>",
-                  "trace load -f mytracefile    -> w/o file extension"
+                  "File extension is <.trace>, files ending in <.pcapng> are converted from pcapng",
+                  "trace load -f mytracefile          -> w/o file extension\n"
+                  "trace load -f mytracefile.pcapng   -> from pcapng"
                  );
 
     void *argtable[] = {
@@ -1216,21 +1840,43 @@ static int CmdTraceLoad(const char *Cmd) {
     CLIParamStrToBuf(arg_get_str(ctx, 1), (uint8_t *)filename, FILE_PATH_SIZE, &fnlen);
     CLIParserFree(ctx);
 
-    if (gs_trace) {
-        free(gs_trace); // maybe better to not clobber this until we have successful load?
-        gs_trace = NULL;
-        gs_traceLen = 0;
+    if (str_endswith(filename, ".pcapng")) {
+        // keep the current trace until the conversion succeeded
+        uint8_t *trace = NULL;
+        uint32_t tracelen = 0;
+        int res = trace_load_pcapng(filename, &trace, &tracelen);
+        if (res != PM3_SUCCESS) {
+            if (res == PM3_EIO) {
+                PrintAndLogEx(FAILED, "Could not open file " _YELLOW_("%s"), filename);
+            }
+            return res;
+        }
+        trace_free();
+        gs_trace = trace;
+        gs_traceLen = tracelen;
+        PrintAndLogEx(SUCCESS, "Recorded Activity (TraceLen = " _YELLOW_("%u") " bytes) ( from pcapng )", gs_traceLen);
+        PrintAndLogEx(HINT, "Hint: Try `" _YELLOW_("trace list -1 -t ...") "` to view trace.  Remember the " _YELLOW_("`-1`") " param");
+        return PM3_SUCCESS;
     }
 
-    size_t len = 0;
-    if (loadFile_safe(filename, ".trace", (void **)&gs_trace, &len) != PM3_SUCCESS) {
-        PrintAndLogEx(FAILED, "Could not open file " _YELLOW_("%s"), filename);
-        return PM3_EIO;
+    trace_free(); // maybe better to not clobber this until we have successful load?
+
+    int res = trace_map_file(filename);
+    if (res == PM3_EOVFLOW) {
+        PrintAndLogEx(FAILED, "Trace file " _YELLOW_("%s") " is larger than 4 GiB", filename);
+        return PM3_EOVFLOW;
     }
 
-    gs_traceLen = (long)len;
+    if (res != PM3_SUCCESS) {
+        size_t len = 0;
+        if (loadFile_safe(filename, ".trace", (void **)&gs_trace, &len) != PM3_SUCCESS) {
+            PrintAndLogEx(FAILED, "Could not open file " _YELLOW_("%s"), filename);
+            return PM3_EIO;
+        }
+        gs_traceLen = len;
+    }
 
-    PrintAndLogEx(SUCCESS, "Recorded Activity (TraceLen = " _YELLOW_("%u") " bytes)", gs_traceLen);
+    PrintAndLogEx(SUCCESS, "Recorded Activity (TraceLen = " _YELLOW_("%u") " bytes)%s", gs_traceLen, (gs_trace_mapped) ? " ( file backed )" : "");
     PrintAndLogEx(HINT, "Hint: Try `" _YELLOW_("trace list -1 -t ...") "` to view trace.  Remember the " _YELLOW_("`-1`") " param");
     return PM3_SUCCESS;
 }
@@ -1240,13 +1886,17 @@ static int CmdTraceSave(const char *Cmd) {
     CLIParserContext *ctx;
     CLIParserInit(&ctx, "trace save",
                   "Save protocol data from trace buffer to binary file\n"
-                  "File extension is <.trace>",
-                  "trace save -f mytracefile    -> w/o file extension"
+                  "File extension is <.trace>, or <.pcapng> with `--pcapng`\n"
+                  "14a and 14b are saved with the ISO 14443 link type Wireshark dissects, other protocols as USER0",
+                  "trace save -f mytracefile                 -> w/o file extension\n"
+                  "trace save -f mytracefile --pcapng -t 14a -> as pcapng"
                  );
 
     void *argtable[] = {
         arg_param_begin,
         arg_str1("f", "file", "<fn>", "Specify trace file to save"),
+        arg_lit0(NULL, "pcapng", "save as pcapng"),
+        arg_str0("t", "type", "<str>", "protocol of the trace, see `trace list -h`"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, false);
@@ -1254,8 +1904,19 @@ static int CmdTraceSave(const char *Cmd) {
     int fnlen = 0;
     char filename[FILE_PATH_SIZE] = {0};
     CLIParamStrToBuf(arg_get_str(ctx, 1), (uint8_t *)filename, FILE_PATH_SIZE, &fnlen);
+    bool use_pcapng = arg_get_lit(ctx, 2);
+
+    int tlen = 0;
+    char type[10] = {0};
+    CLIParamStrToBuf(arg_get_str(ctx, 3), (uint8_t *)type, sizeof(type), &tlen);
+    str_lower(type);
     CLIParserFree(ctx);
 
+    uint8_t protocol;
+    if (trace_protocol_from_str(type, &protocol) != PM3_SUCCESS) {
+        return PM3_EINVARG;
+    }
+
     if (gs_traceLen == 0) {
         download_trace();
         if (gs_traceLen == 0) {
@@ -1264,10 +1925,329 @@ static int CmdTraceSave(const char *Cmd) {
         }
     }
 
+    if (use_pcapng) {
+        return trace_save_pcapng(filename, protocol);
+    }
+
     saveFile(filename, ".trace", gs_trace, gs_traceLen);
     return PM3_SUCCESS;
 }
 
+// a wakeup from the reader, sessions are only told apart for 14a and 14b
+static bool trace_index_session_start(uint8_t protocol, const tracelog_hdr_t *hdr) {
+    if (hdr->isResponse || hdr->data_len == 0) {
+        return false;
+    }
+
+    if (trace_is_14a_family(protocol)) {
+        return (hdr->data_len == 1) && ((hdr->frame[0] == ISO14443A_CMD_REQA) || (hdr->frame[0] == ISO14443A_CMD_WUPA));
+    }
+
+    if (protocol == ISO_14443B || protocol == PROTO_CRYPTORF) {
+        return (hdr->data_len >= 3) && (hdr->frame[0] == ISO14443B_REQB);
+    }
+    return false;
+}
+
+static void trace_index_add_uid(trace_idx_session_t *session, const uint8_t *uid, uint8_t len) {
+    if (session->uidlen + len <= TRACE_IDX_MAX_UID) {
+        memcpy(session->uid + session->uidlen, uid, len);
+        session->uidlen += len;
+    }
+}
+
+static void trace_index_record(trace_index_t *idx, trace_idx_rec_t *rec, tracelog_hdr_t *hdr) {
+    trace_idx_session_t *session = &idx->sessions[rec->session];
+    uint8_t *frame = hdr->frame;
+    uint16_t data_len = hdr->data_len;
+
+    rec->cmd = (data_len) ? frame[0] : 0;
+    rec->flags = (hdr->isResponse) ? TRACE_IDX_RESPONSE : 0;
+    // the MIFARE check follows the annotator's auth state, the index has its own
+    uint8_t crc_protocol = (idx->protocol == PROTO_MIFARE || idx->protocol == PROTO_MFPLUS) ? ISO_14443A : idx->protocol;
+    rec->crc = (session->crypto) ? 2 : trace_crc_status(crc_protocol, hdr->isResponse, frame, data_len, frame + data_len);
+    if (rec->crc == 0) {
+        idx->crc_errors++;
+    }
+
+    if (trace_is_14a_family(idx->protocol) && hdr->isResponse == false) {
+
+        if ((data_len >= 4) && (rec->cmd == MIFARE_AUTH_KEYA || rec->cmd == MIFARE_AUTH_KEYB || rec->cmd == MIFARE_ULC_AUTH_1)) {
+            rec->flags |= TRACE_IDX_AUTH;
+            idx->auths++;
+            session->crypto |= (idx->protocol == PROTO_MIFARE || idx->protocol == PROTO_MFPLUS) && (rec->cmd != MIFARE_ULC_AUTH_1);
+        }
+
+        // SELECT of a cascade level, a leading cascade tag is not part of the uid
+        if ((data_len >= 7) && (frame[1] == 0x70) &&
+                (rec->cmd == ISO14443A_CMD_ANTICOLL_OR_SELECT || rec->cmd == ISO14443A_CMD_ANTICOLL_OR_SELECT_2 || rec->cmd == ISO14443A_CMD_ANTICOLL_OR_SELECT_3)) {
+            if (frame[2] == 0x88) {
+                trace_index_add_uid(session, frame + 3, 3);
+            } else {
+                trace_index_add_uid(session, frame + 2, 4);
+            }
+        }
+    }
+
+    // PUPI of the ATQB
+    if ((idx->protocol == ISO_14443B || idx->protocol == PROTO_CRYPTORF) && hdr->isResponse &&
+            (data_len >= 5) && (rec->cmd == 0x50) && (session->uidlen == 0)) {
+        trace_index_add_uid(session, frame + 1, 4);
+    }
+}
+
+// Walks the buffer once and keeps offset, time, direction, first byte, CRC status
+// and session of every record. Rebuilt only when the buffer or protocol changes
+static int trace_index_build(uint8_t protocol) {
+
+    if (gs_trace_index.valid && gs_trace_index.protocol == protocol) {
+        return PM3_SUCCESS;
+    }
+
+    trace_index_free();
+
+    uint32_t count = 0;
+    uint32_t sessions = 1;
+    uint32_t pos = 0;
+    while (is_last_record(pos, gs_traceLen) == false) {
+        const tracelog_hdr_t *hdr = (const tracelog_hdr_t *)(gs_trace + pos);
+        uint32_t next = pos + TRACELOG_HDR_LEN + hdr->data_len + TRACELOG_PARITY_LEN(hdr);
+        if (next > gs_traceLen) {
+            break;
+        }
+        if (trace_index_session_start(protocol, hdr)) {
+            sessions++;
+        }
+        count++;
+        pos = next;
+    }
+
+    trace_index_t *idx = &gs_trace_index;
+    idx->recs = calloc(MAX(count, 1), sizeof(trace_idx_rec_t));
+    idx->sessions = calloc(sessions, sizeof(trace_idx_session_t));
+    if (idx->recs == NULL || idx->sessions == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        trace_index_free();
+        return PM3_EMALLOC;
+    }
+
+    idx->protocol = protocol;
+    idx->monotonic = true;
+    idx->session_count = 1;
+
+    uint32_t first_timestamp = (count) ? ((tracelog_hdr_t *)gs_trace)->timestamp : 0;
+
+    pos = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        tracelog_hdr_t *hdr = (tracelog_hdr_t *)(gs_trace + pos);
+        trace_idx_rec_t *rec = &idx->recs[i];
+
+        rec->offset = pos;
+        rec->time = hdr->timestamp - first_timestamp;
+        if (i && rec->time < idx->recs[i - 1].time) {
+            idx->monotonic = false;
+        }
+
+        // records ahead of the first wakeup stay in session 0
+        if (trace_index_session_start(protocol, hdr) && (i > idx->sessions[idx->session_count - 1].first)) {
+            idx->sessions[idx->session_count].first = i;
+            idx->session_count++;
+        }
+        rec->session = idx->session_count - 1;
+
+        trace_index_record(idx, rec, hdr);
+
+        pos += TRACELOG_HDR_LEN + hdr->data_len + TRACELOG_PARITY_LEN(hdr);
+    }
+
+    idx->count = count;
+    idx->valid = true;
+    return PM3_SUCCESS;
+}
+
+static bool trace_frame_has_bytes(const uint8_t *frame, uint16_t len, const uint8_t *d, uint8_t dlen) {
+    for (uint16_t i = 0; i + dlen <= len; i++) {
+        if (memcmp(frame + i, d, dlen) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// by the anticollision uid when there is one, a prefix of it matches too,
+// else by any frame of the session carrying the uid, as sent or byte reversed
+static bool trace_index_session_has_uid(const trace_index_t *idx, uint32_t session, const uint8_t *uid, uint8_t uidlen) {
+    const trace_idx_session_t *s = &idx->sessions[session];
+    if (s->uidlen) {
+        return (s->uidlen >= uidlen) && (memcmp(s->uid, uid, uidlen) == 0);
+    }
+
+    uint8_t ruid[TRACE_IDX_MAX_UID];
+    for (uint8_t i = 0; i < uidlen; i++) {
+        ruid[i] = uid[uidlen - 1 - i];
+    }
+
+    uint32_t last = (session + 1 < idx->session_count) ? idx->sessions[session + 1].first : idx->count;
+    for (uint32_t i = s->first; i < last; i++) {
+        const tracelog_hdr_t *hdr = (const tracelog_hdr_t *)(gs_trace + idx->recs[i].offset);
+        if (trace_frame_has_bytes(hdr->frame, hdr->data_len, uid, uidlen) || trace_frame_has_bytes(hdr->frame, hdr->data_len, ruid, uidlen)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+typedef struct {
+    uint64_t from;
+    uint64_t to;
+    bool use_cmd;
+    uint8_t cmd;
+    uint8_t uid[TRACE_IDX_MAX_UID];
+    uint8_t uidlen;
+} trace_filter_t;
+
+// annotators keeping state between frames, these are replayed silently from
+// the start of the session rather than started at the matching record
+static bool trace_filter_replay(uint8_t protocol) {
+    return (protocol == ISO_14443A || protocol == PROTO_MIFARE || protocol == PROTO_MFPLUS ||
+            protocol == PROTO_HITAG1 || protocol == PROTO_HITAG2 || protocol == PROTO_HITAGS || protocol == PROTO_HITAGU);
+}
+
+// prints record k and returns the first record after it, a line can take several records
+static uint32_t trace_list_index_line(const trace_index_t *idx, uint32_t k, bool show, bool showWaitCycles, bool markCRCBytes, uint32_t *prev_eot, bool use_us,
+                                      const uint64_t *dicKeys, uint32_t dicKeysCount) {
+    print_deferred_t muted = {0};
+    if (show == false) {
+        PrintAndLogDefer(&muted);
+    }
+
+    uint32_t pos = printTraceLine(idx->recs[k].offset, gs_traceLen, gs_trace, idx->protocol, showWaitCycles, markCRCBytes, prev_eot, use_us, dicKeys, dicKeysCount);
+
+    if (show == false) {
+        PrintAndLogDefer(NULL);
+        PrintAndLogDeferredFree(&muted);
+    }
+
+    do {
+        k++;
+    } while (k < idx->count && idx->recs[k].offset < pos);
+    return k;
+}
+
+// Lists the records matching all given filters. The time window is a binary
+// search in the index when timestamps only go up, --cmd selects reader frames
+// and the responses to them, --uid whole sessions
+static int trace_list_filtered(uint8_t protocol, const trace_filter_t *f, bool showWaitCycles, bool markCRCBytes, uint32_t *prev_eot, bool use_us,
+                               const uint64_t *dicKeys, uint32_t dicKeysCount) {
+
+    int res = trace_index_build(protocol);
+    if (res != PM3_SUCCESS) {
+        return res;
+    }
+
+    const trace_index_t *idx = &gs_trace_index;
+
+    uint32_t lo = 0;
+    uint32_t hi = idx->count;
+    if (idx->monotonic) {
+        uint32_t a = 0, b = idx->count;
+        while (a < b) {
+            uint32_t mid = a + ((b - a) / 2);
+            if (idx->recs[mid].time < f->from) {
+                a = mid + 1;
+            } else {
+                b = mid;
+            }
+        }
+        lo = a;
+
+        b = idx->count;
+        while (a < b) {
+            uint32_t mid = a + ((b - a) / 2);
+            if (idx->recs[mid].time <= f->to) {
+                a = mid + 1;
+            } else {
+                b = mid;
+            }
+        }
+        hi = a;
+    }
+
+    bool *selected = calloc(MAX(idx->count, 1), sizeof(bool));
+    int8_t *uid_match = calloc(idx->session_count, sizeof(int8_t));
+    if (selected == NULL || uid_match == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(selected);
+        free(uid_match);
+        return PM3_EMALLOC;
+    }
+
+    bool reader_selected = false;
+    for (uint32_t i = lo; i < hi; i++) {
+        const trace_idx_rec_t *rec = &idx->recs[i];
+
+        bool sel = (rec->time >= f->from) && (rec->time <= f->to);
+
+        if (f->use_cmd) {
+            if ((rec->flags & TRACE_IDX_RESPONSE) == 0) {
+                reader_selected = (rec->cmd == f->cmd);
+            }
+            sel &= reader_selected;
+        }
+
+        if (sel && f->uidlen) {
+            // 0 unknown, 1 match, -1 no match
+            if (uid_match[rec->session] == 0) {
+                uid_match[rec->session] = trace_index_session_has_uid(idx, rec->session, f->uid, f->uidlen) ? 1 : -1;
+            }
+            sel = (uid_match[rec->session] == 1);
+        }
+        selected[i] = sel;
+    }
+    free(uid_match);
+
+    bool replay = trace_filter_replay(protocol);
+    uint32_t shown = 0;
+    uint32_t k = 0;
+    bool walking = false;
+
+    for (uint32_t j = lo; j < hi; j++) {
+
+        // already printed as part of an earlier line
+        if (selected[j] == false || j < k) {
+            continue;
+        }
+
+        uint32_t start = j;
+        if (replay) {
+            uint32_t first = idx->sessions[idx->recs[j].session].first;
+            start = (walking && k > first) ? k : first;
+        }
+
+        k = start;
+        while (k < j) {
+            k = trace_list_index_line(idx, k, false, showWaitCycles, markCRCBytes, prev_eot, use_us, dicKeys, dicKeysCount);
+        }
+
+        if (k == j) {
+            k = trace_list_index_line(idx, k, true, showWaitCycles, markCRCBytes, prev_eot, use_us, dicKeys, dicKeysCount);
+            shown++;
+        }
+        walking = true;
+
+        if (kbd_enter_pressed()) {
+            PrintAndLogEx(INFO, "User interrupted detected. Aborting");
+            break;
+        }
+    }
+    free(selected);
+
+    PrintAndLogEx(NORMAL, "");
+    PrintAndLogEx(INFO, "Showed " _YELLOW_("%u") " of " _YELLOW_("%u") " records", shown, idx->count);
+    PrintAndLogEx(INFO, "Index... " _YELLOW_("%u") " sessions, " _YELLOW_("%u") " auths, " _YELLOW_("%u") " CRC errors", idx->session_count, idx->auths, idx->crc_errors);
+    return PM3_SUCCESS;
+}
+
 int CmdTraceListAlias(const char *Cmd, const char *alias, const char *protocol) {
     CLIParserContext *ctx;
     char desc[500] = {0};
@@ -1279,8 +2259,9 @@ int CmdTraceListAlias(const char *Cmd, const char *alias, const char *protocol)
     char example[200] = {0};
     snprintf(example, sizeof(example) - 1,
              "%s list --frame      -> show frame delay times\n"
-             "%s list -1           -> use trace buffer ",
-             alias, alias);
+             "%s list -1           -> use trace buffer\n"
+             "%s list -1 --cmd 30  -> only reads and their responses",
+             alias, alias, alias);
     char fullalias[100] = {0};
     snprintf(fullalias, sizeof(fullalias) - 1, "%s list", alias);
     CLIParserInit(&ctx, fullalias, desc, example);
@@ -1295,12 +2276,16 @@ int CmdTraceListAlias(const char *Cmd, const char *alias, const char *protocol)
         arg_lit0("x", NULL, "show hexdump to convert to pcap(ng)\n"
                  "                                   or to import into Wireshark using encapsulation type \"ISO 14443\""),
         arg_str0("f", "file", "<fn>", "filename of dictionary"),
+        arg_u64_0(NULL, "from", "<dec>", "only records starting at or after this time"),
+        arg_u64_0(NULL, "to", "<dec>", "only records starting at or before this time"),
+        arg_str0(NULL, "cmd", "<hex>", "only reader frames with this first byte and their responses"),
+        arg_str0(NULL, "uid", "<hex>", "only sessions with this UID"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
     CLIParserFree(ctx);
 
-    char args[128] = {0};
+    char args[256] = {0};
     snprintf(args, sizeof(args), "-t %s ", protocol);
     strncat(args, Cmd, sizeof(args) - strlen(args) - 1);
     return CmdTraceList(args);
@@ -1336,7 +2321,11 @@ int CmdTraceList(const char *Cmd) {
                   "\n"
                   "trace list -t mf -f mfc_default_keys.dic     -> use default dictionary file\n"
                   "trace list -t 14a --frame                    -> show frame delay times\n"
-                  "trace list -t 14a -1                         -> use trace buffer "
+                  "trace list -t 14a -1                         -> use trace buffer\n"
+                  "\n"
+                  "trace list -t 14a -1 --cmd 30                -> only READ commands and their responses\n"
+                  "trace list -t 14a -1 -u --from 1000 --to 5000 -> only records starting in this window (us)\n"
+                  "trace list -t 14a -1 --uid 04C1A2B3C4D5E6    -> only sessions with this UID"
                  );
 
     void *argtable[] = {
@@ -1350,6 +2339,10 @@ int CmdTraceList(const char *Cmd) {
                  "                                   or to import into Wireshark using encapsulation type \"ISO 14443\""),
         arg_str0("t", "type", "<str>", "protocol to annotate the trace"),
         arg_str0("f", "file", "<fn>", "filename of dictionary"),
+        arg_u64_0(NULL, "from", "<dec>", "only records starting at or after this time"),
+        arg_u64_0(NULL, "to", "<dec>", "only records starting at or before this time"),
+        arg_str0(NULL, "cmd", "<hex>", "only reader frames with this first byte and their responses"),
+        arg_str0(NULL, "uid", "<hex>", "only sessions with this UID"),
         arg_param_end
     };
     CLIExecWithReturn(ctx, Cmd, argtable, true);
@@ -1373,38 +2366,40 @@ int CmdTraceList(const char *Cmd) {
         diclen = 0;
     }
 
+    trace_filter_t filter = {
+        .from = 0,
+        .to = UINT32_MAX,
+    };
+    bool use_filter = (arg_get_u64_count(ctx, 9) || arg_get_u64_count(ctx, 10));
+    filter.from = MIN(arg_get_u64_def(ctx, 9, 0), UINT32_MAX);
+    filter.to = MIN(arg_get_u64_def(ctx, 10, UINT32_MAX), UINT32_MAX);
+
+    int cmdlen = 0;
+    uint8_t cmd[1] = {0};
+    CLIGetHexWithReturn(ctx, 11, cmd, &cmdlen);
+    filter.use_cmd = (cmdlen > 0);
+    filter.cmd = cmd[0];
+
+    int uidlen = 0;
+    CLIGetHexWithReturn(ctx, 12, filter.uid, &uidlen);
+    filter.uidlen = uidlen;
+
+    use_filter |= (filter.use_cmd || filter.uidlen);
+
     CLIParserFree(ctx);
 
+    // the index keeps ticks, as the Start column without -u
+    if (use_us) {
+        filter.from = (filter.from * 1356) / 100;
+        if (filter.to != UINT32_MAX) {
+            filter.to = MIN(((filter.to * 1356) + 99) / 100, UINT32_MAX);
+        }
+    }
+
     clearCommandBuffer();
 
-    // no crc, no annotations
-    uint8_t protocol = -1;
-
-    // validate type of output
-    if (strcmp(type, "14a") == 0)      protocol = ISO_14443A;
-    else if (strcmp(type, "14b") == 0)      protocol = ISO_14443B;
-    else if (strcmp(type, "15") == 0)       protocol = ISO_15693;
-    else if (strcmp(type, "7816") == 0)     protocol = ISO_7816_4;
-    else if (strcmp(type, "cryptorf") == 0) protocol = PROTO_CRYPTORF;
-    else if (strcmp(type, "des") == 0)      protocol = MFDES;
-    else if (strcmp(type, "felica") == 0)   protocol = FELICA;
-    else if (strcmp(type, "ht1") == 0)   protocol = PROTO_HITAG1;
-    else if (strcmp(type, "ht2") == 0)   protocol = PROTO_HITAG2;
-    else if (strcmp(type, "hts") == 0)   protocol = PROTO_HITAGS;
-    else if (strcmp(type, "htu") == 0)   protocol = PROTO_HITAGU;
-    else if (strcmp(type, "iclass") == 0)   protocol = ICLASS;
-    else if (strcmp(type, "legic") == 0)    protocol = LEGIC;
-    else if (strcmp(type, "lto") == 0)      protocol = LTO;
-    else if (strcmp(type, "mf") == 0)       protocol = PROTO_MIFARE;
-    else if (strcmp(type, "raw") == 0)      protocol = -1;
-    else if (strcmp(type, "seos") == 0)     protocol = SEOS;
-    else if (strcmp(type, "thinfilm") == 0) protocol = THINFILM;
-    else if (strcmp(type, "topaz") == 0)    protocol = TOPAZ;
-    else if (strcmp(type, "mfp") == 0)      protocol = PROTO_MFPLUS;
-    else if (strcmp(type, "fmcos20") == 0)  protocol = PROTO_FMCOS20;
-    else if (strcmp(type, "") == 0)         protocol = -1;
-    else {
-        PrintAndLogEx(FAILED, "Unknown protocol \"%s\"", type);
+    uint8_t protocol;
+    if (trace_protocol_from_str(type, &protocol) != PM3_SUCCESS) {
         return PM3_EINVARG;
     }
 
@@ -1427,7 +2422,7 @@ int CmdTraceList(const char *Cmd) {
         return PM3_SUCCESS;
     }
 
-    uint16_t tracepos = 0;
+    uint32_t tracepos = 0;
 
     /*
     if (protocol == FELICA) {
@@ -1573,12 +2568,16 @@ int CmdTraceList(const char *Cmd) {
             prev_EOT = &previous_EOT;
         }
 
-        while (tracepos < gs_traceLen) {
-            tracepos = printTraceLine(tracepos, gs_traceLen, gs_trace, protocol, show_wait_cycles, mark_crc, prev_EOT, use_us, dicKeys, dicKeysCount);
+        if (use_filter) {
+            trace_list_filtered(protocol, &filter, show_wait_cycles, mark_crc, prev_EOT, use_us, dicKeys, dicKeysCount);
+        } else {
+            while (tracepos < gs_traceLen) {
+                tracepos = printTraceLine(tracepos, gs_traceLen, gs_trace, protocol, show_wait_cycles, mark_crc, prev_EOT, use_us, dicKeys, dicKeysCount);
 
-            if (kbd_enter_pressed()) {
-                PrintAndLogEx(INFO, "User interrupted detected. Aborting");
-                break;
+                if (kbd_enter_pressed()) {
+                    PrintAndLogEx(INFO, "User interrupted detected. Aborting");
+                    break;
+                }
             }
         }
 
@@ -1589,6 +2588,7 @@ int CmdTraceList(const char *Cmd) {
 
     if (show_hex) {
         PrintAndLogEx(HINT, "Hint: Syntax to use: `" _YELLOW_("text2pcap -t \"%%S.\" -l 264 -n <input-text-file> <output-pcapng-file>") "`");
+        PrintAndLogEx(HINT, "Hint: or save it directly with `" _YELLOW_("trace save -f <fn> --pcapng -t %s") "`", trace_protocol_name(protocol));
     }
 
     return PM3_SUCCESS;
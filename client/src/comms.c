@@ -22,8 +22,10 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/time.h>
 
 #include "uart/uart.h"
+#include "uart/spscring.h"
 #include "ui.h"
 #include "crc16.h"
 #include "util.h" // g_pendingPrompt
@@ -47,15 +49,25 @@ static bool reconnect_ok = false;
 
 static bool comm_thread_dead = false;
 static bool comm_raw_mode = false;
-static uint8_t *comm_raw_data = NULL;
-static size_t comm_raw_len = 0;
-static size_t comm_raw_pos = 0;
-
-// Transmit buffer.
-static PacketCommandOLD txBuffer;
-static PacketCommandNGRaw txBufferNG;
-static size_t txBufferNGLen;
-static bool txBuffer_pending = false;
+// raw mode: the comm thread produces into comm_raw_ring, the waiting thread consumes
+static SpscRing *comm_raw_ring = NULL;
+// set by the comm thread while it may be writing into comm_raw_ring
+static bool comm_raw_busy = false;
+static size_t comm_raw_len = 0;  // number of bytes to receive
+static size_t comm_raw_pos = 0;  // number of bytes received so far
+
+// Transmit queue.
+// Senders only block when COMM_TX_QUEUE_LEN commands are waiting to be put on the wire,
+// the communication thread sends all queued commands back to back.
+typedef struct {
+    PacketCommandOLD old;
+    PacketCommandNGRaw ng;
+    size_t ng_len;          // NG/MIX frame length, 0 for OLD frames
+} tx_slot_t;
+
+static tx_slot_t txQueue[COMM_TX_QUEUE_LEN];
+static uint8_t tx_head = 0;  // next slot to fill
+static uint8_t tx_count = 0; // number of queued slots
 static pthread_mutex_t txBufferMutex = PTHREAD_MUTEX_INITIALIZER;
 static pthread_cond_t txBufferSig = PTHREAD_COND_INITIALIZER;
 
@@ -72,12 +84,48 @@ static int cmd_tail = 0;
 // to lock rxBuffer operations from different threads
 static pthread_mutex_t rxBufferMutex = PTHREAD_MUTEX_INITIALIZER;
 
+// One record per thread blocked in waitReply(), registered under the command it waits for.
+// storeReply() only signals the records whose command matches the reply that landed in rxBuffer.
+// Protected by rxBufferMutex.
+typedef struct rx_waiter_s {
+    uint32_t cmd;                // command waited for, CMD_UNKNOWN wakes up on any reply
+    pthread_cond_t sig;
+    struct rx_waiter_s *next;
+} rx_waiter_t;
+
+static rx_waiter_t *rx_waiters = NULL;
+
+// Round-trip latency histogram, from the moment a command is put on the wire
+// to the moment WaitForResponse hands the matching reply to its caller.
+// Bucket n counts latencies below (COMM_LATENCY_BASE_US << n) microseconds,
+// the last bucket collects everything slower.
+#define COMM_LATENCY_BASE_US  128
+static uint32_t latency_hist[COMM_LATENCY_BUCKETS];
+static uint64_t latency_sum_us;
+static uint64_t latency_min_us = UINT64_MAX;
+static uint64_t latency_max_us;
+
+// Send timestamps of commands in flight, oldest first.
+// Replies come back in submission order, so the oldest matching entry belongs to the received reply.
+#define COMM_TX_INFLIGHT_LEN  32
+typedef struct {
+    uint16_t cmd;
+    uint64_t us;
+} tx_stamp_t;
+static tx_stamp_t tx_inflight[COMM_TX_INFLIGHT_LEN];
+static uint8_t tx_inflight_tail = 0;
+static uint8_t tx_inflight_count = 0;
+static pthread_mutex_t txInflightMutex = PTHREAD_MUTEX_INITIALIZER;
+
 // Global start time for WaitForResponseTimeout & dl_it, so we can reset timeout when we get packets
 // as sending lot of these packets can slow down things wuite a lot on slow links (e.g. hw status or lf read at 9600)
 static uint64_t timeout_start_time;
 
 static uint64_t last_packet_time;
 
+// maximum time a waiting thread sleeps before re-checking timeouts and comm thread state
+#define COMM_WAIT_SLICE_MS 100
+
 static bool dl_it(uint8_t *dest, uint32_t bytes, PacketResponseNG *response, size_t ms_timeout, bool show_warning, uint32_t rec_cmd);
 
 // Simple alias to track usages linked to the Bootloader, these commands must not be migrated.
@@ -125,16 +173,19 @@ void SendCommandOLD(uint64_t cmd, uint64_t arg0, uint64_t arg1, uint64_t arg2, c
     This causes hangups at times, when the pm3 unit is unresponsive or disconnected. The main console thread is alive,
     but comm thread just spins here. Not good.../holiman
     **/
-    while (txBuffer_pending) {
-        // wait for communication thread to complete sending a previous command
+    while (tx_count == COMM_TX_QUEUE_LEN) {
+        // wait for communication thread to make room in the queue
         pthread_cond_wait(&txBufferSig, &txBufferMutex);
     }
 
-    txBuffer = c;
-    txBuffer_pending = true;
+    tx_slot_t *slot = &txQueue[tx_head];
+    slot->old = c;
+    slot->ng_len = 0;
+    tx_head = (tx_head + 1) % COMM_TX_QUEUE_LEN;
+    tx_count++;
 
     // tell communication thread that a new command can be send
-    pthread_cond_signal(&txBufferSig);
+    pthread_cond_broadcast(&txBufferSig);
 
     pthread_mutex_unlock(&txBufferMutex);
 
@@ -155,50 +206,53 @@ static void SendCommandNG_internal(uint16_t cmd, uint8_t *data, size_t len, bool
         return;
     }
 
-    PacketCommandNGPostamble *tx_post = (PacketCommandNGPostamble *)((uint8_t *)&txBufferNG + sizeof(PacketCommandNGPreamble) + len);
-
     pthread_mutex_lock(&txBufferMutex);
     /**
     This causes hangups at times, when the pm3 unit is unresponsive or disconnected. The main console thread is alive,
     but comm thread just spins here. Not good.../holiman
     **/
-    while (txBuffer_pending) {
-        // wait for communication thread to complete sending a previous command
+    while (tx_count == COMM_TX_QUEUE_LEN) {
+        // wait for communication thread to make room in the queue
         pthread_cond_wait(&txBufferSig, &txBufferMutex);
     }
 
-    txBufferNG.pre.magic = COMMANDNG_PREAMBLE_MAGIC;
-    txBufferNG.pre.ng = ng;
-    txBufferNG.pre.length = len;
-    txBufferNG.pre.cmd = cmd;
+    tx_slot_t *slot = &txQueue[tx_head];
+    PacketCommandNGRaw *txBufferNG = &slot->ng;
+    PacketCommandNGPostamble *tx_post = (PacketCommandNGPostamble *)((uint8_t *)txBufferNG + sizeof(PacketCommandNGPreamble) + len);
+
+    txBufferNG->pre.magic = COMMANDNG_PREAMBLE_MAGIC;
+    txBufferNG->pre.ng = ng;
+    txBufferNG->pre.length = len;
+    txBufferNG->pre.cmd = cmd;
     if (len > 0 && data) {
-        memcpy(&txBufferNG.data, data, len);
+        memcpy(&txBufferNG->data, data, len);
     }
 
     if ((g_conn.send_via_fpc_usart && g_conn.send_with_crc_on_fpc) || ((!g_conn.send_via_fpc_usart) && g_conn.send_with_crc_on_usb)) {
         uint8_t first = 0, second = 0;
-        compute_crc(CRC_14443_A, (uint8_t *)&txBufferNG, sizeof(PacketCommandNGPreamble) + len, &first, &second);
+        compute_crc(CRC_14443_A, (uint8_t *)txBufferNG, sizeof(PacketCommandNGPreamble) + len, &first, &second);
         tx_post->crc = (first << 8) + second;
     } else {
         tx_post->crc = COMMANDNG_POSTAMBLE_MAGIC;
     }
 
-    txBufferNGLen = sizeof(PacketCommandNGPreamble) + len + sizeof(PacketCommandNGPostamble);
+    slot->ng_len = sizeof(PacketCommandNGPreamble) + len + sizeof(PacketCommandNGPostamble);
 
 #ifdef COMMS_DEBUG_RAW
-    print_hex_break((uint8_t *)&txBufferNG.pre, sizeof(PacketCommandNGPreamble), 32);
+    print_hex_break((uint8_t *)&txBufferNG->pre, sizeof(PacketCommandNGPreamble), 32);
     if (ng) {
-        print_hex_break((uint8_t *)&txBufferNG.data, len, 32);
+        print_hex_break((uint8_t *)&txBufferNG->data, len, 32);
     } else {
-        print_hex_break((uint8_t *)&txBufferNG.data, 3 * sizeof(uint64_t), 32);
-        print_hex_break((uint8_t *)&txBufferNG.data + 3 * sizeof(uint64_t), len - 3 * sizeof(uint64_t), 32);
+        print_hex_break((uint8_t *)&txBufferNG->data, 3 * sizeof(uint64_t), 32);
+        print_hex_break((uint8_t *)&txBufferNG->data + 3 * sizeof(uint64_t), len - 3 * sizeof(uint64_t), 32);
     }
     print_hex_break((uint8_t *)tx_post, sizeof(PacketCommandNGPostamble), 32);
 #endif
-    txBuffer_pending = true;
+    tx_head = (tx_head + 1) % COMM_TX_QUEUE_LEN;
+    tx_count++;
 
     // tell communication thread that a new command can be send
-    pthread_cond_signal(&txBufferSig);
+    pthread_cond_broadcast(&txBufferSig);
 
     pthread_mutex_unlock(&txBufferMutex);
 
@@ -235,6 +289,20 @@ void clearCommandBuffer(void) {
     cmd_tail = cmd_head;
     pthread_mutex_unlock(&rxBufferMutex);
 }
+
+static bool reply_wakes_waiter(uint32_t wait_cmd, uint16_t cmd) {
+    return (wait_cmd == CMD_UNKNOWN) || (cmd == wait_cmd) || (cmd == CMD_WTX);
+}
+
+// rxBufferMutex must be held
+static void wakeWaiters(bool all, uint16_t cmd) {
+    for (rx_waiter_t *w = rx_waiters; w != NULL; w = w->next) {
+        if (all || reply_wakes_waiter(w->cmd, cmd)) {
+            pthread_cond_signal(&w->sig);
+        }
+    }
+}
+
 /**
  * @brief storeCommand stores a USB command in a circular buffer
  * @param UC
@@ -253,6 +321,10 @@ static void storeReply(const PacketResponseNG *packet) {
 
     //increment head and wrap
     cmd_head = (cmd_head + 1) % CMD_BUFFER_SIZE;
+
+    // only wake up the waiting threads interested in this reply,
+    // or all of them when the ring needs to be drained before it overflows
+    wakeWaiters((cmd_head + 1) % CMD_BUFFER_SIZE == cmd_tail, packet->cmd);
     pthread_mutex_unlock(&rxBufferMutex);
 }
 /**
@@ -278,6 +350,141 @@ static int getReply(PacketResponseNG *packet) {
     return 1;
 }
 
+/**
+ * @brief waitReply blocks the calling thread until a reply matching `cmd` is available in the
+ *  circular buffer or `ms` milliseconds elapsed. It replaces polling the buffer every millisecond,
+ *  the waiting thread is woken up by storeReply() as soon as the packet lands.
+ * @param cmd command to wait for, or CMD_UNKNOWN to wake up on any reply
+ * @param ms maximum time to block
+ */
+static void waitReply(uint32_t cmd, uint32_t ms) {
+    struct timeval now;
+    gettimeofday(&now, NULL);
+
+    uint64_t ns = ((uint64_t)now.tv_usec * 1000) + ((uint64_t)ms * 1000000);
+    struct timespec deadline;
+    deadline.tv_sec = now.tv_sec + (ns / 1000000000);
+    deadline.tv_nsec = ns % 1000000000;
+
+    pthread_mutex_lock(&rxBufferMutex);
+
+    // replies stored before we took the lock won't signal us anymore, look for them first
+    for (int i = cmd_tail; i != cmd_head; i = (i + 1) % CMD_BUFFER_SIZE) {
+        if (reply_wakes_waiter(cmd, rxBuffer[i].cmd)) {
+            pthread_mutex_unlock(&rxBufferMutex);
+            return;
+        }
+    }
+
+    rx_waiter_t waiter = { .cmd = cmd, .next = rx_waiters };
+    pthread_cond_init(&waiter.sig, NULL);
+    rx_waiters = &waiter;
+
+    pthread_cond_timedwait(&waiter.sig, &rxBufferMutex, &deadline);
+
+    for (rx_waiter_t **w = &rx_waiters; *w != NULL; w = &(*w)->next) {
+        if (*w == &waiter) {
+            *w = waiter.next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&rxBufferMutex);
+    pthread_cond_destroy(&waiter.sig);
+}
+
+static void stampSent(uint16_t cmd) {
+    pthread_mutex_lock(&txInflightMutex);
+    if (tx_inflight_count == COMM_TX_INFLIGHT_LEN) {
+        // commands without replies, forget the oldest
+        tx_inflight_tail = (tx_inflight_tail + 1) % COMM_TX_INFLIGHT_LEN;
+        tx_inflight_count--;
+    }
+    tx_stamp_t *stamp = &tx_inflight[(tx_inflight_tail + tx_inflight_count) % COMM_TX_INFLIGHT_LEN];
+    stamp->cmd = cmd;
+    stamp->us = usclock();
+    tx_inflight_count++;
+    pthread_mutex_unlock(&txInflightMutex);
+}
+
+static void updateLatency(uint16_t cmd) {
+
+    uint64_t sent_us = 0;
+    bool found = false;
+
+    pthread_mutex_lock(&txInflightMutex);
+    for (uint8_t i = 0; i < tx_inflight_count; i++) {
+        const tx_stamp_t *stamp = &tx_inflight[(tx_inflight_tail + i) % COMM_TX_INFLIGHT_LEN];
+        if (stamp->cmd == cmd) {
+            sent_us = stamp->us;
+            // only account for the first reply to a sent command,
+            // older commands still in flight didn't get a reply and never will
+            tx_inflight_tail = (tx_inflight_tail + i + 1) % COMM_TX_INFLIGHT_LEN;
+            tx_inflight_count -= i + 1;
+            found = true;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&txInflightMutex);
+
+    if (found == false) {
+        return;
+    }
+
+    uint64_t delta = usclock() - sent_us;
+
+    uint8_t bucket = 0;
+    while ((bucket < COMM_LATENCY_BUCKETS - 1) && (delta >= ((uint64_t)COMM_LATENCY_BASE_US << bucket))) {
+        bucket++;
+    }
+
+    latency_hist[bucket]++;
+    latency_sum_us += delta;
+    latency_min_us = MIN(latency_min_us, delta);
+    latency_max_us = MAX(latency_max_us, delta);
+}
+
+void ResetCommunicationLatency(void) {
+    memset(latency_hist, 0, sizeof(latency_hist));
+    latency_sum_us = 0;
+    latency_min_us = UINT64_MAX;
+    latency_max_us = 0;
+}
+
+void PrintCommunicationLatency(void) {
+
+    uint32_t count = 0;
+    for (uint8_t i = 0; i < COMM_LATENCY_BUCKETS; i++) {
+        count += latency_hist[i];
+    }
+
+    PrintAndLogEx(INFO, "--- " _CYAN_("Client round-trip latency") " ---------");
+    if (count == 0) {
+        PrintAndLogEx(INFO, "  no replies measured yet");
+        return;
+    }
+
+    PrintAndLogEx(INFO, "  replies.................. %u", count);
+    PrintAndLogEx(INFO, "  min / avg / max.......... %" PRIu64 " / %" PRIu64 " / %" PRIu64 " us"
+                  , latency_min_us
+                  , latency_sum_us / count
+                  , latency_max_us
+                 );
+
+    for (uint8_t i = 0; i < COMM_LATENCY_BUCKETS; i++) {
+        if (latency_hist[i] == 0) {
+            continue;
+        }
+
+        uint64_t hi = (uint64_t)COMM_LATENCY_BASE_US << i;
+        uint32_t pct = (uint32_t)((100 * (uint64_t)latency_hist[i]) / count);
+        if (i == COMM_LATENCY_BUCKETS - 1) {
+            PrintAndLogEx(INFO, "  >= %7" PRIu64 " us......... %6u ( %3u%% )", hi >> 1, latency_hist[i], pct);
+        } else {
+            PrintAndLogEx(INFO, "   < %7" PRIu64 " us......... %6u ( %3u%% )", hi, latency_hist[i], pct);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Entry point into our code: called whenever we received a packet over USB
 // that we weren't necessarily expecting, for example a debug print.
@@ -443,22 +650,44 @@ __attribute__((force_align_arg_pointer))
                 PrintAndLogEx(WARNING, "\nCommunicating with Proxmark3 device " _RED_("failed"));
             }
             __atomic_test_and_set(&comm_thread_dead, __ATOMIC_SEQ_CST);
+
+            // don't let the waiting threads sleep until their timeout
+            pthread_mutex_lock(&rxBufferMutex);
+            wakeWaiters(true, CMD_UNKNOWN);
+            pthread_mutex_unlock(&rxBufferMutex);
             break;
         }
 
+        // announce ourselves before looking at the mode, so a consumer leaving raw mode
+        // either sees us busy or we see raw mode off and keep our hands off the ring
+        __atomic_store_n(&comm_raw_busy, true, __ATOMIC_SEQ_CST);
         bool is_receiving_raw = __atomic_load_n(&comm_raw_mode, __ATOMIC_SEQ_CST);
+        if (is_receiving_raw == false) {
+            __atomic_store_n(&comm_raw_busy, false, __ATOMIC_SEQ_CST);
+        }
 
         if (is_receiving_raw) {
-            uint8_t *bufferData = __atomic_load_n(&comm_raw_data, __ATOMIC_SEQ_CST); // read only
+            SpscRing *ring = __atomic_load_n(&comm_raw_ring, __ATOMIC_SEQ_CST); // read only
             size_t bufferLen = __atomic_load_n(&comm_raw_len, __ATOMIC_SEQ_CST); // read only
             size_t bufferPos = __atomic_load_n(&comm_raw_pos, __ATOMIC_SEQ_CST); // read and write
             if (bufferPos < bufferLen) {
-                size_t rxMaxLen = bufferLen - bufferPos;
+                // receive straight into the free part of the ring
+                uint8_t *bufferData;
+                size_t rxMaxLen = SpscRing_writePeek(ring, &bufferData);
 
+                rxMaxLen = MIN(rxMaxLen, bufferLen - bufferPos);
                 rxMaxLen = MIN(COMM_RAW_RECEIVE_LEN, rxMaxLen);
 
-                res = uart_receive(sp, bufferData + bufferPos, rxMaxLen, &rxlen);
+                if (rxMaxLen == 0) {
+                    // consumer is lagging behind, leave the data in the OS buffers for now
+                    msleep(1);
+                    res = PM3_ENODATA;
+                } else {
+                    res = uart_receive(sp, bufferData, rxMaxLen, &rxlen);
+                }
+
                 if (res == PM3_SUCCESS) {
+                    SpscRing_writeCommit(ring, rxlen);
                     uint64_t clk = msclock();
                     __atomic_store_n(&timeout_start_time,  clk, __ATOMIC_SEQ_CST);
                     __atomic_store_n(&comm_raw_pos, bufferPos + rxlen, __ATOMIC_SEQ_CST);
@@ -475,13 +704,14 @@ __attribute__((force_align_arg_pointer))
                 uint32_t dummyLen;
                 uart_receive(sp, dummyData, sizeof(dummyData), &dummyLen);
             }
+            __atomic_store_n(&comm_raw_busy, false, __ATOMIC_SEQ_CST);
         } else {
             if (is_receiving_raw_last) {
                 // is_receiving_raw changed from true to false
 
-                // Set the buffer as undefined
-                // comm_raw_data == NULL is used in SetCommunicationReceiveMode()
-                __atomic_store_n(&comm_raw_data, NULL, __ATOMIC_SEQ_CST);
+                // Set the ring as undefined
+                // comm_raw_ring == NULL is used in SetCommunicationReceiveMode()
+                __atomic_store_n(&comm_raw_ring, NULL, __ATOMIC_SEQ_CST);
             }
             res = uart_receive(sp, (uint8_t *)&rx_raw.pre, sizeof(PacketResponseNGPreamble), &rxlen);
 
@@ -643,35 +873,41 @@ __attribute__((force_align_arg_pointer))
 #ifdef COMMS_DEBUG
                 PrintAndLogEx(NORMAL, "Received ACK, fast TX mode: ignoring other RX till TX");
 #endif
-                while (!txBuffer_pending) {
+                while (tx_count == 0) {
                     pthread_cond_wait(&txBufferSig, &txBufferMutex);
                 }
             }
         }
 
-        if (txBuffer_pending) {
+        // put all queued commands on the wire back to back
+        while (tx_count) {
 
-            if (txBufferNGLen) { // NG packet
-                res = uart_send(sp, (uint8_t *) &txBufferNG, txBufferNGLen);
-                if (res == PM3_EIO) {
-                    commfailed = true;
-                }
-                g_conn.last_command = txBufferNG.pre.cmd;
-                txBufferNGLen = 0;
+            const tx_slot_t *slot = &txQueue[(tx_head + COMM_TX_QUEUE_LEN - tx_count) % COMM_TX_QUEUE_LEN];
+
+            if (slot->ng_len) { // NG packet
+                g_conn.last_command = slot->ng.pre.cmd;
+                stampSent(g_conn.last_command);
+                res = uart_send(sp, (uint8_t *) &slot->ng, slot->ng_len);
             } else {
-                res = uart_send(sp, (uint8_t *) &txBuffer, sizeof(PacketCommandOLD));
-                if (res == PM3_EIO) {
-                    commfailed = true;
-                }
-                g_conn.last_command = txBuffer.cmd;
+                g_conn.last_command = slot->old.cmd;
+                stampSent(g_conn.last_command);
+                res = uart_send(sp, (uint8_t *) &slot->old, sizeof(PacketCommandOLD));
+            }
+
+            if (res == PM3_EIO) {
+                commfailed = true;
             }
 
-            txBuffer_pending = false;
+            tx_count--;
 
             // main thread doesn't know send failed...
 
-            // tell main thread that txBuffer is empty
-            pthread_cond_signal(&txBufferSig);
+            // tell main thread that there is room in the queue
+            pthread_cond_broadcast(&txBufferSig);
+
+            if (commfailed) {
+                break;
+            }
         }
 
         pthread_mutex_unlock(&txBufferMutex);
@@ -697,7 +933,7 @@ bool IsCommunicationThreadDead(void) {
 
 
 // To start raw receive mode:
-// 1. Call SetCommunicationRawReceiveBuffer(...)
+// 1. Call SetCommunicationRawReceiveRing(...)
 // 2. Call SetCommunicationReceiveMode(true)
 //
 // To stop raw receive mode:
@@ -707,26 +943,40 @@ bool IsCommunicationThreadDead(void) {
 // 1. The receiving thread won't accept any normal packets after calling
 // SetCommunicationReceiveMode(true). You need to call
 // SetCommunicationReceiveMode(false) to stop the raw receiving process.
-// 2. If the received size >= len used in SetCommunicationRawReceiveBuffer(),
+// 2. If the received size >= len used in SetCommunicationRawReceiveRing(),
 // The receiving thread will ignore the incoming data to prevent overflow.
-// 3. Normally you only need WaitForRawDataTimeout() rather than the
+// 3. The receiving thread is the only producer of the ring, the caller must be
+// its only consumer. When the ring is full, the receiving thread stops reading
+// from the port until the consumer made room, no data is dropped.
+// 4. Normally you only need WaitForRawDataTimeout() rather than the
 // low level functions like SetCommunicationReceiveMode(),
-// SetCommunicationRawReceiveBuffer() and GetCommunicationRawReceiveNum()
+// SetCommunicationRawReceiveRing() and GetCommunicationRawReceiveNum()
 
 bool SetCommunicationReceiveMode(bool isRawMode) {
     if (isRawMode) {
-        const uint8_t *buffer = __atomic_load_n(&comm_raw_data, __ATOMIC_SEQ_CST);
-        if (buffer == NULL) {
-            PrintAndLogEx(ERR, "Buffer for raw data is not set");
+        const SpscRing *ring = __atomic_load_n(&comm_raw_ring, __ATOMIC_SEQ_CST);
+        if (ring == NULL) {
+            PrintAndLogEx(ERR, "Ring for raw data is not set");
             return false;
         }
     }
     __atomic_store_n(&comm_raw_mode, isRawMode, __ATOMIC_SEQ_CST);
+
+    if (isRawMode == false) {
+        // the receiving thread might be in the middle of a receive into the ring,
+        // wait until it is done so the ring can be reused or released safely
+        while (__atomic_load_n(&comm_raw_busy, __ATOMIC_SEQ_CST)) {
+            if (IsCommunicationThreadDead() || g_conn.run == false) {
+                break;
+            }
+            msleep(1);
+        }
+    }
     return true;
 }
 
-void SetCommunicationRawReceiveBuffer(uint8_t *buffer, size_t len) {
-    __atomic_store_n(&comm_raw_data,  buffer, __ATOMIC_SEQ_CST);
+void SetCommunicationRawReceiveRing(SpscRing *ring, size_t len) {
+    __atomic_store_n(&comm_raw_ring,  ring, __ATOMIC_SEQ_CST);
     __atomic_store_n(&comm_raw_len,  len, __ATOMIC_SEQ_CST);
     __atomic_store_n(&comm_raw_pos,  0, __ATOMIC_SEQ_CST);
 }
@@ -980,8 +1230,31 @@ static size_t communication_delay(void) {
  * @return the number of received bytes
  */
 size_t WaitForRawDataTimeout(uint8_t *buffer, size_t len, size_t ms_timeout, bool show_process) {
+    return WaitForRawDataTimeoutEx(buffer, len, ms_timeout, show_process, NULL, NULL);
+}
+
+/**
+ * @brief Same as WaitForRawDataTimeout, also hands every chunk to a callback
+ * as soon as it arrives.
+ *
+ * @param buffer The receive buffer, may be NULL when only the callback needs the data
+ * @param cb called with each chunk, may be NULL
+ * @param cb_data passed on to cb
+ */
+size_t WaitForRawDataTimeoutEx(uint8_t *buffer, size_t len, size_t ms_timeout, bool show_process, raw_data_cb_t cb, void *cb_data) {
     uint8_t print_counter = 0;
-    size_t last_pos = 0;
+
+    // reused between calls, SetCommunicationReceiveMode(false) guarantees the
+    // comm thread left the ring alone when the previous capture returned
+    static SpscRing *ring = NULL;
+    if (ring == NULL) {
+        ring = SpscRing_create(COMM_RAW_RING_SIZE);
+        if (ring == NULL) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            return 0;
+        }
+    }
+    SpscRing_reset(ring);
 
     // Add delay depending on the communication channel & speed
     if (ms_timeout != (size_t) - 1) {
@@ -989,7 +1262,7 @@ size_t WaitForRawDataTimeout(uint8_t *buffer, size_t len, size_t ms_timeout, boo
     }
     __atomic_store_n(&timeout_start_time,  msclock(), __ATOMIC_SEQ_CST);
 
-    SetCommunicationRawReceiveBuffer(buffer, len);
+    SetCommunicationRawReceiveRing(ring, len);
     SetCommunicationReceiveMode(true);
 
     size_t pos = 0;
@@ -1007,25 +1280,36 @@ size_t WaitForRawDataTimeout(uint8_t *buffer, size_t len, size_t ms_timeout, boo
             }
         }
 
-        pos = __atomic_load_n(&comm_raw_pos, __ATOMIC_SEQ_CST);
+        // drain everything the comm thread produced so far
+        const uint8_t *data;
+        size_t n = SpscRing_readPeek(ring, &data);
 
-        // Check the timeout if pos is not updated
-        if (last_pos == pos) {
+        if (n == 0) {
+            // Check the timeout if nothing new arrived
             uint64_t tmp_clk = __atomic_load_n(&timeout_start_time, __ATOMIC_SEQ_CST);
             // If ms_timeout == -1, the loop can only be breaked by pressing Enter or receiving enough data
             if ((ms_timeout != (size_t) - 1) && (msclock() - tmp_clk > ms_timeout)) {
                 break;
             }
-        } else {
-            // Print process when (print_counter % 64) == 0
-            if (show_process && (print_counter & 0x3F) == 0) {
-                PrintAndLogEx(INFO, "[%zu/%zu]", pos, len);
-            }
+            msleep(1);
+            continue;
+        }
+
+        n = MIN(n, len - pos);
+        if (buffer != NULL) {
+            memcpy(buffer + pos, data, n);
+        }
+        if (cb != NULL) {
+            cb(data, n, cb_data);
         }
+        SpscRing_readCommit(ring, n);
+        pos += n;
 
+        // Print process when (print_counter % 64) == 0
+        if (show_process && (print_counter & 0x3F) == 0) {
+            PrintAndLogEx(INFO, "[%zu/%zu]", pos, len);
+        }
         print_counter++;
-        last_pos = pos;
-        msleep(10);
     }
     if (pos == len && (ms_timeout != (size_t) - 1)) {
         // If ms_timeout != -1, when the desired data is received, tell the arm side
@@ -1037,7 +1321,6 @@ size_t WaitForRawDataTimeout(uint8_t *buffer, size_t len, size_t ms_timeout, boo
         msleep(ms_timeout);
     }
     SetCommunicationReceiveMode(false);
-    pos = __atomic_load_n(&comm_raw_pos, __ATOMIC_SEQ_CST);
     return pos;
 }
 
@@ -1079,6 +1362,7 @@ bool WaitForResponseTimeoutW(uint32_t cmd, PacketResponseNG *response, size_t ms
         while (getReply(response)) {
 
             if (cmd == CMD_UNKNOWN || response->cmd == cmd) {
+                updateLatency(response->cmd);
                 return true;
             }
 
@@ -1101,8 +1385,14 @@ bool WaitForResponseTimeoutW(uint32_t cmd, PacketResponseNG *response, size_t ms
             PrintAndLogEx(INFO, "You can cancel this operation by pressing the pm3 button");
             show_warning = false;
         }
-        // just to avoid CPU busy loop:
-        msleep(1);
+
+        // sleep until the reply lands, wake up regularly to check timeout and comm thread state
+        uint32_t slice = COMM_WAIT_SLICE_MS;
+        if (ms_timeout != (size_t) - 1) {
+            uint64_t elapsed = msclock() - tmp_clk;
+            slice = (elapsed < ms_timeout) ? MIN(slice, ms_timeout - elapsed + 1) : 1;
+        }
+        waitReply(cmd, slice);
     }
     return false;
 }
@@ -1249,6 +1539,8 @@ static bool dl_it(uint8_t *dest, uint32_t bytes, PacketResponseNG *response, siz
             PrintAndLogEx(INFO, "You can cancel this operation by pressing the pm3 button");
             show_warning = false;
         }
+
+        waitReply(CMD_UNKNOWN, COMM_WAIT_SLICE_MS);
     }
     return false;
 }
@@ -23,6 +23,7 @@
 #include "pm3_cmd.h"    // Packet structs
 #include "util.h"       // FILE_PATH_SIZE
 #include "iso7816/iso7816core.h" // SetISODEPState
+#include "uart/spscring.h"       // SpscRing
 
 #ifdef __cplusplus
 extern "C" {
@@ -47,6 +48,15 @@ extern "C" {
 
 #define COMM_RAW_RECEIVE_LEN (1024)
 
+// size of the lock-free ring between the comm thread and raw data consumers, power of two
+#define COMM_RAW_RING_SIZE (256 * 1024)
+
+// number of commands which can be queued for transmission before SendCommand* blocks
+#define COMM_TX_QUEUE_LEN (8)
+
+// number of buckets in the round-trip latency histogram shown by `hw status`
+#define COMM_LATENCY_BUCKETS (16)
+
 typedef enum {
     BIG_BUF,
     BIG_BUF_EML,
@@ -106,7 +116,7 @@ void clearCommandBuffer(void);
 bool IsReconnectedOk(void);
 bool IsCommunicationThreadDead(void);
 bool SetCommunicationReceiveMode(bool isRawMode);
-void SetCommunicationRawReceiveBuffer(uint8_t *buffer, size_t len);
+void SetCommunicationRawReceiveRing(SpscRing *ring, size_t len);
 size_t GetCommunicationRawReceiveNum(void);
 
 bool OpenProxmarkSilent(pm3_device_t **dev, const char *port, uint32_t speed);
@@ -116,10 +126,15 @@ void CloseProxmark(pm3_device_t *dev);
 void StartReconnectProxmark(void);
 
 size_t WaitForRawDataTimeout(uint8_t *buffer, size_t len, size_t ms_timeout, bool show_process);
+typedef void (*raw_data_cb_t)(const uint8_t *data, size_t len, void *cb_data);
+size_t WaitForRawDataTimeoutEx(uint8_t *buffer, size_t len, size_t ms_timeout, bool show_process, raw_data_cb_t cb, void *cb_data);
 bool WaitForResponseTimeoutW(uint32_t cmd, PacketResponseNG *response, size_t ms_timeout, bool show_warning);
 bool WaitForResponseTimeout(uint32_t cmd, PacketResponseNG *response, size_t ms_timeout);
 bool WaitForResponse(uint32_t cmd, PacketResponseNG *response);
 
+void PrintCommunicationLatency(void);
+void ResetCommunicationLatency(void);
+
 //bool GetFromDevice(DeviceMemType_t memtype, uint8_t *dest, uint32_t bytes, uint32_t start_index, PacketResponseNG *response, size_t ms_timeout, bool show_warning);
 bool GetFromDevice(DeviceMemType_t memtype, uint8_t *dest, uint32_t bytes, uint32_t start_index, uint8_t *data, uint32_t datalen, PacketResponseNG *response, size_t ms_timeout, bool show_warning);
 
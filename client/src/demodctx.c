@@ -0,0 +1,137 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Demodulation context
+//-----------------------------------------------------------------------------
+
+#include "demodctx.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include "ui.h"
+
+demod_ctx_t g_demod_ctx_main;
+__thread demod_ctx_t *g_demod_ctx_bound = NULL;
+static __thread signal_t main_signal;
+static uint64_t samples_gen = 0;
+
+demod_ctx_t *demod_ctx_new(int32_t *samples, size_t len, bool copy) {
+
+    demod_ctx_t *ctx = calloc(1, sizeof(demod_ctx_t));
+    if (ctx == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return NULL;
+    }
+
+    ctx->signal = *getSignalProperties();
+    demod_ctx_touch(ctx);
+
+    if (samples == NULL || len == 0) {
+        return ctx;
+    }
+
+    if (copy) {
+        if (demod_ctx_reserve(ctx, len) == false) {
+            free(ctx);
+            return NULL;
+        }
+        memcpy(ctx->samples, samples, len * sizeof(int32_t));
+    } else {
+        ctx->samples = samples;
+        ctx->samples_size = len;
+    }
+    ctx->samples_len = len;
+    return ctx;
+}
+
+void demod_ctx_free(demod_ctx_t *ctx) {
+    if (ctx == NULL || ctx == &g_demod_ctx_main) {
+        return;
+    }
+
+    if (g_demod_ctx_bound == ctx) {
+        g_demod_ctx_bound = NULL;
+    }
+
+    if (ctx->owns_samples) {
+        free(ctx->samples);
+    }
+    free(ctx);
+}
+
+demod_ctx_t *demod_ctx_bind(demod_ctx_t *ctx) {
+    demod_ctx_t *prev = demod_ctx();
+    if (ctx == NULL) {
+        ctx = &g_demod_ctx_main;
+    }
+    if (ctx == prev) {
+        return prev;
+    }
+
+    // lfdemod.c keeps the signal properties per thread, the main context
+    // may be in use by several threads so its copy is per thread too
+    signal_t *sp = getSignalProperties();
+    if (prev == &g_demod_ctx_main) {
+        main_signal = *sp;
+    } else {
+        prev->signal = *sp;
+    }
+    *sp = (ctx == &g_demod_ctx_main) ? main_signal : ctx->signal;
+
+    g_demod_ctx_bound = (ctx == &g_demod_ctx_main) ? NULL : ctx;
+    return prev;
+}
+
+bool demod_ctx_reserve(demod_ctx_t *ctx, size_t len) {
+    if (ctx == NULL || ctx == &g_demod_ctx_main) {
+        return false;
+    }
+
+    if (len <= ctx->samples_size && (ctx->owns_samples || ctx->samples == NULL)) {
+        return true;
+    }
+
+    size_t size = MAX(len, ctx->samples_size);
+    int32_t *samples = calloc(size, sizeof(int32_t));
+    if (samples == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return false;
+    }
+
+    if (ctx->samples != NULL) {
+        memcpy(samples, ctx->samples, ctx->samples_len * sizeof(int32_t));
+    }
+
+    if (ctx->owns_samples) {
+        free(ctx->samples);
+    }
+
+    ctx->samples = samples;
+    ctx->samples_size = size;
+    ctx->owns_samples = true;
+    return true;
+}
+
+void demod_ctx_touch(demod_ctx_t *ctx) {
+    uint64_t gen = __atomic_add_fetch(&samples_gen, 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&ctx->samples_gen, gen, __ATOMIC_RELAXED);
+}
+
+uint64_t demod_ctx_version(demod_ctx_t *ctx) {
+    if (__atomic_load_n(&ctx->samples_gen, __ATOMIC_RELAXED) == 0) {
+        demod_ctx_touch(ctx);
+    }
+    return __atomic_load_n(&ctx->samples_gen, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,100 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Demodulation context
+//
+// Everything the LF demodulators read and write, the sample view and the
+// demod buffer, lives in a demod_ctx_t. The old names g_GraphBuffer,
+// g_GraphTraceLen, g_DemodBuffer, g_DemodBufferLen, g_DemodClock and
+// g_DemodStartIdx are macros resolving to the context bound to the calling
+// thread, or to the main context (the one the plot window shows) when none is.
+//
+// To run demodulators on another capture, or several on the same capture at
+// once, give every thread its own context:
+//
+//   demod_ctx_t *ctx = demod_ctx_new(samples, len, false);
+//   demod_ctx_t *prev = demod_ctx_bind(ctx);
+//   demodHID(false);
+//   demod_ctx_bind(prev);
+//   ... ctx->buffer / ctx->buffer_len hold the result
+//   demod_ctx_free(ctx);
+//
+// Worker contexts never touch the plot window, markers or grid.
+//-----------------------------------------------------------------------------
+
+#ifndef DEMODCTX_H__
+#define DEMODCTX_H__
+
+#include "common.h"
+#include "lfdemod.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MAX_DEMOD_BUF_LEN (1024*128)
+
+typedef struct {
+    // samples, for the main context this is the graph buffer
+    int32_t *samples;
+    size_t samples_len;
+    size_t samples_size;
+    bool owns_samples;
+    // version of the samples, a new one after every change. Unique across contexts
+    uint64_t samples_gen;
+
+    // demodulated bits, one per byte
+    uint8_t buffer[MAX_DEMOD_BUF_LEN];
+    size_t buffer_len;
+    int32_t start_idx;
+    int clock;
+
+    // signal properties (lfdemod.c) of a worker context, swapped in and out on bind
+    signal_t signal;
+} demod_ctx_t;
+
+extern demod_ctx_t g_demod_ctx_main;
+extern __thread demod_ctx_t *g_demod_ctx_bound;
+
+static inline demod_ctx_t *demod_ctx(void) {
+    return (g_demod_ctx_bound) ? g_demod_ctx_bound : &g_demod_ctx_main;
+}
+
+static inline bool demod_ctx_is_main(void) {
+    return (demod_ctx() == &g_demod_ctx_main);
+}
+
+// view on samples, or a private copy of them when copy is set.
+// samples may be NULL to start with an empty context.
+// Signal properties start as those of the calling thread
+demod_ctx_t *demod_ctx_new(int32_t *samples, size_t len, bool copy);
+void demod_ctx_free(demod_ctx_t *ctx);
+
+// make ctx the context of the calling thread, NULL goes back to the main one.
+// returns the previously bound context
+demod_ctx_t *demod_ctx_bind(demod_ctx_t *ctx);
+
+// grow the samples of a worker context, a view becomes a private copy
+bool demod_ctx_reserve(demod_ctx_t *ctx, size_t len);
+
+// the samples of ctx were changed, gives them a new version
+void demod_ctx_touch(demod_ctx_t *ctx);
+// current version of the samples of ctx
+uint64_t demod_ctx_version(demod_ctx_t *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
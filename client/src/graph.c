@@ -18,24 +18,349 @@
 #include "graph.h"
 #include <stdlib.h>
 #include <string.h>
+#include <stdio.h>
+#if !defined(_WIN32)
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+#include <pthread.h>
 #include "ui.h"
 #include "proxgui.h"
 #include "util.h"           // param_get32ex
 #include "lfdemod.h"
 #include "cmddata.h"        // for g_debugmode
 #include "commonutil.h"     // Uint4bytetomemle
+#include "graphdsp.h"
 
 
-int32_t g_GraphBuffer[MAX_GRAPH_TRACE_LEN];
-int32_t g_OperationBuffer[MAX_GRAPH_TRACE_LEN];
-int32_t g_OverlayBuffer[MAX_GRAPH_TRACE_LEN];
+int32_t *g_OperationBuffer = NULL;
+int32_t *g_OverlayBuffer = NULL;
 bool    g_useOverlays = false;
-size_t  g_GraphTraceLen;
 buffer_savestate_t g_saveState_gb;
 marker_t g_MarkerA, g_MarkerB, g_MarkerC, g_MarkerD;
 marker_t *g_TempMarkers;
 uint8_t g_TempMarkerSize = 0;
 
+// the three graph buffers share one allocation, mapped from an unlinked temp file when big
+static int32_t *graph_storage = NULL;
+static bool graph_storage_mapped = false;
+
+// a compact capture, valid while g_GraphStore says so. The int32 storage is
+// released while there is one
+uint8_t g_GraphStore = GRAPH_STORE_S32;
+static void *graph_compact = NULL;
+static size_t graph_compact_size = 0;
+static bool graph_compact_mapped = false;
+static int graph_compact_bias = 0;
+// set by setGraphBuffer(), the operation buffer gets the widened samples too
+static bool graph_compact_operation = false;
+// other threads may read the main context while it is widened
+static pthread_mutex_t graph_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void *graph_storage_alloc(size_t samples, size_t len, bool *mapped) {
+    *mapped = false;
+
+#if !defined(_WIN32)
+    if (samples >= GRAPH_MMAP_THRESHOLD) {
+        FILE *f = tmpfile();
+        if (f != NULL) {
+            void *map = NULL;
+            if (ftruncate(fileno(f), len) == 0) {
+                map = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, fileno(f), 0);
+            }
+            // the mapping keeps the file alive
+            fclose(f);
+            if (map != NULL && map != MAP_FAILED) {
+                *mapped = true;
+                return map;
+            }
+        }
+        PrintAndLogEx(DEBUG, "graph: temp file mapping failed, using heap");
+    }
+#else
+    (void)samples;
+#endif
+
+    return calloc(len, sizeof(uint8_t));
+}
+
+static void graph_storage_free(void *storage, size_t len, bool mapped) {
+    if (storage == NULL) {
+        return;
+    }
+#if !defined(_WIN32)
+    if (mapped) {
+        munmap(storage, len);
+        return;
+    }
+#else
+    (void)len;
+    (void)mapped;
+#endif
+    free(storage);
+}
+
+// double, stopping once at the device limit where most graphs end up
+static size_t graph_grow(size_t size, size_t len) {
+    size_t next = (size) ? size * 2 : GRAPH_MIN_ALLOC;
+    if (size < MAX_GRAPH_TRACE_LEN && next > MAX_GRAPH_TRACE_LEN) {
+        next = MAX_GRAPH_TRACE_LEN;
+    }
+    return MIN(MAX(next, len), MAX_GRAPH_LOAD_LEN);
+}
+
+static void graph_storage_release(void) {
+    demod_ctx_t *ctx = &g_demod_ctx_main;
+    graph_storage_free(graph_storage, ctx->samples_size * 3 * sizeof(int32_t), graph_storage_mapped);
+    graph_storage = NULL;
+    graph_storage_mapped = false;
+    ctx->samples = NULL;
+    ctx->samples_size = 0;
+    g_OperationBuffer = NULL;
+    g_OverlayBuffer = NULL;
+}
+
+// with graph_lock held
+static void graph_compact_free(void) {
+    size_t width = (g_GraphStore == GRAPH_STORE_S16) ? sizeof(int16_t) : sizeof(uint8_t);
+    graph_storage_free(graph_compact, graph_compact_size * width, graph_compact_mapped);
+    graph_compact = NULL;
+    graph_compact_size = 0;
+    graph_compact_mapped = false;
+    __atomic_store_n(&g_GraphStore, GRAPH_STORE_S32, __ATOMIC_RELEASE);
+}
+
+static void *graph_reserve_compact(size_t len, uint8_t store, int bias) {
+    if (demod_ctx_is_main() == false) {
+        return NULL;
+    }
+
+    // loaders reserve sample by sample
+    if (g_GraphStore == store && graph_compact_bias == bias && len <= graph_compact_size) {
+        return graph_compact;
+    }
+
+    // graph_reserve() of the caller says so
+    if (len > MAX_GRAPH_LOAD_LEN) {
+        return NULL;
+    }
+
+    demod_ctx_t *ctx = &g_demod_ctx_main;
+    pthread_mutex_lock(&graph_lock);
+
+    if (g_GraphStore != store || graph_compact_bias != bias) {
+        graph_compact_free();
+        graph_storage_release();
+        ctx->samples_len = 0;
+        graph_compact_bias = bias;
+        graph_compact_operation = false;
+    }
+
+    if (len > graph_compact_size) {
+        size_t width = (store == GRAPH_STORE_S16) ? sizeof(int16_t) : sizeof(uint8_t);
+        size_t size = graph_grow(graph_compact_size, len);
+        bool mapped = false;
+        void *compact = graph_storage_alloc(size, size * width, &mapped);
+        if (compact == NULL) {
+            pthread_mutex_unlock(&graph_lock);
+            PrintAndLogEx(WARNING, "Failed to allocate memory");
+            return NULL;
+        }
+
+        if (graph_compact != NULL) {
+            memcpy(compact, graph_compact, MIN(ctx->samples_len, graph_compact_size) * width);
+        }
+        graph_storage_free(graph_compact, graph_compact_size * width, graph_compact_mapped);
+        graph_compact = compact;
+        graph_compact_size = size;
+        graph_compact_mapped = mapped;
+    }
+
+    __atomic_store_n(&g_GraphStore, store, __ATOMIC_RELEASE);
+    void *compact = graph_compact;
+    pthread_mutex_unlock(&graph_lock);
+    return compact;
+}
+
+uint8_t *graph_reserve_u8(size_t len, int bias) {
+    return graph_reserve_compact(len, GRAPH_STORE_U8, bias);
+}
+
+int16_t *graph_reserve_s16(size_t len) {
+    return graph_reserve_compact(len, GRAPH_STORE_S16, 0);
+}
+
+int32_t *graph_widen(void) {
+    demod_ctx_t *ctx = &g_demod_ctx_main;
+    pthread_mutex_lock(&graph_lock);
+
+    if (g_GraphStore != GRAPH_STORE_S32) {
+        size_t size = graph_compact_size;
+        size_t len = MIN(ctx->samples_len, size);
+        bool mapped = false;
+        int32_t *storage = graph_storage_alloc(size, size * 3 * sizeof(int32_t), &mapped);
+        if (storage == NULL) {
+            PrintAndLogEx(WARNING, "Failed to allocate memory, samples dropped");
+            size = 0;
+            len = 0;
+            demod_ctx_touch(ctx);
+        } else if (g_GraphStore == GRAPH_STORE_U8) {
+            const uint8_t *src = graph_compact;
+            for (size_t i = 0; i < len; i++) {
+                storage[i] = src[i] - graph_compact_bias;
+            }
+        } else {
+            const int16_t *src = graph_compact;
+            for (size_t i = 0; i < len; i++) {
+                storage[i] = src[i];
+            }
+        }
+
+        if (storage != NULL && graph_compact_operation) {
+            memcpy(storage + size, storage, len * sizeof(int32_t));
+        }
+
+        graph_compact_free();
+        graph_storage = storage;
+        graph_storage_mapped = mapped;
+        ctx->samples = storage;
+        ctx->samples_size = size;
+        ctx->samples_len = len;
+        g_OperationBuffer = (storage) ? storage + size : NULL;
+        g_OverlayBuffer = (storage) ? storage + (2 * size) : NULL;
+    }
+
+    int32_t *samples = ctx->samples;
+    pthread_mutex_unlock(&graph_lock);
+    return samples;
+}
+
+// clamps a compact capture to +/-127 in place like dsp_to_u8(), false when there is none
+static bool graph_compact_to_u8(uint8_t *dest, size_t len) {
+    if (demod_ctx_is_main() == false) {
+        return false;
+    }
+
+    pthread_mutex_lock(&graph_lock);
+    if (g_GraphStore == GRAPH_STORE_S32) {
+        pthread_mutex_unlock(&graph_lock);
+        return false;
+    }
+
+    if (g_GraphStore == GRAPH_STORE_U8) {
+        uint8_t *src = graph_compact;
+        int bias = graph_compact_bias;
+        for (size_t i = 0; i < len; i++) {
+            int v = src[i] - bias;
+            v = (v > 127) ? 127 : v;
+            v = (v < -127) ? -127 : v;
+            src[i] = (uint8_t)(v + bias);
+            dest[i] = (uint8_t)(v + 128);
+        }
+    } else {
+        int16_t *src = graph_compact;
+        for (size_t i = 0; i < len; i++) {
+            int v = src[i];
+            v = (v > 127) ? 127 : v;
+            v = (v < -127) ? -127 : v;
+            src[i] = (int16_t)v;
+            dest[i] = (uint8_t)(v + 128);
+        }
+    }
+
+    pthread_mutex_unlock(&graph_lock);
+    return true;
+}
+
+// isGraphBitstream() of a compact capture, -1 when there is none
+static int graph_compact_is_bitstream(void) {
+    if (demod_ctx_is_main() == false) {
+        return -1;
+    }
+
+    pthread_mutex_lock(&graph_lock);
+    if (g_GraphStore == GRAPH_STORE_S32) {
+        pthread_mutex_unlock(&graph_lock);
+        return -1;
+    }
+
+    int res = 1;
+    size_t len = MIN(g_demod_ctx_main.samples_len, graph_compact_size);
+    for (size_t i = 0; i < len; i++) {
+        int v = (g_GraphStore == GRAPH_STORE_U8) ? ((uint8_t *)graph_compact)[i] - graph_compact_bias : ((int16_t *)graph_compact)[i];
+        if (v > 1 || v < 0) {
+            res = 0;
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&graph_lock);
+    return res;
+}
+
+bool graph_reserve(size_t len) {
+    if (demod_ctx_is_main() == false) {
+        return demod_ctx_reserve(demod_ctx(), len);
+    }
+
+    // writers need the int32 samples
+    if (g_GraphStore != GRAPH_STORE_S32) {
+        graph_widen();
+    }
+
+    demod_ctx_t *ctx = &g_demod_ctx_main;
+    if (len <= ctx->samples_size) {
+        return true;
+    }
+
+    if (len > MAX_GRAPH_LOAD_LEN) {
+        PrintAndLogEx(WARNING, "graph: %zu samples exceeds the maximum of %u", len, MAX_GRAPH_LOAD_LEN);
+        return false;
+    }
+
+    size_t size = graph_grow(ctx->samples_size, len);
+
+    bool mapped = false;
+    int32_t *storage = graph_storage_alloc(size, size * 3 * sizeof(int32_t), &mapped);
+    if (storage == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return false;
+    }
+
+    if (ctx->samples_size) {
+        memcpy(storage, ctx->samples, ctx->samples_size * sizeof(int32_t));
+        memcpy(storage + size, g_OperationBuffer, ctx->samples_size * sizeof(int32_t));
+        memcpy(storage + (2 * size), g_OverlayBuffer, ctx->samples_size * sizeof(int32_t));
+    }
+    graph_storage_release();
+
+    graph_storage = storage;
+    graph_storage_mapped = mapped;
+    ctx->samples = storage;
+    ctx->samples_size = size;
+    g_OperationBuffer = storage + size;
+    g_OverlayBuffer = storage + (2 * size);
+    return true;
+}
+
+void graph_free(void) {
+    demod_ctx_t *ctx = &g_demod_ctx_main;
+    pthread_mutex_lock(&graph_lock);
+    graph_compact_free();
+    graph_storage_release();
+    ctx->samples_len = 0;
+    demod_ctx_touch(ctx);
+    pthread_mutex_unlock(&graph_lock);
+}
+
+bool graph_is_mapped(void) {
+    return (g_GraphStore == GRAPH_STORE_S32) ? graph_storage_mapped : graph_compact_mapped;
+}
+
+void graph_changed(void) {
+    demod_ctx_touch(demod_ctx());
+}
+
 /* write a manchester bit to the graph
 */
 void AppendGraph(bool redraw, uint16_t clock, int bit) {
@@ -57,6 +382,10 @@ void AppendGraph(bool redraw, uint16_t clock, int bit) {
         end = MAX_GRAPH_TRACE_LEN - g_GraphTraceLen;
     }
 
+    if (graph_reserve(g_GraphTraceLen + end) == false) {
+        return;
+    }
+
     //set first half the clock bit (all 1's or 0's for a 0 or 1 bit)
     for (i = 0; i < half; ++i) {
         g_GraphBuffer[g_GraphTraceLen++] = bit;
@@ -66,6 +395,7 @@ void AppendGraph(bool redraw, uint16_t clock, int bit) {
     for (; i < end; ++i) {
         g_GraphBuffer[g_GraphTraceLen++] = bit ^ 1;
     }
+    graph_changed();
 
     if (redraw) {
         RepaintGraphWindow();
@@ -76,9 +406,27 @@ void AppendGraph(bool redraw, uint16_t clock, int bit) {
 size_t ClearGraph(bool redraw) {
     size_t gtl = g_GraphTraceLen;
 
-    memset(g_GraphBuffer, 0x00, g_GraphTraceLen);
-    memset(g_OperationBuffer, 0x00, g_GraphTraceLen);
-    memset(g_OverlayBuffer, 0x00, g_GraphTraceLen);
+    graph_changed();
+
+    // worker contexts have no plot window
+    if (demod_ctx_is_main() == false) {
+        g_GraphTraceLen = 0;
+        g_DemodBufferLen = 0;
+        return gtl;
+    }
+
+    // a compact capture goes without being widened
+    if (g_GraphStore != GRAPH_STORE_S32) {
+        pthread_mutex_lock(&graph_lock);
+        graph_compact_free();
+        pthread_mutex_unlock(&graph_lock);
+    }
+
+    if (g_demod_ctx_main.samples_size) {
+        memset(g_GraphBuffer, 0x00, g_GraphTraceLen);
+        memset(g_OperationBuffer, 0x00, g_GraphTraceLen);
+        memset(g_OverlayBuffer, 0x00, g_GraphTraceLen);
+    }
 
     g_GraphTraceLen = 0;
     g_GraphStart = 0;
@@ -106,17 +454,31 @@ void setGraphBuffer(const uint8_t *src, size_t size) {
 
     ClearGraph(false);
 
-    if (size > MAX_GRAPH_TRACE_LEN) {
-        size = MAX_GRAPH_TRACE_LEN;
+    if (size > MAX_GRAPH_LOAD_LEN) {
+        size = MAX_GRAPH_LOAD_LEN;
+    }
+
+    uint8_t *compact = graph_reserve_u8(size, 128);
+    if (compact != NULL) {
+        memcpy(compact, src, size);
+        graph_compact_operation = true;
+    } else if (graph_reserve(size)) {
+        dsp_from_u8(src, g_GraphBuffer, size);
+    } else {
+        return;
+    }
+    g_GraphTraceLen = size;
+    graph_changed();
+
+    if (demod_ctx_is_main() == false) {
+        return;
     }
 
-    for (size_t i = 0; i < size; ++i) {
-        g_GraphBuffer[i] = src[i] - 128;
-        g_OperationBuffer[i] = src[i] - 128;
+    if (compact == NULL) {
+        memcpy(g_OperationBuffer, g_GraphBuffer, size * sizeof(int));
     }
 
     remove_temporary_markers();
-    g_GraphTraceLen = size;
     RepaintGraphWindow();
 }
 
@@ -135,20 +497,16 @@ size_t getFromGraphBufferEx(uint8_t *dest, size_t maxLen) {
         return 0;
     }
 
-    size_t i;
-    maxLen = (maxLen < g_GraphTraceLen) ? maxLen : g_GraphTraceLen;
-    for (i = 0; i < maxLen; ++i) {
-        //trim
-        if (g_GraphBuffer[i] > 127) {
-            g_GraphBuffer[i] = 127;
-        }
+    // the clock detectors reuse their index over dest as long as the graph is unchanged
+    uint64_t version = demod_ctx_version(demod_ctx());
 
-        if (g_GraphBuffer[i] < -127) {
-            g_GraphBuffer[i] = -127;
-        }
-        dest[i] = (uint8_t)(g_GraphBuffer[i] + 128);
+    maxLen = (maxLen < g_GraphTraceLen) ? maxLen : g_GraphTraceLen;
+    //trim to +/-127
+    if (graph_compact_to_u8(dest, maxLen) == false) {
+        dsp_to_u8(g_GraphBuffer, dest, maxLen);
     }
-    return i;
+    lf_samples_version(dest, maxLen, version);
+    return maxLen;
 }
 
 //TODO: In progress function to get chunks of data from the GB w/o modifying the GB
@@ -195,6 +553,11 @@ bool HasGraphData(void) {
 }
 
 bool isGraphBitstream(void) {
+    int compact = graph_compact_is_bitstream();
+    if (compact >= 0) {
+        return (compact == 1);
+    }
+
     // convert to bitstream if necessary
     for (int i = 0; i < g_GraphTraceLen; i++) {
         if (g_GraphBuffer[i] > 1 || g_GraphBuffer[i] < 0) {
@@ -218,6 +581,7 @@ void convertGraphFromBitstreamEx(int hi, int low) {
         else
             g_GraphBuffer[i] = 0;
     }
+    graph_changed();
 
     uint8_t *bits = calloc(g_GraphTraceLen, sizeof(uint8_t));
     if (bits == NULL) {
@@ -257,7 +621,7 @@ int GetAskClock(const char *str, bool verbose) {
         return -1;
     }
 
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBufferEx(bits, MAX_GRAPH_TRACE_LEN);
     if (size == 0) {
         PrintAndLogEx(WARNING, "Failed to copy from graphbuffer");
         free(bits);
@@ -294,7 +658,7 @@ int GetPskCarrier(bool verbose) {
         return -1;
     }
 
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBufferEx(bits, MAX_GRAPH_TRACE_LEN);
     if (size == 0) {
         PrintAndLogEx(WARNING, "Failed to copy from graphbuffer");
         free(bits);
@@ -338,7 +702,7 @@ int GetPskClock(const char *str, bool verbose) {
         return -1;
     }
 
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBufferEx(bits, MAX_GRAPH_TRACE_LEN);
     if (size == 0) {
         PrintAndLogEx(WARNING, "Failed to copy from graphbuffer");
         free(bits);
@@ -380,7 +744,7 @@ int GetNrzClock(const char *str, bool verbose) {
         return -1;
     }
 
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBufferEx(bits, MAX_GRAPH_TRACE_LEN);
     if (size == 0) {
         PrintAndLogEx(WARNING, "Failed to copy from graphbuffer");
         free(bits);
@@ -441,7 +805,7 @@ bool fskClocks(uint8_t *fc1, uint8_t *fc2, uint8_t *rf1, int *firstClockEdge) {
         return false;
     }
 
-    size_t size = getFromGraphBuffer(bits);
+    size_t size = getFromGraphBufferEx(bits, MAX_GRAPH_TRACE_LEN);
     if (size == 0) {
         PrintAndLogEx(WARNING, "Failed to copy from graphbuffer");
         free(bits);
@@ -469,6 +833,10 @@ bool fskClocks(uint8_t *fc1, uint8_t *fc2, uint8_t *rf1, int *firstClockEdge) {
 }
 
 void add_temporary_marker(uint32_t position, const char *label) {
+    if (demod_ctx_is_main() == false) {
+        return;
+    }
+
     if (g_TempMarkerSize == 0) { //Initialize the marker array
 
         g_TempMarkers = (marker_t *)calloc(1, sizeof(marker_t));
@@ -511,6 +879,7 @@ void add_temporary_marker(uint32_t position, const char *label) {
 }
 
 void remove_temporary_markers(void) {
+    if (demod_ctx_is_main() == false) return;
     if (g_TempMarkerSize == 0) return;
 
     memset(g_TempMarkers, 0x00, (g_TempMarkerSize * sizeof(marker_t)));
@@ -540,7 +909,46 @@ buffer_savestate_t save_buffer32(uint32_t *src, size_t length) {
     return bst;
 }
 
+// ADC samples fit in a byte, keep those packed four to a word
+#define SAVESTATE_TYPE_S8_PACKED    (0x80 | sizeof(int8_t))
+
+static buffer_savestate_t save_bufferS8_packed(const int32_t *src, size_t length) {
+    size_t buffSize = (length + 3) / 4;
+
+    uint32_t *savedBuffer = (uint32_t *)calloc(buffSize, sizeof(uint32_t));
+    if (savedBuffer == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        buffer_savestate_t bst = {0};
+        return bst;
+    }
+
+    for (size_t i = 0; i < length; i++) {
+        savedBuffer[i / 4] |= (uint32_t)(uint8_t)src[i] << (8 * (i % 4));
+    }
+
+    buffer_savestate_t bst = {
+        .type = SAVESTATE_TYPE_S8_PACKED,
+        .bufferSize = buffSize,
+        .buffer = savedBuffer,
+        .padding = ((buffSize * 4) - length)
+    };
+
+    return bst;
+}
+
 buffer_savestate_t save_bufferS32(int32_t *src, size_t length) {
+
+    bool fits8 = true;
+    for (size_t i = 0; i < length; i++) {
+        if (src[i] < INT8_MIN || src[i] > INT8_MAX) {
+            fits8 = false;
+            break;
+        }
+    }
+    if (fits8) {
+        return save_bufferS8_packed(src, length);
+    }
+
     //calloc the memory needed
     uint32_t *savedBuffer = (uint32_t *)calloc(length, (sizeof(uint32_t)));
     if (savedBuffer == NULL) {
@@ -613,6 +1021,14 @@ size_t restore_buffer32(buffer_savestate_t saveState, uint32_t *dest) {
 }
 
 size_t restore_bufferS32(buffer_savestate_t saveState, int32_t *dest) {
+    if (saveState.type == SAVESTATE_TYPE_S8_PACKED) {
+        size_t length = ((saveState.bufferSize * 4) - saveState.padding);
+        for (size_t i = 0; i < length; i++) {
+            dest[i] = (int8_t)(saveState.buffer[i / 4] >> (8 * (i % 4)));
+        }
+        return length;
+    }
+
     if (saveState.type != (sizeof(int32_t) >> 8)) {
         PrintAndLogEx(WARNING, "Invalid Save State type! Expected int32_t");
         PrintAndLogEx(WARNING, "Buffer not modified!\n");
@@ -648,3 +1064,71 @@ size_t restore_buffer8(buffer_savestate_t saveState, uint8_t *dest) {
 
     return index;
 }
+
+// compact graph samples as they are, bias in the save state
+#define SAVESTATE_TYPE_GRAPH_U8     (0x40 | sizeof(uint8_t))
+#define SAVESTATE_TYPE_GRAPH_S16    (0x40 | sizeof(int16_t))
+
+buffer_savestate_t graph_save(void) {
+    if (demod_ctx_is_main() == false) {
+        return save_bufferS32(g_GraphBuffer, g_GraphTraceLen);
+    }
+
+    pthread_mutex_lock(&graph_lock);
+    if (g_GraphStore == GRAPH_STORE_S32) {
+        pthread_mutex_unlock(&graph_lock);
+        return save_bufferS32(g_GraphBuffer, g_GraphTraceLen);
+    }
+
+    size_t width = (g_GraphStore == GRAPH_STORE_S16) ? sizeof(int16_t) : sizeof(uint8_t);
+    size_t len = MIN(g_demod_ctx_main.samples_len, graph_compact_size) * width;
+    size_t buffSize = (len + 3) / 4;
+
+    uint32_t *savedBuffer = (uint32_t *)calloc(buffSize, sizeof(uint32_t));
+    if (savedBuffer == NULL) {
+        pthread_mutex_unlock(&graph_lock);
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        buffer_savestate_t bst = {0};
+        return bst;
+    }
+    memcpy(savedBuffer, graph_compact, len);
+
+    buffer_savestate_t bst = {
+        .type = (g_GraphStore == GRAPH_STORE_S16) ? SAVESTATE_TYPE_GRAPH_S16 : SAVESTATE_TYPE_GRAPH_U8,
+        .bufferSize = buffSize,
+        .buffer = savedBuffer,
+        .padding = ((buffSize * 4) - len),
+        .bias = graph_compact_bias
+    };
+
+    pthread_mutex_unlock(&graph_lock);
+    return bst;
+}
+
+void graph_restore(buffer_savestate_t saveState) {
+    if (saveState.type != SAVESTATE_TYPE_GRAPH_U8 && saveState.type != SAVESTATE_TYPE_GRAPH_S16) {
+        restore_bufferS32(saveState, g_GraphBuffer);
+        graph_changed();
+        return;
+    }
+
+    bool is_u8 = (saveState.type == SAVESTATE_TYPE_GRAPH_U8);
+    size_t width = (is_u8) ? sizeof(uint8_t) : sizeof(int16_t);
+    size_t length = ((saveState.bufferSize * 4) - saveState.padding) / width;
+
+    // back into the compact capture while it is one, the plot buffers of a widened one stay
+    void *compact = NULL;
+    if (g_GraphStore == ((is_u8) ? GRAPH_STORE_U8 : GRAPH_STORE_S16) && graph_compact_bias == saveState.bias) {
+        compact = (is_u8) ? (void *)graph_reserve_u8(length, saveState.bias) : (void *)graph_reserve_s16(length);
+    }
+
+    if (compact != NULL) {
+        memcpy(compact, saveState.buffer, length * width);
+    } else if (graph_reserve(length)) {
+        int32_t *dest = g_GraphBuffer;
+        for (size_t i = 0; i < length; i++) {
+            dest[i] = (is_u8) ? ((const uint8_t *)saveState.buffer)[i] - saveState.bias : ((const int16_t *)saveState.buffer)[i];
+        }
+    }
+    graph_changed();
+}
@@ -20,6 +20,7 @@
 #define GRAPH_H__
 
 #include "common.h"
+#include "demodctx.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,6 +33,7 @@ typedef struct {
     const uint8_t  padding;    // The amount of padding at the end of the buffer, if needed
     uint32_t       offset;     // (optional) Any offset the buffer needs after restoring
     uint32_t       clock;      // (optional) Clock data for the buffer
+    int16_t        bias;       // (optional) Bias of compact graph samples, see graph_save()
 } buffer_savestate_t;
 
 typedef struct {
@@ -66,16 +68,67 @@ buffer_savestate_t save_buffer8(uint8_t *src, size_t length);
 size_t restore_buffer32(buffer_savestate_t saveState, uint32_t *dest);
 size_t restore_bufferS32(buffer_savestate_t saveState, int32_t *dest);
 size_t restore_buffer8(buffer_savestate_t saveState, uint8_t *dest);
+// save / restore the samples of the graph, a compact capture is saved as it is
+// instead of being widened. The length of the graph is not restored
+buffer_savestate_t graph_save(void);
+void graph_restore(buffer_savestate_t saveState);
 
+// The graph buffers are allocated on first use and grow on demand.
+// Samples from the device and the demodulators stay within MAX_GRAPH_TRACE_LEN,
+// only captures loaded from file may go up to MAX_GRAPH_LOAD_LEN. From
+// GRAPH_MMAP_THRESHOLD samples the storage, compact or not, is a temp file
+// mapping instead of heap.
 #define MAX_GRAPH_TRACE_LEN (40000 * 32)
+#define MAX_GRAPH_LOAD_LEN (256 * 1024 * 1024)
+#define GRAPH_MMAP_THRESHOLD (16 * 1024 * 1024)
+#define GRAPH_MIN_ALLOC (64 * 1024)
 #define GRAPH_SAVE 1
 #define GRAPH_RESTORE 0
 
-extern int32_t g_GraphBuffer[MAX_GRAPH_TRACE_LEN];
-extern int32_t g_OperationBuffer[MAX_GRAPH_TRACE_LEN];
-extern int32_t g_OverlayBuffer[MAX_GRAPH_TRACE_LEN];
+// make room for len samples in all three buffers, existing samples are kept.
+// In a worker demod context only its own samples grow.
+bool graph_reserve(size_t len);
+void graph_free(void);
+bool graph_is_mapped(void);
+// to call after writing to g_GraphBuffer or changing g_GraphTraceLen directly,
+// the LF clock detectors reuse their edge index until the samples change
+void graph_changed(void);
+
+// A capture in the main context is stored compact until a command needs its
+// samples as int32: 8 bit ADC samples as uint8_t, traces loaded from file as
+// int16_t when they fit. The first use of g_GraphBuffer widens them, from then
+// on the int32 samples are the only copy. getFromGraphBuffer() reads compact
+// samples directly, the LF demodulators never widen a capture.
+#define GRAPH_STORE_S32 0
+#define GRAPH_STORE_U8  1
+#define GRAPH_STORE_S16 2
+
+extern uint8_t g_GraphStore;
+
+// compact samples of the main context, fill them and set g_GraphTraceLen after.
+// Samples stored the same way are kept, otherwise the graph starts out empty.
+// uint8_t sample s stands for s - bias. NULL in a worker context or without
+// memory, write to g_GraphBuffer then
+uint8_t *graph_reserve_u8(size_t len, int bias);
+int16_t *graph_reserve_s16(size_t len);
+// int32 samples of the main context, widens a compact capture
+int32_t *graph_widen(void);
+
+// samples of the demod context bound to the calling thread, see demodctx.h
+static inline int32_t *graph_samples(void) {
+    demod_ctx_t *ctx = demod_ctx();
+    if (ctx == &g_demod_ctx_main && __atomic_load_n(&g_GraphStore, __ATOMIC_ACQUIRE) != GRAPH_STORE_S32) {
+        return graph_widen();
+    }
+    return ctx->samples;
+}
+
+#define g_GraphBuffer   (graph_samples())
+#define g_GraphTraceLen (demod_ctx()->samples_len)
+
+extern int32_t *g_OperationBuffer;
+extern int32_t *g_OverlayBuffer;
 extern bool    g_useOverlays;
-extern size_t  g_GraphTraceLen;
 
 extern marker_t g_MarkerA, g_MarkerB, g_MarkerC, g_MarkerD;
 extern marker_t *g_TempMarkers;
@@ -0,0 +1,715 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Graph buffer DSP kernels
+//
+// The element wise kernels in graphdsp_core.h are instantiated once per
+// instruction set and vector width, like the bitsliced crypto1, and picked at
+// runtime with the hardnested SIMD detection. Filters with a loop carried
+// state (iir, envelope, the fill step of dirthreshold) stay scalar.
+//-----------------------------------------------------------------------------
+
+#include "graphdsp.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+
+#include "ui.h"
+#include "commonutil.h"     // ARRAYLEN
+#include "util_posix.h"
+#include "hardnested_bf_core.h"   // SIMD detection
+
+typedef struct {
+    void (*minmax)(const int *, size_t, int *, int *);
+    int64_t (*sum)(const int *, size_t);
+    void (*scale)(int *, size_t, int, int);
+    void (*to_u8)(int *, uint8_t *, size_t);
+    void (*from_u8)(const uint8_t *, int *, size_t);
+    void (*zero_band)(const int *, int *, size_t, int, int);
+    void (*dir_codes)(const int *, size_t, int, int, int, int *);
+    const char *name;
+} dsp_impl_t;
+
+#define DSP_CAT_(a, b)  a##b
+#define DSP_CAT(a, b)   DSP_CAT_(a, b)
+#define DSP_FN(name)    DSP_CAT(name, DSP_SUFFIX)
+
+#if defined(COMPILER_HAS_SIMD_AVX512)
+#define DSP_TARGET  __attribute__((target("avx512f")))
+#define DSP_SUFFIX  AVX512
+#define DSP_VEC     64
+#define DSP_NAME    "AVX512"
+#include "graphdsp_core.h"
+#undef DSP_TARGET
+#undef DSP_SUFFIX
+#undef DSP_NAME
+#undef DSP_VEC
+#endif
+
+#if defined(COMPILER_HAS_SIMD_X86)
+#define DSP_TARGET  __attribute__((target("avx2")))
+#define DSP_SUFFIX  AVX2
+#define DSP_VEC     32
+#define DSP_NAME    "AVX2"
+#include "graphdsp_core.h"
+#undef DSP_TARGET
+#undef DSP_SUFFIX
+#undef DSP_NAME
+#undef DSP_VEC
+
+#define DSP_TARGET  __attribute__((target("sse2")))
+#define DSP_SUFFIX  SSE2
+#define DSP_VEC     16
+#define DSP_NAME    "SSE2"
+#include "graphdsp_core.h"
+#undef DSP_TARGET
+#undef DSP_SUFFIX
+#undef DSP_NAME
+#undef DSP_VEC
+#endif
+
+#if defined(COMPILER_HAS_SIMD_NEON)
+#define DSP_TARGET
+#define DSP_SUFFIX  NEON
+#define DSP_VEC     16
+#define DSP_NAME    "NEON"
+#include "graphdsp_core.h"
+#undef DSP_TARGET
+#undef DSP_SUFFIX
+#undef DSP_NAME
+#undef DSP_VEC
+#endif
+
+#define DSP_TARGET
+#define DSP_SUFFIX  NOSIMD
+#define DSP_VEC     0
+#define DSP_NAME    "no SIMD"
+#include "graphdsp_core.h"
+#undef DSP_TARGET
+#undef DSP_SUFFIX
+#undef DSP_NAME
+#undef DSP_VEC
+
+static const dsp_impl_t *dsp_select(void) {
+    switch (GetSIMDInstrAuto()) {
+#if defined(COMPILER_HAS_SIMD_AVX512)
+        case SIMD_AVX512:
+            return &dsp_impl_AVX512;
+#endif
+#if defined(COMPILER_HAS_SIMD_X86)
+        case SIMD_AVX2:
+            return &dsp_impl_AVX2;
+        // AVX1 has no 256 bit integer ops
+        case SIMD_AVX:
+        case SIMD_SSE2:
+            return &dsp_impl_SSE2;
+        case SIMD_MMX:
+            return &dsp_impl_NOSIMD;
+#endif
+#if defined(COMPILER_HAS_SIMD_NEON)
+        case SIMD_NEON:
+            return &dsp_impl_NEON;
+#endif
+        case SIMD_AUTO:
+        case SIMD_NONE:
+        default:
+            return &dsp_impl_NOSIMD;
+    }
+}
+
+const char *dsp_instr(void) {
+    return dsp_select()->name;
+}
+
+void dsp_minmax(const int *in, size_t len, int *min, int *max) {
+    dsp_select()->minmax(in, len, min, max);
+}
+
+int64_t dsp_sum(const int *in, size_t len) {
+    return dsp_select()->sum(in, len);
+}
+
+static void normalize(const dsp_impl_t *impl, int *data, size_t len, int min, int max) {
+    if (max == min) {
+        return;
+    }
+
+    const int mid = (max + min) / 2;
+    const int range = max - min;
+
+    // min / max may come from part of the buffer only, check the
+    // whole of it fits the double path before taking it
+    int lo, hi;
+    impl->minmax(data, len, &lo, &hi);
+    int64_t worst = MAX((int64_t)hi - mid, (int64_t)mid - lo) * 256;
+    if (range > 0 && worst < (1LL << 52) && (worst / range) < INT_MAX) {
+        impl->scale(data, len, mid, range);
+        return;
+    }
+
+    for (size_t i = 0; i < len; ++i) {
+        data[i] = ((int64_t)(data[i] - mid) * 256) / range;
+    }
+}
+
+void dsp_normalize(int *data, size_t len, int min, int max) {
+    normalize(dsp_select(), data, len, min, max);
+}
+
+void dsp_to_u8(int *data, uint8_t *dest, size_t len) {
+    dsp_select()->to_u8(data, dest, len);
+}
+
+void dsp_from_u8(const uint8_t *src, int *dest, size_t len) {
+    dsp_select()->from_u8(src, dest, len);
+}
+
+static void center_threshold(const dsp_impl_t *impl, const int *in, int *out, size_t len, int up, int down) {
+    if (len < 5) {
+        return;
+    }
+
+    impl->zero_band(in, out, len, up, down);
+
+    // clean out spikes, zeroes cascade forward so this one stays scalar
+    for (size_t i = 2; i < len - 2; ++i) {
+
+        int a = out[i - 2] + out[i - 1];
+        int b = out[i + 2] + out[i + 1];
+        if (a == 0 && b == 0) {
+            out[i] = 0;
+        }
+    }
+}
+
+void dsp_center_threshold(const int *in, int *out, size_t len, int up, int down) {
+    center_threshold(dsp_select(), in, out, len, up, down);
+}
+
+#define DSP_BLOCK   4096
+
+static void directional_threshold(const dsp_impl_t *impl, const int *in, int *out, size_t len, int up, int down) {
+    if (len < 2) {
+        return;
+    }
+
+    int lastValue = in[0];
+
+    // Will be changed at the end, but init 0 as we adjust to last samples
+    // value if no threshold kicks in.
+    out[0] = 0;
+
+    if (in != out) {
+        // previous value comes from out, keep the plain loop
+        for (size_t i = 1; i < len; ++i) {
+            if (in[i] >= up && in[i] > lastValue) {
+                lastValue = out[i];
+                out[i] = 1;
+            } else if (in[i] <= down && in[i] < lastValue) {
+                lastValue = out[i];
+                out[i] = -1;
+            } else {
+                lastValue = out[i];
+                out[i] = out[i - 1];
+            }
+        }
+        out[0] = out[1];
+        return;
+    }
+
+    // in place the previous value is the previous input sample, so the
+    // rising / falling decisions are taken a block ahead of the writes
+    int code[DSP_BLOCK];
+    int v = out[0];
+    for (size_t i = 1; i < len;) {
+        size_t n = MIN(len - i, DSP_BLOCK);
+        impl->dir_codes(in + i, n, lastValue, up, down, code);
+        lastValue = in[i + n - 1];
+
+        // branch free, codes of a noisy capture are unpredictable
+        for (size_t k = 0; k < n; k++, i++) {
+            int keep = (code[k] == 0) ? -1 : 0;
+            v = (v & keep) | (code[k] & ~keep);
+            out[i] = v;
+        }
+    }
+
+    // Align with first edited sample.
+    out[0] = out[1];
+}
+
+void dsp_directional_threshold(const int *in, int *out, size_t len, int up, int down) {
+    directional_threshold(dsp_select(), in, out, len, up, down);
+}
+
+void dsp_iir_simple(int *data, size_t len, uint8_t k) {
+// ref: http://www.edn.com/design/systems-design/4320010/A-simple-software-lowpass-filter-suits-embedded-system-applications
+// parameter K
+#define FILTER_SHIFT 4
+
+    int32_t filter_reg = 0;
+    int8_t shift = (k <= 8) ? k : FILTER_SHIFT;
+
+    for (size_t i = 0; i < len; ++i) {
+        // Update filter with current sample
+        filter_reg = filter_reg - (filter_reg >> shift) + data[i];
+
+        // Scale output for unity gain
+        data[i] = filter_reg >> shift;
+    }
+}
+
+void dsp_envelope_square(const int *in, int *out, size_t len) {
+    if (len < 10) {
+        return;
+    }
+
+    size_t i = 0;
+    while (i < len - 8) {
+
+        if (in[i] == 0 && in[i + 1] == 0 && in[i + 2] == 0 && in[i + 3] == 0 &&
+                in[i + 4] == 0 && in[i + 5] == 0 && in[i + 6] == 0 && in[i + 7] == 0) {
+
+            i += 8;
+            continue;
+        }
+
+        out[i] = 255;
+        i++;
+    }
+}
+
+size_t dsp_decimate(int *data, size_t len, int n) {
+    if (n < 1) {
+        return len;
+    }
+
+    for (size_t i = 0; i < (len / n); ++i) {
+        data[i] = data[i * n];
+    }
+    return len / n;
+}
+
+// in place radix 2, n a power of two.  w holds the twiddles of every
+// stage back to back, the m point stage starts at m / 2 - 1
+static void dsp_fft(double *re, double *im, size_t n, const double *wr, const double *wi) {
+
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+
+        if (i < j) {
+            double t = re[i];
+            re[i] = re[j];
+            re[j] = t;
+            t = im[i];
+            im[i] = im[j];
+            im[j] = t;
+        }
+    }
+
+    for (size_t m = 2; m <= n; m <<= 1) {
+        size_t half = m >> 1;
+        const double *swr = wr + half - 1;
+        const double *swi = wi + half - 1;
+        for (size_t i = 0; i < n; i += m) {
+            double *ar = re + i, *ai = im + i;
+            double *br = ar + half, *bi = ai + half;
+            for (size_t k = 0; k < half; k++) {
+                double tr = (br[k] * swr[k]) - (bi[k] * swi[k]);
+                double ti = (br[k] * swi[k]) + (bi[k] * swr[k]);
+                br[k] = ar[k] - tr;
+                bi[k] = ai[k] - ti;
+                ar[k] += tr;
+                ai[k] += ti;
+            }
+        }
+    }
+}
+
+static void autocovariance_direct(const int *in, size_t len, double mean, size_t lags, double *out) {
+    for (size_t i = 0; i < lags; ++i) {
+        double autocv = 0.0;
+        for (size_t j = 0; j < (len - i); j++) {
+            autocv += (in[j] - mean) * (in[j + i] - mean);
+        }
+        out[i] = autocv;
+    }
+}
+
+int dsp_autocovariance(const int *in, size_t len, double mean, size_t lags, double *out) {
+    if (lags > len) {
+        lags = len;
+    }
+
+    if (lags == 0) {
+        return PM3_SUCCESS;
+    }
+
+    // correlate around an integer close to the mean, the sums of products
+    // are then integers and come out of the FFT exact after rounding
+    int lo, hi;
+    dsp_minmax(in, len, &lo, &hi);
+    double cd = floor(mean);
+    int64_t c = (cd < lo) ? lo : (cd > hi) ? hi : (int64_t)cd;
+    double maxabs = (double)MAX(hi - c, c - lo);
+
+    size_t n = 1;
+    uint8_t bits = 0;
+    while (n < len + lags) {
+        n <<= 1;
+        bits++;
+    }
+
+    // rounding error of the FFT grows with the energy and the depth
+    if (maxabs * maxabs * (double)len * (bits + 1) > (double)(1ULL << 44)) {
+        autocovariance_direct(in, len, mean, lags, out);
+        return PM3_SUCCESS;
+    }
+
+    double *re = calloc(n, sizeof(double));
+    double *im = calloc(n, sizeof(double));
+    double *wr = calloc(n, sizeof(double));
+    double *wi = calloc(n, sizeof(double));
+    if (re == NULL || im == NULL || wr == NULL || wi == NULL) {
+        free(re);
+        free(im);
+        free(wr);
+        free(wi);
+        // slow but needs no memory
+        autocovariance_direct(in, len, mean, lags, out);
+        return PM3_SUCCESS;
+    }
+
+    // largest stage last, the others take every 2nd, 4th .. of it
+    for (size_t k = 0; k < n / 2; k++) {
+        wr[n / 2 - 1 + k] = cos(2.0 * M_PI * k / n);
+        wi[n / 2 - 1 + k] = -sin(2.0 * M_PI * k / n);
+    }
+    for (size_t half = n / 4; half > 0; half >>= 1) {
+        for (size_t k = 0; k < half; k++) {
+            wr[half - 1 + k] = wr[(2 * half) - 1 + (2 * k)];
+            wi[half - 1 + k] = wi[(2 * half) - 1 + (2 * k)];
+        }
+    }
+
+    int64_t total = 0;
+    for (size_t j = 0; j < len; j++) {
+        re[j] = (double)(in[j] - c);
+        total += in[j] - c;
+    }
+
+    // |X|^2 is real and even, a second forward transform gives n times the
+    // circular autocorrelation, no wrap around since n >= len + lags
+    dsp_fft(re, im, n, wr, wi);
+    for (size_t k = 0; k < n; k++) {
+        re[k] = (re[k] * re[k]) + (im[k] * im[k]);
+        im[k] = 0;
+    }
+    dsp_fft(re, im, n, wr, wi);
+
+    // sum (x[j] - d)(x[j + i] - d) with x = in - c, d = mean - c
+    const double d = mean - (double)c;
+    int64_t head = total;   // x[0] .. x[len - i - 1]
+    int64_t tail = total;   // x[i] .. x[len - 1]
+    for (size_t i = 0; i < lags; i++) {
+        double r = nearbyint(re[i] / n);
+        out[i] = r - (d * (double)(head + tail)) + ((double)(len - i) * d * d);
+        head -= in[len - 1 - i] - c;
+        tail -= in[i] - c;
+    }
+
+    free(re);
+    free(im);
+    free(wr);
+    free(wi);
+    return PM3_SUCCESS;
+}
+
+//-----------------------------------------------------------------------------
+// data bench
+//-----------------------------------------------------------------------------
+
+typedef struct {
+    const int *src;
+    int *work;
+    uint8_t *u8;
+    int64_t val;
+    size_t n;
+} dsp_bench_t;
+
+static void bench_minmax(const dsp_impl_t *impl, dsp_bench_t *b) {
+    int lo, hi;
+    impl->minmax(b->work, b->n, &lo, &hi);
+    b->val = (int64_t)(((uint64_t)(uint32_t)lo << 32) | (uint32_t)hi);
+}
+
+static void bench_sum(const dsp_impl_t *impl, dsp_bench_t *b) {
+    b->val = impl->sum(b->work, b->n);
+}
+
+static void bench_norm(const dsp_impl_t *impl, dsp_bench_t *b) {
+    int lo, hi;
+    impl->minmax(b->work + 10, b->n - 10, &lo, &hi);
+    normalize(impl, b->work, b->n, lo, hi);
+}
+
+static void bench_to_u8(const dsp_impl_t *impl, dsp_bench_t *b) {
+    impl->to_u8(b->work, b->u8, b->n);
+}
+
+static void bench_from_u8(const dsp_impl_t *impl, dsp_bench_t *b) {
+    impl->from_u8(b->u8, b->work, b->n);
+}
+
+static void bench_cthreshold(const dsp_impl_t *impl, dsp_bench_t *b) {
+    center_threshold(impl, b->work, b->work, b->n, 20, -20);
+}
+
+static void bench_dirthreshold(const dsp_impl_t *impl, dsp_bench_t *b) {
+    directional_threshold(impl, b->work, b->work, b->n, 20, -20);
+}
+
+static void bench_iir(const dsp_impl_t *impl, dsp_bench_t *b) {
+    (void)impl;
+    dsp_iir_simple(b->work, b->n, 2);
+}
+
+static void bench_envelope(const dsp_impl_t *impl, dsp_bench_t *b) {
+    (void)impl;
+    dsp_envelope_square(b->work, b->work, b->n);
+}
+
+static void bench_decimate(const dsp_impl_t *impl, dsp_bench_t *b) {
+    (void)impl;
+    b->val = dsp_decimate(b->work, b->n, 2);
+}
+
+typedef struct {
+    const char *name;
+    void (*fn)(const dsp_impl_t *, dsp_bench_t *);
+    bool simd;
+} dsp_bench_kernel_t;
+
+static const dsp_bench_kernel_t dsp_bench_kernels[] = {
+    { "minmax",       bench_minmax,       true  },
+    { "sum",          bench_sum,          true  },
+    { "norm",         bench_norm,         true  },
+    { "to u8",        bench_to_u8,        true  },
+    { "from u8",      bench_from_u8,      true  },
+    { "cthreshold",   bench_cthreshold,   true  },
+    { "dirthreshold", bench_dirthreshold, true  },
+    { "iir",          bench_iir,          false },
+    { "envelope",     bench_envelope,     false },
+    { "decimate",     bench_decimate,     false },
+};
+
+#define DSP_BENCH_RUNS  5
+
+// best of a few runs, in Msamples/s
+static double bench_run(const dsp_bench_kernel_t *k, const dsp_impl_t *impl, dsp_bench_t *b) {
+    uint64_t best = UINT64_MAX;
+    for (uint8_t r = 0; r < DSP_BENCH_RUNS; r++) {
+        memcpy(b->work, b->src, b->n * sizeof(int));
+        for (size_t i = 0; i < b->n; i++) {
+            b->u8[i] = (uint8_t)(b->src[i] + 128);
+        }
+        b->val = 0;
+
+        uint64_t t1 = usclock();
+        k->fn(impl, b);
+        t1 = usclock() - t1;
+        best = MIN(best, t1);
+    }
+
+    if (best == 0) {
+        best = 1;
+    }
+    return (double)b->n / (double)best;
+}
+
+int dsp_bench(size_t n) {
+
+    if (n < 1024) {
+        n = 1024;
+    }
+
+    // ASK like capture, a 64 bit message repeating at RF/32 with noise and a DC offset
+    int *src = calloc(n, sizeof(int));
+    int *work = calloc(n, sizeof(int));
+    int *ref = calloc(n, sizeof(int));
+    uint8_t *u8 = calloc(n, sizeof(uint8_t));
+    uint8_t *ref_u8 = calloc(n, sizeof(uint8_t));
+    if (src == NULL || work == NULL || ref == NULL || u8 == NULL || ref_u8 == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(src);
+        free(work);
+        free(ref);
+        free(u8);
+        free(ref_u8);
+        return PM3_EMALLOC;
+    }
+
+    const uint64_t msg = 0x1D555955A5A6A5A5ULL;
+    uint32_t lcg = 0x1BADF00D;
+    for (size_t i = 0; i < n; i++) {
+        lcg = lcg * 1103515245 + 12345;
+        int noise = (int)((lcg >> 16) & 0x1F) - 16;
+        int bit = (msg >> ((i / 32) & 63)) & 1;
+        src[i] = 20 + ((bit) ? 100 : -100) + noise;
+    }
+
+    const dsp_impl_t *impls[] = {
+#if defined(COMPILER_HAS_SIMD_AVX512)
+        &dsp_impl_AVX512,
+#endif
+#if defined(COMPILER_HAS_SIMD_X86)
+        &dsp_impl_AVX2,
+        &dsp_impl_SSE2,
+#endif
+#if defined(COMPILER_HAS_SIMD_NEON)
+        &dsp_impl_NEON,
+#endif
+        &dsp_impl_NOSIMD,
+    };
+    const SIMDExecInstr instrs[] = {
+#if defined(COMPILER_HAS_SIMD_AVX512)
+        SIMD_AVX512,
+#endif
+#if defined(COMPILER_HAS_SIMD_X86)
+        SIMD_AVX2,
+        SIMD_SSE2,
+#endif
+#if defined(COMPILER_HAS_SIMD_NEON)
+        SIMD_NEON,
+#endif
+        SIMD_NONE,
+    };
+
+    // only what this CPU runs, lower enum is the larger instruction set
+    SIMDExecInstr best = GetSIMDInstrAuto();
+    size_t first = 0;
+    while (first < ARRAYLEN(instrs) - 1 && instrs[first] < best) {
+        first++;
+    }
+
+    PrintAndLogEx(INFO, "Synthetic capture... " _YELLOW_("%zu") " samples", n);
+    PrintAndLogEx(INFO, "Kernels use....... " _YELLOW_("%s"), dsp_instr());
+    PrintAndLogEx(NORMAL, "");
+
+    char line[200] = {0};
+    int pos = snprintf(line, sizeof(line), "%-14s", "Msamples/s");
+    for (size_t i = ARRAYLEN(impls); i > first; i--) {
+        pos += snprintf(line + pos, sizeof(line) - pos, " %10s", impls[i - 1]->name);
+    }
+    PrintAndLogEx(INFO, "%s", line);
+    PrintAndLogEx(INFO, "-------------------------------------------------------------");
+
+    dsp_bench_t b = { .src = src, .work = work, .u8 = u8, .n = n };
+
+    bool match = true;
+    for (size_t k = 0; k < ARRAYLEN(dsp_bench_kernels); k++) {
+        const dsp_bench_kernel_t *kernel = &dsp_bench_kernels[k];
+
+        pos = snprintf(line, sizeof(line), "%-14s", kernel->name);
+
+        // scalar instance first, it is the reference
+        pos += snprintf(line + pos, sizeof(line) - pos, " %10.1f", bench_run(kernel, &dsp_impl_NOSIMD, &b));
+        memcpy(ref, work, n * sizeof(int));
+        memcpy(ref_u8, u8, n);
+        int64_t ref_val = b.val;
+
+        if (kernel->simd) {
+            for (size_t i = ARRAYLEN(impls) - 1; i > first; i--) {
+                pos += snprintf(line + pos, sizeof(line) - pos, " %10.1f", bench_run(kernel, impls[i - 1], &b));
+
+                if (memcmp(ref, work, n * sizeof(int)) || memcmp(ref_u8, u8, n) || ref_val != b.val) {
+                    PrintAndLogEx(FAILED, "%s ( %s ) differs from the scalar kernel", kernel->name, impls[i - 1]->name);
+                    match = false;
+                }
+            }
+        }
+        PrintAndLogEx(INFO, "%s", line);
+    }
+
+    // autocorrelation, direct sums are quadratic so compare on a slice
+    size_t slice = MIN(n, 16384);
+    size_t lags = slice - MIN(slice / 4, 4000);
+    int64_t sum = dsp_sum(src, slice);
+    double mean = (double)sum / slice;
+    double *ac_fft = calloc(lags, sizeof(double));
+    double *ac_direct = calloc(lags, sizeof(double));
+    if (ac_fft && ac_direct) {
+
+        uint64_t t1 = usclock();
+        autocovariance_direct(src, slice, mean, lags, ac_direct);
+        uint64_t t_direct = usclock() - t1;
+
+        t1 = usclock();
+        dsp_autocovariance(src, slice, mean, lags, ac_fft);
+        uint64_t t_fft = usclock() - t1;
+
+        double err = 0;
+        for (size_t i = 0; i < lags; i++) {
+            err = MAX(err, fabs(ac_fft[i] - ac_direct[i]) / MAX(1.0, fabs(ac_direct[0])));
+        }
+        if (err > 1e-9) {
+            PrintAndLogEx(FAILED, "autocorr FFT differs from direct sums ( %g )", err);
+            match = false;
+        }
+
+        PrintAndLogEx(NORMAL, "");
+        PrintAndLogEx(INFO, "autocorr over " _YELLOW_("%zu") " samples, " _YELLOW_("%zu") " lags", slice, lags);
+        PrintAndLogEx(INFO, "  direct..... " _YELLOW_("%8.1f") " ms", t_direct / 1000.0);
+        PrintAndLogEx(INFO, "  FFT........ " _YELLOW_("%8.1f") " ms", t_fft / 1000.0);
+    }
+    free(ac_fft);
+    free(ac_direct);
+
+    if (n > slice) {
+        lags = n - 4000;
+        double *ac = calloc(lags, sizeof(double));
+        if (ac) {
+            sum = dsp_sum(src, n);
+            mean = (double)sum / n;
+            uint64_t t1 = usclock();
+            dsp_autocovariance(src, n, mean, lags, ac);
+            t1 = usclock() - t1;
+            PrintAndLogEx(INFO, "autocorr over " _YELLOW_("%zu") " samples, " _YELLOW_("%zu") " lags", n, lags);
+            PrintAndLogEx(INFO, "  FFT........ " _YELLOW_("%8.1f") " ms", t1 / 1000.0);
+        }
+        free(ac);
+    }
+
+    PrintAndLogEx(NORMAL, "");
+    if (match) {
+        PrintAndLogEx(SUCCESS, "kernels....... %s", _GREEN_("ok"));
+    } else {
+        PrintAndLogEx(FAILED, "kernels....... %s", _RED_("fail"));
+    }
+
+    free(src);
+    free(work);
+    free(ref);
+    free(u8);
+    free(ref_u8);
+    return (match) ? PM3_SUCCESS : PM3_ESOFT;
+}
@@ -0,0 +1,59 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Graph buffer DSP kernels used by the data commands
+//-----------------------------------------------------------------------------
+
+#ifndef GRAPHDSP_H__
+#define GRAPHDSP_H__
+
+#include "common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// instruction set the kernels run with on this CPU
+const char *dsp_instr(void);
+
+void dsp_minmax(const int *in, size_t len, int *min, int *max);
+int64_t dsp_sum(const int *in, size_t len);
+
+// data norm, (x - (max + min) / 2) * 256 / (max - min)
+void dsp_normalize(int *data, size_t len, int min, int max);
+
+// clamp to +/-127 in place and store as unsigned samples (getFromGraphBuffer)
+void dsp_to_u8(int *data, uint8_t *dest, size_t len);
+// unsigned samples to signed (setGraphBuffer)
+void dsp_from_u8(const uint8_t *src, int *dest, size_t len);
+
+// data cthreshold / data dirthreshold / data iir / data envelope / data decimate
+void dsp_center_threshold(const int *in, int *out, size_t len, int up, int down);
+void dsp_directional_threshold(const int *in, int *out, size_t len, int up, int down);
+void dsp_iir_simple(int *data, size_t len, uint8_t k);
+void dsp_envelope_square(const int *in, int *out, size_t len);
+size_t dsp_decimate(int *data, size_t len, int n);
+
+// out[i] = sum over j < len - i of (in[j] - mean) * (in[j + i] - mean), i < lags.
+// Uses an FFT when the integer correlation is exact in doubles
+int dsp_autocovariance(const int *in, size_t len, double mean, size_t lags, double *out);
+
+// time every kernel on a synthetic capture of n samples
+int dsp_bench(size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,207 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Graph buffer DSP kernels.
+//
+// No include guard on purpose, this file is included once per instruction set
+// by graphdsp.c with these defined:
+//   DSP_TARGET  function attribute enabling the instruction set, may be empty
+//   DSP_SUFFIX  appended to every generated name
+//   DSP_NAME    instruction set name shown to the user
+//   DSP_VEC     vector register width in bytes, 0 for the plain C instance
+//
+// The vector loops use the GCC vector extensions, like the hardnested brute
+// forcer, with lanes of DSP_VEC / 4 samples and never wider than DSP_VEC, wider
+// generic vectors end up on the stack. The remaining samples go through the
+// plain C loop. The u8 conversions widen / narrow bytes, which the generic
+// vectors don't do well, so they keep the plain loop for the compiler to
+// vectorize. Every instance gives the same results.
+//-----------------------------------------------------------------------------
+
+#if DSP_VEC
+#define DSP_LANES   (DSP_VEC / 4)
+#define DSP_VI      DSP_FN(dsp_vi_)
+#define DSP_VH      DSP_FN(dsp_vh_)
+#define DSP_VD      DSP_FN(dsp_vd_)
+typedef int     DSP_VI __attribute__((vector_size(DSP_VEC)));
+typedef int     DSP_VH __attribute__((vector_size(DSP_VEC / 2)));
+typedef double  DSP_VD __attribute__((vector_size(DSP_VEC)));
+
+// int32 lanes of the 16 bit halves can take that many samples without overflow
+#define DSP_SUM_BLOCK   32768
+#endif
+
+DSP_TARGET
+static void DSP_FN(dsp_minmax_)(const int *in, size_t len, int *min, int *max) {
+    int lo = INT_MAX, hi = INT_MIN;
+    size_t i = 0;
+#if DSP_VEC
+    if (len >= DSP_LANES) {
+        DSP_VI vlo, vhi;
+        memcpy(&vlo, in, sizeof(vlo));
+        vhi = vlo;
+        for (i = DSP_LANES; i + DSP_LANES <= len; i += DSP_LANES) {
+            DSP_VI v;
+            memcpy(&v, in + i, sizeof(v));
+            DSP_VI lt = v < vlo;
+            DSP_VI gt = v > vhi;
+            vlo = (v & lt) | (vlo & ~lt);
+            vhi = (v & gt) | (vhi & ~gt);
+        }
+        for (int k = 0; k < DSP_LANES; k++) {
+            lo = (vlo[k] < lo) ? vlo[k] : lo;
+            hi = (vhi[k] > hi) ? vhi[k] : hi;
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        lo = (in[i] < lo) ? in[i] : lo;
+        hi = (in[i] > hi) ? in[i] : hi;
+    }
+    *min = lo;
+    *max = hi;
+}
+
+DSP_TARGET
+static int64_t DSP_FN(dsp_sum_)(const int *in, size_t len) {
+    int64_t sum = 0;
+    size_t i = 0;
+#if DSP_VEC
+    // x = hi * 65536 + lo, both halves summed in int32 lanes and
+    // folded into the 64 bit sum every DSP_SUM_BLOCK vectors
+    while (i + DSP_LANES <= len) {
+        DSP_VI hi = {0}, lo = {0};
+        for (size_t n = 0; n < DSP_SUM_BLOCK && i + DSP_LANES <= len; n++, i += DSP_LANES) {
+            DSP_VI v;
+            memcpy(&v, in + i, sizeof(v));
+            hi += v >> 16;
+            lo += v & 0xFFFF;
+        }
+        for (int k = 0; k < DSP_LANES; k++) {
+            sum += ((int64_t)hi[k] * 65536) + lo[k];
+        }
+    }
+#endif
+    for (; i < len; i++) {
+        sum += in[i];
+    }
+    return sum;
+}
+
+// (x - mid) * 256 / range, truncated.  Exact in doubles as long as the
+// numerator stays below 2^53, callers make sure the result fits an int
+DSP_TARGET
+static void DSP_FN(dsp_scale_)(int *data, size_t len, int mid, int range) {
+    const double m = mid;
+    const double r = range;
+    size_t i = 0;
+#if DSP_VEC
+    // doubles take twice the room, half a vector of samples at a time
+    for (; i + (DSP_LANES / 2) <= len; i += (DSP_LANES / 2)) {
+        DSP_VH v;
+        memcpy(&v, data + i, sizeof(v));
+        DSP_VD d = __builtin_convertvector(v, DSP_VD);
+        d = ((d - m) * 256.0) / r;
+        v = __builtin_convertvector(d, DSP_VH);
+        memcpy(data + i, &v, sizeof(v));
+    }
+#endif
+    for (; i < len; i++) {
+        data[i] = (int)((((double)data[i] - m) * 256.0) / r);
+    }
+}
+
+DSP_TARGET
+static void DSP_FN(dsp_to_u8_)(int *data, uint8_t *dest, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        int v = data[i];
+        v = (v > 127) ? 127 : v;
+        v = (v < -127) ? -127 : v;
+        data[i] = v;
+        dest[i] = (uint8_t)(v + 128);
+    }
+}
+
+DSP_TARGET
+static void DSP_FN(dsp_from_u8_)(const uint8_t *src, int *dest, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        dest[i] = src[i] - 128;
+    }
+}
+
+DSP_TARGET
+static void DSP_FN(dsp_zero_band_)(const int *in, int *out, size_t len, int up, int down) {
+    size_t i = 0;
+#if DSP_VEC
+    for (; i + DSP_LANES <= len; i += DSP_LANES) {
+        DSP_VI v, o;
+        memcpy(&v, in + i, sizeof(v));
+        memcpy(&o, out + i, sizeof(o));
+        o &= ~((v <= up) & (v >= down));
+        memcpy(out + i, &o, sizeof(o));
+    }
+#endif
+    for (; i < len; i++) {
+        out[i] = ((in[i] <= up) & (in[i] >= down)) ? 0 : out[i];
+    }
+}
+
+// 1 rising above up, -1 falling below down, 0 keep previous.
+// prev is the sample before in[0]
+DSP_TARGET
+static void DSP_FN(dsp_dir_codes_)(const int *in, size_t len, int prev, int up, int down, int *code) {
+    if (len == 0) {
+        return;
+    }
+
+    code[0] = ((in[0] >= up) & (in[0] > prev)) ? 1 : (((in[0] <= down) & (in[0] < prev)) ? -1 : 0);
+    size_t i = 1;
+#if DSP_VEC
+    for (; i + DSP_LANES <= len; i += DSP_LANES) {
+        DSP_VI cur, last;
+        memcpy(&cur, in + i, sizeof(cur));
+        memcpy(&last, in + i - 1, sizeof(last));
+        // comparisons give -1 / 0 per lane
+        DSP_VI r = (cur >= up) & (cur > last);
+        DSP_VI f = (cur <= down) & (cur < last);
+        DSP_VI c = -r | (f & ~r);
+        memcpy(code + i, &c, sizeof(c));
+    }
+#endif
+    for (; i < len; i++) {
+        int r = ((in[i] >= up) & (in[i] > in[i - 1])) ? 1 : 0;
+        int f = ((in[i] <= down) & (in[i] < in[i - 1])) ? -1 : 0;
+        code[i] = r ? r : f;
+    }
+}
+
+static const dsp_impl_t DSP_FN(dsp_impl_) = {
+    DSP_FN(dsp_minmax_),
+    DSP_FN(dsp_sum_),
+    DSP_FN(dsp_scale_),
+    DSP_FN(dsp_to_u8_),
+    DSP_FN(dsp_from_u8_),
+    DSP_FN(dsp_zero_band_),
+    DSP_FN(dsp_dir_codes_),
+    DSP_NAME,
+};
+
+#if DSP_VEC
+#undef DSP_LANES
+#undef DSP_VI
+#undef DSP_VH
+#undef DSP_VD
+#undef DSP_SUM_BLOCK
+#endif
@@ -0,0 +1,389 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Streaming LF demodulation
+//-----------------------------------------------------------------------------
+
+#include "lfstream.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "ui.h"
+#include "util_posix.h"
+#include "commonutil.h"     // ARRAYLEN
+#include "cmddata.h"       // g_DemodBuffer
+#include "demodctx.h"
+#include "graph.h"
+#include "lfdemod.h"
+#include "cmdlfem410x.h"
+#include "cmdlfhid.h"
+#include "cmdlfindala.h"
+#include "cmdlft55xx.h"
+
+static uint32_t lf_stream_hash(uint32_t h, const void *data, size_t len) {
+    // FNV-1a
+    const uint8_t *p = data;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ p[i]) * 0x01000193;
+    }
+    return h;
+}
+
+// the ID demods leave the frame in the demod buffer, starting at its preamble.
+// What follows the frame depends on where the window ends
+static int lf_stream_frame(int res, size_t frame_len, uint32_t *id) {
+    if (res == PM3_SUCCESS) {
+        *id = lf_stream_hash(0x811C9DC5, g_DemodBuffer, MIN(frame_len, g_DemodBufferLen));
+    }
+    return res;
+}
+
+static int lf_stream_em410x(bool verbose, uint32_t *id) {
+    (void) verbose;
+    uint32_t hi = 0;
+    uint64_t lo = 0;
+    // as demodEM410x, keeping the ID
+    int res = AskEm410xDemod(0, 0, 100, 0, false, &hi, &lo, true);
+    if (res == PM3_SUCCESS) {
+        *id = lf_stream_hash(lf_stream_hash(0x811C9DC5, &hi, sizeof(hi)), &lo, sizeof(lo));
+    }
+    return res;
+}
+
+static int lf_stream_hid(bool verbose, uint32_t *id) {
+    // HIDdemodFSK cuts the buffer to the frame
+    return lf_stream_frame(demodHID(verbose), g_DemodBufferLen, id);
+}
+
+static int lf_stream_indala(bool verbose, uint32_t *id) {
+    int res = demodIndala(verbose);
+    return lf_stream_frame(res, (g_DemodBufferLen >= 224) ? 224 : 64, id);
+}
+
+// detection leaves the config of the last hit behind, the stream should
+// not change what the user set up. The offset depends on where the window
+// cut the data stream, so it is no part of the identity
+static int lf_stream_t55xx(bool verbose, uint32_t *id) {
+    t55xx_conf_block_t saved = Get_t55xx_Config();
+    bool found = t55xxTryDetectModulation(0, verbose);
+    t55xx_conf_block_t found_conf = Get_t55xx_Config();
+    Set_t55xx_Config(saved);
+
+    if (found == false) {
+        return PM3_ESOFT;
+    }
+
+    uint32_t h = 0x811C9DC5;
+    h = lf_stream_hash(h, &found_conf.block0, sizeof(found_conf.block0));
+    h = lf_stream_hash(h, &found_conf.modulation, sizeof(found_conf.modulation));
+    h = lf_stream_hash(h, &found_conf.bitrate, sizeof(found_conf.bitrate));
+    h = lf_stream_hash(h, &found_conf.inverted, sizeof(found_conf.inverted));
+    h = lf_stream_hash(h, &found_conf.Q5, sizeof(found_conf.Q5));
+    h = lf_stream_hash(h, &found_conf.ST, sizeof(found_conf.ST));
+    *id = h;
+    return PM3_SUCCESS;
+}
+
+typedef struct {
+    uint8_t mask;
+    const char *name;
+    // on success, *id identifies the tag independent of where its frame
+    // sits in the window
+    int (*demod)(bool verbose, uint32_t *id);
+    // samples looked at, enough for two or three frames
+    size_t window;
+    // new samples between two runs, bounds the latency
+    size_t stride;
+} lf_stream_decoder_t;
+
+static const lf_stream_decoder_t lf_stream_decoders[] = {
+    { LF_STREAM_EM410X, "EM410x",  lf_stream_em410x, 12288, 2048 },  // 64 bits at RF/64
+    { LF_STREAM_HID,    "HID",     lf_stream_hid,    16384, 2048 },  // 96 bits at RF/50
+    { LF_STREAM_INDALA, "Indala",  lf_stream_indala, 16384, 2048 },  // up to 224 bits at RF/32
+    { LF_STREAM_T55XX,  "T55xx",   lf_stream_t55xx,  16384, 8192 },  // tries every modulation
+};
+
+typedef struct {
+    const lf_stream_decoder_t *dec;
+    demod_ctx_t *ctx;
+    uint64_t next_run;
+    uint64_t last_run;
+    // position and identity of the last frame decoded
+    uint64_t last_hit;
+    uint32_t last_id;
+    bool hit;
+    uint32_t runs;
+    uint32_t ids;
+    uint64_t first_id;
+    uint64_t busy_us;
+} lf_stream_state_t;
+
+struct lf_stream_s {
+    // most recent samples, history[len - 1] is sample number total - 1
+    int32_t *history;
+    size_t len;
+    size_t size;
+    size_t window;
+    uint64_t total;
+    uint32_t sample_rate;
+
+    // unpacking state of lf_stream_push_raw
+    uint32_t acc;
+    uint8_t acc_bits;
+
+    lf_stream_state_t state[ARRAYLEN(lf_stream_decoders)];
+    size_t count;
+};
+
+lf_stream_t *lf_stream_new(uint8_t decoders, uint32_t sample_rate) {
+
+    lf_stream_t *s = calloc(1, sizeof(lf_stream_t));
+    if (s == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        return NULL;
+    }
+
+    s->sample_rate = (sample_rate) ? sample_rate : 125000;
+
+    for (size_t i = 0; i < ARRAYLEN(lf_stream_decoders); i++) {
+        const lf_stream_decoder_t *dec = &lf_stream_decoders[i];
+        if ((decoders & dec->mask) == 0) {
+            continue;
+        }
+
+        lf_stream_state_t *st = &s->state[s->count];
+        st->dec = dec;
+        st->next_run = dec->window / 2;
+        st->ctx = demod_ctx_new(NULL, 0, false);
+        if (st->ctx == NULL) {
+            lf_stream_free(s);
+            return NULL;
+        }
+        s->window = MAX(s->window, dec->window);
+        s->count++;
+    }
+
+    // room for a window plus a window of new samples before sliding
+    s->size = 2 * MAX(s->window, 1);
+    s->history = calloc(s->size, sizeof(int32_t));
+    if (s->history == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        lf_stream_free(s);
+        return NULL;
+    }
+    return s;
+}
+
+void lf_stream_free(lf_stream_t *s) {
+    if (s == NULL) {
+        return;
+    }
+
+    for (size_t i = 0; i < s->count; i++) {
+        demod_ctx_free(s->state[i].ctx);
+    }
+    free(s->history);
+    free(s);
+}
+
+static void lf_stream_run(lf_stream_t *s, lf_stream_state_t *st) {
+
+    size_t w = MIN(s->len, st->dec->window);
+    if (demod_ctx_reserve(st->ctx, w) == false) {
+        return;
+    }
+    memcpy(st->ctx->samples, s->history + s->len - w, w * sizeof(int32_t));
+    st->ctx->samples_len = w;
+    st->ctx->buffer_len = 0;
+    demod_ctx_touch(st->ctx);
+
+    uint64_t t1 = usclock();
+
+    demod_ctx_t *prev = demod_ctx_bind(st->ctx);
+    print_deferred_t out = {0};
+    PrintAndLogDefer(&out);
+
+    // same preparation as data load does for a whole trace
+    uint8_t *bits = calloc(w, sizeof(uint8_t));
+    uint32_t id = 0;
+    int res = PM3_EMALLOC;
+    if (bits) {
+        size_t size = getFromGraphBuffer(bits);
+        removeSignalOffset(bits, size);
+        setGraphBuffer(bits, size);
+        computeSignalProperties(bits, size);
+        free(bits);
+
+        res = st->dec->demod(true, &id);
+    }
+
+    PrintAndLogDefer(NULL);
+    demod_ctx_bind(prev);
+
+    st->busy_us += usclock() - t1;
+    st->runs++;
+    st->last_run = s->total;
+
+    if (res != PM3_SUCCESS) {
+        PrintAndLogDeferredFree(&out);
+        return;
+    }
+
+    // a tag keeps sending the same frame, report it once unless it was
+    // out of the field for longer than a second. Single windows fail to decode
+    // now and then, a tag is not gone because of that
+    uint64_t gone = MAX(2 * st->dec->window, s->sample_rate);
+    bool same = st->hit && (id == st->last_id) && (s->total - st->last_hit <= gone);
+    st->hit = true;
+    st->last_id = id;
+    st->last_hit = s->total;
+
+    if (same) {
+        PrintAndLogDeferredFree(&out);
+        return;
+    }
+
+    if (st->ids == 0) {
+        st->first_id = s->total;
+    }
+    st->ids++;
+
+    PrintAndLogEx(NORMAL, "");
+    PrintAndLogEx(SUCCESS, _GREEN_("%s") " at " _YELLOW_("%" PRIu64) " ms ( sample %" PRIu64 ", decoded in %.1f ms )"
+                  , st->dec->name
+                  , (s->total * 1000) / s->sample_rate
+                  , s->total
+                  , (double)(usclock() - t1) / 1000.0
+                 );
+    PrintAndLogDeferredFlush(&out);
+}
+
+int lf_stream_push(lf_stream_t *s, const int32_t *samples, size_t n) {
+    if (s == NULL || samples == NULL) {
+        return PM3_EINVARG;
+    }
+
+    while (n) {
+        // slide, keeping the largest window
+        if (s->len == s->size) {
+            memmove(s->history, s->history + s->len - s->window, s->window * sizeof(int32_t));
+            s->len = s->window;
+        }
+
+        size_t cnt = MIN(n, s->size - s->len);
+
+        // stop at the next run of any decoder so none misses its turn
+        for (size_t i = 0; i < s->count; i++) {
+            if (s->state[i].next_run > s->total) {
+                cnt = MIN(cnt, s->state[i].next_run - s->total);
+            }
+        }
+
+        memcpy(s->history + s->len, samples, cnt * sizeof(int32_t));
+        s->len += cnt;
+        s->total += cnt;
+        samples += cnt;
+        n -= cnt;
+
+        for (size_t i = 0; i < s->count; i++) {
+            lf_stream_state_t *st = &s->state[i];
+            if (st->next_run <= s->total) {
+                lf_stream_run(s, st);
+                st->next_run = s->total + st->dec->stride;
+            }
+        }
+    }
+    return PM3_SUCCESS;
+}
+
+void lf_stream_flush(lf_stream_t *s) {
+    if (s == NULL) {
+        return;
+    }
+
+    // a frame in the samples after the last run would be lost otherwise
+    for (size_t i = 0; i < s->count; i++) {
+        lf_stream_state_t *st = &s->state[i];
+        if (s->total > st->last_run) {
+            lf_stream_run(s, st);
+            st->next_run = s->total + st->dec->stride;
+        }
+    }
+}
+
+int lf_stream_push_raw(lf_stream_t *s, const uint8_t *data, size_t len, uint8_t bits_per_sample) {
+    if (s == NULL || data == NULL || bits_per_sample == 0 || bits_per_sample > 8) {
+        return PM3_EINVARG;
+    }
+
+    int32_t samples[512];
+    size_t n = 0;
+    const uint8_t mask = (1 << bits_per_sample) - 1;
+
+    for (size_t i = 0; i < len; i++) {
+        s->acc = (s->acc << 8) | data[i];
+        s->acc_bits += 8;
+
+        while (s->acc_bits >= bits_per_sample) {
+            s->acc_bits -= bits_per_sample;
+            // left aligned in a byte, like getSamplesFromBufEx
+            uint8_t sample = ((s->acc >> s->acc_bits) & mask) << (8 - bits_per_sample);
+            samples[n++] = ((int)sample) - 127;
+
+            if (n == ARRAYLEN(samples)) {
+                lf_stream_push(s, samples, n);
+                n = 0;
+            }
+        }
+        s->acc &= (1 << s->acc_bits) - 1;
+    }
+    return lf_stream_push(s, samples, n);
+}
+
+size_t lf_stream_ids(const lf_stream_t *s) {
+    size_t ids = 0;
+    for (size_t i = 0; s && i < s->count; i++) {
+        ids += s->state[i].ids;
+    }
+    return ids;
+}
+
+void lf_stream_print_stats(const lf_stream_t *s) {
+    if (s == NULL) {
+        return;
+    }
+
+    PrintAndLogEx(NORMAL, "");
+    PrintAndLogEx(INFO, "Streamed " _YELLOW_("%" PRIu64) " samples ( %" PRIu64 " ms )", s->total, (s->total * 1000) / s->sample_rate);
+    PrintAndLogEx(INFO, "decoder | IDs | first ID | runs | avg run");
+    PrintAndLogEx(INFO, "--------+-----+----------+------+---------");
+    for (size_t i = 0; i < s->count; i++) {
+        const lf_stream_state_t *st = &s->state[i];
+        char first[20] = "       -";
+        if (st->ids) {
+            snprintf(first, sizeof(first), "%5" PRIu64 " ms", (st->first_id * 1000) / s->sample_rate);
+        }
+        PrintAndLogEx(INFO, " %-6s | %3u | %s | %4u | %4.1f ms"
+                      , st->dec->name
+                      , st->ids
+                      , first
+                      , st->runs
+                      , (st->runs) ? (double)st->busy_us / st->runs / 1000.0 : 0.0
+                     );
+    }
+}
@@ -0,0 +1,62 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Streaming LF demodulation
+//
+// Samples are pushed in chunks of any size, as they come over the comm link
+// or out of a trace file. Every decoder keeps its own demod context and runs
+// over the most recent window of samples each time enough new ones arrived,
+// so a tag ID is reported as soon as a full frame is in the window.
+// The same ID is only reported again after the tag was gone for a while.
+//-----------------------------------------------------------------------------
+
+#ifndef LFSTREAM_H__
+#define LFSTREAM_H__
+
+#include "common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LF_STREAM_EM410X    0x01
+#define LF_STREAM_HID       0x02
+#define LF_STREAM_INDALA    0x04
+#define LF_STREAM_T55XX     0x08
+#define LF_STREAM_ALL       0x0F
+
+typedef struct lf_stream_s lf_stream_t;
+
+// sample_rate is used to print stream positions as time
+lf_stream_t *lf_stream_new(uint8_t decoders, uint32_t sample_rate);
+void lf_stream_free(lf_stream_t *s);
+
+// signed samples, as they would land in the graph buffer
+int lf_stream_push(lf_stream_t *s, const int32_t *samples, size_t n);
+// raw bytes of CMD_LF_ACQ_RAW_ADC, bits_per_sample packed MSB first.
+// Samples split over two calls are put back together
+int lf_stream_push_raw(lf_stream_t *s, const uint8_t *data, size_t len, uint8_t bits_per_sample);
+
+// decodes what arrived since each decoder's last run, at the end of a stream
+void lf_stream_flush(lf_stream_t *s);
+
+// number of tag IDs reported so far
+size_t lf_stream_ids(const lf_stream_t *s);
+void lf_stream_print_stats(const lf_stream_t *s);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
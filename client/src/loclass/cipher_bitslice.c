@@ -0,0 +1,206 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Bitsliced iClass MAC
+//
+// The kernel in cipher_bitslice_core.h is instantiated once per instruction
+// set using function target attributes, and picked at runtime with the same
+// SIMD detection / override as hardnested (hf mf hardnested --i2 etc).
+//-----------------------------------------------------------------------------
+
+#include "cipher_bitslice.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "cipher.h"
+#include "ui.h"
+#include "util_posix.h"
+#include "hardnested_bf_core.h"   // SIMD detection
+
+#if defined(COMPILER_HAS_SIMD_AVX512)
+#define BS_LANES    512
+#define BS_TARGET   __attribute__((target("avx512f")))
+#define BS_FN       mac_bitsliced_AVX512
+#include "cipher_bitslice_core.h"
+#undef BS_LANES
+#undef BS_TARGET
+#undef BS_FN
+#endif
+
+#if defined(COMPILER_HAS_SIMD_X86)
+#define BS_LANES    256
+#define BS_TARGET   __attribute__((target("avx2")))
+#define BS_FN       mac_bitsliced_AVX2
+#include "cipher_bitslice_core.h"
+#undef BS_LANES
+#undef BS_TARGET
+#undef BS_FN
+
+#define BS_LANES    128
+#define BS_TARGET   __attribute__((target("sse2")))
+#define BS_FN       mac_bitsliced_SSE2
+#include "cipher_bitslice_core.h"
+#undef BS_LANES
+#undef BS_TARGET
+#undef BS_FN
+#endif
+
+#if defined(COMPILER_HAS_SIMD_NEON)
+#define BS_LANES    128
+#define BS_TARGET
+#define BS_FN       mac_bitsliced_NEON
+#include "cipher_bitslice_core.h"
+#undef BS_LANES
+#undef BS_TARGET
+#undef BS_FN
+#endif
+
+#define BS_LANES    64
+#define BS_TARGET
+#define BS_FN       mac_bitsliced_NOSIMD
+#include "cipher_bitslice_core.h"
+#undef BS_LANES
+#undef BS_TARGET
+#undef BS_FN
+
+typedef void mac_bitsliced_t(const uint8_t *, const uint8_t *, size_t, uint8_t *);
+
+typedef struct {
+    mac_bitsliced_t *fn;
+    size_t lanes;
+    const char *name;
+} mac_bitsliced_impl_t;
+
+static mac_bitsliced_impl_t mac_bitsliced_select(void) {
+    switch (GetSIMDInstrAuto()) {
+#if defined(COMPILER_HAS_SIMD_AVX512)
+        case SIMD_AVX512:
+            return (mac_bitsliced_impl_t) { mac_bitsliced_AVX512, 512, "AVX512" };
+#endif
+#if defined(COMPILER_HAS_SIMD_X86)
+        case SIMD_AVX2:
+            return (mac_bitsliced_impl_t) { mac_bitsliced_AVX2, 256, "AVX2" };
+        // AVX1 has no 256 bit integer ops
+        case SIMD_AVX:
+        case SIMD_SSE2:
+            return (mac_bitsliced_impl_t) { mac_bitsliced_SSE2, 128, "SSE2" };
+        case SIMD_MMX:
+            return (mac_bitsliced_impl_t) { mac_bitsliced_NOSIMD, 64, "no SIMD" };
+#endif
+#if defined(COMPILER_HAS_SIMD_NEON)
+        case SIMD_NEON:
+            return (mac_bitsliced_impl_t) { mac_bitsliced_NEON, 128, "NEON" };
+#endif
+        case SIMD_AUTO:
+        case SIMD_NONE:
+        default:
+            return (mac_bitsliced_impl_t) { mac_bitsliced_NOSIMD, 64, "no SIMD" };
+    }
+}
+
+size_t doMAC_bitsliced_lanes(void) {
+    return mac_bitsliced_select().lanes;
+}
+
+const char *doMAC_bitsliced_instr(void) {
+    return mac_bitsliced_select().name;
+}
+
+void doMAC_bitsliced(const uint8_t *cc_nr_p, const uint8_t *div_keys, size_t n, uint8_t *macs) {
+
+    // input bits in the order doMAC clocks them in, cc_nr is bit reversed per byte
+    uint8_t y[96];
+    for (uint8_t i = 0; i < 96; i++) {
+        y[i] = (cc_nr_p[i >> 3] >> (i & 7)) & 1;
+    }
+
+    mac_bitsliced_impl_t impl = mac_bitsliced_select();
+
+    for (size_t i = 0; i < n; i += impl.lanes) {
+        size_t cnt = n - i;
+        if (cnt > impl.lanes) {
+            cnt = impl.lanes;
+        }
+        impl.fn(y, div_keys + (i * 8), cnt, macs + (i * 4));
+    }
+}
+
+#define BS_TEST_KEYS   (16 * LOCLASS_BS_MAX_LANES)
+
+int testMAC_bitsliced(void) {
+    PrintAndLogEx(SUCCESS, "Testing bitsliced MAC calculation...");
+
+    uint8_t cc_nr[] = {0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0};
+
+    // first key from the "dismantling.IClass" paper, same as testMAC, the rest pseudo random.
+    // odd count so the last batch is partial
+    const size_t n = BS_TEST_KEYS - 3;
+
+    uint8_t *keys = calloc(n, 8);
+    uint8_t *mac_s = calloc(n, 4);
+    uint8_t *mac_bs = calloc(n, 4);
+    if (keys == NULL || mac_s == NULL || mac_bs == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(keys);
+        free(mac_s);
+        free(mac_bs);
+        return PM3_EMALLOC;
+    }
+
+    const uint8_t paper_key[8] = {0xE0, 0x33, 0xCA, 0x41, 0x9A, 0xEE, 0x43, 0xF9};
+    const uint8_t paper_mac[4] = {0x1d, 0x49, 0xC9, 0xDA};
+    memcpy(keys, paper_key, sizeof(paper_key));
+
+    uint32_t lfsr = 0x1BADF00D;
+    for (size_t i = 8; i < n * 8; i++) {
+        lfsr = lfsr * 1103515245 + 12345;
+        keys[i] = (lfsr >> 16) & 0xFF;
+    }
+
+    uint64_t t1 = usclock();
+    for (size_t i = 0; i < n; i++) {
+        doMAC(cc_nr, keys + (i * 8), mac_s + (i * 4));
+    }
+    uint64_t t_scalar = usclock() - t1;
+
+    t1 = usclock();
+    doMAC_bitsliced(cc_nr, keys, n, mac_bs);
+    uint64_t t_bs = usclock() - t1;
+
+    int res = PM3_SUCCESS;
+    if (memcmp(mac_bs, paper_mac, sizeof(paper_mac)) == 0 && memcmp(mac_s, mac_bs, n * 4) == 0) {
+        PrintAndLogEx(SUCCESS, "    bitsliced MAC calculation ( %s )", _GREEN_("ok"));
+    } else {
+        PrintAndLogEx(FAILED, "    bitsliced MAC calculation ( %s )", _RED_("fail"));
+        res = PM3_ESOFT;
+    }
+
+    if (t_scalar == 0) t_scalar = 1;
+    if (t_bs == 0) t_bs = 1;
+
+    PrintAndLogEx(INFO, "    scalar..... " _YELLOW_("%.0f") " MAC/s", (double)n * 1000000.0 / (double)t_scalar);
+    PrintAndLogEx(INFO, "    bitsliced.. " _YELLOW_("%.0f") " MAC/s ( %zu lanes, %s )"
+                  , (double)n * 1000000.0 / (double)t_bs
+                  , doMAC_bitsliced_lanes()
+                  , doMAC_bitsliced_instr()
+                 );
+
+    free(keys);
+    free(mac_s);
+    free(mac_bs);
+    return res;
+}
@@ -0,0 +1,38 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Bitsliced iClass MAC, many diversified keys against the same CC/NR at once
+//-----------------------------------------------------------------------------
+
+#ifndef CIPHER_BITSLICE_H
+#define CIPHER_BITSLICE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// largest batch any kernel evaluates in one pass
+#define LOCLASS_BS_MAX_LANES    512
+
+// keys evaluated per kernel pass on this CPU (64 .. 512)
+size_t doMAC_bitsliced_lanes(void);
+const char *doMAC_bitsliced_instr(void);
+
+// same result as calling doMAC() for every key,
+// div_keys holds n * 8 bytes, macs receives n * 4 bytes
+void doMAC_bitsliced(const uint8_t *cc_nr_p, const uint8_t *div_keys, size_t n, uint8_t *macs);
+
+int testMAC_bitsliced(void);
+
+#endif // CIPHER_BITSLICE_H
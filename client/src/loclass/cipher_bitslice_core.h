@@ -0,0 +1,156 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Bitsliced iClass MAC kernel.
+//
+// No include guard on purpose, this file is included once per instruction set
+// by cipher_bitslice.c with these defined:
+//   BS_LANES   number of keys per call (64, 128, 256, 512)
+//   BS_TARGET  function attribute enabling the instruction set, may be empty
+//   BS_FN      name of the generated function
+//
+// Lane i of every bitslice holds one bit of candidate key i. Registers are
+// stored per bit, index 0 is the least significant bit, so r[7] is r0 in the
+// notation of cipher.c / "Dismantling iClass".
+//-----------------------------------------------------------------------------
+
+BS_TARGET
+static void BS_FN(const uint8_t *y, const uint8_t *keys, size_t n, uint8_t *macs) {
+
+    typedef uint64_t bs_t __attribute__((vector_size(BS_LANES / 8)));
+    typedef union {
+        bs_t v;
+        uint64_t w[BS_LANES / 64];
+    } bs_u;
+
+    // transpose div keys into key[byte][bit]
+    bs_u key[8][8];
+    memset(key, 0, sizeof(key));
+
+    for (size_t i = 0; i < n; i++) {
+        const uint8_t *k = keys + (i * 8);
+        const uint8_t sh = i & 63;
+        const size_t w = i >> 6;
+        for (uint8_t j = 0; j < 8; j++) {
+            for (uint8_t bit = 0; bit < 8; bit++) {
+                key[j][bit].w[w] |= (uint64_t)((k[j] >> bit) & 1) << sh;
+            }
+        }
+    }
+
+    const bs_t zero = {0};
+    const bs_t ones = ~zero;
+
+#define BS_CONST(val, bit) ((((val) >> (bit)) & 1) ? ones : zero)
+
+    // k[select] is a 8:1 mux, the first level differences never change for a key
+    bs_t k0[8], d01[8], k2[8], d23[8], k4[8], d45[8], k6[8], d67[8];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        k0[bit] = key[0][bit].v;
+        k2[bit] = key[2][bit].v;
+        k4[bit] = key[4][bit].v;
+        k6[bit] = key[6][bit].v;
+        d01[bit] = key[0][bit].v ^ key[1][bit].v;
+        d23[bit] = key[2][bit].v ^ key[3][bit].v;
+        d45[bit] = key[4][bit].v ^ key[5][bit].v;
+        d67[bit] = key[6][bit].v ^ key[7][bit].v;
+    }
+
+    bs_t l[8], r[8], b[8], t[16];
+
+    // init,  l = (k[0] ^ 0x4c) + 0xEC,  r = (k[0] ^ 0x4c) + 0x21
+    bs_t cl = zero, cr = zero;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+        bs_t x = k0[bit] ^ BS_CONST(0x4C, bit);
+        bs_t a = BS_CONST(0xEC, bit);
+        bs_t c = BS_CONST(0x21, bit);
+        l[bit] = x ^ a ^ cl;
+        cl = (x & a) | (cl & (x ^ a));
+        r[bit] = x ^ c ^ cr;
+        cr = (x & c) | (cr & (x ^ c));
+        b[bit] = BS_CONST(0x4C, bit);
+    }
+    for (uint8_t bit = 0; bit < 16; bit++) {
+        t[bit] = BS_CONST(0xE012, bit);
+    }
+
+    // 96 bits of cc_nr in, then 32 zero bits while clocking out the MAC
+    bs_t out[32];
+
+    for (uint8_t step = 0; step < 128; step++) {
+
+        if (step >= 96) {
+            out[step - 96] = r[2];
+            if (step == 127) {
+                break;
+            }
+        }
+
+        const bs_t yv = (step < 96 && y[step]) ? ones : zero;
+
+        const bs_t tt = t[15] ^ t[14] ^ t[10] ^ t[8] ^ t[5] ^ t[4] ^ t[1] ^ t[0];
+
+        // select(T(t), y, r)
+        const bs_t z0 = (r[7] & r[5]) ^ (r[6] & ~r[4]) ^ (r[5] | r[3]);
+        const bs_t z1 = (r[7] | r[5]) ^ (r[2] | r[0]) ^ r[6] ^ r[1] ^ tt ^ yv;
+        const bs_t z2 = (r[4] & ~r[2]) ^ (r[3] & r[1]) ^ r[0] ^ tt;
+
+        // t' = (T(t) ^ r0 ^ r4) t0 .. t14
+        const bs_t t_in = tt ^ r[7] ^ r[3];
+        for (uint8_t bit = 0; bit < 15; bit++) {
+            t[bit] = t[bit + 1];
+        }
+        t[15] = t_in;
+
+        // b' = (B(b) ^ r7) b0 .. b6
+        const bs_t b_in = b[6] ^ b[5] ^ b[4] ^ b[0] ^ r[0];
+        for (uint8_t bit = 0; bit < 7; bit++) {
+            b[bit] = b[bit + 1];
+        }
+        b[7] = b_in;
+
+        // r' = (k[select] ^ b') + l,  l' = r' + r
+        bs_t c1 = zero, c2 = zero;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            bs_t m0 = k0[bit] ^ (z2 & d01[bit]);
+            bs_t m1 = k2[bit] ^ (z2 & d23[bit]);
+            bs_t m2 = k4[bit] ^ (z2 & d45[bit]);
+            bs_t m3 = k6[bit] ^ (z2 & d67[bit]);
+            m0 ^= z1 & (m0 ^ m1);
+            m2 ^= z1 & (m2 ^ m3);
+            bs_t v = m0 ^ (z0 & (m0 ^ m2)) ^ b[bit];
+
+            bs_t s1 = v ^ l[bit] ^ c1;
+            c1 = (v & l[bit]) | (c1 & (v ^ l[bit]));
+
+            bs_t s2 = s1 ^ r[bit] ^ c2;
+            c2 = (s1 & r[bit]) | (c2 & (s1 ^ r[bit]));
+
+            r[bit] = s1;
+            l[bit] = s2;
+        }
+    }
+
+#undef BS_CONST
+
+    // transpose back, output bit j goes to mac[j / 8] bit (j % 8), same as doMAC
+    memset(macs, 0, n * 4);
+    for (uint8_t j = 0; j < 32; j++) {
+        bs_u o = { .v = out[j] };
+        for (size_t i = 0; i < n; i++) {
+            macs[(i * 4) + (j >> 3)] |= ((o.w[i >> 6] >> (i & 63)) & 1) << (j & 7);
+        }
+    }
+}
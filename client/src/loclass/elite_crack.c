@@ -39,6 +39,7 @@
 #include <time.h>
 #include "cipherutils.h"
 #include "cipher.h"
+#include "cipher_bitslice.h"
 #include "ikeys.h"
 #include "elite_crack.h"
 #include "fileutils.h"
@@ -172,21 +173,19 @@ static void rk(const uint8_t *key, uint8_t n, uint8_t *outp_key) {
     }
 }
 
-static mbedtls_des_context ctx_enc;
-static mbedtls_des_context ctx_dec;
-
-static void desdecrypt_iclass(uint8_t *iclass_key, uint8_t *input, uint8_t *output) {
+// the DES context is supplied by the caller, no shared state so hash2 is safe to call from several threads
+static void desdecrypt_iclass(mbedtls_des_context *ctx, uint8_t *iclass_key, uint8_t *input, uint8_t *output) {
     uint8_t key_std_format[8] = {0};
     permutekey_rev(iclass_key, key_std_format);
-    mbedtls_des_setkey_dec(&ctx_dec, key_std_format);
-    mbedtls_des_crypt_ecb(&ctx_dec, input, output);
+    mbedtls_des_setkey_dec(ctx, key_std_format);
+    mbedtls_des_crypt_ecb(ctx, input, output);
 }
 
-static void desencrypt_iclass(uint8_t *iclass_key, uint8_t *input, uint8_t *output) {
+static void desencrypt_iclass(mbedtls_des_context *ctx, uint8_t *iclass_key, uint8_t *input, uint8_t *output) {
     uint8_t key_std_format[8] = {0};
     permutekey_rev(iclass_key, key_std_format);
-    mbedtls_des_setkey_enc(&ctx_enc, key_std_format);
-    mbedtls_des_crypt_ecb(&ctx_enc, input, output);
+    mbedtls_des_setkey_enc(ctx, key_std_format);
+    mbedtls_des_crypt_ecb(ctx, input, output);
 }
 
 /**
@@ -223,8 +222,11 @@ void hash2(uint8_t *key64, uint8_t *outp_keytable) {
     key64_negated[6] = ~key64[6];
     key64_negated[7] = ~key64[7];
 
+    mbedtls_des_context ctx;
+    mbedtls_des_init(&ctx);
+
     // Once again, key is on iclass-format
-    desencrypt_iclass(key64, key64_negated, z[0]);
+    desencrypt_iclass(&ctx, key64, key64_negated, z[0]);
 
     if (g_debugMode > 0) {
         PrintAndLogEx(DEBUG, "High security custom key (Kcus):");
@@ -235,7 +237,7 @@ void hash2(uint8_t *key64, uint8_t *outp_keytable) {
 
     // y[0]=DES_dec(z[0],~key)
     // Once again, key is on iclass-format
-    desdecrypt_iclass(z[0], key64_negated, y[0]);
+    desdecrypt_iclass(&ctx, z[0], key64_negated, y[0]);
 //    PrintAndLogEx(INFO, "y0  %s",  sprint_hex(y[0],8));
 
     for (uint8_t i = 1; i < 8; i++) {
@@ -243,9 +245,10 @@ void hash2(uint8_t *key64, uint8_t *outp_keytable) {
         rk(key64, i, temp_output);
         //y [i] = DES enc (rk(K cus , i), y [i−1] )
 
-        desdecrypt_iclass(temp_output, z[i - 1], z[i]);
-        desencrypt_iclass(temp_output, y[i - 1], y[i]);
+        desdecrypt_iclass(&ctx, temp_output, z[i - 1], z[i]);
+        desencrypt_iclass(&ctx, temp_output, y[i - 1], y[i]);
     }
+    mbedtls_des_free(&ctx);
 
     if (outp_keytable != NULL) {
         for (uint8_t i = 0 ; i < 8 ; i++) {
@@ -325,73 +328,86 @@ static void *bf_thread(void *thread_arg) {
     memcpy(bytes_to_recover, targ->bytes_to_recover, sizeof(bytes_to_recover));
     memcpy(keytable, targ->keytable, sizeof(keytable));
 
+    // candidates are diversified one by one, then their MACs are checked a batch at a time
+    const size_t lanes = doMAC_bitsliced_lanes();
+    uint8_t div_keys[LOCLASS_BS_MAX_LANES * 8];
+    uint8_t macs[LOCLASS_BS_MAX_LANES * 4];
+    uint32_t brutes[LOCLASS_BS_MAX_LANES];
+
     while (!(brute & endmask)) {
 
         int found = __atomic_load_n(&loclass_found, __ATOMIC_SEQ_CST);
 
         if (found != 0xFF) return NULL;
 
-        //Update the keytable with the brute-values
-        for (uint8_t i = 0; i < numbytes_to_recover; i++) {
-            keytable[bytes_to_recover[i]] &= 0xFF00;
-            keytable[bytes_to_recover[i]] |= (brute >> (i * 8) & 0xFF);
-        }
+        size_t cnt = 0;
+        while (cnt < lanes && !(brute & endmask)) {
 
-        uint8_t key_sel[8] = {0};
+            //Update the keytable with the brute-values
+            for (uint8_t i = 0; i < numbytes_to_recover; i++) {
+                keytable[bytes_to_recover[i]] &= 0xFF00;
+                keytable[bytes_to_recover[i]] |= (brute >> (i * 8) & 0xFF);
+            }
 
-        // Piece together the key
-        key_sel[0] = keytable[key_index[0]] & 0xFF;
-        key_sel[1] = keytable[key_index[1]] & 0xFF;
-        key_sel[2] = keytable[key_index[2]] & 0xFF;
-        key_sel[3] = keytable[key_index[3]] & 0xFF;
-        key_sel[4] = keytable[key_index[4]] & 0xFF;
-        key_sel[5] = keytable[key_index[5]] & 0xFF;
-        key_sel[6] = keytable[key_index[6]] & 0xFF;
-        key_sel[7] = keytable[key_index[7]] & 0xFF;
+            uint8_t key_sel[8] = {0};
 
-        // Permute from iclass format to standard format
+            // Piece together the key
+            key_sel[0] = keytable[key_index[0]] & 0xFF;
+            key_sel[1] = keytable[key_index[1]] & 0xFF;
+            key_sel[2] = keytable[key_index[2]] & 0xFF;
+            key_sel[3] = keytable[key_index[3]] & 0xFF;
+            key_sel[4] = keytable[key_index[4]] & 0xFF;
+            key_sel[5] = keytable[key_index[5]] & 0xFF;
+            key_sel[6] = keytable[key_index[6]] & 0xFF;
+            key_sel[7] = keytable[key_index[7]] & 0xFF;
 
-        uint8_t key_sel_p[8] = {0};
-        permutekey_rev(key_sel, key_sel_p);
+            // Permute from iclass format to standard format
 
-        // Diversify
-        uint8_t div_key[8] = {0};
-        diversifyKey(csn, key_sel_p, div_key);
+            uint8_t key_sel_p[8] = {0};
+            permutekey_rev(key_sel, key_sel_p);
 
-        // Calc mac
-        uint8_t calculated_MAC[4] = {0};
-        doMAC(cc_nr, div_key, calculated_MAC);
+            // Diversify
+            diversifyKey(csn, key_sel_p, div_keys + (cnt * 8));
+            brutes[cnt] = brute;
+            cnt++;
 
-        // success
-        if (memcmp(calculated_MAC, mac, 4) == 0) {
+            brute += loclass_tc;
 
-            loclass_thread_ret_t *r = (loclass_thread_ret_t *)calloc(sizeof(loclass_thread_ret_t), sizeof(uint8_t));
-            if (r == NULL) {
-                PrintAndLogEx(WARNING, "Failed to allocate memory");
-                pthread_exit(NULL);
-            }
+#define _CLR_ "\x1b[0K"
 
-            for (uint8_t i = 0 ; i < numbytes_to_recover; i++) {
-                r->values[i] = keytable[bytes_to_recover[i]] & 0xFF;
+            if (numbytes_to_recover == 3) {
+                if ((brute > 0) && ((brute & 0xFFFF) == 0)) {
+                    PrintAndLogEx(INPLACE, "[ %02x %02x %02x ] %8u / %u", bytes_to_recover[0], bytes_to_recover[1], bytes_to_recover[2], brute, 0xFFFFFF);
+                }
+            } else if (numbytes_to_recover == 2) {
+                if ((brute > 0) && ((brute & 0x3F) == 0))
+                    PrintAndLogEx(INPLACE, "[ %02x %02x ] %5u / %u" _CLR_, bytes_to_recover[0], bytes_to_recover[1], brute, 0xFFFF);
+            } else {
+                if ((brute > 0) && ((brute & 0x1F) == 0))
+                    PrintAndLogEx(INPLACE, "[ %02x ] %3u / %u" _CLR_, bytes_to_recover[0], brute, 0xFF);
             }
-            __atomic_store_n(&loclass_found, targ->thread_idx, __ATOMIC_SEQ_CST);
-            pthread_exit((void *)r);
         }
 
-        brute += loclass_tc;
+        // Calc mac
+        doMAC_bitsliced(cc_nr, div_keys, cnt, macs);
 
-#define _CLR_ "\x1b[0K"
+        for (size_t c = 0; c < cnt; c++) {
+
+            // success
+            if (memcmp(macs + (c * 4), mac, 4) == 0) {
+
+                loclass_thread_ret_t *r = (loclass_thread_ret_t *)calloc(sizeof(loclass_thread_ret_t), sizeof(uint8_t));
+                if (r == NULL) {
+                    PrintAndLogEx(WARNING, "Failed to allocate memory");
+                    pthread_exit(NULL);
+                }
 
-        if (numbytes_to_recover == 3) {
-            if ((brute > 0) && ((brute & 0xFFFF) == 0)) {
-                PrintAndLogEx(INPLACE, "[ %02x %02x %02x ] %8u / %u", bytes_to_recover[0], bytes_to_recover[1], bytes_to_recover[2], brute, 0xFFFFFF);
+                for (uint8_t i = 0 ; i < numbytes_to_recover; i++) {
+                    r->values[i] = (brutes[c] >> (i * 8)) & 0xFF;
+                }
+                __atomic_store_n(&loclass_found, targ->thread_idx, __ATOMIC_SEQ_CST);
+                pthread_exit((void *)r);
             }
-        } else if (numbytes_to_recover == 2) {
-            if ((brute > 0) && ((brute & 0x3F) == 0))
-                PrintAndLogEx(INPLACE, "[ %02x %02x ] %5u / %u" _CLR_, bytes_to_recover[0], bytes_to_recover[1], brute, 0xFFFF);
-        } else {
-            if ((brute > 0) && ((brute & 0x1F) == 0))
-                PrintAndLogEx(INPLACE, "[ %02x ] %3u / %u" _CLR_, bytes_to_recover[0], brute, 0xFF);
         }
     }
     pthread_exit(NULL);
@@ -20,6 +20,7 @@
 #include "pm3_cmd.h"
 #include "fileutils.h"
 #include "jansson.h"
+#include "aidsearch.h"
 
 // NXP Appnote AN10787 - Application Directory (MAD)
 typedef enum {
@@ -217,7 +218,8 @@ const char *nxp_cluster_to_text(uint8_t cluster) {
     return "Reserved";
 }
 
-static json_t *df_known_aids = NULL;
+// aid_desfire.json, loaded and indexed on first use
+static aid_index_t df_known_aids = {0};
 
 static int open_aiddf_file(json_t **root, bool verbose) {
 
@@ -255,9 +257,18 @@ out:
     return retval;
 }
 
-static int close_aiddf_file(json_t *root) {
+static int load_aiddf_index(void) {
+    if (df_known_aids.root) {
+        return PM3_SUCCESS;
+    }
+
+    json_t *root = NULL;
+    int res = open_aiddf_file(&root, false);
+    if (res == PM3_SUCCESS) {
+        res = AIDIndexBuild(&df_known_aids, root);
+    }
     json_decref(root);
-    return PM3_SUCCESS;
+    return res;
 }
 
 static const char *aiddf_json_get_str(json_t *data, const char *name) {
@@ -278,26 +289,15 @@ static const char *aiddf_json_get_str(json_t *data, const char *name) {
     return cstr;
 }
 
-static int print_aiddf_description(json_t *root, uint8_t aid[3], char *fmt, bool verbose) {
+static int print_aiddf_description(uint8_t aid[3], char *fmt, bool verbose) {
     char laid[7] = {0};
-    snprintf(laid, sizeof(laid), "%02x%02x%02x", aid[2], aid[1], aid[0]); // must be lowercase
-
-    json_t *elm = NULL;
+    snprintf(laid, sizeof(laid), "%02X%02X%02X", aid[2], aid[1], aid[0]);
 
-    for (uint32_t idx = 0; idx < json_array_size(root); idx++) {
-        json_t *data = json_array_get(root, idx);
-        if (!json_is_object(data)) {
-            PrintAndLogEx(ERR, "data [%d] is not an object\n", idx);
-            continue;
-        }
-        const char *faid = aiddf_json_get_str(data, "AID");
-        char lfaid[strlen(faid) + 1];
-        strcpy(lfaid, faid);
-        str_lower(lfaid);
-        if (strcmp(laid, lfaid) == 0) {
-            elm = data;
-            break;
-        }
+    // exact match only
+    size_t matchlen = 0;
+    json_t *elm = AIDIndexFind(&df_known_aids, laid, &matchlen);
+    if (matchlen != strlen(laid)) {
+        elm = NULL;
     }
 
     if (elm == NULL) {
@@ -335,11 +335,10 @@ static int print_aiddf_description(json_t *root, uint8_t aid[3], char *fmt, bool
 }
 
 int AIDDFDecodeAndPrint(uint8_t aid[3]) {
-    open_aiddf_file(&df_known_aids, false);
+    load_aiddf_index();
 
     char fmt[80];
     snprintf(fmt, sizeof(fmt), "  DF AID Function... %02X%02X%02X  :" _YELLOW_("%s"), aid[2], aid[1], aid[0], "%s");
-    print_aiddf_description(df_known_aids, aid, fmt, false);
-    close_aiddf_file(df_known_aids);
+    print_aiddf_description(aid, fmt, false);
     return PM3_SUCCESS;
 }
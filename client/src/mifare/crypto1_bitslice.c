@@ -0,0 +1,204 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Bitsliced crypto1
+//
+// The kernel in crypto1_bitslice_core.h is instantiated once per instruction
+// set, like the bitsliced iClass MAC, and picked at runtime with the
+// hardnested SIMD detection.
+//-----------------------------------------------------------------------------
+
+#include "crypto1_bitslice.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "crapto1/crapto1.h"
+#include "ui.h"
+#include "util_posix.h"
+#include "hardnested_bf_core.h"   // SIMD detection
+
+// nt, nr, ar and at words
+#define CRYPTO1_BS_CLOCKS   128
+
+#if defined(COMPILER_HAS_SIMD_AVX512)
+#define BS_LANES    512
+#define BS_TARGET   __attribute__((target("avx512f")))
+#define BS_FN       crypto1_bitsliced_AVX512
+#include "crypto1_bitslice_core.h"
+#undef BS_LANES
+#undef BS_TARGET
+#undef BS_FN
+#endif
+
+#if defined(COMPILER_HAS_SIMD_X86)
+#define BS_LANES    256
+#define BS_TARGET   __attribute__((target("avx2")))
+#define BS_FN       crypto1_bitsliced_AVX2
+#include "crypto1_bitslice_core.h"
+#undef BS_LANES
+#undef BS_TARGET
+#undef BS_FN
+
+#define BS_LANES    128
+#define BS_TARGET   __attribute__((target("sse2")))
+#define BS_FN       crypto1_bitsliced_SSE2
+#include "crypto1_bitslice_core.h"
+#undef BS_LANES
+#undef BS_TARGET
+#undef BS_FN
+#endif
+
+#if defined(COMPILER_HAS_SIMD_NEON)
+#define BS_LANES    128
+#define BS_TARGET
+#define BS_FN       crypto1_bitsliced_NEON
+#include "crypto1_bitslice_core.h"
+#undef BS_LANES
+#undef BS_TARGET
+#undef BS_FN
+#endif
+
+#define BS_LANES    64
+#define BS_TARGET
+#define BS_FN       crypto1_bitsliced_NOSIMD
+#include "crypto1_bitslice_core.h"
+#undef BS_LANES
+#undef BS_TARGET
+#undef BS_FN
+
+typedef void crypto1_bitsliced_t(const uint64_t *, size_t, uint32_t, uint32_t, uint32_t *);
+
+typedef struct {
+    crypto1_bitsliced_t *fn;
+    size_t lanes;
+    const char *name;
+} crypto1_bitsliced_impl_t;
+
+static crypto1_bitsliced_impl_t crypto1_bitsliced_select(void) {
+    switch (GetSIMDInstrAuto()) {
+#if defined(COMPILER_HAS_SIMD_AVX512)
+        case SIMD_AVX512:
+            return (crypto1_bitsliced_impl_t) { crypto1_bitsliced_AVX512, 512, "AVX512" };
+#endif
+#if defined(COMPILER_HAS_SIMD_X86)
+        case SIMD_AVX2:
+            return (crypto1_bitsliced_impl_t) { crypto1_bitsliced_AVX2, 256, "AVX2" };
+        // AVX1 has no 256 bit integer ops
+        case SIMD_AVX:
+        case SIMD_SSE2:
+            return (crypto1_bitsliced_impl_t) { crypto1_bitsliced_SSE2, 128, "SSE2" };
+        case SIMD_MMX:
+            return (crypto1_bitsliced_impl_t) { crypto1_bitsliced_NOSIMD, 64, "no SIMD" };
+#endif
+#if defined(COMPILER_HAS_SIMD_NEON)
+        case SIMD_NEON:
+            return (crypto1_bitsliced_impl_t) { crypto1_bitsliced_NEON, 128, "NEON" };
+#endif
+        case SIMD_AUTO:
+        case SIMD_NONE:
+        default:
+            return (crypto1_bitsliced_impl_t) { crypto1_bitsliced_NOSIMD, 64, "no SIMD" };
+    }
+}
+
+size_t crypto1_bitsliced_lanes(void) {
+    return crypto1_bitsliced_select().lanes;
+}
+
+const char *crypto1_bitsliced_instr(void) {
+    return crypto1_bitsliced_select().name;
+}
+
+void crypto1_auth_bitsliced(const uint64_t *keys, size_t n, uint32_t in_nt, uint32_t in_nr, uint32_t *ks) {
+
+    crypto1_bitsliced_impl_t impl = crypto1_bitsliced_select();
+
+    for (size_t i = 0; i < n; i += impl.lanes) {
+        size_t cnt = n - i;
+        if (cnt > impl.lanes) {
+            cnt = impl.lanes;
+        }
+        impl.fn(keys + i, cnt, in_nt, in_nr, ks + (i * 3));
+    }
+}
+
+#define BS_TEST_KEYS   (16 * CRYPTO1_BS_MAX_LANES)
+
+int crypto1_bitsliced_test(void) {
+
+    // odd count so the last batch is partial
+    const size_t n = BS_TEST_KEYS - 3;
+    const uint32_t in_nt = 0x5C7D9B2E;
+    const uint32_t in_nr = 0x1F3A5B7C;
+
+    uint64_t *keys = calloc(n, sizeof(uint64_t));
+    uint32_t *ks_s = calloc(n * 3, sizeof(uint32_t));
+    uint32_t *ks_bs = calloc(n * 3, sizeof(uint32_t));
+    if (keys == NULL || ks_s == NULL || ks_bs == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(keys);
+        free(ks_s);
+        free(ks_bs);
+        return PM3_EMALLOC;
+    }
+
+    uint64_t lfsr = 0x1BADF00D;
+    for (size_t i = 0; i < n; i++) {
+        lfsr = lfsr * 6364136223846793005ULL + 1442695040888963407ULL;
+        keys[i] = lfsr >> 16;
+    }
+    keys[0] = 0xFFFFFFFFFFFF;
+    keys[1] = 0;
+
+    uint64_t t1 = usclock();
+    for (size_t i = 0; i < n; i++) {
+        struct Crypto1State s;
+        crypto1_init(&s, keys[i]);
+        ks_s[(i * 3) + 0] = crypto1_word(&s, in_nt, 1);
+        crypto1_word(&s, in_nr, 1);
+        ks_s[(i * 3) + 1] = crypto1_word(&s, 0, 0);
+        ks_s[(i * 3) + 2] = crypto1_word(&s, 0, 0);
+    }
+    uint64_t t_scalar = usclock() - t1;
+
+    t1 = usclock();
+    crypto1_auth_bitsliced(keys, n, in_nt, in_nr, ks_bs);
+    uint64_t t_bs = usclock() - t1;
+
+    int res = PM3_SUCCESS;
+    if (memcmp(ks_s, ks_bs, n * 3 * sizeof(uint32_t)) == 0) {
+        PrintAndLogEx(SUCCESS, "bitsliced..... %s", _GREEN_("ok"));
+    } else {
+        PrintAndLogEx(FAILED, "bitsliced..... %s", _RED_("fail"));
+        res = PM3_ESOFT;
+    }
+
+    if (t_scalar == 0) t_scalar = 1;
+    if (t_bs == 0) t_bs = 1;
+
+    PrintAndLogEx(INFO, "  scalar..... " _YELLOW_("%.0f") " keys/s", (double)n * 1000000.0 / (double)t_scalar);
+    PrintAndLogEx(INFO, "  bitsliced.. " _YELLOW_("%.0f") " keys/s ( %zu lanes, %s )"
+                  , (double)n * 1000000.0 / (double)t_bs
+                  , crypto1_bitsliced_lanes()
+                  , crypto1_bitsliced_instr()
+                 );
+
+    free(keys);
+    free(ks_s);
+    free(ks_bs);
+    return res;
+}
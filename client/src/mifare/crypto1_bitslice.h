@@ -0,0 +1,43 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Bitsliced crypto1, many keys against the same nested authentication
+//-----------------------------------------------------------------------------
+
+#ifndef CRYPTO1_BITSLICE_H
+#define CRYPTO1_BITSLICE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// largest batch any kernel evaluates in one pass
+#define CRYPTO1_BS_MAX_LANES    512
+
+// keys evaluated per kernel pass on this CPU (64 .. 512)
+size_t crypto1_bitsliced_lanes(void);
+const char *crypto1_bitsliced_instr(void);
+
+// For every key, same as
+//   crypto1_init(s, key)
+//   ks[0] = crypto1_word(s, in_nt, 1)
+//           crypto1_word(s, in_nr, 1)
+//   ks[1] = crypto1_word(s, 0, 0)
+//   ks[2] = crypto1_word(s, 0, 0)
+// ks receives n * 3 words
+void crypto1_auth_bitsliced(const uint64_t *keys, size_t n, uint32_t in_nt, uint32_t in_nr, uint32_t *ks);
+
+int crypto1_bitsliced_test(void);
+
+#endif // CRYPTO1_BITSLICE_H
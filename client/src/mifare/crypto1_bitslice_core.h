@@ -0,0 +1,128 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Bitsliced crypto1 authentication keystream.
+//
+// No include guard on purpose, this file is included once per instruction set
+// by crypto1_bitslice.c with these defined:
+//   BS_LANES   number of keys per call (64, 128, 256, 512)
+//   BS_TARGET  function attribute enabling the instruction set, may be empty
+//   BS_FN      name of the generated function
+//
+// The 48 bit LFSR is kept as a stream x[], at clock t the crypto1 state is
+//   odd  bit i = x[t + 47 - 2i]
+//   even bit i = x[t + 46 - 2i]
+// so shifting is just moving t forward and the new bit goes to x[t + 48].
+//-----------------------------------------------------------------------------
+
+BS_TARGET
+static void BS_FN(const uint64_t *keys, size_t n, uint32_t in_nt, uint32_t in_nr, uint32_t *ks) {
+
+    typedef uint64_t bs_t __attribute__((vector_size(BS_LANES / 8)));
+    typedef union {
+        bs_t v;
+        uint64_t w[BS_LANES / 64];
+    } bs_u;
+
+    bs_u x[48 + CRYPTO1_BS_CLOCKS];
+    memset(x, 0, sizeof(bs_u) * 48);
+
+    // same bit order as crypto1_init()
+    for (size_t i = 0; i < n; i++) {
+        const uint8_t sh = i & 63;
+        const size_t w = i >> 6;
+        for (uint8_t p = 0; p < 48; p++) {
+            x[p].w[w] |= ((keys[i] >> ((47 - p) ^ 7)) & 1) << sh;
+        }
+    }
+
+    const bs_t zero = {0};
+    const bs_t ones = ~zero;
+
+    // 2^k entry truth table as a mux tree, v[] is scratch
+#define BS_LUT(table, k, in, v) do { \
+        _Pragma("GCC unroll 32") \
+        for (uint8_t j_ = 0; j_ < (1 << (k)); j_++) { \
+            (v)[j_] = (((table) >> j_) & 1) ? ones : zero; \
+        } \
+        _Pragma("GCC unroll 5") \
+        for (uint8_t l_ = 0; l_ < (k); l_++) { \
+            _Pragma("GCC unroll 16") \
+            for (uint8_t j_ = 0; j_ < (1 << ((k) - l_ - 1)); j_++) { \
+                (v)[j_] = (v)[2 * j_] ^ ((in)[l_] & ((v)[2 * j_] ^ (v)[2 * j_ + 1])); \
+            } \
+        } \
+    } while (0)
+
+    bs_t out[CRYPTO1_BS_CLOCKS];
+
+    for (uint8_t t = 0; t < CRYPTO1_BS_CLOCKS; t++) {
+
+        bs_t odd[20];
+        for (uint8_t i = 0; i < 20; i++) {
+            odd[i] = x[t + 47 - (2 * i)].v;
+        }
+
+        // filter(), the five 4 bit functions feed the 5 bit one
+        bs_t v[32], f[5];
+        BS_LUT((0xf22c0 >> 4) & 0xffff, 4, odd + 0, v);
+        f[4] = v[0];
+        BS_LUT((0x6c9c0 >> 3) & 0xffff, 4, odd + 4, v);
+        f[3] = v[0];
+        BS_LUT((0x3c8b0 >> 2) & 0xffff, 4, odd + 8, v);
+        f[2] = v[0];
+        BS_LUT((0x1e458 >> 1) & 0xffff, 4, odd + 12, v);
+        f[1] = v[0];
+        BS_LUT(0x0d938, 4, odd + 16, v);
+        f[0] = v[0];
+        BS_LUT(0xEC57E80A, 5, f, v);
+        out[t] = v[0];
+
+        // nt and nr are fed encrypted, then 64 bits of keystream with no input
+        bs_t fb = zero;
+        if (t < 32) {
+            fb = out[t] ^ ((((in_nt >> (t ^ 24)) & 1)) ? ones : zero);
+        } else if (t < 64) {
+            fb = out[t] ^ ((((in_nr >> ((t - 32) ^ 24)) & 1)) ? ones : zero);
+        }
+
+        for (uint8_t i = 0; i < 24; i++) {
+            if ((LF_POLY_ODD >> i) & 1) {
+                fb ^= x[t + 47 - (2 * i)].v;
+            }
+            if ((LF_POLY_EVEN >> i) & 1) {
+                fb ^= x[t + 46 - (2 * i)].v;
+            }
+        }
+        x[t + 48].v = fb;
+    }
+
+#undef BS_LUT
+
+    // transpose back into the words crypto1_word() would return
+    memset(ks, 0, n * 3 * sizeof(uint32_t));
+    for (uint8_t t = 0; t < CRYPTO1_BS_CLOCKS; t++) {
+        // nr keystream is not needed
+        if (t >= 32 && t < 64) {
+            continue;
+        }
+        bs_u o = { .v = out[t] };
+        const uint8_t word = (t < 32) ? 0 : (t >> 5) - 1;
+        const uint8_t bit = (t & 31) ^ 24;
+        for (size_t i = 0; i < n; i++) {
+            ks[(i * 3) + word] |= (uint32_t)((o.w[i >> 6] >> (i & 63)) & 1) << bit;
+        }
+    }
+}
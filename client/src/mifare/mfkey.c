@@ -18,7 +18,12 @@
 //-----------------------------------------------------------------------------
 #include "mfkey.h"
 
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
 #include "crapto1/crapto1.h"
+#include "util.h"               // num_CPUs
 
 // MIFARE
 int inline compare_uint64(const void *a, const void *b) {
@@ -49,6 +54,137 @@ uint32_t intersection(uint64_t *listA, uint64_t *listB) {
     return p3 - listA;
 }
 
+typedef struct {
+    const lfsr_recovery32_split_t *split;
+    uint32_t ks2;
+    uint32_t ks3;
+    uint32_t first;     // bucket or start state
+    uint32_t step;      // bucket stride or end state
+    struct Crypto1State *states;
+} recovery_thread_arg_t;
+
+static void
+#ifdef __has_attribute
+#if __has_attribute(force_align_arg_pointer)
+__attribute__((force_align_arg_pointer))
+#endif
+#endif
+*recovery32_thread(void *arg) {
+    recovery_thread_arg_t *a = (recovery_thread_arg_t *)arg;
+    a->states = lfsr_recovery32_buckets(a->split, a->first, a->step);
+    return NULL;
+}
+
+static void
+#ifdef __has_attribute
+#if __has_attribute(force_align_arg_pointer)
+__attribute__((force_align_arg_pointer))
+#endif
+#endif
+*recovery64_thread(void *arg) {
+    recovery_thread_arg_t *a = (recovery_thread_arg_t *)arg;
+    a->states = lfsr_recovery64_range(a->ks2, a->ks3, a->first, a->step);
+    return NULL;
+}
+
+// run the workers, the last one on the calling thread, and join their lists in argument order
+static struct Crypto1State *recovery_run(void *(*worker)(void *), recovery_thread_arg_t *args, uint32_t num_threads) {
+
+    pthread_t thread_id[num_threads];
+    bool started[num_threads];
+
+    for (uint32_t i = 0; i < num_threads; i++) {
+        started[i] = (i < num_threads - 1) && (pthread_create(&thread_id[i], NULL, worker, &args[i]) == 0);
+        if (started[i] == false) {
+            worker(&args[i]);
+        }
+    }
+
+    size_t total = 0;
+    bool failed = false;
+    for (uint32_t i = 0; i < num_threads; i++) {
+        if (started[i]) {
+            pthread_join(thread_id[i], NULL);
+        }
+        if (args[i].states == NULL) {
+            failed = true;
+            continue;
+        }
+        for (struct Crypto1State *p = args[i].states; p->odd | p->even; p++) {
+            total++;
+        }
+    }
+
+    struct Crypto1State *statelist = NULL;
+    if (failed == false) {
+        statelist = calloc(total + 1, sizeof(struct Crypto1State));
+    }
+
+    size_t n = 0;
+    for (uint32_t i = 0; i < num_threads; i++) {
+        if (statelist != NULL && args[i].states != NULL) {
+            for (struct Crypto1State *p = args[i].states; p->odd | p->even; p++) {
+                statelist[n++] = *p;
+            }
+        }
+        free(args[i].states);
+    }
+    return statelist;
+}
+
+// lfsr_recovery32() with the independent buckets of the second half spread over threads.
+// Same states, the order of the list differs.
+struct Crypto1State *lfsr_recovery32_mt(uint32_t ks2, uint32_t in, uint32_t num_threads) {
+    if (num_threads == 0) {
+        num_threads = num_CPUs();
+    }
+    if (num_threads <= 1) {
+        return lfsr_recovery32(ks2, in);
+    }
+
+    lfsr_recovery32_split_t *split = lfsr_recovery32_split(ks2, in);
+    if (split == NULL) {
+        return NULL;
+    }
+
+    uint32_t num_buckets = lfsr_recovery32_num_buckets(split);
+    if (num_threads > num_buckets) {
+        num_threads = (num_buckets) ? num_buckets : 1;
+    }
+
+    recovery_thread_arg_t args[num_threads];
+    for (uint32_t i = 0; i < num_threads; i++) {
+        args[i] = (recovery_thread_arg_t) { .split = split, .first = i, .step = num_threads };
+    }
+
+    struct Crypto1State *statelist = recovery_run(recovery32_thread, args, num_threads);
+    lfsr_recovery32_split_free(split);
+    return statelist;
+}
+
+// lfsr_recovery64() with the start states split in ranges, same list in the same order
+struct Crypto1State *lfsr_recovery64_mt(uint32_t ks2, uint32_t ks3, uint32_t num_threads) {
+    if (num_threads == 0) {
+        num_threads = num_CPUs();
+    }
+    if (num_threads <= 1) {
+        return lfsr_recovery64(ks2, ks3);
+    }
+
+    // lfsr_recovery64 walks the start states downwards, so the first thread takes the top range
+    const uint32_t states = 1 << 20;
+    recovery_thread_arg_t args[num_threads];
+    for (uint32_t i = 0; i < num_threads; i++) {
+        args[i] = (recovery_thread_arg_t) {
+            .ks2 = ks2,
+            .ks3 = ks3,
+            .first = (uint32_t)((uint64_t)states * (num_threads - 1 - i) / num_threads),
+            .step = (uint32_t)((uint64_t)states * (num_threads - i) / num_threads),
+        };
+    }
+    return recovery_run(recovery64_thread, args, num_threads);
+}
+
 // Darkside attack (hf mf mifare)
 // if successful it will return a list of keys, not just one.
 uint32_t nonce2key(uint32_t uid, uint32_t nt, uint32_t nr, uint32_t ar, uint64_t par_info, uint64_t ks_info, uint64_t **keys) {
@@ -106,7 +242,7 @@ bool mfkey32(nonces_t *data, uint64_t *outputkey) {
 
     uint32_t p640 = prng_successor(data->nonce, 64);
 
-    s = lfsr_recovery32(data->ar ^ p640, 0);
+    s = lfsr_recovery32_mt(data->ar ^ p640, 0, 0);
 
     for (t = s; t->odd | t->even; ++t) {
         lfsr_rollback_word(t, 0, 0);
@@ -138,7 +274,7 @@ bool mfkey32_moebius(nonces_t *data, uint64_t *outputkey) {
     uint32_t p640 = prng_successor(data->nonce, 64);
     uint32_t p641 = prng_successor(data->nonce2, 64);
 
-    s = lfsr_recovery32(data->ar ^ p640, 0);
+    s = lfsr_recovery32_mt(data->ar ^ p640, 0, 0);
 
     for (t = s; t->odd | t->even; ++t) {
         lfsr_rollback_word(t, 0, 0);
@@ -175,7 +311,7 @@ bool mfkey32_nested(nonces_t *data, uint64_t *outputkey) {
     uint32_t ar_enc = data->ar;
     uint32_t ks0 = nt_enc ^ nt;
     uint32_t ks2 = ar_enc ^ ar;
-    s = lfsr_recovery32(ks0, uid ^ nt);
+    s = lfsr_recovery32_mt(ks0, uid ^ nt, 0);
     for (t = s; t->odd | t->even; ++t) {
         crypto1_word(t, nr_enc, 1);
         if (ks2 == crypto1_word(t, 0, 0)) {
@@ -202,7 +338,7 @@ int mfkey64(nonces_t *data, uint64_t *outputkey) {
     // Extract the keystream from the messages
     ks2 = data->ar ^ prng_successor(data->nonce, 64);
     ks3 = data->at ^ prng_successor(data->nonce, 96);
-    revstate = lfsr_recovery64(ks2, ks3);
+    revstate = lfsr_recovery64_mt(ks2, ks3, 0);
     lfsr_rollback_word(revstate, 0, 0);
     lfsr_rollback_word(revstate, 0, 0);
     lfsr_rollback_word(revstate, data->nr, 1);
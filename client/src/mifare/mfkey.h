@@ -22,6 +22,7 @@
 
 #include "common.h"
 #include "mifare.h"
+#include "crapto1/crapto1.h"
 
 uint32_t nonce2key(uint32_t uid, uint32_t nt, uint32_t nr, uint32_t ar, uint64_t par_info, uint64_t ks_info, uint64_t **keys);
 bool mfkey32(nonces_t *data, uint64_t *outputkey);
@@ -29,6 +30,10 @@ bool mfkey32_moebius(nonces_t *data, uint64_t *outputkey);
 bool mfkey32_nested(nonces_t *data, uint64_t *outputkey);
 int mfkey64(nonces_t *data, uint64_t *outputkey);
 
+// threaded lfsr_recovery32 / lfsr_recovery64, num_threads 0 uses all CPUs
+struct Crypto1State *lfsr_recovery32_mt(uint32_t ks2, uint32_t in, uint32_t num_threads);
+struct Crypto1State *lfsr_recovery64_mt(uint32_t ks2, uint32_t ks3, uint32_t num_threads);
+
 int compare_uint64(const void *a, const void *b);
 uint32_t intersection(uint64_t *listA, uint64_t *listB);
 
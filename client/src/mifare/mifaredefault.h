@@ -42,6 +42,8 @@
 #define MIFARE_1K_EV1_MAXSECTOR (MIFARE_1K_MAXSECTOR + 2)
 #define MIFARE_MINI_MAXSECTOR   5
 
+#define MIFARE_MAX_BLOCKS_PER_SECTOR 16
+
 #define MIFARE_4K_MAX_BYTES     4096
 #define MIFARE_2K_MAX_BYTES     2048
 #define MIFARE_1K_MAX_BYTES     1024
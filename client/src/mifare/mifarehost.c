@@ -496,6 +496,45 @@ inline static int Compare16Bits(const void *a, const void *b) {
     return -1;
 }
 
+// Same order as qsort with Compare16Bits (descending), two stable counting passes,
+// odd byte first then even byte. Falls back to qsort if no scratch memory.
+static void sort16bits(struct Crypto1State *states, size_t len) {
+
+    struct Crypto1State *tmp = calloc(len, sizeof(struct Crypto1State));
+    if (tmp == NULL) {
+        qsort(states, len, sizeof(uint64_t), Compare16Bits);
+        return;
+    }
+
+    struct Crypto1State *src = states, *dst = tmp;
+    for (uint8_t pass = 0; pass < 2; pass++) {
+        size_t count[256] = {0};
+        for (size_t i = 0; i < len; i++) {
+            uint32_t v = (pass == 0) ? src[i].odd : src[i].even;
+            count[(v >> 16) & 0xff]++;
+        }
+
+        // descending, bucket 0xff goes first
+        size_t pos = 0;
+        for (int b = 0xff; b >= 0; b--) {
+            size_t c = count[b];
+            count[b] = pos;
+            pos += c;
+        }
+
+        for (size_t i = 0; i < len; i++) {
+            uint32_t v = (pass == 0) ? src[i].odd : src[i].even;
+            dst[count[(v >> 16) & 0xff]++] = src[i];
+        }
+
+        struct Crypto1State *t = src;
+        src = dst;
+        dst = t;
+    }
+    // even number of passes, result is back in states
+    free(tmp);
+}
+
 // wrapper function for multi-threaded lfsr_recovery32
 static void
 #ifdef __has_attribute
@@ -506,14 +545,18 @@ __attribute__((force_align_arg_pointer))
 *nested_worker_thread(void *arg) {
     struct Crypto1State *p1;
     StateList_t *statelist = arg;
-    statelist->head.slhead = lfsr_recovery32(statelist->ks1, statelist->nt_enc ^ statelist->uid);
+    // two of these run side by side, each gets half of the CPUs
+    statelist->head.slhead = lfsr_recovery32_mt(statelist->ks1, statelist->nt_enc ^ statelist->uid, MAX(1, num_CPUs() / 2));
+    if (statelist->head.slhead == NULL) {
+        return NULL;
+    }
 
     for (p1 = statelist->head.slhead; p1->odd | p1->even; p1++) {};
 
     statelist->len = p1 - statelist->head.slhead;
     statelist->tail.sltail = --p1;
 
-    qsort(statelist->head.slhead, statelist->len, sizeof(uint64_t), Compare16Bits);
+    sort16bits(statelist->head.slhead, statelist->len);
 
     return statelist->head.slhead;
 }
@@ -589,6 +632,13 @@ int mf_nested(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trgBlockNo
     for (uint8_t i = 0; i < 2; i++)
         pthread_join(thread_id[i], (void *)&statelists[i].head.slhead);
 
+    if (statelists[0].head.slhead == NULL || statelists[1].head.slhead == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(statelists[0].head.slhead);
+        free(statelists[1].head.slhead);
+        return PM3_EMALLOC;
+    }
+
     // the first 16 Bits of the cryptostate already contain part of our key.
     // Create the intersection of the two lists based on these 16 Bits and
     // roll back the cryptostate
@@ -771,6 +821,13 @@ int mf_static_nested(uint8_t blockNo, uint8_t keyType, uint8_t *key, uint8_t trg
     for (uint8_t i = 0; i < 2; i++)
         pthread_join(thread_id[i], (void *)&statelists[i].head.slhead);
 
+    if (statelists[0].head.slhead == NULL || statelists[1].head.slhead == NULL) {
+        PrintAndLogEx(WARNING, "Failed to allocate memory");
+        free(statelists[0].head.slhead);
+        free(statelists[1].head.slhead);
+        return PM3_EMALLOC;
+    }
+
     // the first 16 Bits of the cryptostate already contain part of our key.
     // Create the intersection of the two lists based on these 16 Bits and
     // roll back the cryptostate
@@ -1329,7 +1386,7 @@ int try_decrypt_word(uint32_t nt, uint32_t ar_enc, uint32_t at_enc, uint8_t *dat
     uint32_t ks2 = ar_enc ^ prng_successor(nt, 64);
     uint32_t ks3 = at_enc ^ prng_successor(nt, 96);
 
-    struct Crypto1State *s = lfsr_recovery64(ks2, ks3);
+    struct Crypto1State *s = lfsr_recovery64_mt(ks2, ks3, 0);
     mf_crypto1_decrypt(s, data, len, false);
     PrintAndLogEx(SUCCESS, "decrypted data... " _YELLOW_("%s"), sprint_hex(data, len));
     PrintAndLogEx(NORMAL, "");
@@ -22,6 +22,7 @@
 #include "proxguiqt.h"
 #include "proxmark3.h"
 #include "ui.h"  // for prints
+#include "demodctx.h"
 
 static ProxGuiQT *gui = NULL;
 static WorkerThread *main_loop_thread = NULL;
@@ -62,6 +63,10 @@ extern "C" void RepaintGraphWindow(void) {
     if (!gui)
         return;
 
+    // demodulating in a worker context, nothing to show
+    if (demod_ctx_is_main() == false)
+        return;
+
     gui->RepaintGraphWindow();
 }
 
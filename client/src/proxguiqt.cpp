@@ -339,6 +339,7 @@ void ProxWidget::applyOperation() {
     //printf("ApplyOperation()");
     //g_saveState_gb = save_bufferS32(g_GraphBuffer, g_GraphTraceLen);
     memcpy(g_GraphBuffer, g_OverlayBuffer, sizeof(int) * g_GraphTraceLen);
+    graph_changed();
     RepaintGraphWindow();
 }
 void ProxWidget::stickOperation() {
@@ -822,7 +823,7 @@ void Plot::drawAnnotations(QRect annotationRect, QPainter *painter) {
     uint32_t pos = 0, loc = 375;
     painter->setPen(WHITE);
 
-    if (g_MarkerA.pos > 0) {
+    if (g_MarkerA.pos > 0 && g_MarkerA.pos < g_GraphTraceLen) {
         free(annotation);
 
         length = (sizeof(markerText) + (sizeof(uint32_t) * 3) + sizeof(" ") + 1);
@@ -1230,6 +1231,7 @@ void Plot::Trim(void) {
     }
 
     g_GraphTraceLen = rref - lref;
+    graph_changed();
     g_GraphStart = 0;
 }
 
@@ -1451,6 +1453,9 @@ void Plot::keyPressEvent(QKeyEvent *event) {
             break;
 
         case Qt::Key_Equal:
+            if (g_MarkerA.pos >= g_GraphTraceLen) {
+                break;
+            }
             if (event->modifiers() & Qt::ControlModifier) {
                 g_OperationBuffer[g_MarkerA.pos] += 5;
             } else {
@@ -1461,6 +1466,9 @@ void Plot::keyPressEvent(QKeyEvent *event) {
             break;
 
         case Qt::Key_Minus:
+            if (g_MarkerA.pos >= g_GraphTraceLen) {
+                break;
+            }
             if (event->modifiers() & Qt::ControlModifier) {
                 g_OperationBuffer[g_MarkerA.pos] -= 5;
             } else {
@@ -1471,21 +1479,29 @@ void Plot::keyPressEvent(QKeyEvent *event) {
             break;
 
         case Qt::Key_Plus:
+            if (g_MarkerA.pos >= g_GraphTraceLen) {
+                break;
+            }
             if (event->modifiers() & Qt::ControlModifier) {
                 g_GraphBuffer[g_MarkerA.pos] += 5;
             } else {
                 g_GraphBuffer[g_MarkerA.pos] += 1;
             }
+            graph_changed();
 
             RepaintGraphWindow();
             break;
 
         case Qt::Key_Underscore:
+            if (g_MarkerA.pos >= g_GraphTraceLen) {
+                break;
+            }
             if (event->modifiers() & Qt::ControlModifier) {
                 g_GraphBuffer[g_MarkerA.pos] -= 5;
             } else {
                 g_GraphBuffer[g_MarkerA.pos] -= 1;
             }
+            graph_changed();
 
             RepaintGraphWindow();
             break;
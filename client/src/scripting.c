@@ -48,6 +48,7 @@
 #include "cmdlfem4x50.h"  // read 4350
 #include "em4x50.h"       // 4x50 structs
 #include "iso7816/iso7816core.h"  // ISODEPSTATE
+#include "aidsearch.h"     // AID lookup
 
 static int returnToLuaWithError(lua_State *L, const char *fmt, ...) {
     char buffer[1024];
@@ -1292,6 +1293,36 @@ static int l_set_iso_dep_state(lua_State *L) {
     return 1;
 }
 
+// Called with 1 parameter.
+// aid       ,string containing the hex representation of the AID
+//
+// outputs:  table with the string fields of the longest known AID which is a prefix of aid,
+//           AID, Vendor, Name, Country, Description, Type. nil if there is none
+static int l_aid_lookup(lua_State *L) {
+    int n = lua_gettop(L);
+    if (n != 1)  {
+        return returnToLuaWithError(L, "Only one AID allowed");
+    }
+
+    const char *aid = luaL_checkstring(L, 1);
+    json_t *elm = AIDSearchFind(aid);
+    if (elm == NULL) {
+        lua_pushnil(L);
+        return 1;
+    }
+
+    lua_newtable(L);
+    const char *key;
+    json_t *value;
+    json_object_foreach(elm, key, value) {
+        if (json_is_string(value)) {
+            lua_pushstring(L, json_string_value(value));
+            lua_setfield(L, -2, key);
+        }
+    }
+    return 1;
+}
+
 // 1. filename
 // 2. extension
 // output: full search path to file
@@ -1444,6 +1475,7 @@ int set_pm3_libraries(lua_State *L) {
         {"em4x50_read",                 l_em4x50_read},
         {"ul_read_uid",                 l_ul_read_uid},
         {"set_isodepstate",             l_set_iso_dep_state},
+        {"aid_lookup",                  l_aid_lookup},
         {NULL, NULL}
     };
 
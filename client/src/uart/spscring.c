@@ -0,0 +1,146 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Lock-free single-producer / single-consumer byte ring
+//-----------------------------------------------------------------------------
+#include "spscring.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+SpscRing *SpscRing_create(size_t capacity) {
+
+    if (capacity == 0) {
+        return NULL;
+    }
+
+    // round up to next power of two
+    size_t cap = 1;
+    while (cap < capacity) {
+        cap <<= 1;
+    }
+
+    SpscRing *ring = (SpscRing *)calloc(1, sizeof(SpscRing));
+    if (ring == NULL) {
+        return NULL;
+    }
+
+    ring->data = (uint8_t *)calloc(cap, sizeof(uint8_t));
+    if (ring->data == NULL) {
+        free(ring);
+        return NULL;
+    }
+
+    ring->capacity = cap;
+    ring->mask = cap - 1;
+    return ring;
+}
+
+void SpscRing_destroy(SpscRing *ring) {
+    if (ring != NULL) {
+        free(ring->data);
+    }
+    free(ring);
+}
+
+void SpscRing_reset(SpscRing *ring) {
+    __atomic_store_n(&ring->head, 0, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&ring->tail, 0, __ATOMIC_SEQ_CST);
+}
+
+size_t SpscRing_getUsedSize(const SpscRing *ring) {
+    size_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    size_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    return head - tail;
+}
+
+size_t SpscRing_getAvailableSize(const SpscRing *ring) {
+    return ring->capacity - SpscRing_getUsedSize(ring);
+}
+
+size_t SpscRing_writePeek(SpscRing *ring, uint8_t **ptr) {
+    // head is ours, tail is published by the consumer
+    size_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    size_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+
+    size_t free_bytes = ring->capacity - (head - tail);
+    size_t offset = head & ring->mask;
+    size_t contiguous = ring->capacity - offset;
+
+    *ptr = ring->data + offset;
+    return (free_bytes < contiguous) ? free_bytes : contiguous;
+}
+
+void SpscRing_writeCommit(SpscRing *ring, size_t count) {
+    // no check there, count must not exceed what SpscRing_writePeek returned
+    size_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    __atomic_store_n(&ring->head, head + count, __ATOMIC_RELEASE);
+}
+
+size_t SpscRing_write(SpscRing *ring, const uint8_t *src, size_t count) {
+    size_t done = 0;
+    // at most two rounds, before and after the wrap
+    while (done < count) {
+        uint8_t *p;
+        size_t n = SpscRing_writePeek(ring, &p);
+        if (n == 0) {
+            break;
+        }
+        if (n > count - done) {
+            n = count - done;
+        }
+        memcpy(p, src + done, n);
+        SpscRing_writeCommit(ring, n);
+        done += n;
+    }
+    return done;
+}
+
+size_t SpscRing_readPeek(SpscRing *ring, const uint8_t **ptr) {
+    // tail is ours, head is published by the producer
+    size_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    size_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+    size_t used = head - tail;
+    size_t offset = tail & ring->mask;
+    size_t contiguous = ring->capacity - offset;
+
+    *ptr = ring->data + offset;
+    return (used < contiguous) ? used : contiguous;
+}
+
+void SpscRing_readCommit(SpscRing *ring, size_t count) {
+    // no check there, count must not exceed what SpscRing_readPeek returned
+    size_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    __atomic_store_n(&ring->tail, tail + count, __ATOMIC_RELEASE);
+}
+
+size_t SpscRing_read(SpscRing *ring, uint8_t *dst, size_t count) {
+    size_t done = 0;
+    while (done < count) {
+        const uint8_t *p;
+        size_t n = SpscRing_readPeek(ring, &p);
+        if (n == 0) {
+            break;
+        }
+        if (n > count - done) {
+            n = count - done;
+        }
+        memcpy(dst + done, p, n);
+        SpscRing_readCommit(ring, n);
+        done += n;
+    }
+    return done;
+}
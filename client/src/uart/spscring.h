@@ -0,0 +1,76 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Lock-free single-producer / single-consumer byte ring
+//
+// One thread writes, one other thread reads, no mutex involved.
+// Capacity is rounded up to a power of two so wrapping is a mask and the
+// head/tail counters can run freely. Both counters live on their own cache line.
+//
+// Zero-copy usage, producer side:
+//     uint8_t *p;
+//     size_t n = SpscRing_writePeek(ring, &p);   // contiguous free space at p
+//     n = fill(p, n);
+//     SpscRing_writeCommit(ring, n);
+//
+// consumer side:
+//     const uint8_t *p;
+//     size_t n = SpscRing_readPeek(ring, &p);    // contiguous data at p
+//     consume(p, n);
+//     SpscRing_readCommit(ring, n);
+//-----------------------------------------------------------------------------
+
+#ifndef SPSCRING_H__
+#define SPSCRING_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SPSCRING_CACHELINE 64
+
+typedef struct {
+    // written by the producer only
+    size_t head;
+    uint8_t pad_head[SPSCRING_CACHELINE - sizeof(size_t)];
+    // written by the consumer only
+    size_t tail;
+    uint8_t pad_tail[SPSCRING_CACHELINE - sizeof(size_t)];
+    // read only after creation
+    uint8_t *data;
+    size_t capacity;
+    size_t mask;
+} SpscRing;
+
+SpscRing *SpscRing_create(size_t capacity);
+void SpscRing_destroy(SpscRing *ring);
+
+// only when neither producer nor consumer are active
+void SpscRing_reset(SpscRing *ring);
+
+size_t SpscRing_getUsedSize(const SpscRing *ring);
+size_t SpscRing_getAvailableSize(const SpscRing *ring);
+
+// producer
+size_t SpscRing_writePeek(SpscRing *ring, uint8_t **ptr);
+void SpscRing_writeCommit(SpscRing *ring, size_t count);
+size_t SpscRing_write(SpscRing *ring, const uint8_t *src, size_t count);
+
+// consumer
+size_t SpscRing_readPeek(SpscRing *ring, const uint8_t **ptr);
+void SpscRing_readCommit(SpscRing *ring, size_t count);
+size_t SpscRing_read(SpscRing *ring, uint8_t *dst, size_t count);
+
+#endif
@@ -61,6 +61,8 @@ bool g_GridLocked = false;
 
 pthread_mutex_t g_print_lock = PTHREAD_MUTEX_INITIALIZER;
 
+static __thread print_deferred_t *print_deferred = NULL;
+
 static void fPrintAndLog(FILE *stream, const char *fmt, ...);
 
 #ifdef _WIN32
@@ -232,6 +234,56 @@ void PrintAndLogOptions(const char *str[][2], size_t size, size_t space) {
     PrintAndLogEx(NORMAL, "%s", buff);
 }
 
+void PrintAndLogDefer(print_deferred_t *d) {
+    print_deferred = d;
+}
+
+// entries are stored as level byte, message, nul
+static void defer_message(logLevel_t level, const char *fmt, va_list args) {
+    char buffer[MAX_PRINT_BUFFER] = {0};
+    vsnprintf(buffer, sizeof(buffer), fmt, args);
+
+    size_t len = strlen(buffer) + 2;
+    if (print_deferred->size - print_deferred->idx < len) {
+        size_t size = print_deferred->size + MAX(len, MAX_PRINT_BUFFER);
+        char *tmp = realloc(print_deferred->ptr, size);
+        if (tmp == NULL) {
+            return;
+        }
+        print_deferred->ptr = tmp;
+        print_deferred->size = size;
+    }
+
+    print_deferred->ptr[print_deferred->idx] = (char)level;
+    memcpy(print_deferred->ptr + print_deferred->idx + 1, buffer, len - 1);
+    print_deferred->idx += len;
+}
+
+void PrintAndLogDeferredFlush(print_deferred_t *d) {
+    if (d == NULL) {
+        return;
+    }
+
+    size_t i = 0;
+    while (i < d->idx) {
+        logLevel_t level = (logLevel_t)d->ptr[i];
+        const char *msg = d->ptr + i + 1;
+        PrintAndLogEx(level, "%s", msg);
+        i += strlen(msg) + 2;
+    }
+    PrintAndLogDeferredFree(d);
+}
+
+void PrintAndLogDeferredFree(print_deferred_t *d) {
+    if (d == NULL) {
+        return;
+    }
+    free(d->ptr);
+    d->ptr = NULL;
+    d->size = 0;
+    d->idx = 0;
+}
+
 static uint8_t PrintAndLogEx_spinidx = 0;
 
 void PrintAndLogEx(logLevel_t level, const char *fmt, ...) {
@@ -246,6 +298,14 @@ void PrintAndLogEx(logLevel_t level, const char *fmt, ...) {
         return;
     }
 
+    if (print_deferred != NULL) {
+        va_list args;
+        va_start(args, fmt);
+        defer_message(level, fmt, args);
+        va_end(args);
+        return;
+    }
+
     char prefix[40] = {0};
     char buffer[MAX_PRINT_BUFFER] = {0};
     char buffer2[MAX_PRINT_BUFFER + sizeof(prefix)] = {0};
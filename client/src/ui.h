@@ -82,6 +82,20 @@ void memcpy_filter_rlmarkers(void *dest, const void *src, size_t n);
 void memcpy_filter_emoji(void *dest, const void *src, size_t n, emojiMode_t mode);
 void free_grabber(void);
 
+// Output of the calling thread can be held back and printed later, used to
+// report results of parallel workers in a fixed order.
+typedef struct {
+    char *ptr;
+    size_t size;
+    size_t idx;
+} print_deferred_t;
+
+// start holding back this thread's output in d, NULL prints directly again
+void PrintAndLogDefer(print_deferred_t *d);
+// print what was held back in d and free it
+void PrintAndLogDeferredFlush(print_deferred_t *d);
+void PrintAndLogDeferredFree(print_deferred_t *d);
+
 int searchHomeFilePath(char **foundpath, const char *subdir, const char *filename, bool create_home);
 
 extern pthread_mutex_t g_print_lock;
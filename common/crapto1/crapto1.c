@@ -19,6 +19,7 @@
 #include "bucketsort.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include "parity.h"
 
 
@@ -155,6 +156,67 @@ recover(uint32_t *o_head, uint32_t *o_tail, uint32_t oks,
 
 
 #if !defined(__arm__) || defined(__linux__) || defined(_WIN32) || defined(__APPLE__) // bare metal ARM Proxmark lacks malloc()/free()
+/** alloc_buckets / free_buckets
+ * memory for out of place bucket_sort
+ */
+static bool alloc_buckets(bucket_array_t bucket) {
+    for (uint32_t i = 0; i < 2; i++) {
+        for (uint32_t j = 0; j <= 0xff; j++) {
+            bucket[i][j].head = calloc(1, sizeof(uint32_t) << 14);
+            if (!bucket[i][j].head)
+                return false;
+        }
+    }
+    return true;
+}
+
+static void free_buckets(bucket_array_t bucket) {
+    for (uint32_t i = 0; i < 2; i++)
+        for (uint32_t j = 0; j <= 0xff; j++)
+            free(bucket[i][j].head);
+}
+
+/** init_tables
+ * split the keystream into an odd and even part and fill the statelists with all states
+ * which could have generated the last 10 bits of it
+ */
+static bool init_tables(uint32_t ks2, uint32_t *oks, uint32_t *eks,
+                        uint32_t **odd_head, uint32_t **odd_tail, uint32_t **even_head, uint32_t **even_tail) {
+    register int i;
+
+    *oks = *eks = 0;
+    for (i = 31; i >= 0; i -= 2)
+        *oks = *oks << 1 | BEBIT(ks2, i);
+    for (i = 30; i >= 0; i -= 2)
+        *eks = *eks << 1 | BEBIT(ks2, i);
+
+    *odd_head = *odd_tail = calloc(1, sizeof(uint32_t) << 21);
+    *even_head = *even_tail = calloc(1, sizeof(uint32_t) << 21);
+    if (!*odd_head || !*even_head)
+        return false;
+    --*odd_tail;
+    --*even_tail;
+
+    // initialize statelists: add all possible states which would result into the rightmost 2 bits of the keystream
+    uint8_t oks_b1 = *oks & 1;
+    uint8_t eks_b1 = *eks & 1;
+    register uint8_t tbl_filter;
+    for (i = 1 << 20; i >= 0; --i) {
+        tbl_filter = filter(i);
+        if (tbl_filter == oks_b1)
+            *++*odd_tail = i;
+        if (tbl_filter == eks_b1)
+            *++*even_tail = i;
+    }
+
+    // extend the statelists. Look at the next 8 Bits of the keystream (4 Bit each odd and even):
+    for (i = 0; i < 4; i++) {
+        extend_table_simple(*odd_head,  odd_tail, (*oks >>= 1) & 1);
+        extend_table_simple(*even_head, even_tail, (*eks >>= 1) & 1);
+    }
+    return true;
+}
+
 /** lfsr_recovery
  * recover the state of the lfsr given 32 bits of the keystream
  * additionally you can use the in parameter to specify the value
@@ -164,70 +226,136 @@ struct Crypto1State *lfsr_recovery32(uint32_t ks2, uint32_t in) {
     struct Crypto1State *statelist;
     uint32_t *odd_head = 0, *odd_tail = 0, oks = 0;
     uint32_t *even_head = 0, *even_tail = 0, eks = 0;
-    register int i;
 
-    // split the keystream into an odd and even part
-    for (i = 31; i >= 0; i -= 2)
-        oks = oks << 1 | BEBIT(ks2, i);
-    for (i = 30; i >= 0; i -= 2)
-        eks = eks << 1 | BEBIT(ks2, i);
+    // allocate memory for out of place bucket_sort
+    bucket_array_t bucket = {0};
 
-    odd_head = odd_tail = calloc(1, sizeof(uint32_t) << 21);
-    even_head = even_tail = calloc(1, sizeof(uint32_t) << 21);
     statelist =  calloc(1, sizeof(struct Crypto1State) << 18);
-    if (!odd_tail-- || !even_tail-- || !statelist) {
+    if (!statelist)
+        goto out;
+
+    statelist->odd = statelist->even = 0;
+
+    if (!alloc_buckets(bucket) || !init_tables(ks2, &oks, &eks, &odd_head, &odd_tail, &even_head, &even_tail)) {
         free(statelist);
         statelist = 0;
         goto out;
     }
 
-    statelist->odd = statelist->even = 0;
+    // the statelists now contain all states which could have generated the last 10 Bits of the keystream.
+    // 22 bits to go to recover 32 bits in total. From now on, we need to take the "in"
+    // parameter into account.
+    in = (in >> 16 & 0xff) | (in << 16) | (in & 0xff00); // Byte swapping
+    recover(odd_head, odd_tail, oks, even_head, even_tail, eks, 11, statelist, in << 1, bucket);
 
-    // allocate memory for out of place bucket_sort
-    bucket_array_t bucket;
+out:
+    free_buckets(bucket);
+    free(odd_head);
+    free(even_head);
+    return statelist;
+}
 
-    for (i = 0; i < 2; i++) {
-        for (uint32_t j = 0; j <= 0xff; j++) {
-            bucket[i][j].head = calloc(1, sizeof(uint32_t) << 14);
-            if (!bucket[i][j].head) {
-                goto out;
-            }
-        }
+/** lfsr_recovery32_split
+ * first half of lfsr_recovery32, narrows the statelists down until they fall apart
+ * into buckets which can be recovered independently, e.g. by several threads
+ */
+struct lfsr_recovery32_split {
+    uint32_t *odd_head, *even_head;
+    uint32_t oks, eks, in;
+    int rem;
+    bucket_info_t bucket_info;
+};
+
+lfsr_recovery32_split_t *lfsr_recovery32_split(uint32_t ks2, uint32_t in) {
+    uint32_t *odd_tail = 0, *even_tail = 0;
+    bucket_array_t bucket = {0};
+
+    lfsr_recovery32_split_t *split = calloc(1, sizeof(lfsr_recovery32_split_t));
+    if (!split)
+        return 0;
+
+    if (!alloc_buckets(bucket) || !init_tables(ks2, &split->oks, &split->eks, &split->odd_head, &odd_tail, &split->even_head, &even_tail)) {
+        free_buckets(bucket);
+        lfsr_recovery32_split_free(split);
+        return 0;
     }
 
-    // initialize statelists: add all possible states which would result into the rightmost 2 bits of the keystream
-    uint8_t oks_b1 = oks & 1;
-    uint8_t eks_b1 = eks & 1;
-    register uint8_t tbl_filter;
-    for (i = 1 << 20; i >= 0; --i) {
-        tbl_filter = filter(i);
-        if (tbl_filter == oks_b1)
-            *++odd_tail = i;
-        if (tbl_filter == eks_b1)
-            *++even_tail = i;
+    // first level of recover()
+    in = (in >> 16 & 0xff) | (in << 16) | (in & 0xff00); // Byte swapping
+    in <<= 1;
+    split->rem = 11;
+    for (uint32_t i = 0; i < 4 && split->rem--; i++) {
+        split->oks >>= 1;
+        split->eks >>= 1;
+        in >>= 2;
+        extend_table(split->odd_head, &odd_tail, split->oks & 1, LF_POLY_EVEN << 1 | 1, LF_POLY_ODD << 1, 0);
+        if (split->odd_head > odd_tail)
+            goto out;
+
+        extend_table(split->even_head, &even_tail, split->eks & 1, LF_POLY_ODD, LF_POLY_EVEN << 1 | 1, in & 3);
+        if (split->even_head > even_tail)
+            goto out;
     }
+    split->in = in;
 
-    // extend the statelists. Look at the next 8 Bits of the keystream (4 Bit each odd and even):
-    for (i = 0; i < 4; i++) {
-        extend_table_simple(odd_head,  &odd_tail, (oks >>= 1) & 1);
-        extend_table_simple(even_head, &even_tail, (eks >>= 1) & 1);
+    bucket_sort_intersect(split->even_head, even_tail, split->odd_head, odd_tail, &split->bucket_info, bucket);
+
+out:
+    free_buckets(bucket);
+    return split;
+}
+
+uint32_t lfsr_recovery32_num_buckets(const lfsr_recovery32_split_t *split) {
+    return split->bucket_info.numbuckets;
+}
+
+/** lfsr_recovery32_buckets
+ * second half of lfsr_recovery32, recovers the states of buckets first, first + step, ...
+ * Every call works on private copies, so calls with different first can run in parallel.
+ */
+struct Crypto1State *lfsr_recovery32_buckets(const lfsr_recovery32_split_t *split, uint32_t first, uint32_t step) {
+    struct Crypto1State *statelist, *sl;
+    uint32_t *odd_head, *even_head;
+    bucket_array_t bucket = {0};
+
+    sl = statelist = calloc(1, sizeof(struct Crypto1State) << 18);
+    // recover() extends the tables in place, give every bucket the full table size to grow into
+    odd_head = malloc(sizeof(uint32_t) << 21);
+    even_head = malloc(sizeof(uint32_t) << 21);
+    if (!statelist || !odd_head || !even_head || !alloc_buckets(bucket)) {
+        free(statelist);
+        statelist = 0;
+        goto out;
     }
 
-    // the statelists now contain all states which could have generated the last 10 Bits of the keystream.
-    // 22 bits to go to recover 32 bits in total. From now on, we need to take the "in"
-    // parameter into account.
-    in = (in >> 16 & 0xff) | (in << 16) | (in & 0xff00); // Byte swapping
-    recover(odd_head, odd_tail, oks, even_head, even_tail, eks, 11, statelist, in << 1, bucket);
+    statelist->odd = statelist->even = 0;
+
+    // same order as recover() would take them
+    for (int i = split->bucket_info.numbuckets - 1 - first; i >= 0; i -= step) {
+        size_t odd_len = split->bucket_info.bucket_info[1][i].tail + 1 - split->bucket_info.bucket_info[1][i].head;
+        size_t even_len = split->bucket_info.bucket_info[0][i].tail + 1 - split->bucket_info.bucket_info[0][i].head;
+        memcpy(odd_head, split->bucket_info.bucket_info[1][i].head, odd_len * sizeof(uint32_t));
+        memcpy(even_head, split->bucket_info.bucket_info[0][i].head, even_len * sizeof(uint32_t));
+        sl = recover(odd_head, odd_head + odd_len - 1, split->oks,
+                     even_head, even_head + even_len - 1, split->eks,
+                     split->rem, sl, split->in, bucket);
+    }
 
 out:
-    for (i = 0; i < 2; i++)
-        for (uint32_t j = 0; j <= 0xff; j++)
-            free(bucket[i][j].head);
+    free_buckets(bucket);
     free(odd_head);
     free(even_head);
     return statelist;
 }
 
+void lfsr_recovery32_split_free(lfsr_recovery32_split_t *split) {
+    if (!split)
+        return;
+    free(split->odd_head);
+    free(split->even_head);
+    free(split);
+}
+
 static const uint32_t S1[] = {     0x62141, 0x310A0, 0x18850, 0x0C428, 0x06214,
                                    0x0310A, 0x85E30, 0xC69AD, 0x634D6, 0xB5CDE, 0xDE8DA, 0x6F46D, 0xB3C83,
                                    0x59E41, 0xA8995, 0xD027F, 0x6813F, 0x3409F, 0x9E6FA
@@ -256,6 +384,13 @@ static const uint32_t C2[] = { 0x1A822E0, 0x21A822E0, 0x21A822E0};
  * Variation mentioned in the paper. Somewhat optimized version
  */
 struct Crypto1State *lfsr_recovery64(uint32_t ks2, uint32_t ks3) {
+    return lfsr_recovery64_range(ks2, ks3, 0, 1 << 20);
+}
+
+/** lfsr_recovery64_range
+ * lfsr_recovery64 limited to the odd start states [from, to), ranges can be searched in parallel
+ */
+struct Crypto1State *lfsr_recovery64_range(uint32_t ks2, uint32_t ks3, uint32_t from, uint32_t to) {
     struct Crypto1State *statelist, *sl;
     uint8_t oks[32], eks[32], hi[32];
     uint32_t low = 0,  win = 0;
@@ -276,7 +411,7 @@ struct Crypto1State *lfsr_recovery64(uint32_t ks2, uint32_t ks3) {
         eks[16 + (i >> 1)] = BEBIT(ks3, i);
     }
 
-    for (i = 0xfffff; i >= 0; --i) {
+    for (i = (int)to - 1; i >= (int)from; --i) {
         if (filter(i) != oks[0])
             continue;
 
@@ -37,6 +37,14 @@ uint32_t prng_successor(uint32_t x, uint32_t n);
 #if !defined(__arm__) || defined(__linux__) || defined(_WIN32) || defined(__APPLE__) // bare metal ARM Proxmark lacks malloc()/free()
 struct Crypto1State *lfsr_recovery32(uint32_t ks2, uint32_t in);
 struct Crypto1State *lfsr_recovery64(uint32_t ks2, uint32_t ks3);
+// lfsr_recovery32 in two halves, the buckets of the second half can be recovered in parallel
+typedef struct lfsr_recovery32_split lfsr_recovery32_split_t;
+lfsr_recovery32_split_t *lfsr_recovery32_split(uint32_t ks2, uint32_t in);
+uint32_t lfsr_recovery32_num_buckets(const lfsr_recovery32_split_t *split);
+struct Crypto1State *lfsr_recovery32_buckets(const lfsr_recovery32_split_t *split, uint32_t first, uint32_t step);
+void lfsr_recovery32_split_free(lfsr_recovery32_split_t *split);
+// lfsr_recovery64 over odd start states [from, to), 0 .. 1 << 20 is the full search
+struct Crypto1State *lfsr_recovery64_range(uint32_t ks2, uint32_t ks3, uint32_t from, uint32_t to);
 struct Crypto1State *
 lfsr_common_prefix(uint32_t pfx, uint32_t rr, uint8_t ks[8], uint8_t par[8][8], uint32_t no_par);
 #endif
@@ -45,10 +45,13 @@
 
 #include "lfdemod.h"
 #include <string.h>  // for memset, memcmp and size_t
-#include <stdlib.h>  // qsort
+#include <stdlib.h>
 #include "parity.h"  // for parity test
 #include "pm3_cmd.h" // error codes
 #include "commonutil.h"  // Arraylen
+#ifndef ON_DEVICE
+#include <pthread.h>     // edge index per thread
+#endif
 
 // **********************************************************************************************
 // ---------------------------------Utilities Section--------------------------------------------
@@ -69,7 +72,12 @@ uint8_t g_debugMode = 0;
 # define prnt Dbprintf
 #endif
 
+// client side every thread demodulates its own demod context, see demodctx.h
+#ifndef ON_DEVICE
+static __thread signal_t signalprop = { 255, -255, 0, 0, true };
+#else
 static signal_t signalprop = { 255, -255, 0, 0, true };
+#endif
 signal_t *getSignalProperties(void) {
     return &signalprop;
 }
@@ -92,12 +100,335 @@ static void printSignal(void) {
     prnt("  THRESHOLD noise amplitude......%d", NOISE_AMPLITUDE_THRESHOLD);
 }
 
+// Client side edge index of a sample buffer.
+// `lf search`, `lf t55xx detect` and the demod commands run the same detectors
+// over and over on fresh copies of an unchanged graph buffer. The client tells
+// which version of its samples a buffer holds (lf_samples_version), the first
+// detector asking for that version builds the index in one pass and every
+// detector after it walks the peaks and level runs instead of the samples.
+// A version is never reused, anything in here writing into the registered
+// buffer forgets the registration. On the device there is no index.
+#define LF_INDEX_SLOTS      2
+#define LF_INDEX_LEVELS     4
+
+#define LF_LOW      0x01    // sample <= low
+#define LF_MID      0x02
+#define LF_HIGH     0x04    // sample >= high
+
+// maximal runs of samples of the same level class for one high / low pair
+typedef struct {
+    int high;
+    int low;
+    uint32_t *start;        // first sample of each run, the first run starts at 0
+    uint8_t *cls;
+    uint32_t count;
+    uint32_t size;
+} lf_levels_t;
+
+typedef struct {
+    uint64_t version;       // 0 when unused
+    uint32_t size;
+    uint32_t hist[256];     // amplitudes from SIGNAL_IGNORE_FIRST_SAMPLES on
+    uint32_t *peaks;        // p with s[p - 1] < s[p] >= s[p + 1]
+    uint32_t peak_count;
+    lf_levels_t levels[LF_INDEX_LEVELS];
+    uint8_t levels_next;
+} lf_index_t;
+
 #ifndef ON_DEVICE
-static int cmp_uint8(const void *a, const void *b) {
-    if (*(const uint8_t *)a < * (const uint8_t *)b)
-        return -1;
-    else
-        return *(const uint8_t *)a > *(const uint8_t *)b;
+typedef struct {
+    const uint8_t *samples; // registered buffer, NULL if none
+    size_t size;
+    uint64_t version;
+    lf_index_t slots[LF_INDEX_SLOTS];
+    uint8_t slots_next;
+} lf_index_cache_t;
+
+static pthread_key_t lf_index_key;
+static pthread_once_t lf_index_once = PTHREAD_ONCE_INIT;
+
+static void lf_levels_free(lf_levels_t *lv) {
+    free(lv->start);
+    free(lv->cls);
+    memset(lv, 0, sizeof(lf_levels_t));
+}
+
+static void lf_index_free(lf_index_t *ix) {
+    free(ix->peaks);
+    for (uint8_t i = 0; i < LF_INDEX_LEVELS; i++) {
+        lf_levels_free(&ix->levels[i]);
+    }
+    memset(ix, 0, sizeof(lf_index_t));
+}
+
+static void lf_index_cache_free(void *arg) {
+    lf_index_cache_t *c = arg;
+    for (uint8_t i = 0; i < LF_INDEX_SLOTS; i++) {
+        lf_index_free(&c->slots[i]);
+    }
+    free(c);
+}
+
+static void lf_index_key_init(void) {
+    pthread_key_create(&lf_index_key, lf_index_cache_free);
+}
+
+// every thread has its own, freed when the thread ends
+static lf_index_cache_t *lf_index_cache(bool create) {
+    pthread_once(&lf_index_once, lf_index_key_init);
+    lf_index_cache_t *c = pthread_getspecific(lf_index_key);
+    if (c == NULL && create) {
+        c = calloc(1, sizeof(lf_index_cache_t));
+        if (c != NULL && pthread_setspecific(lf_index_key, c) != 0) {
+            free(c);
+            c = NULL;
+        }
+    }
+    return c;
+}
+
+void lf_samples_version(const uint8_t *samples, size_t size, uint64_t version) {
+    lf_index_cache_t *c = lf_index_cache(true);
+    if (c == NULL) {
+        return;
+    }
+    c->samples = (version && size <= UINT32_MAX) ? samples : NULL;
+    c->size = size;
+    c->version = version;
+}
+
+// called before writing to samples
+static void lf_samples_written(const uint8_t *samples) {
+    lf_index_cache_t *c = lf_index_cache(false);
+    if (c != NULL && c->samples != NULL && samples >= c->samples && samples < c->samples + c->size) {
+        c->samples = NULL;
+    }
+}
+
+static bool lf_index_build(lf_index_t *ix, const uint8_t *s, uint32_t size, uint64_t version) {
+    lf_index_free(ix);
+
+    uint32_t cap = 0;
+    for (uint32_t i = 0; i < size; i++) {
+        if (i >= SIGNAL_IGNORE_FIRST_SAMPLES) {
+            ix->hist[s[i]]++;
+        }
+
+        if (i == 0 || i + 1 >= size || s[i] <= s[i - 1] || s[i] < s[i + 1]) {
+            continue;
+        }
+
+        if (ix->peak_count == cap) {
+            cap = (cap) ? cap * 2 : 1024;
+            uint32_t *peaks = realloc(ix->peaks, cap * sizeof(uint32_t));
+            if (peaks == NULL) {
+                lf_index_free(ix);
+                return false;
+            }
+            ix->peaks = peaks;
+        }
+        ix->peaks[ix->peak_count++] = i;
+    }
+
+    ix->size = size;
+    ix->version = version;
+    return true;
+}
+
+// index of the registered samples, NULL when the caller has to look at the samples itself
+static lf_index_t *lf_index_get(const uint8_t *samples, size_t size) {
+    // the detectors only print their debug output when walking the samples
+    if (g_debugMode == 2 || samples == NULL) {
+        return NULL;
+    }
+
+    lf_index_cache_t *c = lf_index_cache(false);
+    if (c == NULL || c->samples != samples || size > c->size) {
+        return NULL;
+    }
+
+    for (uint8_t i = 0; i < LF_INDEX_SLOTS; i++) {
+        lf_index_t *ix = &c->slots[i];
+        if (ix->version == c->version && ix->size == c->size) {
+            return ix;
+        }
+    }
+
+    lf_index_t *ix = &c->slots[c->slots_next];
+    c->slots_next = (c->slots_next + 1) % LF_INDEX_SLOTS;
+    if (lf_index_build(ix, c->samples, c->size, c->version) == false) {
+        return NULL;
+    }
+    return ix;
+}
+
+// level runs of the registered samples for high / low, NULL if there is no index for them
+static const lf_levels_t *lf_levels_get(const uint8_t *samples, size_t size, int high, int low) {
+    if (high <= low) {
+        return NULL;
+    }
+
+    lf_index_t *ix = lf_index_get(samples, size);
+    if (ix == NULL) {
+        return NULL;
+    }
+
+    for (uint8_t i = 0; i < LF_INDEX_LEVELS; i++) {
+        lf_levels_t *lv = &ix->levels[i];
+        if (lv->start != NULL && lv->high == high && lv->low == low) {
+            return lv;
+        }
+    }
+
+    lf_levels_t *lv = &ix->levels[ix->levels_next];
+    ix->levels_next = (ix->levels_next + 1) % LF_INDEX_LEVELS;
+    lf_levels_free(lv);
+
+    uint32_t cap = 0;
+    uint8_t last = 0;
+    for (uint32_t i = 0; i < ix->size; i++) {
+        uint8_t cls = (samples[i] <= low) ? LF_LOW : (samples[i] >= high) ? LF_HIGH : LF_MID;
+        if (cls == last) {
+            continue;
+        }
+        last = cls;
+
+        if (lv->count == cap) {
+            cap = (cap) ? cap * 2 : 1024;
+            uint32_t *start = realloc(lv->start, cap * sizeof(uint32_t));
+            uint8_t *cl = (start) ? realloc(lv->cls, cap) : NULL;
+            if (start) {
+                lv->start = start;
+            }
+            if (cl == NULL) {
+                lf_levels_free(lv);
+                return NULL;
+            }
+            lv->cls = cl;
+        }
+        lv->start[lv->count] = i;
+        lv->cls[lv->count++] = cls;
+    }
+
+    if (lv->count == 0) {
+        lf_levels_free(lv);
+        return NULL;
+    }
+    lv->high = high;
+    lv->low = low;
+    lv->size = ix->size;
+    return lv;
+}
+
+#else
+static void lf_samples_written(const uint8_t *samples) {
+    (void)samples;
+}
+
+static lf_index_t *lf_index_get(const uint8_t *samples, size_t size) {
+    (void)samples;
+    (void)size;
+    return NULL;
+}
+
+static const lf_levels_t *lf_levels_get(const uint8_t *samples, size_t size, int high, int low) {
+    (void)samples;
+    (void)size;
+    (void)high;
+    (void)low;
+    return NULL;
+}
+#endif
+
+// run holding sample i
+static uint32_t lf_run_at(const lf_levels_t *lv, size_t i) {
+    uint32_t lo = 0, hi = lv->count;
+    while (hi - lo > 1) {
+        uint32_t m = lo + (hi - lo) / 2;
+        if (lv->start[m] <= i) {
+            lo = m;
+        } else {
+            hi = m;
+        }
+    }
+    return lo;
+}
+
+static size_t lf_run_end(const lf_levels_t *lv, uint32_t k) {
+    return (k + 1 < lv->count) ? lv->start[k + 1] : lv->size;
+}
+
+// first sample from i on of one of the classes in cls, size if there is none before
+static size_t lf_run_next(const lf_levels_t *lv, size_t i, size_t size, uint8_t cls) {
+    if (i >= size) {
+        return i;
+    }
+    for (uint32_t k = lf_run_at(lv, i); k < lv->count && lv->start[k] < size; k++) {
+        if (lv->cls[k] & cls) {
+            return MAX(lv->start[k], i);
+        }
+    }
+    return size;
+}
+
+// number of samples of class cls in [from, to)
+static size_t lf_run_count(const lf_levels_t *lv, size_t from, size_t to, uint8_t cls) {
+    size_t cnt = 0;
+    if (from >= to) {
+        return 0;
+    }
+    for (uint32_t k = lf_run_at(lv, from); k < lv->count && lv->start[k] < to; k++) {
+        if (lv->cls[k] & cls) {
+            cnt += MIN(lf_run_end(lv, k), to) - MAX(lv->start[k], from);
+        }
+    }
+    return cnt;
+}
+
+// first peak at or after from and before end, end if there is none.
+// *pk is where the next search continues in the index
+static size_t lf_peak_next(const lf_index_t *ix, uint32_t *pk, const uint8_t *s, size_t from, size_t end) {
+    if (ix == NULL) {
+        for (; from < end; from++) {
+            if (s[from] > s[from - 1] && s[from] >= s[from + 1]) {
+                return from;
+            }
+        }
+        return end;
+    }
+
+    if (*pk == 0) {
+        uint32_t lo = 0, hi = ix->peak_count;
+        while (lo < hi) {
+            uint32_t m = lo + (hi - lo) / 2;
+            if (ix->peaks[m] < from) {
+                lo = m + 1;
+            } else {
+                hi = m;
+            }
+        }
+        *pk = lo;
+    }
+    while (*pk < ix->peak_count && ix->peaks[*pk] < from) {
+        (*pk)++;
+    }
+    if (*pk < ix->peak_count && ix->peaks[*pk] < end) {
+        return ix->peaks[*pk];
+    }
+    return end;
+}
+
+#ifndef ON_DEVICE
+// n-th smallest sample, counting from 0
+static uint8_t hist_nth(const uint32_t *hist, uint32_t n) {
+    uint32_t cnt = 0;
+    for (uint16_t v = 0; v < 256; v++) {
+        cnt += hist[v];
+        if (cnt > n) {
+            return v;
+        }
+    }
+    return 255;
 }
 #endif
 
@@ -110,23 +441,33 @@ void computeSignalProperties(const uint8_t *samples, uint32_t size) {
     uint32_t offset_size = size - SIGNAL_IGNORE_FIRST_SAMPLES;
 
 #ifndef ON_DEVICE
-    uint8_t tmp[offset_size];
-    memcpy(tmp, samples + SIGNAL_IGNORE_FIRST_SAMPLES, sizeof(tmp));
-    qsort(tmp, sizeof(tmp), sizeof(uint8_t), cmp_uint8);
+    // percentiles from an amplitude histogram, same values as indexing the sorted samples
+    uint32_t own[256] = {0};
+    const uint32_t *hist = own;
+    const lf_index_t *ix = lf_index_get(samples, size);
+    if (ix != NULL && ix->size == size) {
+        hist = ix->hist;
+    } else {
+        for (uint32_t i = SIGNAL_IGNORE_FIRST_SAMPLES; i < size; i++) {
+            own[samples[i]]++;
+        }
+    }
 
-    uint8_t low10 = 0.5 * (tmp[(int)(offset_size * 0.1)] + tmp[(int)((offset_size - 1) * 0.1)]);
-    uint8_t hi90 =  0.5 * (tmp[(int)(offset_size * 0.9)] + tmp[(int)((offset_size - 1) * 0.9)]);
+    uint8_t low10 = 0.5 * (hist_nth(hist, offset_size * 0.1) + hist_nth(hist, (offset_size - 1) * 0.1));
+    uint8_t hi90 =  0.5 * (hist_nth(hist, offset_size * 0.9) + hist_nth(hist, (offset_size - 1) * 0.9));
     uint32_t cnt = 0;
-    for (uint32_t i = SIGNAL_IGNORE_FIRST_SAMPLES; i < size; i++) {
+    for (uint16_t v = 0; v < 256; v++) {
+        if (hist[v] == 0)
+            continue;
 
-        if (samples[i] < signalprop.low) signalprop.low = samples[i];
-        if (samples[i] > signalprop.high) signalprop.high = samples[i];
+        if (v < signalprop.low) signalprop.low = v;
+        if (v > signalprop.high) signalprop.high = v;
 
-        if (samples[i] < low10 || samples[i] > hi90)
+        if (v < low10 || v > hi90)
             continue;
 
-        sum += samples[i];
-        cnt++;
+        sum += v * hist[v];
+        cnt += hist[v];
     }
     if (cnt > 0)
         signalprop.mean = sum / cnt;
@@ -160,13 +501,13 @@ void removeSignalOffset(uint8_t *samples, uint32_t size) {
     uint32_t offset_size = size - SIGNAL_IGNORE_FIRST_SAMPLES;
 
 #ifndef ON_DEVICE
+    uint32_t hist[256] = {0};
+    for (uint32_t i = SIGNAL_IGNORE_FIRST_SAMPLES; i < size; i++) {
+        hist[samples[i]]++;
+    }
 
-    uint8_t tmp[offset_size];
-    memcpy(tmp, samples + SIGNAL_IGNORE_FIRST_SAMPLES, sizeof(tmp));
-    qsort(tmp, sizeof(tmp), sizeof(uint8_t), cmp_uint8);
-
-    uint8_t low10 = 0.5 * (tmp[(int)(offset_size * 0.05)] + tmp[(int)((offset_size - 1) * 0.05)]);
-    uint8_t hi90 =  0.5 * (tmp[(int)(offset_size * 0.95)] + tmp[(int)((offset_size - 1) * 0.95)]);
+    uint8_t low10 = 0.5 * (hist_nth(hist, offset_size * 0.05) + hist_nth(hist, (offset_size - 1) * 0.05));
+    uint8_t hi90 =  0.5 * (hist_nth(hist, offset_size * 0.95) + hist_nth(hist, (offset_size - 1) * 0.95));
     int32_t cnt = 0;
     for (uint32_t i = SIGNAL_IGNORE_FIRST_SAMPLES; i < size; i++) {
 
@@ -188,6 +529,7 @@ void removeSignalOffset(uint8_t *samples, uint32_t size) {
 #endif
 
     // shift and saturate samples to center the mean
+    lf_samples_written(samples);
     for (uint32_t i = 0; i < size; i++) {
         if (acc_off > 0) {
             samples[i] = (samples[i] >= acc_off) ? samples[i] - acc_off : 0;
@@ -229,6 +571,7 @@ bool parityTest(uint32_t bits, uint8_t bitLen, uint8_t pType) {
 // takes a array of binary values, start position, length of bits per parity (includes parity bit - MAX 32),
 //   Parity Type (1 for odd; 0 for even; 2 for Always 1's; 3 for Always 0's), and binary Length (length to run)
 size_t removeParity(uint8_t *bits, size_t startIdx, uint8_t pLen, uint8_t pType, size_t bLen) {
+    lf_samples_written(bits);
     uint32_t parityWd = 0;
     size_t bitCnt = 0;
     for (int word = 0; word < (bLen); word += pLen) {
@@ -342,6 +685,7 @@ static size_t removeEm410xParity(uint8_t *bits, size_t startIdx, size_t *size, b
 // Parity Type (1 for odd; 0 for even; 2 Always 1's; 3 Always 0's), and binary Length (length to run)
 // Make sure *dest is long enough to store original sourceLen + #_of_parities_to_be_added
 size_t addParity(const uint8_t *src, uint8_t *dest, uint8_t sourceLen, uint8_t pLen, uint8_t pType) {
+    lf_samples_written(dest);
     uint32_t parityWd = 0;
     size_t j = 0, bitCnt = 0;
     for (int word = 0; word < sourceLen; word += pLen - 1) {
@@ -371,6 +715,7 @@ size_t addParity(const uint8_t *src, uint8_t *dest, uint8_t sourceLen, uint8_t p
 
 // array must be size dividable with 8
 int bits_to_array(const uint8_t *bits, size_t size, uint8_t *dest) {
+    lf_samples_written(dest);
     if ((size == 0) || (size % 8) != 0) return PM3_EINVARG;
 
     for (uint32_t i = 0; i < (size / 8); i++)
@@ -493,6 +838,21 @@ void getNextHigh(const uint8_t *samples, size_t size, int high, size_t *i) {
         *i += 1;
 }
 
+// same as getNextLow / getNextHigh, from the level runs when there are some
+static void next_low(const lf_levels_t *lv, const uint8_t *samples, size_t size, int low, size_t *i) {
+    if (lv)
+        *i = lf_run_next(lv, *i, size, LF_LOW);
+    else
+        getNextLow(samples, size, low, i);
+}
+
+static void next_high(const lf_levels_t *lv, const uint8_t *samples, size_t size, int high, size_t *i) {
+    if (lv)
+        *i = lf_run_next(lv, *i, size, LF_HIGH);
+    else
+        getNextHigh(samples, size, high, i);
+}
+
 // load wave counters
 bool loadWaveCounters(uint8_t *samples, size_t size, int lowToLowWaveLen[], int highToLowWaveLen[], int *waveCnt, int *skip, int *minClk, int *high, int *low) {
     size_t i = 0;
@@ -563,6 +923,7 @@ size_t pskFindFirstPhaseShift(const uint8_t *samples, size_t size, uint8_t *curP
 
 // amplify based on ask edge detection  -  not accurate enough to use all the time
 void askAmp(uint8_t *bits, size_t size) {
+    lf_samples_written(bits);
     uint8_t last = 128;
     for (size_t i = 1; i < size; ++i) {
         if (bits[i] - bits[i - 1] >= 30) //large jump up
@@ -585,6 +946,7 @@ uint32_t manchesterEncode2Bytes(uint16_t datain) {
 }
 
 void manchesterEncodeUint32(uint32_t data_in, uint8_t bitlen_in, uint8_t *bits_out, uint16_t *index) {
+    lf_samples_written(bits_out);
     for (int i = bitlen_in - 1; i >= 0; i--) {
         if ((data_in >> i) & 1) {
             bits_out[(*index)++] = 1;
@@ -599,6 +961,7 @@ void manchesterEncodeUint32(uint32_t data_in, uint8_t bitlen_in, uint8_t *bits_o
 // encode binary data into binary manchester
 // NOTE: bitstream must have triple the size of "size" available in memory to do the swap
 int ManchesterEncode(uint8_t *bits, size_t size) {
+    lf_samples_written(bits);
     //allow up to 4096b out (means bits must be at least 2048+4096 to handle the swap)
     size = (size > 2048) ? 2048 : size;
     size_t modIdx = size;
@@ -623,6 +986,13 @@ bool DetectCleanAskWave(const uint8_t *dest, size_t size, uint8_t high, uint8_t
     // sanity check
     if (loopEnd > size) loopEnd = size;
 
+    const lf_levels_t *lv = lf_levels_get(dest, size, high, low);
+    if (lv) {
+        size_t mid = lf_run_count(lv, 160, loopEnd, LF_MID);
+        size_t peaks = (loopEnd > 160) ? loopEnd - 160 - mid : 0;
+        return (peaks > 200 || mid == 0);
+    }
+
     for (size_t i = 160; i < loopEnd; i++) {
 
         if (dest[i] > low && dest[i] < high)
@@ -652,10 +1022,11 @@ int DetectStrongAskClock(uint8_t *dest, size_t size, int high, int low, int *clo
     size_t i = 100;
     size_t minClk = 768;
     uint16_t shortestWaveIdx = 0;
+    const lf_levels_t *lv = lf_levels_get(dest, size, high, low);
 
     // get to first full low to prime loop and skip incomplete first pulse
-    getNextHigh(dest, size, high, &i);
-    getNextLow(dest, size, low, &i);
+    next_high(lv, dest, size, high, &i);
+    next_low(lv, dest, size, low, &i);
 
     if (i == size)
         return -1;
@@ -682,8 +1053,8 @@ int DetectStrongAskClock(uint8_t *dest, size_t size, int high, int low, int *clo
         // measure from low to low
         size_t startwave = i;
 
-        getNextHigh(dest, size, high, &i);
-        getNextLow(dest, size, low, &i);
+        next_high(lv, dest, size, high, &i);
+        next_low(lv, dest, size, low, &i);
 
         //get minimum measured distance
         if (i - startwave < minClk && i < size) {
@@ -748,6 +1119,32 @@ int DetectStrongAskClock(uint8_t *dest, size_t size, int high, int low, int *clo
     return shortestWaveIdx;
 }
 
+// number of clock positions start + n * clk, n < cnt, without a peak within tol of them
+static size_t ask_missing_peaks(const lf_levels_t *lv, size_t start, uint16_t clk, uint8_t tol, size_t cnt) {
+    if (cnt == 0)
+        return 0;
+
+    size_t last = start + (cnt - 1) * clk;
+    size_t missing = 0;
+    for (uint32_t k = lf_run_at(lv, start); k < lv->count && lv->start[k] <= last; k++) {
+        size_t end = lf_run_end(lv, k);
+        if (lv->cls[k] != LF_MID || end - lv->start[k] <= 2 * tol)
+            continue;
+
+        // positions with all of [pos - tol, pos + tol] in between the peaks
+        size_t from = MAX(lv->start[k] + tol, start);
+        size_t to = MIN(end - 1 - tol, last);
+        if (from > to)
+            continue;
+
+        size_t n_from = (from - start + clk - 1) / clk;
+        size_t n_to = (to - start) / clk;
+        if (n_to >= n_from)
+            missing += n_to - n_from + 1;
+    }
+    return missing;
+}
+
 // not perfect especially with lower clocks or VERY good antennas (heavy wave clipping)
 // maybe somehow adjust peak trimming value based on samples to fix?
 // return start index of best starting position for that clock and return clock (by reference)
@@ -823,6 +1220,8 @@ int DetectASKClock(uint8_t *dest, size_t size, int *clock, int maxErr) {
         clkCnt = 1;
     }
 
+    const lf_levels_t *lv = lf_levels_get(dest, size, peak_hi, peak_low);
+
     //test each valid clock from smallest to greatest to see which lines up
     for (; clkCnt < num_clks; clkCnt++) {
         if (clk[clkCnt] <= 32) {
@@ -839,14 +1238,16 @@ int DetectASKClock(uint8_t *dest, size_t size, int *clock, int maxErr) {
         //try lining up the peaks by moving starting point (try first few clocks)
 
         // get to first full low to prime loop and skip incomplete first pulse
-        getNextHigh(dest, size, peak_hi, &j);
-        getNextLow(dest, size, peak_low, &j);
+        next_high(lv, dest, size, peak_hi, &j);
+        next_low(lv, dest, size, peak_low, &j);
 
         for (; j < loopCnt; j++) {
             errCnt = 0;
             // now that we have the first one lined up test rest of wave array
             loopEnd = ((size - j - tol) / clk[clkCnt]) - 1;
-            for (i = 0; i < loopEnd; ++i) {
+            if (lv)
+                errCnt = ask_missing_peaks(lv, j, clk[clkCnt], tol, loopEnd);
+            for (i = 0; lv == NULL && i < loopEnd; ++i) {
                 arrLoc = j + (i * clk[clkCnt]);
                 if (dest[arrLoc] >= peak_hi || dest[arrLoc] <= peak_low) {
                 } else if (dest[arrLoc - tol] >= peak_hi || dest[arrLoc - tol] <= peak_low) {
@@ -914,11 +1315,18 @@ int DetectStrongNRZClk(const uint8_t *dest, size_t size, int peak, int low, bool
     int lowestTransition = 255;
     bool lastWasHigh = false;
     size_t transitionSampleCount = 0;
+    const lf_levels_t *lv = lf_levels_get(dest, size, peak, low);
+
     //find first valid beginning of a high or low wave
-    while ((dest[i] >= peak || dest[i] <= low) && (i < size))
-        ++i;
-    while ((dest[i] < peak && dest[i] > low) && (i < size))
-        ++i;
+    if (lv) {
+        i = lf_run_next(lv, i, size, LF_MID);
+        i = lf_run_next(lv, i, size, LF_LOW | LF_HIGH);
+    } else {
+        while ((dest[i] >= peak || dest[i] <= low) && (i < size))
+            ++i;
+        while ((dest[i] < peak && dest[i] > low) && (i < size))
+            ++i;
+    }
 
     lastWasHigh = (dest[i] >= peak);
 
@@ -927,7 +1335,21 @@ int DetectStrongNRZClk(const uint8_t *dest, size_t size, int peak, int low, bool
 
     transition1 = i;
 
-    for (; i < size; i++) {
+    if (lv) {
+        transitionSampleCount = lf_run_count(lv, i, size, LF_MID);
+        // the run at i has the level of lastWasHigh, transitions are at the start of the runs after it
+        for (uint32_t k = lf_run_at(lv, i) + 1; k < lv->count && lv->start[k] < size; k++) {
+            if (lv->cls[k] == LF_MID || (lv->cls[k] == LF_HIGH) == lastWasHigh)
+                continue;
+
+            lastWasHigh = (lv->cls[k] == LF_HIGH);
+            if (lv->start[k] - transition1 < lowestTransition)
+                lowestTransition = lv->start[k] - transition1;
+            transition1 = lv->start[k];
+        }
+    }
+
+    for (; lv == NULL && i < size; i++) {
         if ((dest[i] >= peak && !lastWasHigh) || (dest[i] <= low && lastWasHigh)) {
             lastWasHigh = (dest[i] >= peak);
             if (i - transition1 < lowestTransition)
@@ -949,6 +1371,53 @@ int DetectStrongNRZClk(const uint8_t *dest, size_t size, int peak, int low, bool
     return lowestTransition;
 }
 
+// DetectNRZClock() lining up clk from a peak at start, over the level runs.
+// Only the samples at the clock positions and the kind of stretch in between matter
+static int16_t nrz_count_peaks(const lf_levels_t *lv, size_t start, size_t end, uint16_t clk, uint8_t ignoreWindow, bool *lastPeakHigh, bool *errBitHigh) {
+    int16_t peakcnt = 0;
+    bool bitHigh = false;
+    uint8_t ignoreCnt = 0;
+    uint32_t k = lf_run_at(lv, start);
+
+    for (size_t c = start; c < end; c += clk) {
+        // at a clock bit
+        while (lf_run_end(lv, k) <= c) k++;
+        if (lv->cls[k] != LF_MID) {
+            //if same peak don't count it
+            if ((lv->cls[k] == LF_HIGH) != *lastPeakHigh) {
+                peakcnt++;
+            }
+            *lastPeakHigh = (lv->cls[k] == LF_HIGH);
+            bitHigh = true;
+            *errBitHigh = false;
+            ignoreCnt = ignoreWindow;
+        }
+
+        // up to the next clock bit
+        size_t next = MIN(c + clk, end);
+        for (size_t p = c + 1; p < next;) {
+            while (lf_run_end(lv, k) <= p) k++;
+            size_t stop = MIN(lf_run_end(lv, k), next);
+            if (lv->cls[k] == LF_MID) {
+                if (stop - p > ignoreCnt) {
+                    bitHigh = false;
+                    if (*errBitHigh == true)
+                        peakcnt--;
+                    *errBitHigh = false;
+                    ignoreCnt = 0;
+                } else {
+                    ignoreCnt -= stop - p;
+                }
+            } else if (!bitHigh) {
+                //error bar found no clock...
+                *errBitHigh = true;
+            }
+            p = stop;
+        }
+    }
+    return peakcnt;
+}
+
 // detect nrz clock by reading #peaks vs no peaks(or errors)
 int DetectNRZClock(uint8_t *dest, size_t size, int clock, size_t *clockStartIdx) {
     size_t i = 0;
@@ -986,8 +1455,22 @@ int DetectNRZClock(uint8_t *dest, size_t size, int clock, size_t *clockStartIdx)
     int16_t peaksdet[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
     uint16_t minPeak = 255;
     bool firstpeak = true;
+    const lf_levels_t *lv = lf_levels_get(dest, size, peak, low);
     //test for large clipped waves - ignore first peak
-    for (i = 0; i < loopCnt; i++) {
+    for (uint32_t k = 0; lv && k < lv->count && lv->start[k] < loopCnt; k++) {
+        if (lv->cls[k] != LF_MID) {
+            if (firstpeak) continue;
+            smplCnt += MIN(lf_run_end(lv, k), loopCnt) - lv->start[k];
+        } else {
+            firstpeak = false;
+            if (smplCnt > 0) {
+                if (minPeak > smplCnt && smplCnt > 7) minPeak = smplCnt;
+                peakcnt++;
+                smplCnt = 0;
+            }
+        }
+    }
+    for (i = 0; lv == NULL && i < loopCnt; i++) {
         if (dest[i] >= peak || dest[i] <= low) {
             if (firstpeak) continue;
             smplCnt++;
@@ -1014,6 +1497,18 @@ int DetectNRZClock(uint8_t *dest, size_t size, int clock, size_t *clockStartIdx)
         if (clk[clkCnt] < minPeak - (clk[clkCnt] / 4)) continue;
         //try lining up the peaks by moving starting point (try first 256)
         for (ii = 20; ii < loopCnt; ++ii) {
+            if (lv) {
+                // only start on peaks
+                ii = lf_run_next(lv, ii, loopCnt, LF_LOW | LF_HIGH);
+                if (ii == loopCnt) break;
+
+                peakcnt = nrz_count_peaks(lv, ii, size - 20, clk[clkCnt], ignoreWindow, &lastPeakHigh, &errBitHigh);
+                if (peakcnt > peaksdet[clkCnt]) {
+                    bestStart[clkCnt] = ii;
+                    peaksdet[clkCnt] = peakcnt;
+                }
+                continue;
+            }
             if ((dest[ii] >= peak) || (dest[ii] <= low)) {
                 peakcnt = 0;
                 bitHigh = false;
@@ -1088,41 +1583,38 @@ uint16_t countFC(const uint8_t *bits, size_t size, bool fskAdj) {
     size_t i;
     if (size < 180) return 0;
 
-    // prime i to first up transition
-    for (i = 160; i < size - 20; i++)
-        if (bits[i] > bits[i - 1] && bits[i] >= bits[i + 1])
-            break;
+    const lf_index_t *ix = lf_index_get(bits, size);
+    uint32_t pk = 0;
 
-    for (; i < size - 20; i++) {
-        if (bits[i] > bits[i - 1] && bits[i] >= bits[i + 1]) {
-            // new up transition
-            fcCounter++;
-            if (fskAdj) {
-                //if we had 5 and now have 9 then go back to 8 (for when we get a fc 9 instead of an 8)
-                if (lastFCcnt == 5 && fcCounter == 9) fcCounter--;
-
-                //if fc=9 or 4 add one (for when we get a fc 9 instead of 10 or a 4 instead of a 5)
-                if ((fcCounter == 9) || fcCounter == 4) fcCounter++;
-                // save last field clock count  (fc/xx)
-                lastFCcnt = fcCounter;
-            }
-            // find which fcLens to save it to:
-            for (int m = 0; m < 15; m++) {
-                if (fcLens[m] == fcCounter) {
-                    fcCnts[m]++;
-                    fcCounter = 0;
-                    break;
-                }
-            }
-            if (fcCounter > 0 && fcLensFnd < 15) {
-                //add new fc length
-                fcCnts[fcLensFnd]++;
-                fcLens[fcLensFnd++] = fcCounter;
+    // prime i to first up transition
+    i = lf_peak_next(ix, &pk, bits, 160, size - 20);
+    size_t lastPeak = i - 1;
+
+    for (; i < size - 20; i = lf_peak_next(ix, &pk, bits, i + 1, size - 20)) {
+        // new up transition, one count for every sample since the last one
+        fcCounter = i - lastPeak;
+        lastPeak = i;
+        if (fskAdj) {
+            //if we had 5 and now have 9 then go back to 8 (for when we get a fc 9 instead of an 8)
+            if (lastFCcnt == 5 && fcCounter == 9) fcCounter--;
+
+            //if fc=9 or 4 add one (for when we get a fc 9 instead of 10 or a 4 instead of a 5)
+            if ((fcCounter == 9) || fcCounter == 4) fcCounter++;
+            // save last field clock count  (fc/xx)
+            lastFCcnt = fcCounter;
+        }
+        // find which fcLens to save it to:
+        for (int m = 0; m < 15; m++) {
+            if (fcLens[m] == fcCounter) {
+                fcCnts[m]++;
+                fcCounter = 0;
+                break;
             }
-            fcCounter = 0;
-        } else {
-            // count sample
-            fcCounter++;
+        }
+        if (fcCounter > 0 && fcLensFnd < 15) {
+            //add new fc length
+            fcCnts[fcLensFnd]++;
+            fcLens[fcLensFnd++] = fcCounter;
         }
     }
 
@@ -1215,6 +1707,8 @@ int DetectPSKClock(uint8_t *dest, size_t size, int clock, size_t *firstPhaseShif
         if (clock == clk[validClk]) return (clock);
     }
 
+    const lf_index_t *ix = lf_index_get(dest, size);
+
     //test each valid clock from greatest to smallest to see which lines up
     for (clkCnt = 9; clkCnt >= 1 ; clkCnt--) {
         uint8_t tol = *fc / 2;
@@ -1222,32 +1716,32 @@ int DetectPSKClock(uint8_t *dest, size_t size, int clock, size_t *firstPhaseShif
         size_t waveStart = 0;
         uint16_t errCnt = 0;
         uint16_t peakcnt = 0;
+        uint32_t pk = 0;
         if (g_debugMode == 2) prnt("DEBUG PSK: clk: %d, lastClkBit: %zu", clk[clkCnt], lastClkBit);
 
-        for (i = firstFullWave + fullWaveLen - 1; i < loopCnt - 2; i++) {
-            //top edge of wave = start of new wave
-            if (dest[i] < dest[i + 1] && dest[i + 1] >= dest[i + 2]) {
-                if (waveStart == 0) {
-                    waveStart = i + 1;
-                } else { //waveEnd
-                    waveEnd = i + 1;
-                    waveLenCnt = waveEnd - waveStart;
-                    if (waveLenCnt > *fc) {
-                        //if this wave is a phase shift
-                        if (g_debugMode == 2) prnt("DEBUG PSK: phase shift at: %zu, len: %d, nextClk: %zu, i: %zu, fc: %d", waveStart, waveLenCnt, lastClkBit + clk[clkCnt] - tol, i + 1, *fc);
-                        if (i + 1 >= lastClkBit + clk[clkCnt] - tol) { //should be a clock bit
-                            peakcnt++;
-                            lastClkBit += clk[clkCnt];
-                        } else if (i < lastClkBit + 8) {
-                            //noise after a phase shift - ignore
-                        } else { //phase shift before supposed to based on clock
-                            errCnt++;
-                        }
-                    } else if (i + 1 > lastClkBit + clk[clkCnt] + tol + *fc) {
-                        lastClkBit += clk[clkCnt]; //no phase shift but clock bit
+        // every top edge of a wave is the start of a new one
+        size_t end = loopCnt - 1;
+        for (size_t top = lf_peak_next(ix, &pk, dest, firstFullWave + fullWaveLen, end); top < end; top = lf_peak_next(ix, &pk, dest, top + 1, end)) {
+            if (waveStart == 0) {
+                waveStart = top;
+            } else { //waveEnd
+                waveEnd = top;
+                waveLenCnt = waveEnd - waveStart;
+                if (waveLenCnt > *fc) {
+                    //if this wave is a phase shift
+                    if (g_debugMode == 2) prnt("DEBUG PSK: phase shift at: %zu, len: %d, nextClk: %zu, i: %zu, fc: %d", waveStart, waveLenCnt, lastClkBit + clk[clkCnt] - tol, top, *fc);
+                    if (top >= lastClkBit + clk[clkCnt] - tol) { //should be a clock bit
+                        peakcnt++;
+                        lastClkBit += clk[clkCnt];
+                    } else if (top <= lastClkBit + 8) {
+                        //noise after a phase shift - ignore
+                    } else { //phase shift before supposed to based on clock
+                        errCnt++;
                     }
-                    waveStart = i + 1;
+                } else if (top > lastClkBit + clk[clkCnt] + tol + *fc) {
+                    lastClkBit += clk[clkCnt]; //no phase shift but clock bit
                 }
+                waveStart = top;
             }
         }
         if (errCnt == 0) return clk[clkCnt];
@@ -1283,18 +1777,19 @@ uint8_t detectFSKClk(const uint8_t *bits, size_t size, uint8_t fcHigh, uint8_t f
     size_t i;
     uint8_t fcTol = ((fcHigh * 100 - fcLow * 100) / 2 + 50) / 100; //(uint8_t)(0.5+(float)(fcHigh-fcLow)/2);
 
+    const lf_index_t *ix = lf_index_get(bits, size);
+    uint32_t pk = 0;
+
     // prime i to first peak / up transition
-    for (i = 160; i < size - 20; i++)
-        if (bits[i] > bits[i - 1] && bits[i] >= bits[i + 1])
-            break;
+    i = lf_peak_next(ix, &pk, bits, 160, size - 20);
+    size_t lastPeak = i - 1, rfStart = i - 1;
 
-    for (; i < size - 20; i++) {
-        fcCounter++;
-        rfCounter++;
+    for (; i < size - 20; i = lf_peak_next(ix, &pk, bits, i + 1, size - 20)) {
+        // new peak, the counters count every sample since the last peak / bit change
+        fcCounter = i - lastPeak;
+        rfCounter = i - rfStart;
+        lastPeak = i;
 
-        if (bits[i] <= bits[i - 1] || bits[i] < bits[i + 1])
-            continue;
-        // else new peak
         // if we got less than the small fc + tolerance then set it to the small fc
         // if it is inbetween set it to the last counter
         if (fcCounter < fcHigh && fcCounter > fcLow)
@@ -1325,9 +1820,9 @@ uint8_t detectFSKClk(const uint8_t *bits, size_t size, uint8_t fcHigh, uint8_t f
                 firstBitFnd++;
             }
             rfCounter = 0;
+            rfStart = i;
             lastFCcnt = fcCounter;
         }
-        fcCounter = 0;
     }
     uint8_t rfHighest = 15, rfHighest2 = 15, rfHighest3 = 15;
 
@@ -1491,6 +1986,7 @@ bool DetectST(uint8_t *buffer, size_t *size, int *foundclock, size_t *ststart, s
     if (g_debugMode == 2) prnt("DEBUG STT: Starting STT trim - start: %zu, datalen: %zu ", dataloc, datalen);
     bool firstrun = true;
     // warning - overwriting buffer given with raw wave data with ST removed...
+    lf_samples_written(buffer);
     while (dataloc < bufsize - (clk / 2)) {
         //compensate for long high at end of ST not being high due to signal loss... (and we cut out the start of wave high part)
         if (buffer[dataloc] < high && buffer[dataloc] > low && buffer[dataloc + clk / 4] < high && buffer[dataloc + clk / 4] > low) {
@@ -1569,6 +2065,7 @@ static int millerRawDecode(uint8_t *bits, size_t *size, int invert) {
 // check for phase errors - should never have 111 or 000 should be 01001011 or 10110100 for 1010
 // decodes biphase or if inverted it is AKA conditional dephase encoding AKA differential manchester encoding
 int BiphaseRawDecode(uint8_t *bits, size_t *size, int *offset, int invert) {
+    lf_samples_written(bits);
     //sanity check
     if (*size < 51) return -1;
 
@@ -1612,6 +2109,7 @@ int BiphaseRawDecode(uint8_t *bits, size_t *size, int *offset, int invert) {
 // run through 2 times and take least errCnt
 // "," indicates 00 or 11 wrong bit
 uint16_t manrawdecode(uint8_t *bits, size_t *size, uint8_t invert, uint8_t *alignPos) {
+    lf_samples_written(bits);
 
     // sanity check
     if (*size < 16) {
@@ -1785,8 +2283,13 @@ int askdemod_ext(uint8_t *bits, size_t *size, int *clk, int *invert, int maxErr,
     getHiLo(&high, &low, 75, 75);
 
     size_t errCnt = 0;
+    bool clean = DetectCleanAskWave(bits, *size, high, low);
+
+    // demodulating overwrites the samples
+    lf_samples_written(bits);
+
     // if clean clipped waves detected run alternate demod
-    if (DetectCleanAskWave(bits, *size, high, low)) {
+    if (clean) {
 
         //start pos from detect ask clock is 1/2 clock offset
         // NOTE: can be negative (demod assumes rest of wave was there)
@@ -1882,6 +2385,7 @@ int nrzRawDemod(uint8_t *dest, size_t *size, int *clk, const int *invert, int *s
 
     uint8_t bit = 0;
     //convert wave samples to 1's and 0's
+    lf_samples_written(dest);
     for (i = 20; i < *size - 20; i++) {
         if (dest[i] >= high) bit = 1;
         if (dest[i] <= low)  bit = 0;
@@ -2062,6 +2566,7 @@ static size_t aggregate_bits(uint8_t *dest, size_t size, uint8_t clk, uint8_t in
 
 // full fsk demod from GraphBuffer wave to decoded 1s and 0s (no mandemod)
 size_t fskdemod(uint8_t *dest, size_t size, uint8_t rfLen, uint8_t invert, uint8_t fchigh, uint8_t fclow, int *start_idx) {
+    lf_samples_written(dest);
     if (signalprop.isnoise) return 0;
     // FSK demodulator
     size = fsk_wave_demod(dest, size, fchigh, fclow, start_idx);
@@ -2075,6 +2580,7 @@ size_t fskdemod(uint8_t *dest, size_t size, uint8_t rfLen, uint8_t invert, uint8
 // only transition waves are 1s
 // TODO: Iceman - hard coded value 7,  should be #define
 void psk1TOpsk2(uint8_t *bits, size_t size) {
+    lf_samples_written(bits);
     if (bits == NULL) return;
     uint8_t lastbit = bits[0];
     for (size_t i = 1; i < size; i++) {
@@ -2093,6 +2599,7 @@ void psk1TOpsk2(uint8_t *bits, size_t size) {
 // convert psk2 demod to psk1 demod
 // from only transition waves are 1s to phase shifts change bit
 void psk2TOpsk1(uint8_t *bits, size_t size) {
+    lf_samples_written(bits);
     uint8_t phase = 0;
     for (size_t i = 0; i < size; i++) {
         if (bits[i] == 1) {
@@ -2119,6 +2626,8 @@ int pskRawDemod_ext(uint8_t *dest, size_t *size, int *clock, const int *invert,
 
     *clock = DetectPSKClock(dest, *size, *clock, &firstFullWave, &curPhase, &fc);
     if (*clock <= 0) return -1;
+
+    lf_samples_written(dest);
     //if clock detect found firstfullwave...
     uint16_t tol = fc / 2;
     if (firstFullWave == 0) {
@@ -2209,6 +2718,7 @@ int pskRawDemod(uint8_t *dest, size_t *size, int *clock, int *invert) {
 
 // FSK Demod then try to locate an AWID ID
 int detectAWID(uint8_t *dest, size_t *size, int *waveStartIdx) {
+    lf_samples_written(dest);
     //make sure buffer has enough data (96bits * 50clock samples)
     if (*size < 96 * 50) return -1;
 
@@ -2233,6 +2743,7 @@ int detectAWID(uint8_t *dest, size_t *size, int *waveStartIdx) {
 
 // takes 1s and 0s and searches for EM410x format - output EM ID
 int Em410xDecode(uint8_t *bits, size_t *size, size_t *start_idx, uint32_t *hi, uint64_t *lo) {
+    lf_samples_written(bits);
     // sanity check
     if (bits[1] > 1) return -1;
     if (*size < 64) return -2;
@@ -2304,6 +2815,7 @@ int Em410xDecode(uint8_t *bits, size_t *size, size_t *start_idx, uint32_t *hi, u
 
 // loop to get raw HID waveform then FSK demodulate the TAG ID from it
 int HIDdemodFSK(uint8_t *dest, size_t *size, uint32_t *hi2, uint32_t *hi, uint32_t *lo, int *waveStartIdx) {
+    lf_samples_written(dest);
     //make sure buffer has data
     if (*size < 96 * 50) return -1;
 
@@ -2343,6 +2855,7 @@ int HIDdemodFSK(uint8_t *dest, size_t *size, uint32_t *hi2, uint32_t *hi, uint32
 }
 
 int detectIOProx(uint8_t *dest, size_t *size, int *waveStartIdx) {
+    lf_samples_written(dest);
     //make sure buffer has data
     if (*size < 66 * 64) return -1;
 
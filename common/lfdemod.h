@@ -44,6 +44,9 @@ typedef struct {
 signal_t *getSignalProperties(void);
 
 void computeSignalProperties(const uint8_t *samples, uint32_t size);
+// client only: samples holds the given version of a sample buffer, versions are never reused.
+// The clock detectors keep an edge index per version, see lfdemod.c
+void lf_samples_version(const uint8_t *samples, size_t size, uint64_t version);
 void removeSignalOffset(uint8_t *samples, uint32_t size);
 void getNextLow(const uint8_t *samples, size_t size, int low, size_t *i);
 void getNextHigh(const uint8_t *samples, size_t size, int high, size_t *i);
@@ -164,8 +164,7 @@ uint64_t usclock(void) {
 #else
     struct timespec t;
     clock_gettime(CLOCK_MONOTONIC, &t);
-    //return (1000 * (uint64_t)t.tv_sec + t.tv_nsec / 1000);
-    return (1000 * (uint64_t)t.tv_sec + (t.tv_nsec / 1000));
+    return (1000000 * (uint64_t)t.tv_sec + (t.tv_nsec / 1000));
 #endif
 }
 
@@ -26,7 +26,6 @@
 #include <inttypes.h>
 #include <iostream>
 #include <vector>
-#include <map>
 #include <algorithm>   // sort, max_element, random_shuffle, remove_if, lower_bound
 #include <functional>  // greater, bind2nd
 #include <thread>      // std::thread
@@ -252,75 +251,102 @@ static void init_lookup_right_subtraction() {
     }
 }
 
-static inline void previous_left(uint8_t in, vector<cs_t> *candidate_states) {
-    pcs state;
-    size_t size = candidate_states->size();
-    for (size_t pos = 0; pos < size; pos++)  {
-        state = &((*candidate_states)[pos]);
-
-        uint8_t bx = (uint8_t)((state->l >> 30) & 0x1f);
-        unsigned b3 = (unsigned)(state->l >> 5) & 0x3e0;
-        state->l = (state->l << 5);
-
-        //Ignore impossible states
-        if (bx == 0) {
-            // Are we dealing with an impossible state?
-            if (b3 != 0) {
-                state->invalid = true;
-            } else {
-                // We only need to consider b6=0
-                state->l &= 0x7ffffffe0ull;
-                state->l ^= (((uint64_t)in & 0x1f) << 20);
-            }
-        } else {
-            uint8_t b6 = lookup_left_subtraction[b3 | bx];
-            state->l = (state->l & 0x7ffffffe0ull) | b6;
-            state->l ^= (((uint64_t)in & 0x1f) << 20);
-
-            // Check if we have a second candidate
-            if (b6 == 0x1f) {
-                cs_t nstate = *state;
-                nstate.l &= 0x7ffffffe0ull;
-                candidate_states->push_back(nstate);
-            }
+// Roll one state back a step, the state itself becomes the first predecessor.
+// Returns how many predecessors there are, 0 for an impossible state and 2
+// when *second holds another one.
+static inline uint8_t previous_left_state(uint8_t in, pcs state, pcs second) {
+    uint8_t bx = (uint8_t)((state->l >> 30) & 0x1f);
+    unsigned b3 = (unsigned)(state->l >> 5) & 0x3e0;
+    state->l = (state->l << 5);
+
+    //Ignore impossible states
+    if (bx == 0) {
+        // Are we dealing with an impossible state?
+        if (b3 != 0) {
+            return 0;
         }
+        // We only need to consider b6=0
+        state->l &= 0x7ffffffe0ull;
+        state->l ^= (((uint64_t)in & 0x1f) << 20);
+        return 1;
+    }
+
+    uint8_t b6 = lookup_left_subtraction[b3 | bx];
+    state->l = (state->l & 0x7ffffffe0ull) | b6;
+    state->l ^= (((uint64_t)in & 0x1f) << 20);
+
+    // Check if we have a second candidate
+    if (b6 == 0x1f) {
+        *second = *state;
+        second->l &= 0x7ffffffe0ull;
+        return 2;
     }
+    return 1;
 }
 
-static inline void previous_right(uint8_t in, vector<cs_t> *candidate_states) {
-    pcs state;
-    size_t size = candidate_states->size();
-    for (size_t pos = 0; pos < size; pos++) {
-        state = &((*candidate_states)[pos]);
+static inline uint8_t previous_right_state(uint8_t in, pcs state, pcs second) {
+    uint8_t bx = (uint8_t)((state->r >> 20) & 0x1f);
+    unsigned b16 = (unsigned)(state->r & 0x3e0);//(state->buffer_r >> 10) & 0x1f;
+
+    state->r = (state->r << 5);
+
+    // Ignore impossible states
+    if (bx == 0) {
+        if (b16 != 0) {
+            return 0;
+        }
+        // We only need to consider b18=0
+        state->r &= 0x1ffffe0ull;
+        state->r ^= (((uint64_t)in & 0xf8) << 12);
+        return 1;
+    }
 
-        uint8_t bx = (uint8_t)((state->r >> 20) & 0x1f);
-        unsigned b16 = (unsigned)(state->r & 0x3e0);//(state->buffer_r >> 10) & 0x1f;
+    uint8_t b18 = lookup_right_subtraction[b16 | bx];
+    state->r = (state->r & 0x1ffffe0ull) | b18;
+    state->r ^= (((uint64_t)in & 0xf8) << 12);
+    //state->b_right  = ((b14^b17) & 0x0f);
 
-        state->r = (state->r << 5);
+    // Check if we have a second candidate
+    if (b18 == 0x1f) {
+        *second = *state;
+        second->r &= 0x1ffffe0ull;
+        return 2;
+    }
+    return 1;
+}
 
-        // Ignore impossible states
-        if (bx == 0) {
-            if (b16 != 0) {
-                state->invalid = true;
-            } else {
-                // We only need to consider b18=0
-                state->r &= 0x1ffffe0ull;
-                state->r ^= (((uint64_t)in & 0xf8) << 12);
-            }
-        } else {
-            uint8_t b18 = lookup_right_subtraction[b16 | bx];
-            state->r = (state->r & 0x1ffffe0ull) | b18;
-            state->r ^= (((uint64_t)in & 0xf8) << 12);
-            //state->b_right  = ((b14^b17) & 0x0f);
-
-            // Check if we have a second candidate
-            if (b18 == 0x1f) {
-                cs_t nstate = *state;
-                nstate.r &= 0x1ffffe0ull;
-                candidate_states->push_back(nstate);
-            }
+// Second predecessors go behind all the first ones, impossible states are
+// dropped on the spot
+static vector<cs_t> g_split_states;
+
+static inline void previous_side(uint8_t in, vector<cs_t> *candidate_states, cipher_state_side css) {
+    size_t size = candidate_states->size();
+    size_t w = 0;
+    cs_t second;
+
+    g_split_states.clear();
+    for (size_t pos = 0; pos < size; pos++) {
+        cs_t state = (*candidate_states)[pos];
+        uint8_t n = (css == CSS_RIGHT) ? previous_right_state(in, &state, &second) : previous_left_state(in, &state, &second);
+        if (n == 0) {
+            continue;
+        }
+
+        (*candidate_states)[w++] = state;
+        if (n == 2) {
+            g_split_states.push_back(second);
         }
     }
+    candidate_states->resize(w);
+    candidate_states->insert(candidate_states->end(), g_split_states.begin(), g_split_states.end());
+}
+
+static inline void previous_left(uint8_t in, vector<cs_t> *candidate_states) {
+    previous_side(in, candidate_states, CSS_LEFT);
+}
+
+static inline void previous_right(uint8_t in, vector<cs_t> *candidate_states) {
+    previous_side(in, candidate_states, CSS_RIGHT);
 }
 
 static inline uint8_t next_left_fast(uint8_t in, uint64_t *left) {
@@ -357,25 +383,66 @@ static inline void sm_left_mask(const uint8_t *ks, uint8_t *mask, uint64_t rstat
 
 std::atomic<bool> key_found{0};
 std::atomic<uint64_t> key{0};
-std::atomic<size_t> g_topbits{0};
 std::mutex g_ice_mtx;
 static uint32_t g_num_cpus = std::thread::hardware_concurrency();
 
+static inline uint32_t popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return (uint32_t)((x * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+// When the bit is xored away (=zero), it was the same, so correct ;)
+static inline size_t count_correct_bits(const uint8_t *bt) {
+    uint64_t lo, hi;
+    memcpy(&lo, bt, sizeof(lo));
+    memcpy(&hi, bt + 8, sizeof(hi));
+    return 128 - popcount64(lo) - popcount64(hi);
+}
+
+// Every thread collects its hits as (bits << 56) | counter and sorts them
+// itself, the threads are merged once they are all done. Nothing is shared
+// while counting.
+typedef struct {
+    size_t topbits;
+    uint64_t topcounter;
+    uint8_t mask[16];
+    vector<uint64_t> hits;
+} sm_thread_result_t;
+
+static void merge_thread_results(vector<sm_thread_result_t> *results, vector<uint64_t> *merged) {
+    size_t total = 0;
+    for (const sm_thread_result_t &r : *results) {
+        total += r.hits.size();
+    }
+
+    merged->clear();
+    merged->reserve(total);
+    for (sm_thread_result_t &r : *results) {
+        size_t mid = merged->size();
+        merged->insert(merged->end(), r.hits.begin(), r.hits.end());
+        // highest bin first
+        inplace_merge(merged->begin(), merged->begin() + mid, merged->end(), greater<uint64_t>());
+        vector<uint64_t>().swap(r.hits);
+    }
+}
+
 static void ice_sm_right_thread(
     uint8_t offset,
     uint8_t skips,
     const uint8_t *ks,
-    map<uint64_t, uint64_t> *bincstates,
-    uint8_t *mask
+    sm_thread_result_t *res
 ) {
 
     uint8_t tmp_mask[16];
     uint8_t bt;
 
     for (uint64_t counter = offset; counter < 0x2000000; counter += skips) {
-        // Reset the current bitcount of correct bits
-        size_t bits = 0;
-
         // Copy the state we are going to test
         uint64_t rstate = counter;
 
@@ -389,58 +456,42 @@ static void ice_sm_right_thread(
 
             bt |= next_right_fast(0, &rstate);
 
-            // xor the bits with the keystream and count the "correct" bits
-            bt ^= ks[pos];
-
-            // Save the mask for the left produced bits
-            tmp_mask[pos] = bt;
-
-            // When the bit is xored away (=zero), it was the same, so correct ;)
-            if ((bt & 0x01) == 0) bits++;
-            if (((bt >> 1) & 0x01) == 0) bits++;
-            if (((bt >> 2) & 0x01) == 0) bits++;
-            if (((bt >> 3) & 0x01) == 0) bits++;
-            if (((bt >> 4) & 0x01) == 0) bits++;
-            if (((bt >> 5) & 0x01) == 0) bits++;
-            if (((bt >> 6) & 0x01) == 0) bits++;
-            if (((bt >> 7) & 0x01) == 0) bits++;
+            // xor the bits with the keystream and save the mask for the left produced bits
+            tmp_mask[pos] = bt ^ ks[pos];
         }
 
-        g_ice_mtx.lock();
-        if (bits > g_topbits.load(std::memory_order_relaxed)) {
+        size_t bits = count_correct_bits(tmp_mask);
+
+        if (bits > res->topbits) {
             // Copy the winning mask
-            g_topbits = bits;
-            memcpy(mask, tmp_mask, 16);
+            res->topbits = bits;
+            res->topcounter = counter;
+            memcpy(res->mask, tmp_mask, 16);
         }
-        g_ice_mtx.unlock();
 
         // Ignore states under 90
         if (bits >= 90) {
             //  Make sure the bits are used for ordering
-            g_ice_mtx.lock();
-            if (bincstates->find((((uint64_t)bits) << 56) | counter) != bincstates->end())
-                bincstates->at((((uint64_t)bits) << 56) | counter) = counter;
-            else
-                bincstates->insert(std::pair<uint64_t, uint64_t>((((uint64_t)bits) << 56) | counter, counter));
-            g_ice_mtx.unlock();
+            res->hits.push_back((((uint64_t)bits) << 56) | counter);
         }
 
         if ((counter & 0xfffff) == 0) {
-            g_ice_mtx.lock();
             printf(".");
             fflush(stdout);
-            g_ice_mtx.unlock();
         }
     }
+
+    sort(res->hits.begin(), res->hits.end(), greater<uint64_t>());
 }
-static uint32_t ice_sm_right(const uint8_t *ks, uint8_t *mask, vector<uint64_t> *pcrstates) {
 
-    map<uint64_t, uint64_t> bincstates;
-    g_topbits = 0;
+static uint32_t ice_sm_right(const uint8_t *ks, uint8_t *mask, vector<uint64_t> *pcrstates) {
 
+    vector<sm_thread_result_t> results(g_num_cpus);
     std::vector<std::thread> threads(g_num_cpus);
     for (uint32_t m = 0; m < g_num_cpus; m++) {
-        threads[m] = std::thread(ice_sm_right_thread, m, g_num_cpus, ks, &bincstates, mask);
+        results[m].topbits = 0;
+        results[m].topcounter = 0;
+        threads[m] = std::thread(ice_sm_right_thread, m, g_num_cpus, ks, &results[m]);
     }
     for (auto &t : threads) {
         t.join();
@@ -448,39 +499,39 @@ static uint32_t ice_sm_right(const uint8_t *ks, uint8_t *mask, vector<uint64_t>
 
     printf("\n");
 
-    // Clear the candidate state vector
-    pcrstates->clear();
-
-    // Copy the order the states from lowest-bin to highest-bin
-    map<uint64_t, uint64_t>::iterator it;
-    for (it = bincstates.begin(); it != bincstates.end(); ++it) {
-        pcrstates->push_back(it->second);
+    // The first state to reach the top-bin wins, as if counted in one go
+    size_t topbits = 0;
+    uint64_t topcounter = 0;
+    for (const sm_thread_result_t &r : results) {
+        if (r.topbits > topbits || (r.topbits == topbits && topbits && r.topcounter < topcounter)) {
+            topbits = r.topbits;
+            topcounter = r.topcounter;
+            memcpy(mask, r.mask, 16);
+        }
     }
 
-    // Reverse the vector order (so the highest bin comes first)
-    reverse(pcrstates->begin(), pcrstates->end());
+    // Order the states from the highest bin to the lowest
+    merge_thread_results(&results, pcrstates);
+    for (uint64_t &s : *pcrstates) {
+        s &= 0x00ffffffffffffffull;
+    }
 
-    return g_topbits;
+    return topbits;
 }
 
 static void ice_sm_left_thread(
     uint8_t offset,
     uint8_t skips,
     const uint8_t *ks,
-    map<uint64_t, cs_t> *bincstates,
+    sm_thread_result_t *res,
     const uint8_t *mask
 ) {
 
-    size_t pos, bits;
+    size_t pos;
     uint8_t correct_bits[16];
     uint8_t bt;
     const lookup_entry *lookup;
 
-    // Reset and initialize the cryptostate and vector
-    cs_t state;
-    memset(&state, 0x00, sizeof(cs_t));
-    state.invalid = false;
-
     for (uint64_t counter = offset; counter < 0x800000000ull; counter += skips) {
         uint64_t lstate = counter;
 
@@ -508,52 +559,29 @@ static void ice_sm_left_thread(
         // If we have parsed all 16 bytes of keystream, we have a valid CANDIDATE!
         if (pos == 16) {
             // Count the total correct bits
-            bits = 0;
-            for (pos = 0; pos < 16; pos++) {
-                // Get the next byte-value with correct bits
-                bt = correct_bits[pos];
-
-                // Count all the (correct) bits
-                // When the bit is xored away (=zero), it was the same, so correct ;)
-                if ((bt & 0x01) == 0) bits++;
-                if (((bt >> 1) & 0x01) == 0) bits++;
-                if (((bt >> 2) & 0x01) == 0) bits++;
-                if (((bt >> 3) & 0x01) == 0) bits++;
-                if (((bt >> 4) & 0x01) == 0) bits++;
-                if (((bt >> 5) & 0x01) == 0) bits++;
-                if (((bt >> 6) & 0x01) == 0) bits++;
-                if (((bt >> 7) & 0x01) == 0) bits++;
-            }
-
-            state.l = counter;
+            size_t bits = count_correct_bits(correct_bits);
 
             //  Make sure the bits are used for ordering
-            g_ice_mtx.lock();
+            res->hits.push_back((((uint64_t)bits) << 56) | counter);
             printf(".");
             fflush(stdout);
-            if (bincstates->find((((uint64_t)bits) << 56) | counter) != bincstates->end())
-                bincstates->at((((uint64_t)bits) << 56) | counter) = state;
-            else
-                bincstates->insert(std::pair<uint64_t, cs_t>((((uint64_t)bits) << 56) | counter, state));
-            g_ice_mtx.unlock();
-
         }
 
         if ((counter & 0xffffffffull) == 0) {
-            g_ice_mtx.lock();
             printf("%02.1f%%.", ((float)100 / 8) * (counter >> 32));
             fflush(stdout);
-            g_ice_mtx.unlock();
         }
     }
+
+    sort(res->hits.begin(), res->hits.end(), greater<uint64_t>());
 }
 
 static void ice_sm_left(const uint8_t *ks, uint8_t *mask, vector<cs_t> *pcstates) {
 
-    map<uint64_t, cs_t> bincstates;
+    vector<sm_thread_result_t> results(g_num_cpus);
     std::vector<std::thread> threads(g_num_cpus);
     for (uint32_t m = 0; m < g_num_cpus; m++) {
-        threads[m] = std::thread(ice_sm_left_thread, m, g_num_cpus, ks, &bincstates, mask);
+        threads[m] = std::thread(ice_sm_left_thread, m, g_num_cpus, ks, &results[m], mask);
     }
 
     for (auto &t : threads) {
@@ -562,62 +590,106 @@ static void ice_sm_left(const uint8_t *ks, uint8_t *mask, vector<cs_t> *pcstates
 
     printf("100%%\n");
 
-    // Clear the candidate state vector
-    pcstates->clear();
+    // Order the states from the highest bin to the lowest
+    vector<uint64_t> hits;
+    merge_thread_results(&results, &hits);
+
+    // Reset and initialize the cryptostate and vector
+    cs_t state;
+    memset(&state, 0x00, sizeof(cs_t));
+    state.invalid = false;
 
-    // Copy the order the states from lowest-bin to highest-bin
-    map<uint64_t, cs_t>::iterator it;
-    for (it = bincstates.begin(); it != bincstates.end(); ++it) {
-        pcstates->push_back(it->second);
+    pcstates->clear();
+    pcstates->reserve(hits.size());
+    for (uint64_t h : hits) {
+        state.l = h & 0x00ffffffffffffffull;
+        pcstates->push_back(state);
     }
-    // Reverse the vector order (so the highest bin comes first)
-    reverse(pcstates->begin(), pcstates->end());
 }
 
+// The states of a round are written straight into a second arena instead of
+// rolling back a full copy of the candidates for every one of the 32 inputs
+static vector<cs_t> g_next_states;
+
 static inline void previous_all_input(vector<cs_t> *pcstates, uint32_t gc_byte_index, cipher_state_side css) {
-    uint8_t btGc, in;
-    vector<cs_t> ncstates;
-    vector<cs_t> prev_ncstates;
-    vector<cs_t>::iterator itnew;
+    size_t size = pcstates->size();
+    cs_t second;
+
+    g_next_states.clear();
+    g_next_states.reserve(size * 0x21);
 
     // Loop through the complete entryphy of 5 bits for each candidate
     // We ignore zero (xor 0x00) to avoid duplicates
-    for (btGc = 0; btGc < 0x20; btGc++)  {
-        // Copy the original candidates that are supplied
-        ncstates = *pcstates;
+    for (uint8_t btGc = 0; btGc < 0x20; btGc++)  {
+        uint8_t in = (css == CSS_RIGHT) ? (btGc << 3) : btGc;
 
         // Rollback the (candidate) cipher states with this input
-        if (css == CSS_RIGHT) {
-            in = btGc << 3;
-            previous_right(in, &ncstates);
-        } else {
-            in = btGc;
-            previous_left(in, &ncstates);
-        }
-
-        for (itnew = ncstates.begin(); itnew != ncstates.end(); ++itnew)  {
+        g_split_states.clear();
+        for (size_t pos = 0; pos < size; pos++) {
+            cs_t state = (*pcstates)[pos];
+            uint8_t n = (css == CSS_RIGHT) ? previous_right_state(in, &state, &second) : previous_left_state(in, &state, &second);
             // Wipe away the invalid states
-            if (itnew->invalid == false) {
-                itnew->Gc[gc_byte_index] = in;
-                prev_ncstates.push_back(*itnew);
+            if (n == 0) {
+                continue;
+            }
+
+            state.Gc[gc_byte_index] = in;
+            g_next_states.push_back(state);
+            if (n == 2) {
+                second.Gc[gc_byte_index] = in;
+                g_split_states.push_back(second);
             }
         }
+        g_next_states.insert(g_next_states.end(), g_split_states.begin(), g_split_states.end());
+    }
+
+    // The previous states become the candidates, their buffer the next arena
+    pcstates->swap(g_next_states);
+}
+
+// Meet-in-the-middle lookup, sorted on state. Where several counters lead to
+// the same state the last one is kept, as a map assigned in order would
+typedef struct {
+    uint64_t state;
+    uint32_t counter;
+} match_t;
+
+static inline bool match_less(const match_t &a, const match_t &b) {
+    return (a.state < b.state) || (a.state == b.state && a.counter < b.counter);
+}
+
+static void matchbox_sort(vector<match_t> *matchbox) {
+    sort(matchbox->begin(), matchbox->end(), match_less);
+
+    size_t w = 0;
+    for (size_t i = 0; i < matchbox->size(); i++) {
+        if (i + 1 < matchbox->size() && (*matchbox)[i + 1].state == (*matchbox)[i].state) {
+            continue;
+        }
+        (*matchbox)[w++] = (*matchbox)[i];
     }
+    matchbox->resize(w);
+}
 
-    // Copy the previous states into the vector
-    *pcstates = prev_ncstates;
+static inline const match_t *matchbox_find(const vector<match_t> &matchbox, uint64_t state) {
+    match_t key = { state, 0 };
+    vector<match_t>::const_iterator it = lower_bound(matchbox.begin(), matchbox.end(), key, match_less);
+    if (it == matchbox.end() || it->state != state) {
+        return NULL;
+    }
+    return &(*it);
 }
 
 static inline void search_gc_candidates_right(const uint64_t rstate_before_gc, const uint64_t rstate_after_gc, const uint8_t *Q, vector<cs_t> *pcstates) {
     vector<cs_t>::iterator it;
     vector<cs_t> csl_cand;
-    map<uint64_t, uint64_t> matchbox;
-    map<uint64_t, uint64_t>::iterator itmatch;
+    vector<match_t> matchbox;
     uint64_t rstate;
-    size_t counter;
+    uint32_t counter;
     cs_t state;
 
     // Generate 2^20 different (5 bits) values for the first 4 Gc bytes (0,1,2,3)
+    matchbox.reserve(0x100000);
     for (counter = 0; counter < 0x100000; counter++) {
         rstate  = rstate_before_gc;
         next_right_fast((counter >> 12) & 0xf8, &rstate);
@@ -626,8 +698,9 @@ static inline void search_gc_candidates_right(const uint64_t rstate_before_gc, c
         next_right_fast((counter >> 2) & 0xf8, &rstate);
         next_right_fast((counter << 3) & 0xf8, &rstate);
         next_right_fast(Q[5], &rstate);
-        matchbox[rstate] = counter;
+        matchbox.push_back({ rstate, counter });
     }
+    matchbox_sort(&matchbox);
 
     // Reset and initialize the cryptostate and vecctor
     memset(&state, 0x00, sizeof(cs_t));
@@ -648,12 +721,12 @@ static inline void search_gc_candidates_right(const uint64_t rstate_before_gc, c
 
     // Take the intersection of the corresponding states ~2^15 values (40-25 = 15 bits)
     for (it = csl_cand.begin(); it != csl_cand.end(); ++it) {
-        itmatch = matchbox.find(it->r);
-        if (itmatch != matchbox.end()) {
-            it->Gc[0] = (itmatch->second >> 12) & 0xf8;
-            it->Gc[1] = (itmatch->second >>  7) & 0xf8;
-            it->Gc[2] = (itmatch->second >>  2) & 0xf8;
-            it->Gc[3] = (itmatch->second <<  3) & 0xf8;
+        const match_t *match = matchbox_find(matchbox, it->r);
+        if (match != NULL) {
+            it->Gc[0] = (match->counter >> 12) & 0xf8;
+            it->Gc[1] = (match->counter >>  7) & 0xf8;
+            it->Gc[2] = (match->counter >>  2) & 0xf8;
+            it->Gc[3] = (match->counter <<  3) & 0xf8;
 
             pcstates->push_back(*it);
         }
@@ -663,12 +736,12 @@ static inline void search_gc_candidates_right(const uint64_t rstate_before_gc, c
 static inline void search_gc_candidates_left(const uint64_t lstate_before_gc, const uint8_t *Q, vector<cs_t> *pcstates) {
     vector<cs_t> csl_cand, csl_search;
     vector<cs_t>::iterator itsearch, itcand;
-    map<uint64_t, uint64_t> matchbox;
-    map<uint64_t, uint64_t>::iterator itmatch;
+    vector<match_t> matchbox;
     uint64_t lstate;
-    size_t counter;
+    uint32_t counter;
 
     // Generate 2^20 different (5 bits) values for the first 4 Gc bytes (0,1,2,3)
+    matchbox.reserve(0x100000);
     for (counter = 0; counter < 0x100000; counter++) {
         lstate  = lstate_before_gc;
         next_left_fast((counter >> 15) & 0x1f, &lstate);
@@ -677,8 +750,9 @@ static inline void search_gc_candidates_left(const uint64_t lstate_before_gc, co
         next_left_fast((counter >> 5) & 0x1f, &lstate);
         next_left_fast(counter & 0x1f, &lstate);
         next_left_fast(Q[5], &lstate);
-        matchbox[lstate] = counter;
+        matchbox.push_back({ lstate, counter });
     }
+    matchbox_sort(&matchbox);
 
     // Copy the input candidate states and clean the output vector
     csl_cand = *pcstates;
@@ -698,12 +772,12 @@ static inline void search_gc_candidates_left(const uint64_t lstate_before_gc, co
 
         // Take the intersection of the corresponding states ~2^15 values (40-25 = 15 bits)
         for (itsearch = csl_search.begin(); itsearch != csl_search.end(); ++itsearch) {
-            itmatch = matchbox.find(itsearch->l);
-            if (itmatch != matchbox.end()) {
-                itsearch->Gc[0] = (itmatch->second >> 15) & 0x1f;
-                itsearch->Gc[1] = (itmatch->second >> 10) & 0x1f;
-                itsearch->Gc[2] = (itmatch->second >>  5) & 0x1f;
-                itsearch->Gc[3] = itmatch->second & 0x1f;
+            const match_t *match = matchbox_find(matchbox, itsearch->l);
+            if (match != NULL) {
+                itsearch->Gc[0] = (match->counter >> 15) & 0x1f;
+                itsearch->Gc[1] = (match->counter >> 10) & 0x1f;
+                itsearch->Gc[2] = (match->counter >>  5) & 0x1f;
+                itsearch->Gc[3] = match->counter & 0x1f;
 
                 pcstates->push_back(*itsearch);
             }
@@ -714,45 +788,61 @@ static inline void search_gc_candidates_left(const uint64_t lstate_before_gc, co
     printf("\n");
 }
 
-void combine_valid_left_right_states(const vector<cs_t> *plcstates, const vector<cs_t> *prcstates, vector<uint64_t> *pgc_candidates) {
-    vector<cs_t>::iterator itl, itr;
-    size_t pos;
-    uint64_t gc;
-    bool valid;
+// The 2 bits of every Gc byte both halves know about
+static inline uint16_t gc_overlap(const cs_t *state) {
+    uint16_t sig = 0;
+    for (size_t pos = 0; pos < 8; pos++) {
+        sig = (sig << 2) | ((state->Gc[pos] >> 3) & 0x03);
+    }
+    return sig;
+}
+
+typedef struct {
+    uint16_t sig;
+    uint32_t idx;
+} overlap_t;
 
-    vector<cs_t> outer, inner;
+static inline bool overlap_less(const overlap_t &a, const overlap_t &b) {
+    return (a.sig < b.sig) || (a.sig == b.sig && a.idx < b.idx);
+}
+
+void combine_valid_left_right_states(const vector<cs_t> *plcstates, const vector<cs_t> *prcstates, vector<uint64_t> *pgc_candidates) {
+    const vector<cs_t> *outer, *inner;
     if (plcstates->size() > prcstates->size()) {
-        outer = *plcstates;
-        inner = *prcstates;
+        outer = plcstates;
+        inner = prcstates;
     } else {
-        outer = *prcstates;
-        inner = *plcstates;
+        outer = prcstates;
+        inner = plcstates;
     }
 
-    printf("Outer  " _YELLOW_("%zu")" , inner " _YELLOW_("%zu") "\n", outer.size(), inner.size());
+    printf("Outer  " _YELLOW_("%zu")" , inner " _YELLOW_("%zu") "\n", outer->size(), inner->size());
+
+    // Inner states sorted on the overlapping bits, in their own order where
+    // these are the same, so every outer state only visits its matches
+    vector<overlap_t> index(inner->size());
+    for (size_t i = 0; i < inner->size(); i++) {
+        index[i].sig = gc_overlap(&(*inner)[i]);
+        index[i].idx = i;
+    }
+    sort(index.begin(), index.end(), overlap_less);
 
     // Clean up the candidate list
     pgc_candidates->clear();
-    for (itl = outer.begin(); itl != outer.end(); ++itl) {
-        for (itr = inner.begin(); itr != inner.end(); ++itr) {
-            valid = true;
-            // Check for left and right candidates that share the overlapping bits (8 x 2bits of Gc)
-            for (pos = 0; pos < 8; pos++) {
-                if ((itl->Gc[pos] & 0x18) != (itr->Gc[pos] & 0x18)) {
-                    valid = false;
-                    break;
-                }
+    for (vector<cs_t>::const_iterator itl = outer->begin(); itl != outer->end(); ++itl) {
+        // Check for left and right candidates that share the overlapping bits (8 x 2bits of Gc)
+        overlap_t lo = { gc_overlap(&(*itl)), 0 };
+        vector<overlap_t>::const_iterator itr = lower_bound(index.begin(), index.end(), lo, overlap_less);
+
+        for (; itr != index.end() && itr->sig == lo.sig; ++itr) {
+            const cs_t *r = &(*inner)[itr->idx];
+            uint64_t gc = 0;
+            for (size_t pos = 0; pos < 8; pos++) {
+                gc <<= 8;
+                gc |= (itl->Gc[pos] | r->Gc[pos]);
             }
 
-            if (valid) {
-                gc = 0;
-                for (pos = 0; pos < 8; pos++) {
-                    gc <<= 8;
-                    gc |= (itl->Gc[pos] | itr->Gc[pos]);
-                }
-
-                pgc_candidates->push_back(gc);
-            }
+            pgc_candidates->push_back(gc);
         }
     }
     printf("Found a total of " _YELLOW_("%llu")" combinations, ", ((unsigned long long)plcstates->size()) * prcstates->size());
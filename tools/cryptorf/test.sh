@@ -1,9 +1,33 @@
 #!/bin/sh
 
-# harder test
-time ./sma c2fa94a5231d14e1 d291eeef5f76e6df 586385693a9b0f2c ec9aba404505b0fa
-time ./sma_multi c2fa94a5231d14e1 d291eeef5f76e6df 586385693a9b0f2c ec9aba404505b0fa
+# Times sma and sma_multi on the test vectors and checks they find the key.
+# ./test.sh              both tools
+# ./test.sh sma_multi    only sma_multi
 
-# simpler
-time ./sma ffffffffffffffff 1234567812345678 88c9d4466a501a87 dec2ee1b1c9276e9
-time ./sma_multi ffffffffffffffff 1234567812345678 88c9d4466a501a87 dec2ee1b1c9276e9
+TOOLS=${*:-"sma sma_multi"}
+FAILED=0
+
+run() {
+    tool=$1
+    key=$2
+    shift 2
+    start=$(date +%s)
+    out=$(./"$tool" "$@")
+    end=$(date +%s)
+    if echo "$out" | grep -q "key found \[.*$key.*\]"; then
+        echo "$tool $1 ... ok   $((end - start)) s"
+    else
+        echo "$tool $1 ... FAIL $((end - start)) s"
+        FAILED=1
+    fi
+}
+
+for tool in $TOOLS; do
+    # harder test
+    run "$tool" 38351d8ad41f71fa c2fa94a5231d14e1 d291eeef5f76e6df 586385693a9b0f2c ec9aba404505b0fa
+
+    # simpler
+    run "$tool" 4f794a463ff81d81 ffffffffffffffff 1234567812345678 88c9d4466a501a87 dec2ee1b1c9276e9
+done
+
+exit $FAILED
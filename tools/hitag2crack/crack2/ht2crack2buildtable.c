@@ -1,536 +1,667 @@
 /*
  * ht2crack2buildtable.c
  * This builds the 1.2TB table and sorts it.
+ *
+ * It is an external merge sort. As many entries as fit in RAM are made,
+ * bucketed by their first two keystream bytes, sorted and written out in
+ * one go as a run. The runs are then merged bucket range by bucket range
+ * into the final table, each range read and written sequentially.
+ *
+ * Runs are only renamed into place once complete and the table header
+ * keeps how many buckets are merged, so an interrupted build picks up
+ * where it stopped when started again with the same -n and -o.
  */
 
-#include "ht2crackutils.h"
-#include <stdlib.h>
-
-// DATAMAX is the size of each bucket (bytes).  There are 65536 buckets so choose a value such that
-// DATAMAX * 65536 < RAM available.  For ex, if you want to use 12GB of RAM (for a 16GB machine
-// leaving some RAM free for OS and other stuff), DATAMAX = 12GB / 65536 = 196608.  Round this down
-// to a power of 10; DATAMAX = 196600.
-#define DATAMAX 196600 // around 192K rounded down to a power of 10
-
-// NUM_BUILD_THREADS and NUM_SORT_THREADS are the number of threads to run concurrently.  These should
-// ideally be equal to the number of virtual cores you have available.  A quad-core machine will
-// likely have 8 virtual cores, so set them to 8.
-//
-// If sorting fails with a 'bus error' then that is likely because your disk I/O can't keep up with
-// the read/write demands of the multi-threaded sorting.  In this case, reduce the number of sorting
-// threads.  This will most likely only be a problem with network disks; SATA should be okay;
-// USB2/3 should keep up.
-//
-// These MUST be a power of 2 for the maths to work - you have been warned!
-// Also, sort threads MUST be <= build threads or a horrible buffer overflow will happen!
-#define NUM_BUILD_THREADS 8
-#define NUM_SORT_THREADS 8
-
-// DATASIZE is the number of bytes in an entry.  This is 10; 4 bytes of keystream (2 are in the filepath) +
-// 6 bytes of PRNG state.
-#define DATASIZE 10
-
-int debug = 0;
-
-// table entry for a bucket
-struct table {
-    char path[32];
-    pthread_mutex_t mutex;
-    unsigned char *data;
-    unsigned char *ptr;
-};
-
-
-// actual table
-struct table *t;
-
-// jump table 1
-uint64_t d[48];
-int nsteps;
-
-// jump table 2
-uint64_t d2[48];
-int nsteps2;
-
-// create table entry
-static void create_table(struct table *tt, int d_1, int d_2) {
-    if (!tt) {
-        printf("create_table: t is NULL\n");
-        exit(1);
-    }
-
-    // create some space
-    tt->data = (unsigned char *)calloc(1, DATAMAX);
-    if (!(tt->data)) {
-        printf("create_table: cannot calloc data\n");
-        exit(1);
-    }
+#include "ht2crack2table.h"
+#include <getopt.h>
+#include <inttypes.h>
+#include <time.h>
+
+// generated entry, 6 bytes of keystream + 6 bytes of PRNG state
+#define GENSIZE 12
+
+// biggest single read or write
+#define IO_CHUNK (1UL << 30)
+
+typedef struct {
+    char path[512];
+    uint64_t first;
+    uint64_t entries;
+    uint64_t *index;
+} run_t;
+
+static int nthreads = 1;
+static uint64_t budget;
+static uint64_t numentries;
+static const char *outfile = HT2TABLE_DEFAULT;
+
+// jump ladder, ladder[0] steps from one entry to the next
+static ht2jump_t ladder[HT2JUMP_LEVELS];
+
+static run_t *runs;
+static int nruns;
+
+// run being made
+static unsigned char *genbuf;
+static unsigned char *runbuf;
+static uint64_t run_first;
+static uint64_t run_entries;
+static uint64_t *counts;
+static uint64_t run_index[HT2TABLE_BUCKETS + 1];
+
+// buckets being merged
+static uint64_t table_index[HT2TABLE_BUCKETS + 1];
+static unsigned char *mergein;
+static unsigned char *mergeout;
+static uint64_t *seg_base;
+static uint32_t batch_lo;
+static uint32_t batch_hi;
+
+static uint32_t next_bucket;
+
+static void usage(void) {
+    printf("ht2crack2buildtable - builds the sorted table for ht2crack2search\n\n");
+    printf(" -o FILE    table file (defaults to %s)\n", HT2TABLE_DEFAULT);
+    printf(" -n BITS    build 2^BITS entries (defaults to %d, the full table)\n", HT2TABLE_FULL_BITS);
+    printf(" -m MB      RAM to use (defaults to 3/4 of the available RAM)\n");
+    printf(" -t N       threads (defaults to the number of cores)\n");
+    printf("\nA full table is about 1.4TB and the runs take as much again while\n");
+    printf("building. Smaller tables only cover part of the PRNG cycle, they are\n");
+    printf("meant for testing with ht2crack2gentest.\n");
+
+    exit(1);
+}
 
-    // set data ptr to start of data table
-    tt->ptr = tt->data;
+static uint64_t available_ram(void) {
+    char line[256];
+    unsigned long long kb;
 
-    // init the mutex
-    if (pthread_mutex_init(&(tt->mutex), NULL)) {
-        printf("create_table: cannot init mutex\n");
-        exit(1);
+    FILE *fp = fopen("/proc/meminfo", "r");
+    if (fp) {
+        while (fgets(line, sizeof(line), fp)) {
+            if (sscanf(line, "MemAvailable: %llu kB", &kb) == 1) {
+                fclose(fp);
+                return kb * 1024;
+            }
+        }
+        fclose(fp);
     }
 
-    // create the path
-//    snprintf(tt->path, sizeof(tt->path), "/Volumes/2tb/%02X/%02X.bin", d_1 & 0xff, d_2 & 0xff);
-    snprintf(tt->path, sizeof(tt->path), "table/%02x/%02x.bin", d_1 & 0xff, d_2 & 0xff);
+    // no idea what is free, take half of it
+    return (uint64_t)sysconf(_SC_PHYS_PAGES) * (uint64_t)sysconf(_SC_PAGESIZE) / 2;
 }
 
-
-// create all table entries
-static void create_tables(struct table *tt) {
-    int i, j;
-
-    if (!tt) {
-        printf("create_tables: t is NULL\n");
-        exit(1);
+static void write_all(int fd, const void *buf, uint64_t len, const char *path) {
+    const unsigned char *p = buf;
+    while (len) {
+        ssize_t n = write(fd, p, (len > IO_CHUNK) ? IO_CHUNK : len);
+        if (n <= 0) {
+            printf("cannot write all of the data to %s\n", path);
+            exit(1);
+        }
+        p += n;
+        len -= n;
     }
+}
 
-    for (i = 0; i < 0x100; i++) {
-        for (j = 0; j < 0x100; j++) {
-            create_table(tt + ((i * 0x100) + j), i, j);
+static void pwrite_all(int fd, const void *buf, uint64_t len, uint64_t offset, const char *path) {
+    const unsigned char *p = buf;
+    while (len) {
+        ssize_t n = pwrite(fd, p, (len > IO_CHUNK) ? IO_CHUNK : len, offset);
+        if (n <= 0) {
+            printf("cannot write all of the data to %s\n", path);
+            exit(1);
         }
+        p += n;
+        len -= n;
+        offset += n;
     }
 }
 
-
-// free the table memory
-static void free_tables(struct table *tt) {
-    if (!tt) {
-        printf("free_tables: tt is NULL\n");
-        exit(1);
+static void pread_all(int fd, void *buf, uint64_t len, uint64_t offset, const char *path) {
+    unsigned char *p = buf;
+    while (len) {
+        ssize_t n = pread(fd, p, (len > IO_CHUNK) ? IO_CHUNK : len, offset);
+        if (n <= 0) {
+            printf("cannot read all of the data from %s\n", path);
+            exit(1);
+        }
+        p += n;
+        len -= n;
+        offset += n;
     }
+}
 
-    for (int i = 0; i < 0x10000; i++) {
-        struct table *ttmp = tt + i;
-        free(ttmp->data);
-    }
+static void make_header(ht2table_header_t *hdr, uint64_t first, uint64_t entries, uint32_t done) {
+    memset(hdr, 0, sizeof(ht2table_header_t));
+    memcpy(hdr->magic, HT2TABLE_MAGIC, sizeof(hdr->magic));
+    hdr->version = HT2TABLE_VERSION;
+    hdr->recsize = HT2TABLE_RECSIZE;
+    hdr->entries = entries;
+    hdr->first = first;
+    hdr->start = HT2TABLE_START;
+    hdr->step = HT2TABLE_STEP;
+    hdr->buckets_done = done;
 }
 
+// 1 if the header belongs to this build, whatever its progress
+static int check_header(const ht2table_header_t *hdr, uint64_t first) {
+    return !memcmp(hdr->magic, HT2TABLE_MAGIC, sizeof(hdr->magic)) &&
+           (hdr->version == HT2TABLE_VERSION) &&
+           (hdr->recsize == HT2TABLE_RECSIZE) &&
+           (hdr->start == HT2TABLE_START) &&
+           (hdr->step == HT2TABLE_STEP) &&
+           (hdr->first == first);
+}
 
+// runs a function on every thread and waits for them all
+typedef struct {
+    void (*fn)(int);
+    int index;
+} work_t;
 
-// write (partial) table to file
-static void writetable(struct table *t1) {
-    int fd;
+static void *work_thread(void *arg) {
+    work_t *w = (work_t *)arg;
+    w->fn(w->index);
+    return NULL;
+}
 
-    if (debug) printf("writetable %s\n", t1->path);
+static void run_threads(void (*fn)(int)) {
+    pthread_t threads[nthreads];
+    work_t work[nthreads];
 
-    fd = open(t1->path, O_WRONLY | O_CREAT | O_APPEND, 0644);
-    if (fd <= 0) {
-        printf("writetable cannot open file %s for appending\n", t1->path);
-        exit(1);
+    for (int i = 0; i < nthreads; i++) {
+        work[i].fn = fn;
+        work[i].index = i;
+        if (pthread_create(&threads[i], NULL, work_thread, &work[i])) {
+            printf("cannot start thread %d\n", i);
+            exit(1);
+        }
     }
 
-    if (debug) printf("writetable %s opened\n", t1->path);
-
-    if (write(fd, t1->data, t1->ptr - t1->data) < (t1->ptr - t1->data)) {
-        printf("writetable cannot write all of the data\n");
-        exit(1);
+    for (int i = 0; i < nthreads; i++) {
+        if (pthread_join(threads[i], NULL)) {
+            printf("cannot join thread %d\n", i);
+            exit(1);
+        }
     }
-
-    if (debug) printf("writetable %s written\n", t1->path);
-
-    close(fd);
 }
 
+static int reccmp(const void *p1, const void *p2) {
+    return memcmp(p1, p2, HT2TABLE_RECSIZE);
+}
 
-// store value in table
-static void store(unsigned char *data) {
-    unsigned char d_1, d_2;
-    int offset;
-    struct table *t1;
-
-    // use the first two bytes as an index
-    d_1 = data[0];
-    d_2 = data[1];
-    offset = (d_1 * 0x100) + d_2;
-
-    if (debug) printf("store, d1=%02X, d2=%02X, offset = %d\n", d_1, d_2, offset);
+// make a contiguous slice of the run and count its buckets
+static void gen_thread(int t) {
+    Hitag_State hstate;
+    Hitag_State hstate2;
+    uint64_t lo = run_entries * t / nthreads;
+    uint64_t hi = run_entries * (t + 1) / nthreads;
+    uint64_t *cnt = counts + ((uint64_t)t * HT2TABLE_BUCKETS);
 
-    // get pointer to table entry
-    t1 = t + offset;
+    memset(cnt, 0, HT2TABLE_BUCKETS * sizeof(uint64_t));
 
-    // wait for a lock on this entry
-    if (pthread_mutex_lock(&(t1->mutex))) {
-        printf("store: cannot lock mutex at offset %d\n", offset);
-        exit(1);
-    }
+    hstate.shiftreg = HT2TABLE_START;
+    buildlfsr(&hstate);
+    ht2jump_n(ladder, &hstate, run_first + lo);
 
-    if (debug) printf("store, offset = %d, got lock\n", offset);
+    for (uint64_t i = lo; i < hi; i++) {
+        unsigned char *e = genbuf + (i * GENSIZE);
 
-    // store the entry
-    memcpy(t1->ptr, data + 2, 10);
+        // copy the current state
+        hstate2.shiftreg = hstate.shiftreg;
+        hstate2.lfsr = hstate.lfsr;
 
-    if (debug) printf("store, offset = %d, copied data\n", offset);
+        // get 48 bits of keystream from hstate2
+        // this is split into 2 x 24 bit
+        uint32_t ks1 = hitag2_nstep(&hstate2, 24);
+        uint32_t ks2 = hitag2_nstep(&hstate2, 24);
 
-    // update the ptr
-    t1->ptr += 10;
+        writebuf(e, ks1, 3);
+        writebuf(e + 3, ks2, 3);
+        writebuf(e + 6, hstate.shiftreg, 6);
+        cnt[(e[0] << 8) | e[1]]++;
 
-    // check if table is full
-    if ((t1->ptr - t1->data) >= DATAMAX) {
-        // write the table to disk
-        writetable(t1);
-        // reset ptr
-        t1->ptr = t1->data;
+        // jump to the next entry
+        hstate.shiftreg = ht2jump_apply(&ladder[0], hstate.shiftreg);
+        buildlfsr(&hstate);
     }
+}
 
-    if (debug) printf("store, offset = %d, after possible write\n", offset);
+// move the slice to its buckets, counts now holds where each goes
+static void scatter_thread(int t) {
+    uint64_t lo = run_entries * t / nthreads;
+    uint64_t hi = run_entries * (t + 1) / nthreads;
+    uint64_t *pos = counts + ((uint64_t)t * HT2TABLE_BUCKETS);
 
-    // release the lock
-    if (pthread_mutex_unlock(&(t1->mutex))) {
-        printf("store: cannot unlock mutex at offset %d\n", offset);
-        exit(1);
+    for (uint64_t i = lo; i < hi; i++) {
+        const unsigned char *e = genbuf + (i * GENSIZE);
+        uint32_t b = (e[0] << 8) | e[1];
+        memcpy(runbuf + (pos[b]++ * HT2TABLE_RECSIZE), e + 2, HT2TABLE_RECSIZE);
     }
-
-    if (debug) printf("store, offset = %d, unlocked\n", offset);
-
 }
 
-// writes the ks (keystream) and s (state)
-static void write_ks_s(uint32_t ks1, uint32_t ks2, uint64_t shiftreg) {
-    unsigned char buf[16];
-
-    // create buffer
-    writebuf(buf, ks1, 3);
-    writebuf(buf + 3, ks2, 3);
-    writebuf(buf + 6, shiftreg, 6);
-
-    // store buffer
-    store(buf);
+static void sort_thread(int t) {
+    (void)t;
+    uint32_t b;
+    while ((b = __atomic_fetch_add(&next_bucket, 1, __ATOMIC_RELAXED)) < HT2TABLE_BUCKETS) {
+        qsort(runbuf + (run_index[b] * HT2TABLE_RECSIZE), run_index[b + 1] - run_index[b], HT2TABLE_RECSIZE, reccmp);
+    }
 }
 
+static void run_path(char *path, size_t len, int r) {
+    snprintf(path, len, "%s.run%04d", outfile, r);
+}
 
-// builds the di table for jumping
-static void builddi(int steps, int table) {
-    uint64_t statemask;
-    int i;
-    Hitag_State mystate;
-    uint64_t *thisd = NULL;
-
-    statemask = 1;
-
-    // select jump table
-    if (table == 1) {
-        nsteps = steps;
-        thisd = d;
-    } else if (table == 2) {
-        nsteps2 = steps;
-        thisd = d2;
-    } else {
-        printf("builddi: invalid table num\n");
+static void add_run(const char *path, uint64_t first, uint64_t entries, const uint64_t *index) {
+    runs = (run_t *)realloc(runs, (nruns + 1) * sizeof(run_t));
+    if (!runs) {
+        printf("cannot realloc runs\n");
         exit(1);
     }
 
-    // build di states
-    for (i = 0; i < 48; i++) {
-        mystate.shiftreg = statemask;
-        buildlfsr(&mystate);
-        hitag2_nstep(&mystate, steps);
-        thisd[i] = mystate.shiftreg;
-
-        statemask = statemask << 1;
+    run_t *r = &runs[nruns++];
+    snprintf(r->path, sizeof(r->path), "%s", path);
+    r->first = first;
+    r->entries = entries;
+    r->index = (uint64_t *)malloc((HT2TABLE_BUCKETS + 1) * sizeof(uint64_t));
+    if (!r->index) {
+        printf("cannot malloc run index\n");
+        exit(1);
     }
+    memcpy(r->index, index, (HT2TABLE_BUCKETS + 1) * sizeof(uint64_t));
 }
 
-// jump function - quickly jumps a load of steps
-static void jumpnsteps(Hitag_State *hstate, int table) {
-    uint64_t output = 0;
-    uint64_t bitmask;
-    int i;
-    uint64_t *thisd = NULL;
+// pick up a run left by an earlier build, 0 if there is none to use
+static int load_run(int r, uint64_t first) {
+    char path[512];
+    ht2table_header_t hdr;
+    struct stat filestat;
 
+    run_path(path, sizeof(path), r);
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
 
-    // select jump table
-    if (table == 1) {
-        thisd = d;
-    } else if (table == 2) {
-        thisd = d2;
-    } else {
-        printf("jumpnsteps: invalid table num\n");
-        exit(1);
+    int ok = !fstat(fd, &filestat) &&
+             (pread(fd, &hdr, sizeof(hdr), 0) == sizeof(hdr)) &&
+             check_header(&hdr, first) &&
+             (hdr.buckets_done == HT2TABLE_BUCKETS) &&
+             (hdr.entries > 0) && (first + hdr.entries <= numentries) &&
+             ((uint64_t)filestat.st_size == HT2TABLE_DATA_OFFSET + hdr.entries * HT2TABLE_RECSIZE);
+
+    if (ok) {
+        pread_all(fd, run_index, sizeof(run_index), sizeof(hdr), path);
+        add_run(path, first, hdr.entries, run_index);
+        printf("run %d: reusing entries %" PRIu64 "-%" PRIu64 "\n", r, first, first + hdr.entries - 1);
     }
 
-    // xor all di.si where di is a d state and si is a bit
-    // we do this by multiplying di by si:
-    // if si is 1, di.si = di; if si is 0, di.si = 0
+    close(fd);
+    return ok;
+}
 
-    bitmask = 1;
-    for (i = 0; i < 48; i++) {
-        if (hstate->shiftreg & bitmask) {
-            output = output ^ thisd[i];
+static void make_run(int r, uint64_t first, uint64_t entries) {
+    char path[512];
+    char tmppath[520];
+    ht2table_header_t hdr;
+    time_t t0 = time(NULL);
+
+    run_first = first;
+    run_entries = entries;
+
+    run_threads(gen_thread);
+
+    // bucket starts, and where each thread puts its entries of a bucket
+    uint64_t pos = 0;
+    for (uint32_t b = 0; b < HT2TABLE_BUCKETS; b++) {
+        run_index[b] = pos;
+        for (int t = 0; t < nthreads; t++) {
+            uint64_t c = counts[((uint64_t)t * HT2TABLE_BUCKETS) + b];
+            counts[((uint64_t)t * HT2TABLE_BUCKETS) + b] = pos;
+            pos += c;
         }
-
-        bitmask = bitmask << 1;
     }
+    run_index[HT2TABLE_BUCKETS] = pos;
 
-    hstate->shiftreg = output;
-    buildlfsr(hstate);
-}
+    run_threads(scatter_thread);
+    next_bucket = 0;
+    run_threads(sort_thread);
 
+    run_path(path, sizeof(path), r);
+    snprintf(tmppath, sizeof(tmppath), "%s.tmp", path);
 
-// thread to build a part of the table
-static void *buildtable(void *dd) {
-    Hitag_State hstate;
-    Hitag_State hstate2;
-    unsigned long maxentries = 1;
-    int index = (int)(long)dd;
-    int tnum = NUM_BUILD_THREADS;
+    int fd = open(tmppath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        printf("cannot create run file %s\n", tmppath);
+        exit(1);
+    }
 
-    /* set random state */
-    hstate.shiftreg = 0x123456789abc;
-    buildlfsr(&hstate);
+    make_header(&hdr, first, entries, HT2TABLE_BUCKETS);
+    write_all(fd, &hdr, sizeof(hdr), tmppath);
+    write_all(fd, run_index, sizeof(run_index), tmppath);
+    write_all(fd, runbuf, entries * HT2TABLE_RECSIZE, tmppath);
 
-    /* jump to offset using jump table 2 (2048) */
-    for (unsigned long i = 0; i < index; i++) {
-        jumpnsteps(&hstate, 2);
+    if (fsync(fd)) {
+        printf("cannot sync run file %s\n", tmppath);
+        exit(1);
     }
+    close(fd);
 
-    /* set max entries - this is a fraction of 2^37 depending on how many threads we are running.
-       1 thread  = 2^37
-       2 threads = 2^36
-       4 threads = 2^35
-       8 threads = 2^34
-       etc
-    */
-    maxentries = maxentries << 37;
-    while (!(tnum & 0x1)) {
-        maxentries = maxentries >> 1;
-        tnum = tnum >> 1;
+    if (rename(tmppath, path)) {
+        printf("cannot rename %s to %s\n", tmppath, path);
+        exit(1);
     }
 
-    /* make the entries */
-    for (unsigned long i = 0; i < maxentries; i++) {
-
-        // copy the current state
-        hstate2.shiftreg = hstate.shiftreg;
-        hstate2.lfsr = hstate.lfsr;
-
-        // get 48 bits of keystream from hstate2
-        // this is split into 2 x 24 bit
-        uint32_t ks1 = hitag2_nstep(&hstate2, 24);
-        uint32_t ks2 = hitag2_nstep(&hstate2, 24);
+    add_run(path, first, entries, run_index);
+    printf("run %d: entries %" PRIu64 "-%" PRIu64 " written in %ld s\n", r, first, first + entries - 1, (long)(time(NULL) - t0));
+}
 
-        write_ks_s(ks1, ks2, hstate.shiftreg);
+static void make_runs(void) {
+    uint64_t next = 0;
+    int r = 0;
 
-        // jump hstate forward 2048 * NUM_BUILD_THREADS states using di table
-        // this is because we're running NUM_BUILD_THREADS threads at once, from NUM_BUILD_THREADS
-        // different offsets that are 2048 states apart.
-        jumpnsteps(&hstate, 1);
+    while ((next < numentries) && load_run(r, next)) {
+        next += runs[r].entries;
+        r++;
     }
 
-    return NULL;
-}
-
+    if (next == numentries) {
+        return;
+    }
 
-// make 'table/' (unsorted) and 'sorted/' dir structures
-static void makedirs(void) {
-    char path[32];
-    int i;
+    // what is left of the budget after the counts goes on the run
+    uint64_t room = budget - ((uint64_t)nthreads * HT2TABLE_BUCKETS * sizeof(uint64_t));
+    uint64_t maxrun = room / (GENSIZE + HT2TABLE_RECSIZE);
+    if (maxrun > numentries - next) {
+        maxrun = numentries - next;
+    }
 
-    if (mkdir("table", 0755)) {
-        printf("cannot make dir table\n");
+    genbuf = (unsigned char *)malloc(maxrun * GENSIZE);
+    runbuf = (unsigned char *)malloc(maxrun * HT2TABLE_RECSIZE);
+    counts = (uint64_t *)malloc((uint64_t)nthreads * HT2TABLE_BUCKETS * sizeof(uint64_t));
+    if (!genbuf || !runbuf || !counts) {
+        printf("cannot malloc %" PRIu64 " run entries, try a smaller -m\n", maxrun);
         exit(1);
     }
-    if (mkdir("sorted", 0755)) {
-        printf("cannot make dir sorted\n");
-        exit(1);
+
+    printf("making runs of %" PRIu64 " entries\n", maxrun);
+
+    for (; next < numentries; r++) {
+        uint64_t entries = (numentries - next < maxrun) ? numentries - next : maxrun;
+        make_run(r, next, entries);
+        next += entries;
     }
 
-    for (i = 0; i < 0x100; i++) {
-        snprintf(path, sizeof(path), "table/%02x", i);
-        if (mkdir(path, 0755)) {
-            printf("cannot make dir %s\n", path);
-            exit(1);
+    free(genbuf);
+    free(runbuf);
+    free(counts);
+}
+
+// k way merge of the runs' parts of one bucket
+typedef struct {
+    const unsigned char *p;
+    const unsigned char *end;
+} cursor_t;
+
+static void heap_down(cursor_t *heap, int n, int i) {
+    for (;;) {
+        int min = i;
+        int l = (2 * i) + 1;
+        int r = l + 1;
+        if ((l < n) && (memcmp(heap[l].p, heap[min].p, HT2TABLE_RECSIZE) < 0)) {
+            min = l;
         }
-        snprintf(path, sizeof(path), "sorted/%02x", i);
-        if (mkdir(path, 0755)) {
-            printf("cannot make dir %s\n", path);
-            exit(1);
+        if ((r < n) && (memcmp(heap[r].p, heap[min].p, HT2TABLE_RECSIZE) < 0)) {
+            min = r;
+        }
+        if (min == i) {
+            return;
         }
+        cursor_t tmp = heap[i];
+        heap[i] = heap[min];
+        heap[min] = tmp;
+        i = min;
     }
 }
 
-static int datacmp(const void *p1, const void *p2, void *dummy) {
-    unsigned char *d_1 = (unsigned char *)p1;
-    unsigned char *d_2 = (unsigned char *)p2;
-
-    return memcmp(d_1, d_2, DATASIZE);
-}
-
-static void *sorttable(void *dd) {
-    int i, j;
-    int fdin;
-    int fdout;
-    char infile[64];
-    char outfile[64];
-    unsigned char *data = NULL;
-    struct stat filestat;
-    int index = (int)(long)dd;
-    int space = 0x100 / NUM_SORT_THREADS;
+static void merge_thread(int t) {
+    (void)t;
+    uint32_t b;
 
-    // create table - 50MB should be enough
-    unsigned char *table = (unsigned char *)calloc(1, 50UL * 1024UL * 1024UL);
-    if (!table) {
-        printf("sorttable: cannot calloc table\n");
+    cursor_t *heap = (cursor_t *)malloc(nruns * sizeof(cursor_t));
+    if (!heap) {
+        printf("cannot malloc merge heap\n");
         exit(1);
     }
 
-    // loop over our first byte values
-    for (i = (index * space); i < ((index + 1) * space); i++) {
-        // loop over all second byte values
-        for (j = 0; j < 0x100; j++) {
-
-            printf("sorttable: processing bytes 0x%02x/0x%02x\n", i, j);
-
-            // open file, stat it and mmap it
-            snprintf(infile, sizeof(infile), "table/%02x/%02x.bin", i, j);
-
-            fdin = open(infile, O_RDONLY);
-            if (fdin <= 0) {
-                printf("cannot open file %s\n", infile);
-                exit(1);
+    while ((b = __atomic_fetch_add(&next_bucket, 1, __ATOMIC_RELAXED)) < batch_hi) {
+        unsigned char *out = mergeout + ((table_index[b] - table_index[batch_lo]) * HT2TABLE_RECSIZE);
+        int n = 0;
+
+        for (int r = 0; r < nruns; r++) {
+            uint64_t start = seg_base[r] + (runs[r].index[b] - runs[r].index[batch_lo]);
+            uint64_t len = runs[r].index[b + 1] - runs[r].index[b];
+            if (len) {
+                heap[n].p = mergein + (start * HT2TABLE_RECSIZE);
+                heap[n].end = heap[n].p + (len * HT2TABLE_RECSIZE);
+                n++;
             }
+        }
 
-            if (fstat(fdin, &filestat)) {
-                printf("cannot stat file %s\n", infile);
-                exit(1);
-            }
+        for (int i = (n / 2) - 1; i >= 0; i--) {
+            heap_down(heap, n, i);
+        }
 
-            data = mmap((caddr_t)0, filestat.st_size, PROT_READ, MAP_PRIVATE, fdin, 0);
-            if (data == MAP_FAILED) {
-                printf("cannot mmap file %s\n", infile);
-                exit(1);
+        while (n) {
+            memcpy(out, heap[0].p, HT2TABLE_RECSIZE);
+            out += HT2TABLE_RECSIZE;
+            heap[0].p += HT2TABLE_RECSIZE;
+            if (heap[0].p == heap[0].end) {
+                heap[0] = heap[--n];
             }
+            heap_down(heap, n, 0);
+        }
+    }
 
-            // copy data into table
-            memcpy(table, data, filestat.st_size);
+    free(heap);
+}
+
+static void merge_runs(int fd, ht2table_header_t *hdr) {
+    // whole buckets, as many as fit the budget twice (in and out)
+    uint64_t maxrecs = budget / (2 * HT2TABLE_RECSIZE);
+    uint64_t maxbucket = 0;
+    for (uint32_t b = 0; b < HT2TABLE_BUCKETS; b++) {
+        if (table_index[b + 1] - table_index[b] > maxbucket) {
+            maxbucket = table_index[b + 1] - table_index[b];
+        }
+    }
+    if (maxrecs < maxbucket) {
+        maxrecs = maxbucket;
+    }
+    if (maxrecs > numentries) {
+        maxrecs = numentries;
+    }
 
-            uint64_t numentries = filestat.st_size / DATASIZE;
+    mergein = (unsigned char *)malloc(maxrecs * HT2TABLE_RECSIZE);
+    mergeout = (unsigned char *)malloc(maxrecs * HT2TABLE_RECSIZE);
+    seg_base = (uint64_t *)malloc(nruns * sizeof(uint64_t));
+    if (!mergein || !mergeout || !seg_base) {
+        printf("cannot malloc merge buffers, try a smaller -m\n");
+        exit(1);
+    }
 
-            // unmap file and close it
-            if (munmap(data, filestat.st_size)) {
-                printf("cannot munmap %s\n", infile);
-                exit(1);
+    while (hdr->buckets_done < HT2TABLE_BUCKETS) {
+        time_t t0 = time(NULL);
+        batch_lo = hdr->buckets_done;
+        batch_hi = batch_lo + 1;
+        while ((batch_hi < HT2TABLE_BUCKETS) && (table_index[batch_hi + 1] - table_index[batch_lo] <= maxrecs)) {
+            batch_hi++;
+        }
+        uint64_t total = table_index[batch_hi] - table_index[batch_lo];
+
+        // one sequential read per run
+        uint64_t base = 0;
+        for (int r = 0; r < nruns; r++) {
+            uint64_t len = runs[r].index[batch_hi] - runs[r].index[batch_lo];
+            seg_base[r] = base;
+            if (len) {
+                int rfd = open(runs[r].path, O_RDONLY);
+                if (rfd < 0) {
+                    printf("cannot open run file %s\n", runs[r].path);
+                    exit(1);
+                }
+                pread_all(rfd, mergein + (base * HT2TABLE_RECSIZE), len * HT2TABLE_RECSIZE, HT2TABLE_DATA_OFFSET + (runs[r].index[batch_lo] * HT2TABLE_RECSIZE), runs[r].path);
+                close(rfd);
             }
+            base += len;
+        }
 
-            close(fdin);
-
-            // sort it
-            void *dummy = NULL; // clang
-            qsort_r(table, numentries, DATASIZE, datacmp, dummy);
+        next_bucket = batch_lo;
+        run_threads(merge_thread);
 
-            // write to file
-            snprintf(outfile, sizeof(outfile), "sorted/%02x/%02x.bin", i, j);
-            fdout = open(outfile, O_WRONLY | O_CREAT, 0644);
-            if (fdout <= 0) {
-                printf("cannot create outfile %s\n", outfile);
-                exit(1);
-            }
-            if (write(fdout, table, numentries * DATASIZE) != (numentries * DATASIZE)) {
-                printf("writetable cannot write all of the data\n");
-                exit(1);
-            }
-            close(fdout);
+        pwrite_all(fd, mergeout, total * HT2TABLE_RECSIZE, HT2TABLE_DATA_OFFSET + (table_index[batch_lo] * HT2TABLE_RECSIZE), outfile);
+        if (fsync(fd)) {
+            printf("cannot sync %s\n", outfile);
+            exit(1);
+        }
 
-            // remove input file
-            if (unlink(infile)) {
-                printf("cannot remove file %s\n", infile);
-                exit(1);
-            }
+        // only now the buckets count as done
+        hdr->buckets_done = batch_hi;
+        pwrite_all(fd, hdr, sizeof(ht2table_header_t), 0, outfile);
+        if (fsync(fd)) {
+            printf("cannot sync %s\n", outfile);
+            exit(1);
         }
+
+        printf("merge: buckets 0x%04x-0x%04x done in %ld s, %.1f%%\n", batch_lo, batch_hi - 1, (long)(time(NULL) - t0), (100.0 * table_index[batch_hi]) / numentries);
     }
 
-    return NULL;
+    free(mergein);
+    free(mergeout);
+    free(seg_base);
 }
 
 int main(int argc, char *argv[]) {
-    pthread_t threads[NUM_BUILD_THREADS];
-    void *status;
+    ht2table_header_t hdr;
+    int bits = HT2TABLE_FULL_BITS;
+    uint64_t mb = 0;
+    int c;
+
+#if !defined(_WIN32) || !defined(__WIN32__)
+    nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (nthreads < 1)
+        nthreads = 1;
+#endif  /* _WIN32 */
+
+    while ((c = getopt(argc, argv, "o:n:m:t:h")) != -1) {
+        switch (c) {
+            case 'o':
+                outfile = optarg;
+                break;
+            case 'n':
+                bits = atoi(optarg);
+                break;
+            case 'm':
+                mb = strtoull(optarg, NULL, 10);
+                break;
+            case 't':
+                nthreads = atoi(optarg);
+                break;
+            case 'h':
+            default:
+                usage();
+        }
+    }
 
-    // make the table of tables
-    t = (struct table *)calloc(sizeof(struct table) * 65536, sizeof(uint8_t));
-    if (!t) {
-        printf("calloc failed\n");
-        exit(1);
+    if ((bits < 1) || (bits > HT2TABLE_FULL_BITS) || (nthreads < 1)) {
+        usage();
     }
 
-    // init the table
-    create_tables(t);
+    // progress shows up in a log file as it happens
+    setvbuf(stdout, NULL, _IOLBF, 0);
 
-    // create the directories
-    makedirs();
+    numentries = 1ULL << bits;
+    budget = (mb) ? mb * 1024 * 1024 : (available_ram() / 4) * 3;
+    if (budget < 16 * 1024 * 1024) {
+        budget = 16 * 1024 * 1024;
+    }
 
-    // build the jump table for incremental steps
-    builddi(2048 * NUM_BUILD_THREADS, 1);
+    printf("building %s, 2^%d entries (%" PRIu64 " MB) with %" PRIu64 " MB of RAM and %d threads\n",
+           outfile, bits, (numentries * HT2TABLE_RECSIZE) >> 20, budget >> 20, nthreads);
 
-    // build the jump table for setting the offset
-    builddi(2048, 2);
+    ht2jump_ladder(ladder, HT2TABLE_STEP);
 
-    // start the threads
-    for (long i = 0; i < NUM_BUILD_THREADS; i++) {
-        int ret = pthread_create(&(threads[i]), NULL, buildtable, (void *)(i));
-        if (ret) {
-            printf("cannot start buildtable thread %ld\n", i);
+    // an existing table is either done or being merged, in which case
+    // the runs must all be there already
+    int fd = open(outfile, O_RDWR);
+    int resume = 0;
+    if (fd >= 0) {
+        if ((pread(fd, &hdr, sizeof(hdr), 0) != sizeof(hdr)) || !check_header(&hdr, 0) || (hdr.entries != numentries)) {
+            printf("%s exists but is not a table of 2^%d entries, remove it first\n", outfile, bits);
             exit(1);
         }
+        if (hdr.buckets_done == HT2TABLE_BUCKETS) {
+            printf("table %s is already complete\n", outfile);
+            close(fd);
+            return 0;
+        }
+        resume = 1;
     }
 
-    if (debug) printf("main, started buildtable threads\n");
+    make_runs();
 
-    // wait for threads to finish
-    for (long i = 0; i < NUM_BUILD_THREADS; i++) {
-        int ret = pthread_join(threads[i], &status);
-        if (ret) {
-            printf("cannot join buildtable thread %ld\n", i);
-            exit(1);
-        }
-        printf("buildtable thread %ld finished\n", i);
+    if (resume && (nruns == 0 || runs[nruns - 1].first + runs[nruns - 1].entries != numentries)) {
+        printf("runs for the partly merged %s are missing, remove it to start again\n", outfile);
+        exit(1);
     }
 
-    // write all remaining files
-    for (long i = 0; i < 0x10000; i++) {
-        struct table *t1 = t + i;
-        if (t1->ptr > t1->data) {
-            writetable(t1);
+    memset(table_index, 0, sizeof(table_index));
+    for (int r = 0; r < nruns; r++) {
+        for (uint32_t b = 0; b <= HT2TABLE_BUCKETS; b++) {
+            table_index[b] += runs[r].index[b];
         }
     }
 
-    // dump the memory
-    free_tables(t);
-    free(t);
-
-    // now for the sorting
-
-    // start the threads
-    for (long i = 0; i < NUM_SORT_THREADS; i++) {
-        int ret = pthread_create(&(threads[i]), NULL, sorttable, (void *)(i));
-        if (ret) {
-            printf("cannot start sorttable thread %ld\n", i);
+    if (resume) {
+        uint64_t *index = (uint64_t *)malloc(sizeof(table_index));
+        if (!index) {
+            printf("cannot malloc index\n");
+            exit(1);
+        }
+        pread_all(fd, index, sizeof(table_index), sizeof(hdr), outfile);
+        if (memcmp(index, table_index, sizeof(table_index))) {
+            printf("runs do not match the partly merged %s, remove it to start again\n", outfile);
+            exit(1);
+        }
+        free(index);
+        printf("resuming merge at bucket 0x%04x\n", hdr.buckets_done);
+    } else {
+        fd = open(outfile, O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            printf("cannot create table file %s\n", outfile);
+            exit(1);
+        }
+        make_header(&hdr, 0, numentries, 0);
+        write_all(fd, &hdr, sizeof(hdr), outfile);
+        write_all(fd, table_index, sizeof(table_index), outfile);
+        if (ftruncate(fd, HT2TABLE_DATA_OFFSET + (numentries * HT2TABLE_RECSIZE))) {
+            printf("cannot size table file %s\n", outfile);
             exit(1);
         }
     }
 
-    if (debug) printf("main, started sorttable threads\n");
+    merge_runs(fd, &hdr);
+    close(fd);
 
-    // wait for threads to finish
-    for (long i = 0; i < NUM_SORT_THREADS; i++) {
-        int ret = pthread_join(threads[i], &status);
-        if (ret) {
-            printf("cannot join sorttable thread %ld\n", i);
-            exit(1);
+    for (int r = 0; r < nruns; r++) {
+        if (unlink(runs[r].path)) {
+            printf("cannot remove run file %s\n", runs[r].path);
         }
-        printf("sorttable thread %ld finished\n", i);
+        free(runs[r].index);
     }
+    free(runs);
 
-    pthread_exit(NULL);
-
+    printf("table %s complete, %" PRIu64 " entries\n", outfile, numentries);
     return 0;
 }
-
-
-
-
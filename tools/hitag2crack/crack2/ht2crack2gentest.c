@@ -1,9 +1,12 @@
 /*
  * ht2crack2gentests.c
  * this uses the RFIDler hitag2 PRNG code to generate test cases to test the tables
+ *
+ * Given a table, the tests are made from PRNG states it covers, so a scaled
+ * down table built with ht2crack2buildtable -n can be checked as well.
  */
 
-#include "ht2crackutils.h"
+#include "ht2crack2table.h"
 
 static int makerandom(char *hex, unsigned int len, int fd) {
     unsigned char raw[32];
@@ -32,6 +35,59 @@ static int makerandom(char *hex, unsigned int len, int fd) {
 }
 
 
+// key giving the PRNG state p after initialisation with uid and nR,
+// the same sums ht2crack2search does to recover it
+static void keyforstate(char *key, uint64_t p, char *uid, char *nR) {
+    Hitag_State hstate;
+    uint32_t uidtmp = rev32(hexreversetoulong(uid));
+    uint32_t nRenc = rev32(hexreversetoulong(nR));
+    uint32_t nRxork = (p >> 16) & 0xffffffff;
+    uint32_t b = 0;
+
+    hstate.shiftreg = p;
+    for (int i = 0; i < 32; i++) {
+        hstate.shiftreg = ((hstate.shiftreg) << 1) | ((uidtmp >> 31) & 0x1);
+        uidtmp = uidtmp << 1;
+        b = (b << 1) | fnf(hstate.shiftreg);
+    }
+
+    uint64_t keyrev = (p & 0xffff) | ((uint64_t)(nRxork ^ nRenc ^ b) << 16);
+    uint64_t k = rev64(keyrev);
+    for (int i = 0; i < 6; i++) {
+        snprintf(key + (2 * i), 3, "%02X", (int)(k & 0xff));
+        k = k >> 8;
+    }
+}
+
+// picks a key whose keystream holds a table entry early enough for the search
+static void makecovered(char *key, char *uid, char *nR, const ht2table_header_t *hdr, const ht2jump_t *ladder, int fd) {
+    Hitag_State hstate;
+    uint64_t rnd;
+
+    if (read(fd, &rnd, sizeof(rnd)) != sizeof(rnd)) {
+        printf("makecovered: cannot read random bytes\n");
+        exit(1);
+    }
+
+    // entry e is matched at keystream bit j, after the 64 bits of auth
+    uint64_t e = 1 + ((rnd >> 11) % (hdr->entries - 1));
+    uint32_t j = rnd % 1900;
+
+    hstate.shiftreg = hdr->start;
+    buildlfsr(&hstate);
+    ht2jump_n(ladder, &hstate, e - 1);
+    hitag2_nstep(&hstate, hdr->step - 64 - j);
+
+    keyforstate(key, hstate.shiftreg, uid, nR);
+
+    Hitag_State check;
+    hitag2_init(&check, rev64(hexreversetoulonglong(key)), rev32(hexreversetoulong(uid)), rev32(hexreversetoulong(nR)));
+    if ((check.shiftreg & 0xffffffffffffULL) != hstate.shiftreg) {
+        printf("makecovered: key %s does not give the wanted state\n", key);
+        exit(1);
+    }
+}
+
 int main(int argc, char *argv[]) {
     Hitag_State hstate;
     char key[32];
@@ -42,8 +98,11 @@ int main(int argc, char *argv[]) {
     int numtests;
     int urandomfd;
 
+    ht2table_t table;
+    ht2jump_t *ladder = NULL;
+
     if (argc < 2) {
-        printf("%s number\n", argv[0]);
+        printf("%s number [table]\n", argv[0]);
         exit(1);
     }
 
@@ -59,12 +118,32 @@ int main(int argc, char *argv[]) {
         exit(1);
     }
 
+    if (argc > 2) {
+        if (!ht2table_open(&table, argv[2])) {
+            exit(1);
+        }
+        if ((table.hdr->entries < 2) || (table.hdr->step != HT2TABLE_STEP)) {
+            printf("table %s is too small to make tests from\n", argv[2]);
+            exit(1);
+        }
+        ladder = (ht2jump_t *)calloc(HT2JUMP_LEVELS, sizeof(ht2jump_t));
+        if (!ladder) {
+            printf("cannot calloc jump ladder\n");
+            exit(1);
+        }
+        ht2jump_ladder(ladder, table.hdr->step);
+    }
+
 
     for (i = 0; i < numtests; i++) {
 
-        makerandom(key, 6, urandomfd);
         makerandom(uid, 4, urandomfd);
         makerandom(nR, 4, urandomfd);
+        if (ladder) {
+            makecovered(key, uid, nR, table.hdr, ladder, urandomfd);
+        } else {
+            makerandom(key, 6, urandomfd);
+        }
         snprintf(filename, sizeof(filename), "keystream.key-%s.uid-%s.nR-%s", key, uid, nR);
 
         FILE *fp = fopen(filename, "w");
@@ -86,6 +165,11 @@ int main(int argc, char *argv[]) {
 
         fclose(fp);
     }
+
+    if (ladder) {
+        free(ladder);
+        ht2table_close(&table);
+    }
     return 0;
 }
 
@@ -4,23 +4,16 @@
  * PRNG state, checks it is correct, and then rolls back the PRNG to recover the key
  */
 
-#include "ht2crackutils.h"
+#include "ht2crack2table.h"
 
-#define INPUTFILE "sorted/%02x/%02x.bin"
-#define DATASIZE 10
+// the whole table, mapped once
+static ht2table_t table;
 
 struct rngdata {
     unsigned char *data;
     int len;
 };
 
-static int datacmp(const void *p1, const void *p2) {
-    unsigned char *d1 = (unsigned char *)p1;
-    unsigned char *d2 = (unsigned char *)p2;
-
-    return memcmp(d1, d2, DATASIZE - 6);
-}
-
 static int loadrngdata(struct rngdata *r, char *file) {
     int fd;
     int i, j;
@@ -153,71 +146,27 @@ static int testcand(const unsigned char *f, unsigned char *rt, int fwd) {
 }
 
 static int searchcand(unsigned char *c, unsigned char *rt, int fwd, unsigned char *m, unsigned char *s) {
-    int fd;
-    struct stat filestat;
-    char file[64];
-    unsigned char *data;
-    unsigned char item[10];
-    unsigned char *found = NULL;
-
+    uint64_t count = 0;
+    const unsigned char *found;
 
     if (!c || !rt || !m || !s) {
         printf("searchcand: invalid params\n");
         return 0;
     }
 
-    snprintf(file, sizeof(file), INPUTFILE, c[0], c[1]);
-
-    fd = open(file, O_RDONLY);
-    if (fd <= 0) {
-        printf("cannot open table file %s\n", file);
-        exit(1);
-    }
-
-    if (fstat(fd, &filestat)) {
-        printf("cannot stat file %s\n", file);
-        exit(1);
-    }
+    found = ht2table_find(&table, c, &count);
 
-    data = mmap((caddr_t)0, filestat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
-    if (data == MAP_FAILED) {
-        printf("cannot mmap file %s\n", file);
-        exit(1);
-    }
-
-    memcpy(item, c + 2, 4);
-
-    found = (unsigned char *)bsearch(item, data, filestat.st_size / DATASIZE, DATASIZE, datacmp);
-
-    if (found) {
-
-        // our candidate is in the table
-        // go backwards and see if there are other matches
-        while (((found - data) >= DATASIZE) && (!memcmp(found - DATASIZE, item, 4))) {
-            found = found - DATASIZE;
-        }
-
-        // now test all matches
-        while (((found - data) <= (filestat.st_size - DATASIZE)) && (!memcmp(found, item, 4))) {
-            if (testcand(found, rt, fwd)) {
-                memcpy(m, c, 2);
-                memcpy(m + 2, found, 4);
-                memcpy(s, found + 4, 6);
-
-                munmap(data, filestat.st_size);
-                close(fd);
-                return 1;
-            }
-
-            found = found + DATASIZE;
+    // our candidate may be in the table several times, test all matches
+    for (uint64_t i = 0; i < count; i++, found += HT2TABLE_RECSIZE) {
+        if (testcand(found, rt, fwd)) {
+            memcpy(m, c, 2);
+            memcpy(m + 2, found, 4);
+            memcpy(s, found + 4, 6);
+            return 1;
         }
     }
 
-    munmap(data, filestat.st_size);
-    close(fd);
-
     return 0;
-
 }
 
 static int findmatch(struct rngdata *r, unsigned char *outmatch, unsigned char *outstate, int *bitoffset) {
@@ -363,7 +312,11 @@ int main(int argc, char *argv[]) {
     int i;
 
     if (argc < 4) {
-        printf("%s rngdatafile UID nR\n", argv[0]);
+        printf("%s rngdatafile UID nR [table]\n", argv[0]);
+        exit(1);
+    }
+
+    if (!ht2table_open(&table, (argc > 4) ? argv[4] : HT2TABLE_DEFAULT)) {
         exit(1);
     }
 
@@ -387,6 +340,7 @@ int main(int argc, char *argv[]) {
 
     if (!findmatch(&rng, rngmatch, rngstate, &bitoffset)) {
         printf("couldn't find a match\n");
+        ht2table_close(&table);
         exit(1);
     }
 
@@ -411,6 +365,7 @@ int main(int argc, char *argv[]) {
     }
     printf("\n");
 
+    ht2table_close(&table);
     return 0;
 
 }
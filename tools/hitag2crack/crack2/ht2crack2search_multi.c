@@ -11,7 +11,7 @@
  * When testing remember OS cache fiddles with your mind and results. Running same test values will be much faster second run
  */
 
-#include "ht2crackutils.h"
+#include "ht2crack2table.h"
 #include <pthread.h>
 #include <stdbool.h>
 #include <strings.h>
@@ -42,8 +42,8 @@ typedef struct thread_args {
 #define _YELLOW_(s)     "\x1b[33m" s AEND
 #define _CYAN_(s)       "\x1b[36m" s AEND
 
-#define INPUTFILE       "sorted/%02x/%02x.bin"
-#define DATASIZE        10
+// the whole table, mapped once and shared by the threads
+static ht2table_t table;
 
 static void print_hex(const uint8_t *data, const size_t len) {
     if (data == NULL || len == 0) return;
@@ -55,12 +55,6 @@ static void print_hex(const uint8_t *data, const size_t len) {
     printf("\n");
 }
 
-static int datacmp(const void *p1, const void *p2) {
-    const void *d1 = p1;
-    const void *d2 = p2;
-    return memcmp(d1, d2, DATASIZE - 6);
-}
-
 static int loadrngdata(rngdata_t *r, char *file) {
     int fd;
     int i, j;
@@ -192,70 +186,27 @@ static int testcand(const unsigned char *f, const unsigned char *rt, int fwd) {
 }
 
 static int searchcand(unsigned char *c, unsigned char *rt, int fwd, unsigned char *m, unsigned char *s) {
+    uint64_t count = 0;
+    const unsigned char *found;
 
     if (!c || !rt || !m || !s) {
         printf("searchcand: invalid params\n");
         return 0;
     }
 
-    char file[64];
-    unsigned char *data;
-    unsigned char item[10];
-    unsigned char *found = NULL;
-
-    snprintf(file, sizeof(file), INPUTFILE, c[0], c[1]);
-
-    int fd = open(file, O_RDONLY);
-    if (fd <= 0) {
-        printf("cannot open table file %s\n", file);
-        exit(1);
-    }
-
-    struct stat filestat;
-    if (fstat(fd, &filestat)) {
-        printf("cannot stat file %s\n", file);
-        exit(1);
-    }
+    found = ht2table_find(&table, c, &count);
 
-    data = mmap((caddr_t)0, filestat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
-    if (data == MAP_FAILED) {
-        printf("cannot mmap file %s\n", file);
-        exit(1);
-    }
-
-    memcpy(item, c + 2, 4);
-
-    found = (unsigned char *)bsearch(item, data, filestat.st_size / DATASIZE, DATASIZE, datacmp);
-
-    if (found) {
-
-        // our candidate is in the table
-        // go backwards and see if there are other matches
-        while (((found - data) >= DATASIZE) && (!memcmp(found - DATASIZE, item, 4))) {
-            found = found - DATASIZE;
-        }
-
-        // now test all matches
-        while (((found - data) <= (filestat.st_size - DATASIZE)) && (!memcmp(found, item, 4))) {
-            if (testcand(found, rt, fwd)) {
-                memcpy(m, c, 2);
-                memcpy(m + 2, found, 4);
-                memcpy(s, found + 4, 6);
-
-                munmap(data, filestat.st_size);
-                close(fd);
-                return 1;
-            }
-
-            found = found + DATASIZE;
+    // our candidate may be in the table several times, test all matches
+    for (uint64_t i = 0; i < count; i++, found += HT2TABLE_RECSIZE) {
+        if (testcand(found, rt, fwd)) {
+            memcpy(m, c, 2);
+            memcpy(m + 2, found, 4);
+            memcpy(s, found + 4, 6);
+            return 1;
         }
     }
 
-    munmap(data, filestat.st_size);
-    close(fd);
-
     return 0;
-
 }
 
 static void *brute_thread(void *arguments) {
@@ -415,7 +366,11 @@ static uint64_t recoverkey(Hitag_State *hstate, char *uidstr, char *nRstr) {
 int main(int argc, char *argv[]) {
 
     if (argc < 4) {
-        printf("%s rngdatafile UID nR\n", argv[0]);
+        printf("%s rngdatafile UID nR [table]\n", argv[0]);
+        exit(1);
+    }
+
+    if (!ht2table_open(&table, (argc > 4) ? argv[4] : HT2TABLE_DEFAULT)) {
         exit(1);
     }
 
@@ -515,6 +470,7 @@ int main(int argc, char *argv[]) {
     // clean up mutex
     pthread_mutex_destroy(&print_lock);
 
+    ht2table_close(&table);
     free(rng.data);
     return 0;
 }
@@ -0,0 +1,125 @@
+/*
+ * ht2crack2table.c
+ * Sorted table access and PRNG jumps shared by the ht2crack2 tools.
+ */
+
+#include "ht2crack2table.h"
+
+int ht2table_open(ht2table_t *t, const char *path) {
+    struct stat filestat;
+
+    memset(t, 0, sizeof(ht2table_t));
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("cannot open table file %s\n", path);
+        return 0;
+    }
+
+    if (fstat(fd, &filestat) || ((uint64_t)filestat.st_size < HT2TABLE_DATA_OFFSET)) {
+        printf("table file %s is too small\n", path);
+        close(fd);
+        return 0;
+    }
+
+    // the whole table, the OS pages in the buckets we touch
+    void *map = mmap((caddr_t)0, filestat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        printf("cannot mmap file %s\n", path);
+        return 0;
+    }
+
+    const ht2table_header_t *hdr = (const ht2table_header_t *)map;
+    if (memcmp(hdr->magic, HT2TABLE_MAGIC, sizeof(hdr->magic)) || (hdr->version != HT2TABLE_VERSION) || (hdr->recsize != HT2TABLE_RECSIZE)) {
+        printf("%s is not a ht2crack2 table\n", path);
+        munmap(map, filestat.st_size);
+        return 0;
+    }
+
+    if ((hdr->buckets_done != HT2TABLE_BUCKETS) || ((uint64_t)filestat.st_size != HT2TABLE_DATA_OFFSET + (hdr->entries * HT2TABLE_RECSIZE))) {
+        printf("table %s is incomplete, run ht2crack2buildtable again to finish it\n", path);
+        munmap(map, filestat.st_size);
+        return 0;
+    }
+
+    t->map = map;
+    t->maplen = filestat.st_size;
+    t->hdr = hdr;
+    t->index = (const uint64_t *)((const unsigned char *)map + sizeof(ht2table_header_t));
+    t->data = (const unsigned char *)map + HT2TABLE_DATA_OFFSET;
+    return 1;
+}
+
+void ht2table_close(ht2table_t *t) {
+    if (t->map) {
+        munmap(t->map, t->maplen);
+    }
+    memset(t, 0, sizeof(ht2table_t));
+}
+
+const unsigned char *ht2table_find(const ht2table_t *t, const unsigned char *ks, uint64_t *count) {
+    uint32_t bucket = (ks[0] << 8) | ks[1];
+    uint64_t lo = t->index[bucket];
+    uint64_t hi = t->index[bucket + 1];
+
+    // lower bound of the remaining 4 bytes
+    while (lo < hi) {
+        uint64_t mid = lo + ((hi - lo) / 2);
+        if (memcmp(t->data + (mid * HT2TABLE_RECSIZE), ks + 2, 4) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    uint64_t n = 0;
+    hi = t->index[bucket + 1];
+    while ((lo + n < hi) && !memcmp(t->data + ((lo + n) * HT2TABLE_RECSIZE), ks + 2, 4)) {
+        n++;
+    }
+
+    if (count) {
+        *count = n;
+    }
+    return (n) ? t->data + (lo * HT2TABLE_RECSIZE) : NULL;
+}
+
+uint64_t ht2jump_apply(const ht2jump_t *j, uint64_t shiftreg) {
+    uint64_t output = 0;
+
+    // xor all di.si where di is a d state and si is a bit
+    for (int i = 0; i < 48; i++) {
+        if ((shiftreg >> i) & 1) {
+            output ^= j->d[i];
+        }
+    }
+    return output;
+}
+
+void ht2jump_ladder(ht2jump_t *ladder, uint32_t step) {
+    Hitag_State mystate;
+
+    for (int i = 0; i < 48; i++) {
+        mystate.shiftreg = 1ULL << i;
+        buildlfsr(&mystate);
+        hitag2_nstep(&mystate, step);
+        ladder[0].d[i] = mystate.shiftreg;
+    }
+
+    // the PRNG is linear, twice a jump is the jump applied to itself
+    for (int k = 1; k < HT2JUMP_LEVELS; k++) {
+        for (int i = 0; i < 48; i++) {
+            ladder[k].d[i] = ht2jump_apply(&ladder[k - 1], ladder[k - 1].d[i]);
+        }
+    }
+}
+
+void ht2jump_n(const ht2jump_t *ladder, Hitag_State *hstate, uint64_t count) {
+    for (int k = 0; (k < HT2JUMP_LEVELS) && count; k++, count >>= 1) {
+        if (count & 1) {
+            hstate->shiftreg = ht2jump_apply(&ladder[k], hstate->shiftreg);
+        }
+    }
+    buildlfsr(hstate);
+}
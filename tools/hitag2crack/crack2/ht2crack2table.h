@@ -0,0 +1,77 @@
+/*
+ * ht2crack2table.h
+ * On disk layout of the sorted table and the PRNG jumps used to build and
+ * test it.
+ *
+ * A table is a single file:
+ *   ht2table_header_t
+ *   uint64_t index[HT2TABLE_BUCKETS + 1]   first record of each 16 bit keystream prefix
+ *   records, HT2TABLE_RECSIZE bytes each    4 bytes keystream + 6 bytes PRNG state
+ *
+ * Records are sorted, the two prefix bytes are not stored but given by the
+ * index, so a lookup is one binary search in one bucket of one mmap. The
+ * intermediate runs of ht2crack2buildtable use the very same layout.
+ * Numbers are in host byte order.
+ */
+
+#ifndef HT2CRACK2TABLE_H
+#define HT2CRACK2TABLE_H
+
+#include "ht2crackutils.h"
+
+#define HT2TABLE_MAGIC      "HT2TABLE"
+#define HT2TABLE_VERSION    1
+#define HT2TABLE_RECSIZE    10
+#define HT2TABLE_BUCKETS    0x10000
+#define HT2TABLE_DEFAULT    "ht2table.bin"
+
+// entries every 2048 PRNG steps, 2^37 of them cover the whole 2^48 cycle
+#define HT2TABLE_STEP       2048
+#define HT2TABLE_START      0x123456789abcULL
+#define HT2TABLE_FULL_BITS  37
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t recsize;
+    uint64_t entries;
+    // number of the first entry, only non zero in runs
+    uint64_t first;
+    uint64_t start;
+    uint32_t step;
+    // buckets with their records in place, HT2TABLE_BUCKETS once complete
+    uint32_t buckets_done;
+} ht2table_header_t;
+
+#define HT2TABLE_DATA_OFFSET (sizeof(ht2table_header_t) + (HT2TABLE_BUCKETS + 1) * sizeof(uint64_t))
+
+typedef struct {
+    const ht2table_header_t *hdr;
+    const uint64_t *index;
+    const unsigned char *data;
+    void *map;
+    size_t maplen;
+} ht2table_t;
+
+// maps a complete table, returns 0 and prints why on failure
+int ht2table_open(ht2table_t *t, const char *path);
+void ht2table_close(ht2table_t *t);
+
+// first of the records matching the 6 keystream bytes in ks, NULL when
+// there are none
+const unsigned char *ht2table_find(const ht2table_t *t, const unsigned char *ks, uint64_t *count);
+
+// jump matrix for a fixed number of steps, d[i] is where state bit i ends up
+typedef struct {
+    uint64_t d[48];
+} ht2jump_t;
+
+#define HT2JUMP_LEVELS 48
+
+// ladder[k] jumps step * 2^k states
+void ht2jump_ladder(ht2jump_t *ladder, uint32_t step);
+uint64_t ht2jump_apply(const ht2jump_t *j, uint64_t shiftreg);
+// jumps count * step states forward
+void ht2jump_n(const ht2jump_t *ladder, Hitag_State *hstate, uint64_t count);
+
+#endif /* HT2CRACK2TABLE_H */
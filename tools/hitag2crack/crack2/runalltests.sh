@@ -1,3 +1,3 @@
 for i in keystream*; do
-./runtest.sh $i
+./runtest.sh $i $1
 done
@@ -1,7 +1,7 @@
 #!/usr/bin/env bash
 
 if [ "$1" == "" ]; then
-echo "runtest.sh testfile"
+echo "runtest.sh testfile [table]"
 echo "testfile name should be of the form:"
 echo "keystream.key-KEY.uid-UID.nR-NR"
 exit 1
@@ -19,7 +19,13 @@ echo "UID           = $UIDV"
 echo "NR            = $NR"
 echo "Expected KEY  = $KEYV"
 
-./ht2crack2search $filename $UIDV $NR
+OUT=`./ht2crack2search $filename $UIDV $NR $2`
+echo "$OUT"
 echo "Expected KEY  = $KEYV"
+if echo "$OUT" | grep -q "KEY:.*$KEYV"; then
+echo "Key check     = OK"
+else
+echo "Key check     = FAIL"
+fi
 echo "********************"
 echo ""
@@ -1,157 +1,112 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// AES-128 decryption with AES-NI, AESNI_LANES keys at a time.
+//
+// Every key of a brute force candidate batch differs, so the key schedule
+// is as hot as the cipher itself. The lanes are expanded and decrypted side
+// by side, which keeps the AES unit busy instead of waiting for the latency
+// of one round after the other.
+//
+// The functions carry their own target attribute, callers check
+// platform_aes_hw_available() before using them.
+//-----------------------------------------------------------------------------
+
 #ifndef __AES_NI_H__
 #define __AES_NI_H__
 
-#include "aes-ni.h"
-// #include <stdint.h>     //for int8_t
-// #include <string.h>     //for memcmp
-// #include <wmmintrin.h>  //for intrinsics for AES-NI
-//compile using gcc and following arguments: -g;-O0;-Wall;-msse2;-msse;-march=native;-maes
-
-/*
-static void AES_CBC_decrypt(const uint8_t *in,  uint8_t *out,  uint8_t iv[],  uint8_t len, uint8_t *key) {
+#if defined(__x86_64__) || defined(__i386__)
 
-    __m128i data, last_in;
-    __m128i feedback = _mm_loadu_si128 ((__m128i*)iv);
+#define AESNI_SUPPORTED 1
 
-    uint j;
-    for (uint8_t i = 0; i < len; i++){
-        last_in =_mm_loadu_si128 (&((__m128i*)in)[i]);
-        data = _mm_xor_si128 (last_in, ((__m128i*)key)[0]);
+#include <stdint.h>
+#include <wmmintrin.h>   // AES-NI
+#include <tmmintrin.h>   // SSSE3 alignr
 
-        for (j = 1; j < 10; j++){
-            data = _mm_aesdec_si128 (data, ((__m128i*)key)[j]);
-        }
-        data = _mm_aesdeclast_si128 (data,((__m128i*)key)[j]);
-        data = _mm_xor_si128 (data, feedback);
-        _mm_storeu_si128 (&((__m128i*)out)[i], data);
-        feedback = last_in;
-    }
-}
-*/
+#define AESNI_LANES 8
+#define AESNI_TARGET __attribute__((target("aes,sse4.1")))
 
-/*
-INLINE static __m128i AES_128_ASSIST (__m128i temp1, __m128i temp2) {
+AESNI_TARGET
+static inline __m128i aesni_128_assist(__m128i temp1, __m128i temp2) {
     __m128i temp3;
-    temp2 = _mm_shuffle_epi32 (temp2 ,0xff);
-    temp3 = _mm_slli_si128 (temp1, 0x4);
-    temp1 = _mm_xor_si128 (temp1, temp3);
-    temp3 = _mm_slli_si128 (temp3, 0x4);
-    temp1 = _mm_xor_si128 (temp1, temp3);
-    temp3 = _mm_slli_si128 (temp3, 0x4);
-    temp1 = _mm_xor_si128 (temp1, temp3);
-    temp1 = _mm_xor_si128 (temp1, temp2);
+    temp2 = _mm_shuffle_epi32(temp2, 0xff);
+    temp3 = _mm_slli_si128(temp1, 0x4);
+    temp1 = _mm_xor_si128(temp1, temp3);
+    temp3 = _mm_slli_si128(temp3, 0x4);
+    temp1 = _mm_xor_si128(temp1, temp3);
+    temp3 = _mm_slli_si128(temp3, 0x4);
+    temp1 = _mm_xor_si128(temp1, temp3);
+    temp1 = _mm_xor_si128(temp1, temp2);
     return temp1;
 }
 
-static void AES_128_Key_Expansion (uint8_t *userkey, __m128i *key) {
-    __m128i temp1, temp2;
-    temp1 = _mm_loadu_si128((__m128i*)userkey);
-    key[0] = temp1;
-    temp2 = _mm_aeskeygenassist_si128 (temp1 ,0x1);
-    temp1 = AES_128_ASSIST(temp1, temp2);
-    key[1] = temp1;
-    temp2 = _mm_aeskeygenassist_si128 (temp1,0x2);
-    temp1 = AES_128_ASSIST(temp1, temp2);
-    key[2] = temp1;
-    temp2 = _mm_aeskeygenassist_si128 (temp1,0x4);
-    temp1 = AES_128_ASSIST(temp1, temp2);
-    key[3] = temp1;
-    temp2 = _mm_aeskeygenassist_si128 (temp1,0x8);
-    temp1 = AES_128_ASSIST(temp1, temp2);
-    key[4] = temp1;
-    temp2 = _mm_aeskeygenassist_si128 (temp1,0x10);
-    temp1 = AES_128_ASSIST(temp1, temp2);
-    key[5] = temp1;
-    temp2 = _mm_aeskeygenassist_si128 (temp1,0x20);
-    temp1 = AES_128_ASSIST(temp1, temp2);
-    key[6] = temp1;
-    temp2 = _mm_aeskeygenassist_si128 (temp1,0x40);
-    temp1 = AES_128_ASSIST(temp1, temp2);
-    key[7] = temp1;
-    temp2 = _mm_aeskeygenassist_si128 (temp1,0x80);
-    temp1 = AES_128_ASSIST(temp1, temp2);
-    key[8] = temp1;
-    temp2 = _mm_aeskeygenassist_si128 (temp1,0x1b);
-    temp1 = AES_128_ASSIST(temp1, temp2);
-    key[9] = temp1;
-    temp2 = _mm_aeskeygenassist_si128 (temp1,0x36);
-    temp1 = AES_128_ASSIST(temp1, temp2);
-    key[10] = temp1;
-}
-
-static void aes_inv_key_10(AESContext * ctx) {
+// aeskeygenassist needs the round constant as an immediate
+#define AESNI_EXPAND_ROUND(rk, r, rcon) \
+    for (int l = 0; l < AESNI_LANES; l++) { \
+        rk[l][r] = aesni_128_assist(rk[l][r - 1], _mm_aeskeygenassist_si128(rk[l][r - 1], rcon)); \
+    }
 
-    __m128i* keysched = (__m128i*)ctx->keysched;
-    __m128i* invkeysched = (__m128i*)ctx->invkeysched;
+// Decryption round keys of the equivalent inverse cipher, in the order
+// they are used. dk[l][0] is the last encryption round key
+AESNI_TARGET
+static inline void aesni_dec_keys(const uint8_t keys[AESNI_LANES][16], __m128i dk[AESNI_LANES][11]) {
+    __m128i rk[AESNI_LANES][11];
+    for (int l = 0; l < AESNI_LANES; l++) {
+        rk[l][0] = _mm_loadu_si128((const __m128i *)keys[l]);
+    }
 
-    *(invkeysched + 10) = *(keysched + 0);
-    *(invkeysched + 9) = _mm_aesimc_si128(*(keysched + 1));
-    *(invkeysched + 8) = _mm_aesimc_si128(*(keysched + 2));
-    *(invkeysched + 7) = _mm_aesimc_si128(*(keysched + 3));
-    *(invkeysched + 6) = _mm_aesimc_si128(*(keysched + 4));
-    *(invkeysched + 5) = _mm_aesimc_si128(*(keysched + 5));
-    *(invkeysched + 4) = _mm_aesimc_si128(*(keysched + 6));
-    *(invkeysched + 3) = _mm_aesimc_si128(*(keysched + 7));
-    *(invkeysched + 2) = _mm_aesimc_si128(*(keysched + 8));
-    *(invkeysched + 1) = _mm_aesimc_si128(*(keysched + 9));
-    *(invkeysched + 0) = *(keysched + 10);
+    AESNI_EXPAND_ROUND(rk, 1, 0x01)
+    AESNI_EXPAND_ROUND(rk, 2, 0x02)
+    AESNI_EXPAND_ROUND(rk, 3, 0x04)
+    AESNI_EXPAND_ROUND(rk, 4, 0x08)
+    AESNI_EXPAND_ROUND(rk, 5, 0x10)
+    AESNI_EXPAND_ROUND(rk, 6, 0x20)
+    AESNI_EXPAND_ROUND(rk, 7, 0x40)
+    AESNI_EXPAND_ROUND(rk, 8, 0x80)
+    AESNI_EXPAND_ROUND(rk, 9, 0x1b)
+    AESNI_EXPAND_ROUND(rk, 10, 0x36)
+
+    for (int l = 0; l < AESNI_LANES; l++) {
+        dk[l][0] = rk[l][10];
+        for (int r = 1; r < 10; r++) {
+            dk[l][r] = _mm_aesimc_si128(rk[l][10 - r]);
+        }
+        dk[l][10] = rk[l][0];
+    }
 }
 
-static void aes_decrypt_cbc_ni(const uint8_t *in,  uint8_t *out,  uint8_t iv[],  uint8_t len, uint8_t *key) {
-
-    __m128i dec = _mm_setzero_si128();
-    __m128i* block = (__m128i*)in;
-    const __m128i* finish = (__m128i*)(in + len);
-
-    // Load IV
-    __m128i iv = _mm_loadu_si128((__m128i*)iv);
-
-    while (block < finish) {
-
-        // Key schedule ptr
-        __m128i* keysched = (__m128i*)ctx->invkeysched;
-        __m128i last = _mm_loadu_si128(block);
-
-        dec  = _mm_xor_si128(last, *keysched);
-
-        dec = _mm_aesdec_si128(dec, *(++keysched));
-        dec = _mm_aesdec_si128(dec, *(++keysched));
-        dec = _mm_aesdec_si128(dec, *(++keysched));
-        dec = _mm_aesdec_si128(dec, *(++keysched));
-        dec = _mm_aesdec_si128(dec, *(++keysched));
-        dec = _mm_aesdec_si128(dec, *(++keysched));
-        dec = _mm_aesdec_si128(dec, *(++keysched));
-        dec = _mm_aesdec_si128(dec, *(++keysched));
-        dec = _mm_aesdec_si128(dec, *(++keysched));
-        dec = _mm_aesdeclast_si128(dec, *(++keysched));
-
-        /// Xor data with IV
-        dec  = _mm_xor_si128(iv, dec);
-
-        // Store data
-        _mm_storeu_si128(block, dec);
-        iv = last;
-
-        // Go to next block
-        ++block;
+// ECB decrypts the blocks c0 and c1 under every lane key
+AESNI_TARGET
+static inline void aesni_decrypt2(const __m128i dk[AESNI_LANES][11], __m128i c0, __m128i c1,
+                                  __m128i p0[AESNI_LANES], __m128i p1[AESNI_LANES]) {
+    for (int l = 0; l < AESNI_LANES; l++) {
+        p0[l] = _mm_xor_si128(c0, dk[l][0]);
+        p1[l] = _mm_xor_si128(c1, dk[l][0]);
+    }
+    for (int r = 1; r < 10; r++) {
+        for (int l = 0; l < AESNI_LANES; l++) {
+            p0[l] = _mm_aesdec_si128(p0[l], dk[l][r]);
+            p1[l] = _mm_aesdec_si128(p1[l], dk[l][r]);
+        }
+    }
+    for (int l = 0; l < AESNI_LANES; l++) {
+        p0[l] = _mm_aesdeclast_si128(p0[l], dk[l][10]);
+        p1[l] = _mm_aesdeclast_si128(p1[l], dk[l][10]);
     }
-
-    // Update IV
-    _mm_storeu_si128((__m128i*)iv, dec);
 }
 
-static void aes_setup_ni(AESContext * ctx, uint8_t *key) {
-
-    __m128i *keysched = (__m128i*)ctx->keysched;
-
-    ctx->decrypt_cbc = aes_decrypt_cbc_ni;
-
-    // Now do the key setup itself.
-    AES_128_Key_Expansion (key, keysched);
-
-    // Now prepare the modified keys for the inverse cipher.
-    aes_inv_key_10(ctx);
-}
-*/
+#endif // x86
 
 #endif
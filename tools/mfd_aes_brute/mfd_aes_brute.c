@@ -27,14 +27,18 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <limits.h>
-#include <openssl/evp.h>
-#include <openssl/err.h>
 #include <string.h>
 #include <time.h>
 #include <pthread.h>
 #include <unistd.h>
 #include <inttypes.h>
 #include "util_posix.h"
+#include "mfd_batch.h"
+
+#if defined(__APPLE__) || defined(__MACH__)
+#else
+#include "detectaes.h"
+#endif
 
 #define AEND  "\x1b[0m"
 #define _RED_(s) "\x1b[31m" s AEND
@@ -55,6 +59,7 @@ typedef struct thread_args {
     uint64_t stoptime;
     uint8_t tag[16];
     uint8_t rdr[32];
+    bool aesni;
 } targs;
 
 static void make_key(uint32_t seed, uint8_t key[]) {
@@ -70,37 +75,6 @@ static void make_key(uint32_t seed, uint8_t key[]) {
     }
 }
 
-static void handleErrors(void) {
-    ERR_print_errors_fp(stderr);
-    abort();
-}
-
-// source https://wiki.openssl.org/index.php/EVP_Symmetric_Encryption_and_Decryption#Decrypting_the_Message
-static int decrypt_aes(uint8_t ciphertext[], int ciphertext_len, uint8_t key[], uint8_t iv[], uint8_t plaintext[]) {
-    EVP_CIPHER_CTX *ctx;
-    if (!(ctx = EVP_CIPHER_CTX_new()))
-        handleErrors();
-
-    if (1 != EVP_DecryptInit_ex(ctx, EVP_aes_128_cbc(), NULL, key, iv))
-        handleErrors();
-
-    EVP_CIPHER_CTX_set_padding(ctx, 0);
-
-    int len = 0;
-    if (1 != EVP_DecryptUpdate(ctx, plaintext, &len, ciphertext, ciphertext_len))
-        handleErrors();
-
-    int plaintext_len = len;
-
-    if (1 != EVP_DecryptFinal_ex(ctx, plaintext + len, &len))
-        handleErrors();
-
-    plaintext_len += len;
-
-    EVP_CIPHER_CTX_free(ctx);
-    return plaintext_len;
-}
-
 static int hexstr_to_byte_array(char hexstr[], uint8_t bytes[], size_t byte_len) {
     size_t hexstr_len = strlen(hexstr);
     if (hexstr_len % 16) {
@@ -156,46 +130,29 @@ static void *brute_thread(void *arguments) {
     uint64_t starttime = args->starttime;
 
     uint64_t stoptime = args->stoptime;
-    uint8_t local_tag[16];
-    uint8_t local_rdr[32];
-    memcpy(local_tag, args->tag, 16);
-    memcpy(local_rdr, args->rdr, 32);
 
-    for (uint64_t i = starttime + args->idx; i < stoptime; i += thread_count) {
+    mfd_batch_t batch;
+    mfd_batch_init(&batch, MFD_AES, args->tag, args->rdr, args->aesni);
+
+    uint8_t keys[MFD_BATCH_SIZE][MFD_KEY_MAX];
+    uint64_t stamps[MFD_BATCH_SIZE];
+
+    for (uint64_t i = starttime + args->idx; i < stoptime;) {
 
         if (__atomic_load_n(&global_found, __ATOMIC_ACQUIRE) == 1) {
             break;
         }
 
-        uint8_t key[16] = {0x00};
-        make_key(i, key);
-
-        uint8_t iv[16] = {0x00};
-        uint8_t dec_tag[16] = {0x00};
-        decrypt_aes(local_tag, 16, key, iv, dec_tag);
-
-        uint8_t dec_rdr[32] = {0x00};
-        decrypt_aes(local_rdr, 32, key, local_tag, dec_rdr);
-
-        // check rol byte first
-        if (dec_tag[0] != dec_rdr[31]) continue;
-
-        // compare rest
-        if (dec_tag[1] != dec_rdr[16]) continue;
-        if (dec_tag[2] != dec_rdr[17]) continue;
-        if (dec_tag[3] != dec_rdr[18]) continue;
-        if (dec_tag[4] != dec_rdr[19]) continue;
-        if (dec_tag[5] != dec_rdr[20]) continue;
-        if (dec_tag[6] != dec_rdr[21]) continue;
-        if (dec_tag[7] != dec_rdr[22]) continue;
-        if (dec_tag[8] != dec_rdr[23]) continue;
-        if (dec_tag[9] != dec_rdr[24]) continue;
-        if (dec_tag[10] != dec_rdr[25]) continue;
-        if (dec_tag[11] != dec_rdr[26]) continue;
-        if (dec_tag[12] != dec_rdr[27]) continue;
-        if (dec_tag[13] != dec_rdr[28]) continue;
-        if (dec_tag[14] != dec_rdr[29]) continue;
-        if (dec_tag[15] != dec_rdr[30]) continue;
+        size_t n = 0;
+        for (; n < MFD_BATCH_SIZE && i < stoptime; n++, i += thread_count) {
+            stamps[n] = i;
+            make_key(i, keys[n]);
+        }
+
+        int hit = mfd_batch_check(&batch, keys, n);
+        if (hit < 0) {
+            continue;
+        }
 
         __sync_fetch_and_add(&global_found, 1);
 
@@ -203,10 +160,10 @@ static void *brute_thread(void *arguments) {
         pthread_mutex_lock(&print_lock);
 
         printf("Found timestamp........ ");
-        print_time(i);
+        print_time(stamps[hit]);
 
         printf("key.................... \x1b[32m");
-        print_hex(key, sizeof(key));
+        print_hex(keys[hit], 16);
         printf(AEND);
 
         pthread_mutex_unlock(&print_lock);
@@ -258,6 +215,13 @@ int main(int argc, char *argv[]) {
     print_hex(rdr_resp_challenge, sizeof(rdr_resp_challenge));
 
 
+    bool support_aesni = false;
+#if defined(__APPLE__) || defined(__MACH__)
+#else
+    support_aesni = platform_aes_hw_available();
+    printf("AES-NI detected........ " _GREEN_("%s") "\n", (support_aesni) ? "yes" : "no");
+#endif
+
     uint64_t t1 = msclock();
 
 #if !defined(_WIN32) || !defined(__WIN32__)
@@ -287,6 +251,7 @@ int main(int argc, char *argv[]) {
         a->stoptime = stop_time;
         memcpy(a->tag, tag_challenge, 16);
         memcpy(a->rdr, rdr_resp_challenge, 32);
+        a->aesni = support_aesni;
         pthread_create(&threads[i], NULL, brute_thread, (void *)a);
     }
 
@@ -0,0 +1,200 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Batched key check for MIFARE DESFire / UL-C authentication challenges
+//-----------------------------------------------------------------------------
+
+#include "mfd_batch.h"
+
+#include <string.h>
+#include "mbedtls/aes.h"
+#include "mbedtls/des.h"
+#include "aes-ni.h"
+
+void mfd_batch_init(mfd_batch_t *b, uint8_t algo, const uint8_t *tag, const uint8_t *rdr, bool use_aesni) {
+    memset(b, 0, sizeof(mfd_batch_t));
+    b->algo = algo;
+
+    switch (algo) {
+        case MFD_DES:
+            b->keylen = 8;
+            b->len = 8;
+            break;
+        case MFD_2TDEA:
+            b->keylen = 16;
+            b->len = 8;
+            break;
+        case MFD_3TDEA:
+            b->keylen = 24;
+            b->len = 16;
+            break;
+        case MFD_AES:
+        default:
+            b->keylen = 16;
+            b->len = 16;
+            break;
+    }
+
+    memcpy(b->tag, tag, b->len);
+    memcpy(b->rdr, rdr, b->len * 2);
+
+#ifdef AESNI_SUPPORTED
+    b->aesni = use_aesni && (b->algo == MFD_AES);
+#else
+    (void)use_aesni;
+#endif
+}
+
+// rdr[i] == tag[i + 1], wrapping around
+static bool mfd_rol_equal(const uint8_t *tag, const uint8_t *rdr, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        if (rdr[i] != tag[(i + 1) % len]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void mfd_xor(uint8_t *dst, const uint8_t *src, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        dst[i] ^= src[i];
+    }
+}
+
+// Single DES and 2TDEA, one block challenges.
+// The tag challenge is decrypted with a zero IV and the second reader block
+// chains on the first one, the first reader block is not needed at all
+static int mfd_check_des(const mfd_batch_t *b, const uint8_t keys[][MFD_KEY_MAX], size_t n) {
+    mbedtls_des_context des;
+    mbedtls_des3_context des3;
+    uint8_t dtag[8], drdr[8];
+
+    for (size_t k = 0; k < n; k++) {
+        if (b->algo == MFD_DES) {
+            mbedtls_des_setkey_dec(&des, keys[k]);
+            mbedtls_des_crypt_ecb(&des, b->tag, dtag);
+            mbedtls_des_crypt_ecb(&des, b->rdr + 8, drdr);
+        } else {
+            mbedtls_des3_set2key_dec(&des3, keys[k]);
+            mbedtls_des3_crypt_ecb(&des3, b->tag, dtag);
+            mbedtls_des3_crypt_ecb(&des3, b->rdr + 8, drdr);
+        }
+        mfd_xor(drdr, b->rdr, 8);
+
+        if (mfd_rol_equal(dtag, drdr, 8)) {
+            return k;
+        }
+    }
+    return -1;
+}
+
+// 3TDEA, two block challenges. The first tag block and the third reader
+// block already decide seven bytes, the other two are only decrypted for
+// the one in 2^56 keys getting past that
+static int mfd_check_3tdea(const mfd_batch_t *b, const uint8_t keys[][MFD_KEY_MAX], size_t n) {
+    mbedtls_des3_context des3;
+    uint8_t dtag[16], drdr[16];
+
+    for (size_t k = 0; k < n; k++) {
+        mbedtls_des3_set3key_dec(&des3, keys[k]);
+        mbedtls_des3_crypt_ecb(&des3, b->tag, dtag);
+        mbedtls_des3_crypt_ecb(&des3, b->rdr + 16, drdr);
+        mfd_xor(drdr, b->rdr + 8, 8);
+
+        if (memcmp(drdr, dtag + 1, 7) != 0) {
+            continue;
+        }
+
+        mbedtls_des3_crypt_ecb(&des3, b->tag + 8, dtag + 8);
+        mfd_xor(dtag + 8, b->tag, 8);
+        mbedtls_des3_crypt_ecb(&des3, b->rdr + 24, drdr + 8);
+        mfd_xor(drdr + 8, b->rdr + 16, 8);
+
+        if (mfd_rol_equal(dtag, drdr, 16)) {
+            return k;
+        }
+    }
+    return -1;
+}
+
+static int mfd_check_aes(const mfd_batch_t *b, const uint8_t keys[][MFD_KEY_MAX], size_t n) {
+    mbedtls_aes_context aes;
+    uint8_t dtag[16], drdr[16];
+
+    for (size_t k = 0; k < n; k++) {
+        mbedtls_aes_setkey_dec(&aes, keys[k], 128);
+        mbedtls_aes_crypt_ecb(&aes, MBEDTLS_AES_DECRYPT, b->tag, dtag);
+        mbedtls_aes_crypt_ecb(&aes, MBEDTLS_AES_DECRYPT, b->rdr + 16, drdr);
+        mfd_xor(drdr, b->rdr, 16);
+
+        if (mfd_rol_equal(dtag, drdr, 16)) {
+            return k;
+        }
+    }
+    return -1;
+}
+
+#ifdef AESNI_SUPPORTED
+AESNI_TARGET
+static int mfd_check_aesni(const mfd_batch_t *b, const uint8_t keys[][MFD_KEY_MAX], size_t n) {
+    const __m128i tag = _mm_loadu_si128((const __m128i *)b->tag);
+    const __m128i rdr0 = _mm_loadu_si128((const __m128i *)b->rdr);
+    const __m128i rdr1 = _mm_loadu_si128((const __m128i *)(b->rdr + 16));
+
+    uint8_t lane_keys[AESNI_LANES][16];
+    __m128i dk[AESNI_LANES][11];
+    __m128i dtag[AESNI_LANES], drdr[AESNI_LANES];
+
+    for (size_t k = 0; k < n; k += AESNI_LANES) {
+
+        // a short tail repeats its last key, lanes past n are never reported
+        for (size_t l = 0; l < AESNI_LANES; l++) {
+            size_t idx = (k + l < n) ? k + l : n - 1;
+            memcpy(lane_keys[l], keys[idx], 16);
+        }
+
+        aesni_dec_keys(lane_keys, dk);
+        aesni_decrypt2(dk, tag, rdr1, dtag, drdr);
+
+        for (size_t l = 0; l < AESNI_LANES && k + l < n; l++) {
+            __m128i expect = _mm_alignr_epi8(dtag[l], dtag[l], 1);
+            __m128i got = _mm_xor_si128(drdr[l], rdr0);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(expect, got)) == 0xFFFF) {
+                return k + l;
+            }
+        }
+    }
+    return -1;
+}
+#endif
+
+int mfd_batch_check(const mfd_batch_t *b, const uint8_t keys[][MFD_KEY_MAX], size_t n) {
+    switch (b->algo) {
+        case MFD_DES:
+        case MFD_2TDEA:
+            return mfd_check_des(b, keys, n);
+        case MFD_3TDEA:
+            return mfd_check_3tdea(b, keys, n);
+        case MFD_AES:
+#ifdef AESNI_SUPPORTED
+            if (b->aesni) {
+                return mfd_check_aesni(b, keys, n);
+            }
+#endif
+            return mfd_check_aes(b, keys, n);
+        default:
+            return -1;
+    }
+}
@@ -0,0 +1,59 @@
+//-----------------------------------------------------------------------------
+// Copyright (C) Proxmark3 contributors. See AUTHORS.md for details.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// See LICENSE.txt for the text of the license.
+//-----------------------------------------------------------------------------
+// Batched key check for MIFARE DESFire / UL-C authentication challenges
+//
+// A key is right when the last block of the reader answer, CBC decrypted,
+// is the tag challenge rotated left by one byte. Only the blocks taking part
+// in that relation are decrypted, with contexts living on the stack, and AES
+// keys go through AES-NI eight at a time when the CPU has it.
+//-----------------------------------------------------------------------------
+
+#ifndef MFD_BATCH_H__
+#define MFD_BATCH_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// same numbers as the crypto algo argument of mfd_multi_brute
+enum {
+    MFD_DES = 0,
+    MFD_2TDEA,
+    MFD_3TDEA,
+    MFD_AES,
+};
+
+#define MFD_BATCH_SIZE  64
+#define MFD_KEY_MAX     24
+
+typedef struct {
+    uint8_t algo;
+    uint8_t keylen;
+    // challenge length, 8 for DES and 2TDEA, 16 for 3TDEA and AES
+    uint8_t len;
+    bool aesni;
+    uint8_t tag[16];
+    uint8_t rdr[32];
+} mfd_batch_t;
+
+// use_aesni is only honoured when the AES-NI path is compiled in
+void mfd_batch_init(mfd_batch_t *b, uint8_t algo, const uint8_t *tag, const uint8_t *rdr, bool use_aesni);
+
+// index of the first of the n keys (n <= MFD_BATCH_SIZE) answering the
+// challenges, -1 if none does
+int mfd_batch_check(const mfd_batch_t *b, const uint8_t keys[][MFD_KEY_MAX], size_t n);
+
+#endif
@@ -29,18 +29,14 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <limits.h>
-#include <openssl/evp.h>
-#include <openssl/err.h>
 #include <string.h>
 #include <time.h>
 #include <pthread.h>
 #include <unistd.h>
 #include <inttypes.h>
-//#include <mbedtls/aes.h>
 #include "util_posix.h"
 #include "randoms.h"
-
-#include "aes-ni.h"
+#include "mfd_batch.h"
 
 #if defined(__APPLE__) || defined(__MACH__)
 #else
@@ -74,6 +70,10 @@ pthread_mutex_t print_lock;
 static int global_found = 0;
 static int thread_count = 2;
 
+// timestamps are handed out to the threads in chunks
+#define CHUNK_SIZE 4096
+static uint64_t next_time = 0;
+
 typedef struct thread_args {
     int thread;
     int idx;
@@ -83,54 +83,10 @@ typedef struct thread_args {
     uint64_t stoptime;
     uint8_t tag[16];
     uint8_t rdr[32];
+    bool aesni;
 } targs;
 
 
-// source https://wiki.openssl.org/index.php/EVP_Symmetric_Encryption_and_Decryption#Decrypting_the_Message
-static void decrypt_aes(uint8_t ciphertext[], int ciphertext_len, uint8_t key[], uint8_t iv[], uint8_t plaintext[]) {
-    EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
-    EVP_DecryptInit_ex(ctx, EVP_aes_128_cbc(), NULL, key, iv);
-//    EVP_CIPHER_CTX_set_padding(ctx, 0);
-    int len = 0;
-    EVP_DecryptUpdate(ctx, plaintext, &len, ciphertext, ciphertext_len);
-    EVP_DecryptFinal_ex(ctx, plaintext + len, &len);
-    EVP_CIPHER_CTX_free(ctx);
-}
-
-static void decrypt_3kdes(uint8_t ciphertext[], int ciphertext_len, uint8_t key[], uint8_t iv[], uint8_t plaintext[]) {
-    EVP_CIPHER_CTX *ctx;
-    ctx = EVP_CIPHER_CTX_new();
-
-    EVP_DecryptInit_ex(ctx, EVP_des_ede3_cbc(), NULL, key, iv);
-    EVP_CIPHER_CTX_set_padding(ctx, 0);
-    int len = 0;
-    EVP_DecryptUpdate(ctx, plaintext, &len, ciphertext, ciphertext_len);
-    EVP_DecryptFinal_ex(ctx, plaintext + len, &len);
-    EVP_CIPHER_CTX_free(ctx);
-}
-
-static void decrypt_2kdes(uint8_t ciphertext[], int ciphertext_len, uint8_t key[], uint8_t iv[], uint8_t plaintext[]) {
-    EVP_CIPHER_CTX *ctx;
-    ctx = EVP_CIPHER_CTX_new();
-    EVP_DecryptInit_ex(ctx, EVP_des_ede_cbc(), NULL, key, iv);
-    EVP_CIPHER_CTX_set_padding(ctx, 0);
-    int len = 0;
-    EVP_DecryptUpdate(ctx, plaintext, &len, ciphertext, ciphertext_len);
-    EVP_DecryptFinal_ex(ctx, plaintext + len, &len);
-    EVP_CIPHER_CTX_free(ctx);
-}
-
-static void decrypt_des(uint8_t ciphertext[], int ciphertext_len, uint8_t key[], uint8_t iv[], uint8_t plaintext[]) {
-    EVP_CIPHER_CTX *ctx;
-    ctx = EVP_CIPHER_CTX_new();
-    EVP_DecryptInit_ex(ctx, EVP_des_cbc(), NULL, key, iv);
-    EVP_CIPHER_CTX_set_padding(ctx, 0);
-    int len = 0;
-    EVP_DecryptUpdate(ctx, plaintext, &len, ciphertext, ciphertext_len);
-    EVP_DecryptFinal_ex(ctx, plaintext + len, &len);
-    EVP_CIPHER_CTX_free(ctx);
-}
-
 static int hexstr_to_byte_array(char hexstr[], uint8_t bytes[], size_t byte_len) {
     size_t hexstr_len = strlen(hexstr);
     if (hexstr_len % 16) {
@@ -181,146 +137,55 @@ static void print_time(uint64_t at) {
 
 static void *brute_thread(void *arguments) {
 
-    //const bool support_aesni = platform_aes_hw_available();
-
     struct thread_args *args = (struct thread_args *) arguments;
 
-    uint64_t starttime = args->starttime;
     uint64_t stoptime = args->stoptime;
-    uint8_t local_algo = args->algo;
     uint8_t gidx = args->generator_idx;
-    uint8_t local_tag[16];
-    uint8_t local_rdr[32];
-    uint8_t keylen = 16;
-
-    if (local_algo == 0) {
-        memcpy(local_tag, args->tag, 8);
-        memcpy(local_rdr, args->rdr, 16);
-        keylen = 8;
-    } else if (local_algo == 1) {
-        memcpy(local_tag, args->tag, 8);
-        memcpy(local_rdr, args->rdr, 16);
-        keylen = 16;
-    } else if (local_algo == 2) {
-        memcpy(local_tag, args->tag, 16);
-        memcpy(local_rdr, args->rdr, 32);
-        keylen = 24;
-    } else if (local_algo == 3) {
-        memcpy(local_tag, args->tag, 16);
-        memcpy(local_rdr, args->rdr, 32);
-        keylen = 16;
-    }
 
-    for (uint64_t i = starttime + args->idx; i < stoptime; i += thread_count) {
+    mfd_batch_t batch;
+    mfd_batch_init(&batch, args->algo, args->tag, args->rdr, args->aesni);
+
+    uint8_t keys[MFD_BATCH_SIZE][MFD_KEY_MAX];
 
-        if (__atomic_load_n(&global_found, __ATOMIC_ACQUIRE) == 1) {
+    while (__atomic_load_n(&global_found, __ATOMIC_ACQUIRE) == 0) {
+
+        // threads take the timestamps chunk by chunk, the one that is ahead keeps going
+        uint64_t from = __atomic_fetch_add(&next_time, CHUNK_SIZE, __ATOMIC_RELAXED);
+        if (from >= stoptime) {
             break;
         }
 
-        uint8_t key[keylen];
-        generators[gidx].Parse(i, key, keylen);
-        //make_key_borland_n(i, key, keylen);
-
-        uint8_t iv[keylen << 1];
-        memset(iv, 0, sizeof(iv));
-
-        uint8_t dec_tag[16] = {0x00};
-        uint8_t dec_rdr[32] = {0x00};
-
-        if (local_algo == 0) {
-            decrypt_des(local_tag, 8, key, iv, dec_tag);
-            decrypt_des(local_rdr, 16, key, local_tag, dec_rdr);
-
-            // check rol byte first
-            if (dec_tag[0] != dec_rdr[15]) continue;
-
-            // compare rest
-            if (dec_tag[1] != dec_rdr[8]) continue;
-            if (dec_tag[2] != dec_rdr[9]) continue;
-            if (dec_tag[3] != dec_rdr[10]) continue;
-            if (dec_tag[4] != dec_rdr[11]) continue;
-            if (dec_tag[5] != dec_rdr[12]) continue;
-            if (dec_tag[6] != dec_rdr[13]) continue;
-            if (dec_tag[7] != dec_rdr[14]) continue;
-
-        } else if (local_algo == 1) {
-            decrypt_2kdes(local_tag, 8, key, iv, dec_tag);
-            decrypt_2kdes(local_rdr, 16, key, local_tag, dec_rdr);
-
-            // check rol byte first
-            if (dec_tag[0] != dec_rdr[15]) continue;
-
-            // compare rest
-            if (dec_tag[1] != dec_rdr[8]) continue;
-            if (dec_tag[2] != dec_rdr[9]) continue;
-            if (dec_tag[3] != dec_rdr[10]) continue;
-            if (dec_tag[4] != dec_rdr[11]) continue;
-            if (dec_tag[5] != dec_rdr[12]) continue;
-            if (dec_tag[6] != dec_rdr[13]) continue;
-            if (dec_tag[7] != dec_rdr[14]) continue;
-
-        } else if (local_algo == 2) {
-            decrypt_3kdes(local_tag, 16, key, iv, dec_tag);
-            decrypt_3kdes(local_rdr, 32, key, local_tag, dec_rdr);
-
-            // check rol byte first
-            if (dec_tag[0] != dec_rdr[31]) continue;
-
-            // compare rest
-            if (dec_tag[1] != dec_rdr[16]) continue;
-            if (dec_tag[2] != dec_rdr[17]) continue;
-            if (dec_tag[3] != dec_rdr[18]) continue;
-            if (dec_tag[4] != dec_rdr[19]) continue;
-            if (dec_tag[5] != dec_rdr[20]) continue;
-            if (dec_tag[6] != dec_rdr[21]) continue;
-            if (dec_tag[7] != dec_rdr[22]) continue;
-            if (dec_tag[8] != dec_rdr[23]) continue;
-            if (dec_tag[9] != dec_rdr[24]) continue;
-            if (dec_tag[10] != dec_rdr[25]) continue;
-            if (dec_tag[11] != dec_rdr[26]) continue;
-            if (dec_tag[12] != dec_rdr[27]) continue;
-            if (dec_tag[13] != dec_rdr[28]) continue;
-            if (dec_tag[14] != dec_rdr[29]) continue;
-            if (dec_tag[15] != dec_rdr[30]) continue;
-
-        } else if (local_algo == 3) {
-            decrypt_aes(local_tag, 16, key, iv, dec_tag);
-            decrypt_aes(local_rdr, 32, key, local_tag, dec_rdr);
-
-            // check rol byte first
-            if (dec_tag[0] != dec_rdr[31]) continue;
-
-            // compare rest
-            if (dec_tag[1] != dec_rdr[16]) continue;
-            if (dec_tag[2] != dec_rdr[17]) continue;
-            if (dec_tag[3] != dec_rdr[18]) continue;
-            if (dec_tag[4] != dec_rdr[19]) continue;
-            if (dec_tag[5] != dec_rdr[20]) continue;
-            if (dec_tag[6] != dec_rdr[21]) continue;
-            if (dec_tag[7] != dec_rdr[22]) continue;
-            if (dec_tag[8] != dec_rdr[23]) continue;
-            if (dec_tag[9] != dec_rdr[24]) continue;
-            if (dec_tag[10] != dec_rdr[25]) continue;
-            if (dec_tag[11] != dec_rdr[26]) continue;
-            if (dec_tag[12] != dec_rdr[27]) continue;
-            if (dec_tag[13] != dec_rdr[28]) continue;
-            if (dec_tag[14] != dec_rdr[29]) continue;
-            if (dec_tag[15] != dec_rdr[30]) continue;
-        }
+        uint64_t to = (from + CHUNK_SIZE < stoptime) ? from + CHUNK_SIZE : stoptime;
 
-        __sync_fetch_and_add(&global_found, 1);
+        for (uint64_t i = from; i < to; i += MFD_BATCH_SIZE) {
 
-        // lock this section to avoid interlacing prints from different threats
-        pthread_mutex_lock(&print_lock);
-        printf("Found timestamp........ ");
-        print_time(i);
+            size_t n = (to - i < MFD_BATCH_SIZE) ? to - i : MFD_BATCH_SIZE;
+            for (size_t k = 0; k < n; k++) {
+                generators[gidx].Parse(i + k, keys[k], batch.keylen);
+            }
 
-        printf("Key.................... \x1b[32m");
-        print_hex(key, keylen);
-        printf(AEND);
+            int hit = mfd_batch_check(&batch, keys, n);
+            if (hit < 0) {
+                continue;
+            }
 
-        pthread_mutex_unlock(&print_lock);
-        break;
+            // only the first thread to get here reports
+            if (__sync_fetch_and_add(&global_found, 1) != 0) {
+                break;
+            }
+
+            // lock this section to avoid interlacing prints from different threats
+            pthread_mutex_lock(&print_lock);
+            printf("Found timestamp........ ");
+            print_time(i + hit);
+
+            printf("Key.................... \x1b[32m");
+            print_hex(keys[hit], batch.keylen);
+            printf(AEND);
+
+            pthread_mutex_unlock(&print_lock);
+            break;
+        }
     }
     free(args);
     return NULL;
@@ -390,9 +255,10 @@ int main(int argc, char *argv[]) {
     printf("Crypto algo............ " _GREEN_("%s") "\n", algostr);
     printf("LCR Random generator... " _GREEN_("%s") "\n", generators[g_idx].Name);
 
+    bool support_aesni = false;
 #if defined(__APPLE__) || defined(__MACH__)
 #else
-    bool support_aesni = platform_aes_hw_available();
+    support_aesni = platform_aes_hw_available();
     printf("AES-NI detected........ " _GREEN_("%s") "\n", (support_aesni) ? "yes" : "no");
 #endif
 
@@ -469,6 +335,7 @@ int main(int argc, char *argv[]) {
 
     // threads
     uint64_t stop_time = time(NULL);
+    next_time = start_time;
     for (int i = 0; i < thread_count; ++i) {
         struct thread_args *a = calloc(1, sizeof(struct thread_args));
         if (a == NULL) {
@@ -481,6 +348,7 @@ int main(int argc, char *argv[]) {
         a->algo = (uint8_t)algo;
         a->starttime = start_time;
         a->stoptime = stop_time;
+        a->aesni = support_aesni;
 
         if (algo == 0) {
             memcpy(a->tag, tag_challenge, 8);
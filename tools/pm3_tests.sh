@@ -341,6 +341,11 @@ while true; do
       if ! CheckFileExist "mfd_aes_brute exists"          "$MFDASEBRUTEBIN"; then break; fi
       if ! CheckExecute      "mfd_aes_brute test 1/2"         "$MFDASEBRUTEBIN 1629394800 bb6aea729414a5b1eff7b16328ce37fd 82f5f498dbc29f7570102397a2e5ef2b6dc14a864f665b3c54d11765af81e95c" "key.................... .*261C07A23F2BC8262F69F10A5BDF3764"; then break; fi
       if ! CheckExecute slow "mfd_aes_brute test 2/2"         "$MFDASEBRUTEBIN 1546300800 3fda933e2953ca5e6cfbbf95d1b51ddf 97fe4b5de24188458d102959b888938c988e96fb98469ce7426f50f108eaa583" "key.................... .*E757178E13516A4F3171BC6EA85E165A"; then break; fi
+      echo -e "\n${C_BLUE}Testing mfd_multi_brute:${C_NC} ${MFDMULTIBRUTEBIN:=./tools/mfd_aes_brute/mfd_multi_brute}"
+      if ! CheckFileExist "mfd_multi_brute exists"        "$MFDMULTIBRUTEBIN"; then break; fi
+      if ! CheckExecute      "mfd_multi_brute DES test"       "$MFDMULTIBRUTEBIN DES 0 1602300000 118565f6e5e6c839 d570fd1578079e6b22aaa187b99f0a2a" "Key.................... .*1C53F758BF5DAEEA"; then break; fi
+      if ! CheckExecute      "mfd_multi_brute 2TDEA test"     "$MFDMULTIBRUTEBIN 2TDEA 0 1606800000 02bdc73fd33cc07d 0e2281d59686bda6a6c5ad218dbfaa8c" "Key.................... .*FE55B8800D886E2ACEF800410BEA53B0"; then break; fi
+      if ! CheckExecute      "mfd_multi_brute AES test"       "$MFDMULTIBRUTEBIN AES 0 1629394800 bb6aea729414a5b1eff7b16328ce37fd 82f5f498dbc29f7570102397a2e5ef2b6dc14a864f665b3c54d11765af81e95c" "Key.................... .*261C07A23F2BC8262F69F10A5BDF3764"; then break; fi
     fi
 
     if $TESTALL || $TESTCRYPTORF; then
@@ -358,8 +363,9 @@ while true; do
       if ! CheckFileExist "ht2crack2gentest exists"        "$HT2CRACK2PATH/ht2crack2gentest"; then break; fi
       if ! CheckFileExist "ht2crack2search exists"         "$HT2CRACK2PATH/ht2crack2search"; then break; fi
       if ! CheckFileExist "ht2crack2search_multi exists"   "$HT2CRACK2PATH/ht2crack2search_multi"; then break; fi
-      # 1.5Tb tables are supposed to be absent, so it's just a fast check without real cracking
-      if ! CheckExecute "ht2crack2 quick test"             "cd $HT2CRACK2PATH; ./ht2crack2gentest 1 && ./runalltests.sh; rm keystream*" "searching on bit"; then break; fi
+      # 1.5Tb tables are supposed to be absent, a scaled down table is built and only cracks what it covers
+      if ! CheckExecute "ht2crack2 build scaled table"     "cd $HT2CRACK2PATH; rm -f ht2table.test*; ./ht2crack2buildtable -n 20 -m 16 -o ht2table.test" "table ht2table.test complete"; then break; fi
+      if ! CheckExecute "ht2crack2 quick test"             "cd $HT2CRACK2PATH; ./ht2crack2gentest 1 ht2table.test && ./runalltests.sh ht2table.test; rm keystream* ht2table.test" "Key check     = OK"; then break; fi
 
       echo -e "\n${C_BLUE}Testing ht2crack3:${C_NC} ${HT2CRACK3PATH:=./tools/hitag2crack/crack3/}"
       if ! CheckFileExist "ht2crack3 exists"               "$HT2CRACK3PATH/ht2crack3"; then break; fi
@@ -440,6 +446,12 @@ while true; do
       if ! CheckExecute "jooki encode test"       "$CLIENTBIN -c 'hf jooki encode --test'" "04 28 F4 DA F0 4A 81  \( ok \)"; then break; fi
       if ! CheckExecute "trace load/list 14a"     "$CLIENTBIN -c 'trace load -f traces/hf_14a_mfu.trace; trace list -1 -t 14a;'" "READBLOCK\(8\)"; then break; fi
       if ! CheckExecute "trace load/list x"       "$CLIENTBIN -c 'trace load -f traces/hf_14a_mfu.trace; trace list -x1 -t 14a;'" "0.0101840425"; then break; fi
+      if ! CheckExecute "trace load/list mf nested" "$CLIENTBIN -c 'trace load -f traces/hf_mf_hid_sio_sim.trace; trace list -1 -t mf;'" "key 3B7E4FD575AD"; then break; fi
+      if ! CheckExecute "trace load/list mf filtered" "$CLIENTBIN -c 'trace load -f traces/hf_mf_hid_sio_sim.trace; trace list -1 -t mf --from 4115144 --to 4160000;'" "READBLOCK\(1\)"; then break; fi
+      if ! CheckExecute "trace save/load pcapng" "rm -f /tmp/pm3_tests_trace.pcapng; $CLIENTBIN -c 'trace load -f traces/hf_mf_hid_sio_sim.trace; trace save -f /tmp/pm3_tests_trace --pcapng -t mf; trace load -f /tmp/pm3_tests_trace.pcapng; trace list -1 -t mf;'; rm -f /tmp/pm3_tests_trace.pcapng" "key 3B7E4FD575AD"; then break; fi
+      if ! CheckExecute "trace load pcapng large frames" "python3 -c \"import struct; b=lambda t, d: struct.pack('<II', t, len(d) + 12) + d + struct.pack('<I', len(d) + 12); open('/tmp/pm3_tests_big.pcapng', 'wb').write(b(0x0A0D0D0A, struct.pack('<IHHq', 0x1A2B3C4D, 1, 0, -1)) + b(1, struct.pack('<HHI', 147, 0, 0)) + b''.join(b(6, struct.pack('<5I', 0, 0, i, 0x7FFF, 0x7FFF) + bytes(0x8000)) for i in range(8)))\"; $CLIENTBIN -c 'trace load -f /tmp/pm3_tests_big.pcapng;'; rm -f /tmp/pm3_tests_big.pcapng" "TraceLen = 294968 bytes"; then break; fi
+      if ! CheckExecute "trace load pcapng keeps trace on failure" "cp traces/hf_14a_mfu.trace /tmp/pm3_tests_bad.pcapng; $CLIENTBIN -c 'trace load -f traces/hf_14a_mfu.trace; trace load -f /tmp/pm3_tests_bad.pcapng; trace list -1 -t 14a;'; rm -f /tmp/pm3_tests_bad.pcapng" "READBLOCK\(8\)"; then break; fi
+      if ! CheckExecute "trace load/list over 64 KiB" "for i in \$(seq 200); do cat traces/hf_14a_mfu.trace; done > /tmp/pm3_tests_big.trace; $CLIENTBIN -c 'trace load -f /tmp/pm3_tests_big.trace; trace list -1 -t 14a;' | grep -c 'READBLOCK(8)'; rm -f /tmp/pm3_tests_big.trace" "^200$"; then break; fi
       if ! CheckExecute "nfc decode test - oob"          "$CLIENTBIN -c 'nfc decode -d DA2010016170706C69636174696F6E2F766E642E626C7565746F6F74682E65702E6F6F62301000649201B96DFB0709466C65782032'" "Flex 2"; then break; fi
       if ! CheckExecute "nfc decode test - device info"  "$CLIENTBIN -c 'nfc decode -d d1025744690004536f6e79010752432d533338300220426c61636b204e46432052656164657220636f6e6e656374656420746f2050430310123e4567e89b12d3a45642665544000004124e464320506f72742d3130302076312e3032'" "NFC Port-100 v1.02"; then break; fi
       if ! CheckExecute "nfc decode test - vcard"        "$CLIENTBIN -c 'nfc decode -d d20ca3746578742f782d7643617264424547494e3a56434152440a56455253494f4e3a332e300a4e3a43687269733b4963656d616e3b3b3b0a464e3a476f7468656e627572670a5245563a323032312d30362d32345432303a31353a30385a0a6974656d322e582d4142444154453b747970653d707265663a323032302d30362d32340a4954454d322e582d41424c4142454c3a5f24213c416e6e69766572736172793e21245f0a454e443a56434152440a'" "END:VCARD"; then break; fi
@@ -447,6 +459,8 @@ while true; do
       if ! CheckExecute "nfc decode test - signature"    "$CLIENTBIN -c 'nfc decode -d 03FF010194113870696C65742E65653A656B616172743A3266195F26063132303832325904202020205F28033233335F2701316E1B5A13333038363439303039303030323636343030355304EBF2CE704103000000AC536967010200803A2448FCA7D354A654A81BD021150D1A152D1DF4D7A55D2B771F12F094EAB6E5E10F2617A2F8DAD4FD38AFF8EA39B71C19BD42618CDA86EE7E144636C8E0E7CFC4096E19C3680E09C78A0CDBC05DA2D698E551D5D709717655E56FE3676880B897D2C70DF5F06ECE07C71435255144F8EE41AF110E7B180DA0E6C22FB8FDEF61800025687474703A2F2F70696C65742E65652F6372742F33303836343930302D303030312E637274FE'" "30864900-0001.crt"; then break; fi
       if ! CheckExecute "wiegand decode test - raw"  "$CLIENTBIN -c 'wiegand decode --raw 2006F623AE'" "FC: 123  CN: 4567  parity \( ok \)"; then break; fi
       if ! CheckExecute "wiegand decode test - new"  "$CLIENTBIN -c 'wiegand decode --new 06BD88EB80'" "FC: 123  CN: 4567  parity \( ok \)"; then break; fi
+      if ! CheckExecute "analyse ring test"          "$CLIENTBIN -c 'analyse ring -m 16 -c 64 -s 4'" "integrity..... ok"; then break; fi
+      if ! CheckExecute "analyse crypto1 test"       "$CLIENTBIN -c 'analyse crypto1 -t 4'" "consistent.... ok"; then break; fi
 
       echo -e "\n${C_BLUE}Testing LF:${C_NC}"
       if ! CheckExecute "lf hitag2 test"             "$CLIENTBIN -c 'lf hitag test'" "Tests \( ok"; then break; fi
@@ -459,6 +473,10 @@ while true; do
       if ! CheckExecute "lf EM4x70 recover test 1/3" "$CLIENTBIN -c 'lf em 4x70 recover --key 022A028C02BE --rnd 7D5167003571F8 --frn 982DBCC0 --grn 36C0E0'" "022a028c02be000102030405"; then break; fi
       if ! CheckExecute "lf EM4x70 recover test 2/3" "$CLIENTBIN -c 'lf em 4x70 recover --key 022A028C02BE --rnd 7D5167003571F8 --frn 982DBCC0 --grn 36C0E0'" "022a028c02be366866191b60"; then break; fi
       if ! CheckExecute "lf EM4x70 recover test 3/3" "$CLIENTBIN -c 'lf em 4x70 recover --key 022A028C02BE --rnd 7D5167003571F8 --frn 982DBCC0 --grn 36C0E0'" "022a028c02bef1e352c2718d"; then break; fi
+      if ! CheckExecute "lf EM4x70 recover resume test" "rm -f em4x70_recover_test.json; $CLIENTBIN -c 'lf em 4x70 recover --key 022A028C02BE --rnd 7D5167003571F8 --frn 982DBCC0 --grn 36C0E0 -f em4x70_recover_test.json;lf em 4x70 recover --key 022A028C02BE --rnd 7D5167003571F8 --frn 982DBCC0 --grn 36C0E0 -f em4x70_recover_test.json'; rm -f em4x70_recover_test.json" "256 of 256 partitions already searched"; then break; fi
+      # partitions 00, 36 and F1 hold the keys, the checkpoint has every other partition searched
+      if ! CheckExecute "lf EM4x70 recover partial resume 1/2" "printf '%s' '{\"Created\":\"proxmark3\",\"FileType\":\"em4x70 recover\",\"Recover\":{\"Key\":\"022A028C02BE\",\"Rnd\":\"7D5167003571F8\",\"Frn\":\"982DBCC0\",\"Grn\":\"36C0E0\"},\"Progress\":{\"Done\":\"FEFFFFFFFFFFBFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFDFF\",\"Keys\":[]}}' > em4x70_recover_test.json; $CLIENTBIN -c 'lf em 4x70 recover --key 022A028C02BE --rnd 7D5167003571F8 --frn 982DBCC0 --grn 36C0E0 -f em4x70_recover_test.json'; rm -f em4x70_recover_test.json" "Searched 3 partitions in"; then break; fi
+      if ! CheckExecute "lf EM4x70 recover partial resume 2/2" "printf '%s' '{\"Created\":\"proxmark3\",\"FileType\":\"em4x70 recover\",\"Recover\":{\"Key\":\"022A028C02BE\",\"Rnd\":\"7D5167003571F8\",\"Frn\":\"982DBCC0\",\"Grn\":\"36C0E0\"},\"Progress\":{\"Done\":\"FEFFFFFFFFFFBFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFDFF\",\"Keys\":[]}}' > em4x70_recover_test.json; $CLIENTBIN -c 'lf em 4x70 recover --key 022A028C02BE --rnd 7D5167003571F8 --frn 982DBCC0 --grn 36C0E0 -f em4x70_recover_test.json'; rm -f em4x70_recover_test.json" "022a028c02bef1e352c2718d"; then break; fi
       if ! CheckExecute "lf FDX-A FECAVA test"       "$CLIENTBIN -c 'data load -f traces/lf_EM4305_fdxa_destron.pm3;lf search -1'" "FDX-A FECAVA Destron ID found"; then break; fi
       if ! CheckExecute "lf FDX-B test"              "$CLIENTBIN -c 'data load -f traces/lf_HomeAgain1600.pm3;lf search -1'" "FDX-B ID found"; then break; fi
       if ! CheckExecute "lf FDX/BioThermo test"      "$CLIENTBIN -c 'data load -f traces/lf_FDXB_Bio-Thermo.pm3; lf fdxb demod'" "95.2 F / 35.1 C"; then break; fi
@@ -473,6 +491,14 @@ while true; do
       if ! CheckExecute "lf PARADOX test"            "$CLIENTBIN -c 'data load -f traces/lf_Paradox-96_40426-APJN08.pm3;lf search -1'" "Paradox ID found"; then break; fi
       if ! CheckExecute "lf VIKING test"             "$CLIENTBIN -c 'data load -f traces/lf_Transit999-best.pm3;lf search -1'" "Viking ID found"; then break; fi
       if ! CheckExecute "lf VISA2000 test"           "$CLIENTBIN -c 'data load -f traces/lf_VISA2000.pm3;lf search -1'" "Visa2000 ID found"; then break; fi
+      if ! CheckExecute "lf search parallel test"    "$CLIENTBIN -c 'data load -f traces/lf_Indala-504278295.pm3;lf search -1p'" "Indala ID found"; then break; fi
+      if ! CheckExecute "data bench test"            "$CLIENTBIN -c 'data bench -n 65536'" "kernels....... ok"; then break; fi
+      if ! CheckExecute "data atr lookup test"       "$CLIENTBIN -c 'data atr -t'" "Tests \( ok"; then break; fi
+      if ! CheckExecute "data aid lookup test"       "$CLIENTBIN -c 'data aid -t'" "Tests \( ok"; then break; fi
+      if ! CheckExecute "lf stream replay test"      "$CLIENTBIN -c 'lf stream -f traces/lf_EM4102-1.pm3 --chunk 64'" "EM 410x ID 010872E77C"; then break; fi
+      if ! CheckExecute "lf stream same tag once"    "for i in 1 2 3 4; do cat traces/lf_Q5_mod-psk1.pm3; done > /tmp/pm3_tests_q5.pm3; $CLIENTBIN -c 'lf stream -f /tmp/pm3_tests_q5.pm3 --t55'; rm -f /tmp/pm3_tests_q5.pm3" "T55xx  \|   1 \|"; then break; fi
+      if ! CheckExecute "lf stream decodes the tail" "head -n 10000 traces/lf_Q5_mod-psk1.pm3 > /tmp/pm3_tests_q5.pm3; $CLIENTBIN -c 'lf stream -f /tmp/pm3_tests_q5.pm3 --t55'; rm -f /tmp/pm3_tests_q5.pm3" "T55xx  \|   1 \|    65 ms \|    2 \|"; then break; fi
+      if ! CheckExecute "lf T55 detect batch test"   "$CLIENTBIN -c 'lf t55xx detect -f traces/lf_ATA5577_noralsy.pm3 -f traces/lf_Q5_mod-psk1.pm3;lf t55xx detect -f traces/lf_Q5_mod-psk1.pm3'" "24000 samples \\) \\( cached"; then break; fi
 
       if ! CheckExecute slow "lf T55 awid 26 test"               "$CLIENTBIN -c 'data load -f traces/lf_ATA5577_awid_26.pm3; lf search -1'" "AWID ID found"; then break; fi
       if ! CheckExecute slow "lf T55 awid 26 test2"              "$CLIENTBIN -c 'data load -f traces/lf_ATA5577_awid_26.pm3; lf awid demod'" \
@@ -572,6 +598,8 @@ while true; do
       if ! CheckExecute "hf iclass lookup test"            "$CLIENTBIN -c 'hf iclass lookup --csn 9655a400f8ff12e0 --epurse f0ffffffffffffff --macs 0000000089cb984b -f $DICPATH/iclass_default_keys.dic'" \
                                                                 "valid key AE A6 84 A6 DA B2 32 78"; then break; fi
       if ! CheckExecute "hf iclass loclass test"         "$CLIENTBIN -c 'hf iclass loclass --test'" "key diversification \( ok \)"; then break; fi
+      if ! CheckExecute "hf iclass loclass bitslice test" "$CLIENTBIN -c 'hf iclass loclass --test'" "bitsliced MAC calculation \( ok \)"; then break; fi
+      if ! CheckExecute "hf iclass lookup bench test"    "$CLIENTBIN -c 'hf iclass lookup --bench --elite'" "consistent \( ok \)"; then break; fi
       if ! CheckExecute "emv test"                       "$CLIENTBIN -c 'emv test'" "Tests \( ok"; then break; fi
       if ! CheckExecute "hf cipurse test"                "$CLIENTBIN -c 'hf cipurse test'" "Tests \( ok"; then break; fi
       if ! CheckExecute "hf mfdes test"                  "$CLIENTBIN -c 'hf mfdes test'"   "Tests \( ok"; then break; fi